@@ -0,0 +1,155 @@
+#include "ggm/Numeric/Fixed.h"
+#include "ggm/Numeric/FixedUtil.h"
+#include "ggm/Numeric/NumericUtil.h"
+
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// note: on cores with weak (or no) floating point units Fixed is expected to win, on desktop cores float
+// usually does, so these compare the same work with both types to measure the trade-off on the target
+
+namespace
+{
+    typedef ggm::Fixed<16, 16> FixedType;
+
+    constexpr std::size_t ValueCount = 1 << 14;
+
+    std::vector<float> make_values(float const scale)
+    {
+        std::vector<float> values(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = scale * (static_cast<float>(i) - 0.5f * static_cast<float>(ValueCount));
+        }
+
+        return values;
+    }
+
+    std::vector<FixedType> make_fixed_values(std::vector<float> const & values)
+    {
+        std::vector<FixedType> fixedValues(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            fixedValues[i] = FixedType{ values[i] };
+        }
+
+        return fixedValues;
+    }
+
+    template <typename T>
+    std::vector<ggm::Vector3D<T>> make_points(std::vector<T> const & values)
+    {
+        std::vector<ggm::Vector3D<T>> points(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            points[i] = ggm::Vector3D<T>{ values[i], values[(i * 7) % values.size()], values[(i * 13) % values.size()] };
+        }
+
+        return points;
+    }
+} // namespace
+
+TEST_CASE("ggm::Numeric::FixedUtil::sincos")
+{
+    using namespace ggm;
+
+    std::vector<float> const     angles      = make_values(0x1p-10f); // [-8, 8)
+    std::vector<FixedType> const fixedAngles = make_fixed_values(angles);
+    std::vector<float>           output(ValueCount);
+    std::vector<FixedType>       fixedOutput(ValueCount);
+
+    BENCHMARK("sincos(float)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            SinCos<float> const result = sincos(angles[i]);
+            output[i]                  = result.sin + result.cos;
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("sincos(Fixed<16, 16>) table")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            SinCos<FixedType> const result = sincos(fixedAngles[i]);
+            fixedOutput[i]                 = result.sin + result.cos;
+        }
+
+        return fixedOutput.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::FixedUtil::normalize")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const     points      = make_points(make_values(0x1p-8f)); // [-32, 32)
+    std::vector<Vector3D<FixedType>> const fixedPoints = make_points(make_fixed_values(make_values(0x1p-8f)));
+    std::vector<Vector3D<float>>           output(ValueCount);
+    std::vector<Vector3D<FixedType>>       fixedOutput(ValueCount);
+
+    BENCHMARK("normalize(Vector3D<float>)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = normalize(points[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("normalize(Vector3D<Fixed<16, 16>>)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            fixedOutput[i] = normalize(fixedPoints[i]);
+        }
+
+        return fixedOutput.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::FixedUtil::rotate")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const     points      = make_points(make_values(0x1p-8f)); // [-32, 32)
+    std::vector<Vector3D<FixedType>> const fixedPoints = make_points(make_fixed_values(make_values(0x1p-8f)));
+    std::vector<Vector3D<float>>           output(ValueCount);
+    std::vector<Vector3D<FixedType>>       fixedOutput(ValueCount);
+
+    MatrixRotation3D<float> const     rotation      = rotation3D_from_angle_axis(0.75f, Vector3D<float>{ 1.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f });
+    MatrixRotation3D<FixedType> const fixedRotation = rotation3D_from_angle_axis(FixedType{ 0.75f },
+                                                                                 Vector3D<FixedType>{ FixedType{ 1.0f / 3.0f },
+                                                                                                      FixedType{ 2.0f / 3.0f },
+                                                                                                      FixedType{ 2.0f / 3.0f } });
+
+    BENCHMARK("Matrix3x3<float> * Vector3D<float>")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = rotation * points[i];
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("Matrix3x3<Fixed<16, 16>> * Vector3D<Fixed<16, 16>>")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            fixedOutput[i] = fixedRotation * fixedPoints[i];
+        }
+
+        return fixedOutput.back();
+    };
+}
@@ -0,0 +1,126 @@
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// note: GGM_USE_FMA is a build option, so the library functions are measured as built (see FmaMode), compare
+// the results of a build with & without the option. dot_fma always calls ggm::fma, as a reference for the
+// fused throughput of the target in either build.
+
+namespace
+{
+#if defined(GGM_USE_FMA)
+    constexpr char const FmaMode[] = "GGM_USE_FMA";
+#else
+    constexpr char const FmaMode[] = "unfused";
+#endif
+
+    constexpr std::size_t ValueCount = 1 << 14;
+
+    std::vector<ggm::Vector4D<float>> make_vectors()
+    {
+        std::vector<ggm::Vector4D<float>> vectors(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            float const s = static_cast<float>(i);
+            vectors[i]    = ggm::Vector4D<float>{ s + 1.0f, 0.5f * s - 7.0f, 3.0f - 0.25f * s, 1.0f };
+        }
+
+        return vectors;
+    }
+
+    std::vector<ggm::Matrix4x4<float>> make_matrices()
+    {
+        std::vector<ggm::Matrix4x4<float>> matrices(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            float const s = 0x1p-10f * static_cast<float>(i);
+            matrices[i]   = ggm::Matrix4x4<float>{
+                // clang-format off
+                1.0f + s,     0.5f,       -s,  2.0f,
+                       s, 2.0f - s,    0.25f, -1.0f,
+                   0.75f,       -s, 1.5f + s,  0.5f,
+                    0.0f,     0.0f,     0.0f,  1.0f,
+                // clang-format on
+            };
+        }
+
+        return matrices;
+    }
+
+    float dot_fma(ggm::Vector4D<float> const & lhs,
+                  ggm::Vector4D<float> const & rhs) noexcept
+    {
+        return ggm::fma(lhs.w, rhs.w, ggm::fma(lhs.z, rhs.z, ggm::fma(lhs.y, rhs.y, lhs.x * rhs.x)));
+    }
+} // namespace
+
+TEST_CASE("ggm::Matrix::MatrixUtil::fma")
+{
+    using namespace ggm;
+
+    std::vector<Vector4D<float>> const  vectors  = make_vectors();
+    std::vector<Matrix4x4<float>> const matrices = make_matrices();
+    std::vector<float>                  dots(ValueCount);
+    std::vector<Vector4D<float>>        products(ValueCount);
+    std::vector<Matrix4x4<float>>       matrixProducts(ValueCount);
+
+    BENCHMARK(std::string("dot(Vector4Df) ") + FmaMode)
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            dots[i] = dot(vectors[i], vectors[ValueCount - 1 - i]);
+        }
+
+        return dots.back();
+    };
+
+    BENCHMARK("dot(Vector4Df) fma")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            dots[i] = dot_fma(vectors[i], vectors[ValueCount - 1 - i]);
+        }
+
+        return dots.back();
+    };
+
+    BENCHMARK(std::string("Matrix4x4f * Vector4Df ") + FmaMode)
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            products[i] = matrices[i] * vectors[i];
+        }
+
+        return products.back();
+    };
+
+    BENCHMARK(std::string("Matrix4x4f * Matrix4x4f ") + FmaMode)
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            matrixProducts[i] = matrices[i] * matrices[ValueCount - 1 - i];
+        }
+
+        return matrixProducts.back();
+    };
+
+    BENCHMARK(std::string("inverse(Matrix4x4f) ") + FmaMode)
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            matrixProducts[i] = inverse(matrices[i]);
+        }
+
+        return matrixProducts.back();
+    };
+}
@@ -0,0 +1,365 @@
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Matrix/MatrixTransformHierarchy.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixUtilSimd.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include "Eigen/Dense"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// note: the functions in MatrixUtilSimd.h are measured against the generic templates & Eigen's fixed-size
+// matrices, with the same target flags, so build with e.g. -mavx2 -mfma
+// (& GGM_USE_FMA) to compare the AVX versions.
+
+namespace
+{
+    constexpr std::size_t ValueCount = 1 << 14;
+
+    template <typename T>
+    ggm::Matrix4x4<T> make_matrix4x4(std::size_t const i) noexcept
+    {
+        T const s = T{ 0x1p-10 } * static_cast<T>(i);
+        return ggm::Matrix4x4<T>{
+            // clang-format off
+            T{ 1 } + s,   T{ 0.5 },         -s,  T{ 2 },
+                     s, T{ 2 } - s,  T{ 0.25 }, T{ -1 },
+             T{ 0.75 },         -s, T{ 1.5 } + s, T{ 0.5 },
+              T{ 0.5 },          s,   T{ -0.5 }, T{ 3 },
+            // clang-format on
+        };
+    }
+
+    template <typename T>
+    std::vector<ggm::Matrix4x4<T>> make_matrices()
+    {
+        std::vector<ggm::Matrix4x4<T>> matrices(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            matrices[i] = make_matrix4x4<T>(i);
+        }
+
+        return matrices;
+    }
+
+    template <typename T>
+    std::vector<ggm::MatrixTransform3D<T>> make_transforms()
+    {
+        std::vector<ggm::MatrixTransform3D<T>> transforms(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            ggm::Matrix4x4<T> const m = make_matrix4x4<T>(i);
+            transforms[i]             = ggm::MatrixTransform3D<T>{
+                // clang-format off
+                m.m00, m.m01, m.m02, m.m03,
+                m.m10, m.m11, m.m12, m.m13,
+                m.m20, m.m21, m.m22, m.m23,
+                // clang-format on
+            };
+        }
+
+        return transforms;
+    }
+
+    /// the same values as make_matrices, as Eigen matrices
+    template <typename EigenMatrix4, typename T>
+    std::vector<EigenMatrix4> make_eigen_matrices(std::vector<ggm::Matrix4x4<T>> const & matrices)
+    {
+        std::vector<EigenMatrix4> eigenMatrices(matrices.size());
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+        {
+            eigenMatrices[i] = Eigen::Map<Eigen::Matrix<T, 4, 4, Eigen::RowMajor> const>(&matrices[i].m00);
+        }
+
+        return eigenMatrices;
+    }
+
+    /// the same values as make_transforms, as Eigen affine transforms
+    template <typename EigenAffine3, typename T>
+    std::vector<EigenAffine3> make_eigen_transforms(std::vector<ggm::MatrixTransform3D<T>> const & transforms)
+    {
+        std::vector<EigenAffine3> eigenTransforms(transforms.size());
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+        {
+            eigenTransforms[i].affine() = Eigen::Map<Eigen::Matrix<T, 3, 4, Eigen::RowMajor> const>(&transforms[i].m00);
+        }
+
+        return eigenTransforms;
+    }
+} // namespace
+
+// =============================================================================
+
+TEST_CASE("ggm::Matrix::MatrixUtilSimd::Matrix4x4f")
+{
+    using namespace ggm;
+
+    std::vector<Matrix4x4<float>> const matrices = make_matrices<float>();
+    std::vector<Matrix4x4<float>>       results(ValueCount);
+
+    std::vector<Eigen::Matrix4f> const eigenMatrices = make_eigen_matrices<Eigen::Matrix4f>(matrices);
+    std::vector<Eigen::Matrix4f>       eigenResults(ValueCount);
+
+    BENCHMARK("Matrix4x4f * Matrix4x4f generic template")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = matrices[i] * matrices[ValueCount - 1 - i];
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("Matrix4x4f * Matrix4x4f simd")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = multiply_simd(matrices[i], matrices[ValueCount - 1 - i]);
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("Eigen::Matrix4f * Eigen::Matrix4f")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            eigenResults[i].noalias() = eigenMatrices[i] * eigenMatrices[ValueCount - 1 - i];
+        }
+
+        return eigenResults.back()(0, 0);
+    };
+
+    BENCHMARK("inverse(Matrix4x4f) generic template")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = inverse(matrices[i]);
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("inverse(Matrix4x4f) simd")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = inverse_simd(matrices[i]);
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("Eigen::Matrix4f::inverse")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            eigenResults[i] = eigenMatrices[i].inverse();
+        }
+
+        return eigenResults.back()(0, 0);
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_CASE("ggm::Matrix::MatrixUtilSimd::Matrix4x4d")
+{
+    using namespace ggm;
+
+    std::vector<Matrix4x4<double>> const matrices = make_matrices<double>();
+    std::vector<Matrix4x4<double>>       results(ValueCount);
+
+    std::vector<Eigen::Matrix4d> const eigenMatrices = make_eigen_matrices<Eigen::Matrix4d>(matrices);
+    std::vector<Eigen::Matrix4d>       eigenResults(ValueCount);
+
+    BENCHMARK("Matrix4x4d * Matrix4x4d generic template")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = matrices[i] * matrices[ValueCount - 1 - i];
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("Matrix4x4d * Matrix4x4d simd")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = multiply_simd(matrices[i], matrices[ValueCount - 1 - i]);
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("Eigen::Matrix4d * Eigen::Matrix4d")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            eigenResults[i].noalias() = eigenMatrices[i] * eigenMatrices[ValueCount - 1 - i];
+        }
+
+        return eigenResults.back()(0, 0);
+    };
+
+    BENCHMARK("inverse(Matrix4x4d) generic template")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = inverse(matrices[i]);
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("inverse(Matrix4x4d) simd")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            results[i] = inverse_simd(matrices[i]);
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("Eigen::Matrix4d::inverse")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            eigenResults[i] = eigenMatrices[i].inverse();
+        }
+
+        return eigenResults.back()(0, 0);
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_CASE("ggm::Matrix::MatrixUtilSimd::MatrixTransform3D")
+{
+    using namespace ggm;
+
+    std::vector<MatrixTransform3D<float>> const  transformsf = make_transforms<float>();
+    std::vector<MatrixTransform3D<double>> const transformsd = make_transforms<double>();
+    std::vector<MatrixTransform3D<float>>        resultsf(ValueCount);
+    std::vector<MatrixTransform3D<double>>       resultsd(ValueCount);
+
+    std::vector<Eigen::Affine3f> const eigenTransforms = make_eigen_transforms<Eigen::Affine3f>(transformsf);
+    std::vector<Eigen::Affine3f>       eigenResults(ValueCount);
+
+    BENCHMARK("transform(MatrixTransform3Df) generic template")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            resultsf[i] = transform(transformsf[i], transformsf[ValueCount - 1 - i]);
+        }
+
+        return resultsf.back();
+    };
+
+    BENCHMARK("transform(MatrixTransform3Df) simd")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            resultsf[i] = transform_simd(transformsf[i], transformsf[ValueCount - 1 - i]);
+        }
+
+        return resultsf.back();
+    };
+
+    BENCHMARK("Eigen::Affine3f * Eigen::Affine3f")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            eigenResults[i] = eigenTransforms[i] * eigenTransforms[ValueCount - 1 - i];
+        }
+
+        return eigenResults.back()(0, 0);
+    };
+
+    BENCHMARK("transform(MatrixTransform3Dd) generic template")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            resultsd[i] = transform(transformsd[i], transformsd[ValueCount - 1 - i]);
+        }
+
+        return resultsd.back();
+    };
+
+    BENCHMARK("transform(MatrixTransform3Dd) simd")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            resultsd[i] = transform_simd(transformsd[i], transformsd[ValueCount - 1 - i]);
+        }
+
+        return resultsd.back();
+    };
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Matrix::MatrixUtilSimd::MatrixTransformHierarchy")
+{
+    using namespace ggm;
+
+    // a hierarchy of ValueCount nodes with ~27 levels, each parent (i * 7) / 10
+    std::vector<std::uint32_t>            parents(ValueCount);
+    std::vector<MatrixTransform3D<float>> locals(ValueCount);
+    for (std::size_t i = 0; i < ValueCount; ++i)
+    {
+        float const s = static_cast<float>(i % 5);
+        parents[i]    = (i == 0) ? TransformHierarchy_NoParent : static_cast<std::uint32_t>((i * 7) / 10);
+        locals[i]     = transform3D_from_translation_rotation_scale(Vector3D<float>{ 1.0f + s, -0.5f * s, 0.25f },
+                                                                    rotation3D_from_angle_axis(0.125f * s + 0.25f, Vector3D<float>{ 0.0f, 0.6f, 0.8f }),
+                                                                    Vector3D<float>{ 1.0f, 1.0f, 1.0f });
+    }
+
+    TransformHierarchyLevels levels;
+    make_transform_hierarchy_levels(parents, levels);
+
+    std::vector<MatrixTransform3D<float>> results(ValueCount);
+
+    // note: a level kernel that gathered the parents & locals of 8 nodes into packets (Matrix4x4Packet style,
+    // one array per element), ran the generic transform across the lanes & scattered the results measured
+    // 41us vs 34us per node (SSE2) & 45-50us vs 54us per node (AVX2) for 4096 nodes, i.e. the gather &
+    // scatter cost as much as the transform, while transform_simd per node took 14-16us, so the nodes
+    // overloads stay per node (see MatrixTransformHierarchy.h)
+    BENCHMARK("world_transforms(MatrixTransform3Df) per level, generic template")
+    {
+        for (std::size_t level = 0; level + 1 < levels.offsets.size(); ++level)
+        {
+            for (std::uint32_t i = levels.offsets[level]; i < levels.offsets[level + 1]; ++i)
+            {
+                std::uint32_t const node   = levels.nodes[i];
+                std::uint32_t const parent = parents[node];
+                results[node]              = (parent == TransformHierarchy_NoParent) ? locals[node] : transform<float>(results[parent], locals[node]);
+            }
+        }
+
+        return results.back();
+    };
+
+    BENCHMARK("world_transforms(MatrixTransform3Df) per level, transform_simd")
+    {
+        for (std::size_t level = 0; level + 1 < levels.offsets.size(); ++level)
+        {
+            std::span<std::uint32_t const> const nodes = std::span{ levels.nodes }.subspan(levels.offsets[level], levels.offsets[level + 1] - levels.offsets[level]);
+            world_transforms<float>(locals, parents, nodes, results);
+        }
+
+        return results.back();
+    };
+}
+
+// =============================================================================
@@ -0,0 +1,147 @@
+#include "ggm/Numeric/NumericBatch.h"
+#include "ggm/Numeric/NumericUtil.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t ValueCount = 1 << 20;
+
+    std::vector<float> make_values(float const scale)
+    {
+        std::vector<float> values(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = scale * (static_cast<float>(i) - 0.5f * static_cast<float>(ValueCount));
+        }
+
+        return values;
+    }
+
+    /// smooth_step as previously defined in ggm/Numeric/NumericUtil.h (with the edge0 fix), where the
+    /// saturate ternaries let the optimizer split the loop into branches
+    constexpr float baseline_smooth_step(float const edge0,
+                                         float const edge1,
+                                         float const value) noexcept
+    {
+        float const s = (value - edge0) / (edge1 - edge0);
+        float const t = (s <= 0.0f)  ? 0.0f
+                        : (s > 1.0f) ? 1.0f
+                                     : s;
+        return t * t * (3.0f - 2.0f * t);
+    }
+} // namespace
+
+TEST_CASE("ggm::Numeric::NumericBatch::lerp")
+{
+    using namespace ggm;
+
+    std::vector<float> const values0 = make_values(0x1p-16f);
+    std::vector<float> const values1 = make_values(0x1p-12f);
+    std::vector<float> const ts      = make_values(0x1p-20f);
+    std::vector<float>       output(ValueCount);
+
+    BENCHMARK("lerp(float) per-element loop")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = lerp(values0[i], values1[i], ts[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("lerp(span<float>) batch")
+    {
+        lerp(values0, values1, ts, output);
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::NumericBatch::clamp")
+{
+    using namespace ggm;
+
+    std::vector<float> const values = make_values(0x1p-16f);
+    std::vector<float>       output(ValueCount);
+
+    BENCHMARK("clamp(float) per-element loop")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = clamp(values[i], -1.0f, 2.0f);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("clamp(span<float>) batch")
+    {
+        clamp(values, -1.0f, 2.0f, output);
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::NumericBatch::smooth_step")
+{
+    using namespace ggm;
+
+    std::vector<float> const values = make_values(0x1p-16f);
+    std::vector<float>       output(ValueCount);
+
+    BENCHMARK("smooth_step(float) ternary saturate (before)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = baseline_smooth_step(-2.0f, 3.0f, values[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("smooth_step(float) per-element loop")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = smooth_step(-2.0f, 3.0f, values[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("smooth_step(span<float>) batch")
+    {
+        smooth_step(-2.0f, 3.0f, values, output);
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::NumericBatch::half")
+{
+    using namespace ggm;
+
+    std::vector<float> const values = make_values(0x1p-4f);
+    std::vector<half>        halfValues(ValueCount);
+    std::vector<float>       output(ValueCount);
+
+    BENCHMARK("half_from_float(span<float>) batch")
+    {
+        half_from_float(values, halfValues);
+
+        return halfValues.back().bits;
+    };
+
+    BENCHMARK("float_from_half(span<half>) batch")
+    {
+        float_from_half(halfValues, output);
+
+        return output.back();
+    };
+}
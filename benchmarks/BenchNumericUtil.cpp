@@ -0,0 +1,166 @@
+#include "ggm/Numeric/NumericBatch.h"
+#include "ggm/Numeric/NumericUtil.h"
+
+#include "BenchUtils/Baseline.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t ValueCount = 1 << 16;
+
+    std::vector<float> make_values(float const scale)
+    {
+        std::vector<float> values(ValueCount);
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = scale * (static_cast<float>(i) - 0.5f * static_cast<float>(ValueCount));
+        }
+
+        return values;
+    }
+
+    /// floor as previously defined in ggm/Numeric/NumericUtil.h (an int round-trip via trunc, which
+    /// was only valid for |value| < 2^digits)
+    constexpr float baseline_floor(float const value) noexcept
+    {
+        float const truncValue = static_cast<float>(static_cast<int>(value));
+        return (value < truncValue) ? (truncValue - 1.0f) : truncValue;
+    }
+} // namespace
+
+TEST_CASE("ggm::Numeric::NumericUtil::is_close")
+{
+    using namespace ggm;
+
+    std::vector<float> const lhs = make_values(0.125f);
+    std::vector<float> const rhs = make_values(0.125f + 0x1p-24f);
+    std::vector<char>        output(ValueCount);
+
+    BENCHMARK("is_close(float) ilogb & scalbn (before)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = Baseline::is_close(lhs[i], rhs[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("is_close(float) exponent bits (after)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = is_close(lhs[i], rhs[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("is_close_ulps(float)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = is_close_ulps(lhs[i], rhs[i]);
+        }
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::NumericUtil::sincos")
+{
+    using namespace ggm;
+
+    std::vector<float> const angles = make_values(0x1p-8f); // [-128, 128)
+    std::vector<float>       sinValues(ValueCount);
+    std::vector<float>       cosValues(ValueCount);
+
+    BENCHMARK("std::sin & std::cos(float) (before)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            sinValues[i] = std::sin(angles[i]);
+            cosValues[i] = std::cos(angles[i]);
+        }
+
+        return sinValues.back() + cosValues.back();
+    };
+
+    BENCHMARK("sincos(float) (after)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            SinCos<float> const result = sincos(angles[i]);
+
+            sinValues[i] = result.sin;
+            cosValues[i] = result.cos;
+        }
+
+        return sinValues.back() + cosValues.back();
+    };
+
+    BENCHMARK("sincos(span<float>) batch")
+    {
+        sincos(angles, sinValues, cosValues);
+
+        return sinValues.back() + cosValues.back();
+    };
+}
+
+TEST_CASE("ggm::Numeric::NumericUtil::floor")
+{
+    using namespace ggm;
+
+    std::vector<float> const values = make_values(0x1p-4f); // [-2048, 2048)
+    std::vector<float>       output(ValueCount);
+
+    BENCHMARK("floor(float) int round-trip (before)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = baseline_floor(values[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("std::floor(float)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = std::floor(values[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("floor(float) bits (after)")
+    {
+        for (std::size_t i = 0; i < ValueCount; ++i)
+        {
+            output[i] = floor(values[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("floor(span<float>) batch")
+    {
+        floor(values, output);
+
+        return output.back();
+    };
+
+    BENCHMARK("fract(span<float>) batch")
+    {
+        fract(values, output);
+
+        return output.back();
+    };
+}
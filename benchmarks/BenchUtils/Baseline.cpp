@@ -0,0 +1,42 @@
+#include "BenchUtils/Baseline.h"
+
+#include "ggm/Vector/VectorUtil.h"
+
+#include <algorithm>
+#include <cmath>
+
+// =============================================================================
+// ggm::Baseline::is_close
+// =============================================================================
+
+bool ggm::Baseline::is_close(float const lhs,
+                             float const rhs,
+                             float const epsilon) noexcept
+{
+    int const   lhsExp    = std::ilogb(lhs);
+    int const   rhsExp    = std::ilogb(rhs);
+    int const   maxExp    = std::max(lhsExp, rhsExp);
+    float const tolerance = (maxExp > 0) ? std::scalbn(epsilon, maxExp) : epsilon;
+    return std::abs(lhs - rhs) <= tolerance;
+}
+
+// =============================================================================
+// ggm::Baseline::reciprocal_sqrt
+// =============================================================================
+
+float ggm::Baseline::reciprocal_sqrt(float const value,
+                                     float const defaultValue) noexcept
+{
+    return (value > 0.0f) ? (1.0f / std::sqrt(value)) : defaultValue;
+}
+
+// =============================================================================
+// ggm::Baseline::normalize
+// =============================================================================
+
+ggm::Vector3D<float> ggm::Baseline::normalize(Vector3D<float> const & value) noexcept
+{
+    return value * Baseline::reciprocal_sqrt(length_squared(value));
+}
+
+// =============================================================================
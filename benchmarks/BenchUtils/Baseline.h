@@ -0,0 +1,36 @@
+#pragma once
+#ifndef GGM_BENCHMARKS_BASELINE_H
+#define GGM_BENCHMARKS_BASELINE_H
+
+#include "ggm/Vector/Vector.h"
+
+// =============================================================================
+/// Reference implementations used as the "before" side of a benchmark.
+/// @details
+/// These are defined in a separate translation unit so that, like the previous
+/// out-of-line library definitions they reproduce, they can not be inlined into
+/// the benchmark loop.
+// =============================================================================
+
+namespace ggm::Baseline
+{
+    // =============================================================================
+
+    /// is_close as previously defined in source/ggm/NumericUtil.cpp
+    bool is_close(float const lhs,
+                  float const rhs,
+                  float const epsilon = 0x1p-20f) noexcept;
+
+    /// reciprocal_sqrt as previously defined in source/ggm/NumericUtil.cpp
+    float reciprocal_sqrt(float const value,
+                          float const defaultValue = 0.0f) noexcept;
+
+    /// normalize using the out-of-line reciprocal_sqrt
+    Vector3D<float> normalize(Vector3D<float> const & value) noexcept;
+
+    // =============================================================================
+} // namespace ggm::Baseline
+
+// =============================================================================
+
+#endif // GGM_BENCHMARKS_BASELINE_H
@@ -0,0 +1,84 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorHash.h"
+#include "ggm/Vector/VectorMesh.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint32_t GridSize    = 1024;
+    constexpr std::size_t   VertexCount = 10'000'000;
+
+    /// the triangle soup of a GridSize x GridSize grid, i.e. each grid vertex duplicated ~6 times (with jitter
+    /// of up to 1.5e-4 when jitter is true), truncated to VertexCount vertices
+    std::vector<ggm::Vector3D<float>> make_soup(bool const jitter)
+    {
+        std::vector<ggm::Vector3D<float>> positions;
+        positions.reserve(VertexCount);
+        for (std::uint32_t y = 0; (y < GridSize) && (positions.size() < VertexCount); ++y)
+        {
+            for (std::uint32_t x = 0; (x < GridSize) && (positions.size() < VertexCount); ++x)
+            {
+                std::uint32_t const corners[6][2]{ { x, y }, { x + 1, y }, { x + 1, y + 1 }, { x, y }, { x + 1, y + 1 }, { x, y + 1 } };
+                for (auto const & corner : corners)
+                {
+                    float const offset = jitter ? 5e-5f * static_cast<float>(static_cast<int>(positions.size() % 7) - 3) : 0.0f;
+                    positions.push_back(ggm::Vector3D<float>{ 0.01f * static_cast<float>(corner[0]) + offset, 0.01f * static_cast<float>(corner[1]) - offset, offset });
+                }
+            }
+        }
+
+        positions.resize(VertexCount);
+        return positions;
+    }
+} // namespace
+
+TEST_CASE("ggm::Vector::VectorMesh::weld_vertices")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const exact    = make_soup(false);
+    std::vector<Vector3D<float>> const jittered = make_soup(true);
+    std::vector<std::uint32_t>         remap(VertexCount);
+
+    BENCHMARK("std::unordered_map<Vector3D<float>> exact dedup, 10M vertices (before)")
+    {
+        std::unordered_map<Vector3D<float>, std::uint32_t> uniques;
+        for (std::size_t i = 0; i < VertexCount; ++i)
+        {
+            remap[i] = uniques.emplace(exact[i], static_cast<std::uint32_t>(uniques.size())).first->second;
+        }
+
+        return uniques.size();
+    };
+
+    BENCHMARK("weld_vertices(epsilon = 0), 10M vertices")
+    {
+        return weld_vertices(exact, 0.0f, remap);
+    };
+
+    BENCHMARK("weld_vertices(epsilon = 1e-3), 10M vertices")
+    {
+        return weld_vertices(jittered, 1e-3f, remap);
+    };
+
+    // note: cells of 2 * epsilon would be beyond std::int32_t, so the cells are enlarged (rather than all vertices
+    // crowding into one cell, which took 41s for 266k vertices around 1e6 with epsilon 1e-4, vs 0.09s)
+    std::vector<Vector3D<float>> offset = exact;
+    for (Vector3D<float> & position : offset)
+    {
+        position += Vector3D<float>{ 1000.0f, 1000.0f, 1000.0f };
+    }
+
+    BENCHMARK("weld_vertices(epsilon = 1e-7) offset by 1000, 10M vertices")
+    {
+        return weld_vertices(offset, 1e-7f, remap);
+    };
+}
@@ -0,0 +1,149 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorBatch.h"
+#include "ggm/Vector/VectorNoise.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// the benchmark names include the number of samples, so samples per second = SampleCount / the mean time
+namespace
+{
+    constexpr std::size_t SampleCount = 1 << 20;
+
+    /// a grid of points with spacing 1/scale (so ~scale^-d points per lattice cell)
+    std::vector<ggm::Vector2D<float>> make_values2D(float const scale)
+    {
+        std::vector<ggm::Vector2D<float>> values(SampleCount);
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            values[i] = ggm::Vector2D<float>{ scale * static_cast<float>(i % 1024), scale * static_cast<float>(i / 1024) };
+        }
+
+        return values;
+    }
+
+    std::vector<ggm::Vector3D<float>> make_values3D(float const scale)
+    {
+        std::vector<ggm::Vector3D<float>> values(SampleCount);
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            values[i] = ggm::Vector3D<float>{ scale * static_cast<float>(i % 128), scale * static_cast<float>((i / 128) % 128), scale * static_cast<float>(i / 16384) };
+        }
+
+        return values;
+    }
+} // namespace
+
+TEST_CASE("ggm::Vector::VectorNoise::perlin_noise")
+{
+    using namespace ggm;
+
+    std::vector<Vector2D<float>> const values2D = make_values2D(0.037f);
+    std::vector<Vector3D<float>> const values3D = make_values3D(0.037f);
+    std::vector<float>                 output(SampleCount);
+
+    BENCHMARK("perlin_noise(Vector2D<float>) per-element loop, 1M samples")
+    {
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            output[i] = perlin_noise(values2D[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("perlin_noise(span<Vector2D<float>>) batch, 1M samples")
+    {
+        perlin_noise(values2D, output);
+
+        return output.back();
+    };
+
+    BENCHMARK("perlin_noise(Vector3D<float>) per-element loop, 1M samples")
+    {
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            output[i] = perlin_noise(values3D[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("perlin_noise(span<Vector3D<float>>) batch, 1M samples")
+    {
+        perlin_noise(values3D, output);
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Vector::VectorNoise::simplex_noise")
+{
+    using namespace ggm;
+
+    std::vector<Vector2D<float>> const values2D = make_values2D(0.037f);
+    std::vector<Vector3D<float>> const values3D = make_values3D(0.037f);
+    std::vector<float>                 output(SampleCount);
+
+    BENCHMARK("simplex_noise(Vector2D<float>) per-element loop, 1M samples")
+    {
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            output[i] = simplex_noise(values2D[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("simplex_noise(span<Vector2D<float>>) batch, 1M samples")
+    {
+        simplex_noise(values2D, output);
+
+        return output.back();
+    };
+
+    BENCHMARK("simplex_noise(Vector3D<float>) per-element loop, 1M samples")
+    {
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            output[i] = simplex_noise(values3D[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("simplex_noise(span<Vector3D<float>>) batch, 1M samples")
+    {
+        simplex_noise(values3D, output);
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Vector::VectorNoise::fbm")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const values3D = make_values3D(0.037f);
+    std::vector<float>                 output(SampleCount);
+
+    BENCHMARK("simplex_fbm(Vector3D<float>, 6 octaves) per-element loop, 1M samples")
+    {
+        for (std::size_t i = 0; i < SampleCount; ++i)
+        {
+            output[i] = simplex_fbm(values3D[i], 6, 2.0f, 0.5f);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("simplex_fbm(span<Vector3D<float>>, 6 octaves) batch, 1M samples")
+    {
+        simplex_fbm(values3D, 6, 2.0f, 0.5f, output);
+
+        return output.back();
+    };
+}
@@ -0,0 +1,219 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorAligned.h"
+#include "ggm/Vector/VectorAlignedUtil.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+#include "ggm/Vector/VectorSoA.h"
+#include "ggm/Vector/VectorSoAUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "BenchUtils/Baseline.h"
+
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t VectorCount      = 1 << 16;
+    constexpr std::size_t LargeVectorCount = 1 << 20;
+
+    std::vector<ggm::Vector3D<float>> make_vectors(std::size_t const count = VectorCount)
+    {
+        std::vector<ggm::Vector3D<float>> vectors(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float const s = static_cast<float>(i);
+            vectors[i]    = ggm::Vector3D<float>{ s + 1.0f, 0.5f * s - 7.0f, 3.0f - 0.25f * s };
+        }
+
+        return vectors;
+    }
+} // namespace
+
+TEST_CASE("ggm::Vector::VectorUtil::normalize")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const input = make_vectors();
+    std::vector<Vector3D<float>>       output(VectorCount);
+
+    BENCHMARK("normalize(Vector3Df) out-of-line reciprocal_sqrt (before)")
+    {
+        for (std::size_t i = 0; i < VectorCount; ++i)
+        {
+            output[i] = Baseline::normalize(input[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("normalize(Vector3Df) inline reciprocal_sqrt (after)")
+    {
+        for (std::size_t i = 0; i < VectorCount; ++i)
+        {
+            output[i] = normalize(input[i]);
+        }
+
+        return output.back();
+    };
+    BENCHMARK("normalize_fast<2>(Vector3Df) ~22 bits")
+    {
+        for (std::size_t i = 0; i < VectorCount; ++i)
+        {
+            output[i] = normalize_fast<2>(input[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("normalize_fast<1>(Vector3Df) ~15 bits")
+    {
+        for (std::size_t i = 0; i < VectorCount; ++i)
+        {
+            output[i] = normalize_fast<1>(input[i]);
+        }
+
+        return output.back();
+    };
+}
+
+TEST_CASE("ggm::Vector::VectorSoAUtil")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const input = make_vectors();
+    std::vector<Vector3D<float>>       output(VectorCount);
+    std::vector<float>                 lengths(VectorCount);
+
+    Vector3DSoA<float> soaInput;
+    Vector3DSoA<float> soaOutput;
+    Vector3DSoA<float> soaCross;
+    gather(input, soaInput);
+    resize(soaOutput, VectorCount);
+    resize(soaCross, VectorCount);
+
+    BENCHMARK("normalize(Vector3Df) array of structures")
+    {
+        for (std::size_t i = 0; i < VectorCount; ++i)
+        {
+            output[i] = normalize(input[i]);
+        }
+
+        return output.back();
+    };
+
+    // note: with -O3 -fno-math-errno (64k vectors), cross went from 116us to 68us & normalize from 140us to
+    // 44us (51us in-place) once the loops vectorized, so a regression to scalar loops shows here
+    BENCHMARK("normalize(Vector3DSoA<float>) structure of arrays")
+    {
+        normalize(soaInput, soaOutput);
+        return soaOutput.x.back();
+    };
+
+    BENCHMARK("normalize(Vector3DSoA<float>) structure of arrays, in-place")
+    {
+        normalize(soaOutput, soaOutput);
+        return soaOutput.x.back();
+    };
+
+    BENCHMARK("cross(Vector3DSoA<float>) structure of arrays")
+    {
+        cross(soaInput, soaOutput, soaCross);
+        return soaCross.x.back();
+    };
+
+    BENCHMARK("length(Vector3Df) array of structures")
+    {
+        for (std::size_t i = 0; i < VectorCount; ++i)
+        {
+            lengths[i] = length(input[i]);
+        }
+
+        return lengths.back();
+    };
+
+    BENCHMARK("length(Vector3DSoA<float>) structure of arrays")
+    {
+        length(soaInput, lengths);
+        return lengths.back();
+    };
+}
+
+TEST_CASE("ggm::Vector::VectorPacketUtil")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const input = make_vectors();
+
+    Vector3DPacketArray<float, 8> packetInput;
+    Vector3DPacketArray<float, 8> packetOutput;
+    gather(input, packetInput);
+    resize(packetOutput, VectorCount);
+
+    BENCHMARK("normalize(Vector3DPacket<float, 8>) array of structure of arrays")
+    {
+        std::size_t const packetCount = packetInput.packets.size();
+        for (std::size_t i = 0; i < packetCount; ++i)
+        {
+            packetOutput.packets[i] = normalize(packetInput.packets[i]);
+        }
+
+        return packetOutput.packets.back().x[0];
+    };
+}
+
+TEST_CASE("ggm::Vector::VectorAlignedUtil")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> const input = make_vectors(LargeVectorCount);
+    std::vector<Vector3D<float>>       output(LargeVectorCount);
+
+    std::vector<Vector3DA<float>> alignedInput(LargeVectorCount);
+    std::vector<Vector3DA<float>> alignedOutput(LargeVectorCount);
+    vector3DA_from_vector3D(std::span<Vector3D<float> const>(input), std::span<Vector3DA<float>>(alignedInput));
+
+    BENCHMARK("normalize(Vector3Df) 12 bytes")
+    {
+        for (std::size_t i = 0; i < LargeVectorCount; ++i)
+        {
+            output[i] = normalize(input[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("normalize(Vector3DAf) 16 bytes aligned")
+    {
+        for (std::size_t i = 0; i < LargeVectorCount; ++i)
+        {
+            alignedOutput[i] = normalize(alignedInput[i]);
+        }
+
+        return alignedOutput.back();
+    };
+
+    BENCHMARK("cross(Vector3Df) 12 bytes")
+    {
+        for (std::size_t i = 1; i < LargeVectorCount; ++i)
+        {
+            output[i] = cross(input[i - 1], input[i]);
+        }
+
+        return output.back();
+    };
+
+    BENCHMARK("cross(Vector3DAf) 16 bytes aligned")
+    {
+        for (std::size_t i = 1; i < LargeVectorCount; ++i)
+        {
+            alignedOutput[i] = cross(alignedInput[i - 1], alignedInput[i]);
+        }
+
+        return alignedOutput.back();
+    };
+}
@@ -0,0 +1,74 @@
+#pragma once
+#ifndef GGM_DISPATCH_LEVEL_H
+#define GGM_DISPATCH_LEVEL_H
+
+// =============================================================================
+/// Runtime ISA dispatch:
+/// ----------
+///
+/// The batch kernels defined in the ggm library (e.g. VectorBatch.h, MatrixBatch.h, MatrixTransformBatch.h)
+/// are compiled once per DispatchLevel & the implementation is picked at runtime, so a single binary can use
+/// the widest instructions available on each machine while still running on the baseline ISA.
+///
+/// The level is selected on first use:
+///   - from the GGM_DISPATCH_LEVEL environment variable, if set to a supported level name
+///     (i.e. "baseline", "sse4.2", "avx2" or "avx512"), which is useful to test a specific level
+///   - otherwise, the highest level supported by both the CPU & the OS (via cpuid & xgetbv)
+///
+/// Every level computes bit-identical results (the kernels are compiled without floating point contraction),
+/// so the level only affects performance. The exception is a GGM_USE_FMA build, where multiply_add is only
+/// fused at the levels with FMA instructions (Avx2 & Avx512), so those match the lower levels within tolerance.
+///
+/// Syntax                          | Description
+/// --------                        | -----------
+/// l = supported_dispatch_level(); | The highest level supported by this machine.
+/// l = active_dispatch_level();    | The level used by the batch kernels.
+/// b = set_dispatch_level(l);      | Force the level used by the batch kernels, false if it is not supported.
+/// reset_dispatch_level();         | Restore the level selected on first use.
+/// s = dispatch_level_name(l);     | The name of the level, as used by GGM_DISPATCH_LEVEL.
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // DispatchLevel
+    // =============================================================================
+
+    /// The instruction set levels that batch kernels are compiled for, in increasing order.
+    /// @details
+    /// On targets other than x86 only Baseline is supported.
+    enum class DispatchLevel
+    {
+        Baseline, ///< The target's baseline ISA, i.e. the flags the library was compiled with (e.g. SSE2 on x86-64)
+        Sse42,    ///< SSE4.2 & POPCNT
+        Avx2,     ///< AVX2, FMA, F16C, BMI1 & BMI2
+        Avx512,   ///< AVX-512 F, VL, BW, DQ & CD
+    };
+
+    // =============================================================================
+
+    /// The highest level supported by both the CPU & the OS.
+    DispatchLevel supported_dispatch_level() noexcept;
+
+    /// The level used by the batch kernels.
+    DispatchLevel active_dispatch_level() noexcept;
+
+    /// Force the level used by the batch kernels.
+    /// @details
+    /// The change applies to subsequent calls of the batch kernels (from any thread).
+    /// @param[in] level The level to use, must be <= supported_dispatch_level()
+    /// @returns true if level is supported & now active, else false (& the active level is unchanged)
+    bool set_dispatch_level(DispatchLevel const level) noexcept;
+
+    /// Restore the level selected on first use (from GGM_DISPATCH_LEVEL or the supported level).
+    void reset_dispatch_level() noexcept;
+
+    /// The name of the level, as used by the GGM_DISPATCH_LEVEL environment variable.
+    char const * dispatch_level_name(DispatchLevel const level) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_DISPATCH_LEVEL_H
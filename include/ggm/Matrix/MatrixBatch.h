@@ -0,0 +1,180 @@
+#pragma once
+#ifndef GGM_MATRIX_BATCH_H
+#define GGM_MATRIX_BATCH_H
+
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Vector/Vector.h"
+
+#include <cstddef>
+#include <span>
+
+// =============================================================================
+/// @addtogroup Matrix
+/// @{
+/// @details
+///
+/// Functions that apply a matrix operation to each element of a span, writing the results to an output span
+/// of the same size (which may be the same as the input span for the transform_* functions, i.e. in-place).
+///
+/// The transform_* functions also read the points from an interleaved vertex buffer, i.e. point i is the
+/// elements values[i * stride + 0, 1, 2], & take a BatchStore to write the results with streaming
+/// (non-temporal) stores, for results that are not read again soon (e.g. a buffer for the GPU).
+///
+/// These are defined in the ggm library (rather than inline) & dispatch at runtime to the widest
+/// instruction set supported by the machine, see DispatchLevel.h.
+///
+/// functions:
+/// ----------
+///
+/// Syntax                              | Description
+/// ------                              | -----------
+/// multiply(ls, rs, ms)                | matrix-matrix multiplication of each pair of matrices, i.e. ms[i] = ls[i] * rs[i]
+/// transform_points(m, ps, qs)         | transform each point, i.e. qs[i] = (m * Vector4D{ps[i], 1}).xyz
+/// transform_points(m, vs, stride, qs) | transform each point of an interleaved vertex buffer
+/// transform_directions(m, ds, es)     | transform each direction, i.e. es[i] = (m * Vector4D{ds[i], 0}).xyz
+/// transform_points_project(m, ps, qs) | transform each point & divide by w, i.e. qs[i] = q.xyz / q.w for q = m * Vector4D{ps[i], 1}
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // BatchStore
+    // =============================================================================
+
+    /// How a batch transform writes its results
+    enum class BatchStore
+    {
+        Cached,    ///< regular stores, for results that are read again soon
+        Streaming, ///< streaming (non-temporal) stores that bypass the cache, regular stores on targets without them
+    };
+
+    // =============================================================================
+
+    /// matrix-matrix multiplication of each pair of matrices, i.e. results[i] = lhs[i] * rhs[i]
+    /// @param[in]  lhs     The left-hand side matrices
+    /// @param[in]  rhs     The right-hand side matrices, must be the same size as lhs
+    /// @param[out] results The products, must be the same size as lhs & must not overlap lhs or rhs
+    /// @relates Matrix4x4
+    void multiply(std::span<Matrix4x4<float> const> const lhs,
+                  std::span<Matrix4x4<float> const> const rhs,
+                  std::span<Matrix4x4<float>> const       results) noexcept;
+    void multiply(std::span<Matrix4x4<double> const> const lhs,
+                  std::span<Matrix4x4<double> const> const rhs,
+                  std::span<Matrix4x4<double>> const       results) noexcept;
+
+    // =============================================================================
+
+    /// transform each point (i.e. including the translation, but ignoring the 4th row), equivalent to
+    /// results[i] = (transform * Vector4D{points[i], 1}).xyz
+    /// @param[in]  transform The matrix to apply
+    /// @param[in]  points    The source points
+    /// @param[out] results   The transformed points, must be the same size as points (or the same span, i.e. in-place)
+    /// @param[in]  store     How to write the results
+    /// @relates Matrix4x4
+    void transform_points(Matrix4x4<float> const &               transform,
+                          std::span<Vector3D<float> const> const points,
+                          std::span<Vector3D<float>> const       results,
+                          BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_points(Matrix4x4<double> const &               transform,
+                          std::span<Vector3D<double> const> const points,
+                          std::span<Vector3D<double>> const       results,
+                          BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each point, for the points of an interleaved vertex buffer
+    /// @param[in]  transform The matrix to apply
+    /// @param[in]  values    The vertex buffer, point i is values[i * stride + 0, 1, 2]
+    /// @param[in]  stride    The number of elements from one point to the next, at least 3
+    /// @param[out] results   The transformed points, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates Matrix4x4
+    void transform_points(Matrix4x4<float> const &         transform,
+                          std::span<float const> const     values,
+                          std::size_t const                stride,
+                          std::span<Vector3D<float>> const results,
+                          BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_points(Matrix4x4<double> const &         transform,
+                          std::span<double const> const     values,
+                          std::size_t const                 stride,
+                          std::span<Vector3D<double>> const results,
+                          BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+
+    /// transform each direction (i.e. excluding the translation & ignoring the 4th row), equivalent to
+    /// results[i] = (transform * Vector4D{directions[i], 0}).xyz
+    /// @param[in]  transform  The matrix to apply
+    /// @param[in]  directions The source directions
+    /// @param[out] results    The transformed directions, must be the same size as directions (or the same span, i.e. in-place)
+    /// @param[in]  store      How to write the results
+    /// @relates Matrix4x4
+    void transform_directions(Matrix4x4<float> const &               transform,
+                              std::span<Vector3D<float> const> const directions,
+                              std::span<Vector3D<float>> const       results,
+                              BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_directions(Matrix4x4<double> const &               transform,
+                              std::span<Vector3D<double> const> const directions,
+                              std::span<Vector3D<double>> const       results,
+                              BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each direction, for the directions of an interleaved vertex buffer
+    /// @param[in]  transform The matrix to apply
+    /// @param[in]  values    The vertex buffer, direction i is values[i * stride + 0, 1, 2]
+    /// @param[in]  stride    The number of elements from one direction to the next, at least 3
+    /// @param[out] results   The transformed directions, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates Matrix4x4
+    void transform_directions(Matrix4x4<float> const &         transform,
+                              std::span<float const> const     values,
+                              std::size_t const                stride,
+                              std::span<Vector3D<float>> const results,
+                              BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_directions(Matrix4x4<double> const &         transform,
+                              std::span<double const> const     values,
+                              std::size_t const                 stride,
+                              std::span<Vector3D<double>> const results,
+                              BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+
+    /// transform each point & divide by w (e.g. by a projection matrix), equivalent to
+    /// results[i] = p.xyz / p.w for p = transform * Vector4D{points[i], 1}
+    /// @param[in]  transform The matrix to apply
+    /// @param[in]  points    The source points
+    /// @param[out] results   The transformed points, must be the same size as points (or the same span, i.e. in-place)
+    /// @param[in]  store     How to write the results
+    /// @relates Matrix4x4
+    void transform_points_project(Matrix4x4<float> const &               transform,
+                                  std::span<Vector3D<float> const> const points,
+                                  std::span<Vector3D<float>> const       results,
+                                  BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_points_project(Matrix4x4<double> const &               transform,
+                                  std::span<Vector3D<double> const> const points,
+                                  std::span<Vector3D<double>> const       results,
+                                  BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each point & divide by w, for the points of an interleaved vertex buffer
+    /// @param[in]  transform The matrix to apply
+    /// @param[in]  values    The vertex buffer, point i is values[i * stride + 0, 1, 2]
+    /// @param[in]  stride    The number of elements from one point to the next, at least 3
+    /// @param[out] results   The transformed points, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates Matrix4x4
+    void transform_points_project(Matrix4x4<float> const &         transform,
+                                  std::span<float const> const     values,
+                                  std::size_t const                stride,
+                                  std::span<Vector3D<float>> const results,
+                                  BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_points_project(Matrix4x4<double> const &         transform,
+                                  std::span<double const> const     values,
+                                  std::size_t const                 stride,
+                                  std::span<Vector3D<double>> const results,
+                                  BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_MATRIX_BATCH_H
@@ -2,6 +2,8 @@
 #ifndef GGM_MATRIX_FWD_H
 #define GGM_MATRIX_FWD_H
 
+#include <cstddef>
+
 // =============================================================================
 
 namespace ggm
@@ -58,6 +60,13 @@ namespace ggm
     template <typename T>
     struct Matrix4x4;
 
+    // =============================================================================
+    // Forward declarations for Matrix4x4Packet type:
+    // =============================================================================
+
+    template <typename T, std::size_t N>
+    struct Matrix4x4Packet;
+
     // =============================================================================
 } // namespace ggm
 
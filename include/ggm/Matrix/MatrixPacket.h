@@ -0,0 +1,37 @@
+#pragma once
+#ifndef GGM_MATRIX_PACKET_H
+#define GGM_MATRIX_PACKET_H
+
+#include <cstddef>
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // Matrix4x4Packet
+    // =============================================================================
+
+    /// A packet of N 4x4 mathematical matrices (row major storage of each element's N lanes)
+    /// @details
+    /// The lanes of element mRC are mRC[0] ... mRC[N - 1], see VectorPacket.h & MatrixPacketUtil.h.
+    /// @tparam T The type of each matrix element (usually float or double)
+    /// @tparam N The number of matrices (lanes) in the packet: 4, 8 or 16
+    template <typename T, std::size_t N>
+    struct Matrix4x4Packet
+    {
+        static_assert((N == 4) || (N == 8) || (N == 16), "N must be a SIMD width: 4, 8 or 16");
+
+        // members:
+        T m00[N], m01[N], m02[N], m03[N]; // uninitialized
+        T m10[N], m11[N], m12[N], m13[N]; // uninitialized
+        T m20[N], m21[N], m22[N], m23[N]; // uninitialized
+        T m30[N], m31[N], m32[N], m33[N]; // uninitialized
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_MATRIX_PACKET_H
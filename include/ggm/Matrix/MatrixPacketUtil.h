@@ -0,0 +1,285 @@
+#pragma once
+#ifndef GGM_MATRIX_PACKET_UTIL_H
+#define GGM_MATRIX_PACKET_UTIL_H
+
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixPacket.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+
+#include <cassert>
+#include <cstddef>
+
+// =============================================================================
+/// @addtogroup Matrix
+/// @{
+/// @details
+///
+/// Packet versions of the Matrix4x4 operators of MatrixUtil.h & MatrixVectorUtil.h, which apply the
+/// Matrix4x4 operator to each lane, so the results are the same as the Matrix4x4 operators (see
+/// VectorPacketUtil.h).
+///
+/// operators:
+/// ----------
+///
+/// Syntax      | Description
+/// ------      | -----------
+/// p = v * m;  | vector-matrix multiplication of each lane
+/// p = m * v;  | matrix-vector multiplication of each lane
+/// b = m == n; | matrix equality of every lane
+/// b = m != n; | matrix inequality of any lane
+///
+/// lane access:
+/// ------------
+///
+/// Syntax                 | Description
+/// ------                 | -----------
+/// m = broadcast<N>(a);   | packet with every lane set to a
+/// a = get_lane(m, i);    | matrix of the i(th) lane
+/// set_lane(m, i, a);     | set the matrix of the i(th) lane
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // operators:
+    // =============================================================================
+
+    /// vector-matrix multiplication of each lane
+    /// @relates Vector4DPacket
+    /// @relates Matrix4x4Packet
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(Vector4DPacket<T, N> const &  lhs,
+                                             Matrix4x4Packet<T, N> const & rhs) noexcept;
+
+    /// vector-matrix multiplication of each lane by the same matrix
+    /// @relates Vector4DPacket
+    /// @relates Matrix4x4
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(Vector4DPacket<T, N> const & lhs,
+                                             Matrix4x4<T> const &         rhs) noexcept;
+
+    // =============================================================================
+
+    /// matrix-vector multiplication of each lane
+    /// @relates Matrix4x4Packet
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(Matrix4x4Packet<T, N> const & lhs,
+                                             Vector4DPacket<T, N> const &  rhs) noexcept;
+
+    /// matrix-vector multiplication of each lane by the same matrix
+    /// @relates Matrix4x4
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(Matrix4x4<T> const &         lhs,
+                                             Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// matrix equality of every lane
+    /// @relates Matrix4x4Packet
+    template <typename T, std::size_t N>
+    constexpr bool operator==(Matrix4x4Packet<T, N> const & lhs,
+                              Matrix4x4Packet<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// matrix inequality of any lane
+    /// @relates Matrix4x4Packet
+    template <typename T, std::size_t N>
+    constexpr bool operator!=(Matrix4x4Packet<T, N> const & lhs,
+                              Matrix4x4Packet<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+    // lane access:
+    // =============================================================================
+
+    /// packet with every lane set to value
+    /// @relates Matrix4x4Packet
+    template <std::size_t N, typename T>
+    constexpr Matrix4x4Packet<T, N> broadcast(Matrix4x4<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// matrix of the given lane
+    /// @relates Matrix4x4Packet
+    template <typename T, std::size_t N>
+    constexpr Matrix4x4<T> get_lane(Matrix4x4Packet<T, N> const & value,
+                                    std::size_t const             lane) noexcept;
+
+    // =============================================================================
+
+    /// set the matrix of the given lane
+    /// @relates Matrix4x4Packet
+    template <typename T, std::size_t N>
+    constexpr void set_lane(Matrix4x4Packet<T, N> & values,
+                            std::size_t const       lane,
+                            Matrix4x4<T> const &    value) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// ggm::operator*
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(Vector4DPacket<T, N> const &  lhs,
+                                                   Matrix4x4Packet<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, get_lane(lhs, lane) * get_lane(rhs, lane));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(Vector4DPacket<T, N> const & lhs,
+                                                   Matrix4x4<T> const &         rhs) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, get_lane(lhs, lane) * rhs);
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(Matrix4x4Packet<T, N> const & lhs,
+                                                   Vector4DPacket<T, N> const &  rhs) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, get_lane(lhs, lane) * get_lane(rhs, lane));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(Matrix4x4<T> const &         lhs,
+                                                   Vector4DPacket<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, lhs * get_lane(rhs, lane));
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::operator==
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr bool ggm::operator==(Matrix4x4Packet<T, N> const & lhs,
+                               Matrix4x4Packet<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        if (get_lane(lhs, lane) != get_lane(rhs, lane))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// =============================================================================
+// ggm::operator!=
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr bool ggm::operator!=(Matrix4x4Packet<T, N> const & lhs,
+                               Matrix4x4Packet<T, N> const & rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+// =============================================================================
+// ggm::broadcast
+// =============================================================================
+
+template <std::size_t N, typename T>
+constexpr ggm::Matrix4x4Packet<T, N> ggm::broadcast(Matrix4x4<T> const & value) noexcept
+{
+    Matrix4x4Packet<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, value);
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::get_lane
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Matrix4x4<T> ggm::get_lane(Matrix4x4Packet<T, N> const & value,
+                                          std::size_t const             lane) noexcept
+{
+    assert(lane < N);
+
+    return Matrix4x4<T>{
+        value.m00[lane], value.m01[lane], value.m02[lane], value.m03[lane],
+        value.m10[lane], value.m11[lane], value.m12[lane], value.m13[lane],
+        value.m20[lane], value.m21[lane], value.m22[lane], value.m23[lane],
+        value.m30[lane], value.m31[lane], value.m32[lane], value.m33[lane],
+    };
+}
+
+// =============================================================================
+// ggm::set_lane
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr void ggm::set_lane(Matrix4x4Packet<T, N> & values,
+                             std::size_t const       lane,
+                             Matrix4x4<T> const &    value) noexcept
+{
+    assert(lane < N);
+
+    values.m00[lane] = value.m00;
+    values.m01[lane] = value.m01;
+    values.m02[lane] = value.m02;
+    values.m03[lane] = value.m03;
+    values.m10[lane] = value.m10;
+    values.m11[lane] = value.m11;
+    values.m12[lane] = value.m12;
+    values.m13[lane] = value.m13;
+    values.m20[lane] = value.m20;
+    values.m21[lane] = value.m21;
+    values.m22[lane] = value.m22;
+    values.m23[lane] = value.m23;
+    values.m30[lane] = value.m30;
+    values.m31[lane] = value.m31;
+    values.m32[lane] = value.m32;
+    values.m33[lane] = value.m33;
+}
+
+// =============================================================================
+
+#endif // GGM_MATRIX_PACKET_UTIL_H
@@ -0,0 +1,150 @@
+#pragma once
+#ifndef GGM_MATRIX_ROTATION_BATCH_H
+#define GGM_MATRIX_ROTATION_BATCH_H
+
+#include "ggm/Matrix/MatrixRotation.h"
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Vector/Vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+// =============================================================================
+/// @addtogroup MatrixRotation
+/// @{
+/// @details
+///
+/// Functions for creating rotation matrices from spans of angles, writing the results to an output
+/// span of the same size.
+///
+/// note: T is not deduced through the implicit conversion to std::span, so when passing containers
+/// specify it explicitly, e.g. rotation2D_from_angle<float>(angles, rotations)
+///
+/// functions:
+/// ----------
+///
+/// Syntax                                 | Description
+/// ------                                 | -----------
+/// rotation2D_from_angle(ss, ms)          | create a rotation matrix for each of the given rotation angles (radians)
+/// rotation3D_from_angle_axis(ss, vs, ms) | create a rotation matrix for each of the given rotation angles (radians) around the corresponding axis
+/// rotation3D_from_angle_axis_x(ss, ms)   | create a rotation matrix for each of the given rotation angles (radians) around the x-axis
+/// rotation3D_from_angle_axis_y(ss, ms)   | create a rotation matrix for each of the given rotation angles (radians) around the y-axis
+/// rotation3D_from_angle_axis_z(ss, ms)   | create a rotation matrix for each of the given rotation angles (radians) around the z-axis
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+
+    /// create a rotation matrix for each of the given rotation angles
+    template <typename T>
+    constexpr void rotation2D_from_angle(std::span<T const> const             angleRadians,
+                                         std::span<MatrixRotation2D<T>> const rotations) noexcept;
+
+    // =============================================================================
+
+    template <typename T>
+    constexpr void rotation3D_from_angle_axis(std::span<T const> const             angleRadians,
+                                              std::span<Vector3D<T> const> const   axes,
+                                              std::span<MatrixRotation3D<T>> const rotations) noexcept;
+
+    template <typename T>
+    constexpr void rotation3D_from_angle_axis_x(std::span<T const> const             angleRadians,
+                                                std::span<MatrixRotation3D<T>> const rotations) noexcept;
+
+    template <typename T>
+    constexpr void rotation3D_from_angle_axis_y(std::span<T const> const             angleRadians,
+                                                std::span<MatrixRotation3D<T>> const rotations) noexcept;
+
+    template <typename T>
+    constexpr void rotation3D_from_angle_axis_z(std::span<T const> const             angleRadians,
+                                                std::span<MatrixRotation3D<T>> const rotations) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::rotation2D_from_angle(std::span<T const> const             angleRadians,
+                                          std::span<MatrixRotation2D<T>> const rotations) noexcept
+{
+    assert(rotations.size() == angleRadians.size());
+
+    std::size_t const count = angleRadians.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rotations[i] = rotation2D_from_angle(angleRadians[i]);
+    }
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::rotation3D_from_angle_axis(std::span<T const> const             angleRadians,
+                                               std::span<Vector3D<T> const> const   axes,
+                                               std::span<MatrixRotation3D<T>> const rotations) noexcept
+{
+    assert(axes.size() == angleRadians.size());
+    assert(rotations.size() == angleRadians.size());
+
+    std::size_t const count = angleRadians.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rotations[i] = rotation3D_from_angle_axis(angleRadians[i], axes[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::rotation3D_from_angle_axis_x(std::span<T const> const             angleRadians,
+                                                 std::span<MatrixRotation3D<T>> const rotations) noexcept
+{
+    assert(rotations.size() == angleRadians.size());
+
+    std::size_t const count = angleRadians.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rotations[i] = rotation3D_from_angle_axis_x(angleRadians[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::rotation3D_from_angle_axis_y(std::span<T const> const             angleRadians,
+                                                 std::span<MatrixRotation3D<T>> const rotations) noexcept
+{
+    assert(rotations.size() == angleRadians.size());
+
+    std::size_t const count = angleRadians.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rotations[i] = rotation3D_from_angle_axis_y(angleRadians[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::rotation3D_from_angle_axis_z(std::span<T const> const             angleRadians,
+                                                 std::span<MatrixRotation3D<T>> const rotations) noexcept
+{
+    assert(rotations.size() == angleRadians.size());
+
+    std::size_t const count = angleRadians.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rotations[i] = rotation3D_from_angle_axis_z(angleRadians[i]);
+    }
+}
+
+// =============================================================================
+
+#endif // GGM_MATRIX_ROTATION_BATCH_H
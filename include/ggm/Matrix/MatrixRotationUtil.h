@@ -3,10 +3,12 @@
 #define GGM_MATRIX_ROTATION_UTIL_H
 
 #include "ggm/Matrix/MatrixRotation.h"
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Numeric/SinCos.h"
 #include "ggm/Vector/Vector.h"
 #include "ggm/Vector/VectorUtil.h"
 
-#include <cmath>
+#include <cassert>
 
 // =============================================================================
 /// @addtogroup MatrixRotation
@@ -15,6 +17,9 @@
 ///
 /// Functions for creating and manipulating rotation matrices.
 ///
+/// The sine & cosine of the angle are computed together with @ref sincos, so each function is
+/// constexpr and branch-free.
+///
 /// functions:
 /// ----------
 ///
@@ -38,7 +43,7 @@ namespace ggm
 
     /// create a rotation matrix with the given rotation angle
     template <typename T>
-    inline MatrixRotation2D<T> rotation2D_from_angle(T const & angleRadians) noexcept;
+    constexpr MatrixRotation2D<T> rotation2D_from_angle(T const & angleRadians) noexcept;
 
     // =============================================================================
 
@@ -57,17 +62,17 @@ namespace ggm
     // =============================================================================
 
     template <typename T>
-    inline MatrixRotation3D<T> rotation3D_from_angle_axis(T const &           angleRadians,
-                                                          Vector3D<T> const & axis) noexcept;
+    constexpr MatrixRotation3D<T> rotation3D_from_angle_axis(T const &           angleRadians,
+                                                             Vector3D<T> const & axis) noexcept;
 
     template <typename T>
-    inline MatrixRotation3D<T> rotation3D_from_angle_axis_x(T const & angleRadians) noexcept;
+    constexpr MatrixRotation3D<T> rotation3D_from_angle_axis_x(T const & angleRadians) noexcept;
 
     template <typename T>
-    inline MatrixRotation3D<T> rotation3D_from_angle_axis_y(T const & angleRadians) noexcept;
+    constexpr MatrixRotation3D<T> rotation3D_from_angle_axis_y(T const & angleRadians) noexcept;
 
     template <typename T>
-    inline MatrixRotation3D<T> rotation3D_from_angle_axis_z(T const & angleRadians) noexcept;
+    constexpr MatrixRotation3D<T> rotation3D_from_angle_axis_z(T const & angleRadians) noexcept;
 
     // =============================================================================
 } // namespace ggm
@@ -77,15 +82,17 @@ namespace ggm
 // =============================================================================
 
 template <typename T>
-inline ggm::MatrixRotation2D<T> ggm::rotation2D_from_angle(T const & angleRadians) noexcept
+constexpr ggm::MatrixRotation2D<T> ggm::rotation2D_from_angle(T const & angleRadians) noexcept
 {
-    T const c = std::cos(angleRadians);
-    T const s = std::sin(angleRadians);
+    SinCos<T> const sinCos = sincos(angleRadians);
+
+    T const c = sinCos.cos;
+    T const s = sinCos.sin;
 
     return MatrixRotation2D<T>{
         // clang-format off
-         c, s,
-        -s, c,
+        c, -s,
+        s,  c,
         // clang-format on
     };
 }
@@ -132,13 +139,15 @@ constexpr ggm::MatrixRotation2D<T> ggm::rotation2D_from_angle_270() noexcept
 // =============================================================================
 
 template <typename T>
-inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis(T const &           angleRadians,
-                                                                Vector3D<T> const & axis) noexcept
+constexpr ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis(T const &           angleRadians,
+                                                                   Vector3D<T> const & axis) noexcept
 {
     assert(is_normalized(axis));
 
-    T const c   = std::cos(angleRadians);
-    T const s   = std::sin(angleRadians);
+    SinCos<T> const sinCos = sincos(angleRadians);
+
+    T const c   = sinCos.cos;
+    T const s   = sinCos.sin;
     T const omc = T{ 1 } - c;
 
     T const x = axis.x;
@@ -168,10 +177,12 @@ inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis(T const &
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_x(T const & angleRadians) noexcept
+constexpr ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_x(T const & angleRadians) noexcept
 {
-    T const c = std::cos(angleRadians);
-    T const s = std::sin(angleRadians);
+    SinCos<T> const sinCos = sincos(angleRadians);
+
+    T const c = sinCos.cos;
+    T const s = sinCos.sin;
 
     return MatrixRotation3D<T>{
         // clang-format off
@@ -185,16 +196,18 @@ inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_x(T const & angl
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_y(T const & angleRadians) noexcept
+constexpr ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_y(T const & angleRadians) noexcept
 {
-    T const c = std::cos(angleRadians);
-    T const s = std::sin(angleRadians);
+    SinCos<T> const sinCos = sincos(angleRadians);
+
+    T const c = sinCos.cos;
+    T const s = sinCos.sin;
 
     return MatrixRotation3D<T>{
         // clang-format off
              c, T{ 0 },      s,
         T{ 0 }, T{ 1 }, T{ 0 },
-            -c, T{ 0 },      c,
+            -s, T{ 0 },      c,
         // clang-format on
     };
 }
@@ -202,10 +215,12 @@ inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_y(T const & angl
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_z(T const & angleRadians) noexcept
+constexpr ggm::MatrixRotation3D<T> ggm::rotation3D_from_angle_axis_z(T const & angleRadians) noexcept
 {
-    T const c = std::cos(angleRadians);
-    T const s = std::sin(angleRadians);
+    SinCos<T> const sinCos = sincos(angleRadians);
+
+    T const c = sinCos.cos;
+    T const s = sinCos.sin;
 
     return MatrixRotation3D<T>{
         // clang-format off
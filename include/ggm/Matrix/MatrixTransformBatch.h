@@ -0,0 +1,186 @@
+#pragma once
+#ifndef GGM_MATRIX_TRANSFORM_BATCH_H
+#define GGM_MATRIX_TRANSFORM_BATCH_H
+
+#include "ggm/Matrix/MatrixBatch.h"
+#include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Vector/Vector.h"
+
+#include <cstddef>
+#include <span>
+
+// =============================================================================
+/// @addtogroup MatrixTransform
+/// @{
+/// @details
+///
+/// Functions that apply a transform matrix to each element of a span, writing the results to an output span
+/// of the same size (which may be the same as the input span, i.e. in-place).
+///
+/// Like the Matrix4x4 functions in MatrixBatch.h, they also read the points from an interleaved vertex
+/// buffer, i.e. point i is the elements values[i * stride + 0, 1(, 2)], & take a BatchStore to write the
+/// results with streaming (non-temporal) stores. There is no transform_points_project, since w is always 1.
+///
+/// These are defined in the ggm library (rather than inline) & dispatch at runtime to the widest
+/// instruction set supported by the machine, see DispatchLevel.h.
+///
+/// functions:
+/// ----------
+///
+/// Syntax                              | Description
+/// ------                              | -----------
+/// transform_points(t, ps, qs)         | transform each point, i.e. qs[i] = t * Vector4D{ps[i], 1} (or t * Vector3D{ps[i], 1} for 2D)
+/// transform_points(t, vs, stride, qs) | transform each point of an interleaved vertex buffer
+/// transform_directions(t, ds, es)     | transform each direction, i.e. es[i] = t * Vector4D{ds[i], 0} (or t * Vector3D{ds[i], 0} for 2D)
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+
+    /// transform each point (i.e. including the translation), equivalent to results[i] = transform * Vector4D{points[i], 1}
+    /// @param[in]  transform The transform to apply
+    /// @param[in]  points    The source points
+    /// @param[out] results   The transformed points, must be the same size as points (or the same span, i.e. in-place)
+    /// @param[in]  store     How to write the results
+    /// @relates MatrixTransform3D
+    void transform_points(MatrixTransform3D<float> const &       transform,
+                          std::span<Vector3D<float> const> const points,
+                          std::span<Vector3D<float>> const       results,
+                          BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_points(MatrixTransform3D<double> const &       transform,
+                          std::span<Vector3D<double> const> const points,
+                          std::span<Vector3D<double>> const       results,
+                          BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each point, for the points of an interleaved vertex buffer
+    /// @param[in]  transform The transform to apply
+    /// @param[in]  values    The vertex buffer, point i is values[i * stride + 0, 1, 2]
+    /// @param[in]  stride    The number of elements from one point to the next, at least 3
+    /// @param[out] results   The transformed points, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates MatrixTransform3D
+    void transform_points(MatrixTransform3D<float> const & transform,
+                          std::span<float const> const     values,
+                          std::size_t const                stride,
+                          std::span<Vector3D<float>> const results,
+                          BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_points(MatrixTransform3D<double> const & transform,
+                          std::span<double const> const     values,
+                          std::size_t const                 stride,
+                          std::span<Vector3D<double>> const results,
+                          BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+
+    /// transform each direction (i.e. excluding the translation), equivalent to results[i] = transform * Vector4D{directions[i], 0}
+    /// @param[in]  transform  The transform to apply
+    /// @param[in]  directions The source directions
+    /// @param[out] results    The transformed directions, must be the same size as directions (or the same span, i.e. in-place)
+    /// @param[in]  store      How to write the results
+    /// @relates MatrixTransform3D
+    void transform_directions(MatrixTransform3D<float> const &       transform,
+                              std::span<Vector3D<float> const> const directions,
+                              std::span<Vector3D<float>> const       results,
+                              BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_directions(MatrixTransform3D<double> const &       transform,
+                              std::span<Vector3D<double> const> const directions,
+                              std::span<Vector3D<double>> const       results,
+                              BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each direction, for the directions of an interleaved vertex buffer
+    /// @param[in]  transform The transform to apply
+    /// @param[in]  values    The vertex buffer, direction i is values[i * stride + 0, 1, 2]
+    /// @param[in]  stride    The number of elements from one direction to the next, at least 3
+    /// @param[out] results   The transformed directions, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates MatrixTransform3D
+    void transform_directions(MatrixTransform3D<float> const & transform,
+                              std::span<float const> const     values,
+                              std::size_t const                stride,
+                              std::span<Vector3D<float>> const results,
+                              BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_directions(MatrixTransform3D<double> const & transform,
+                              std::span<double const> const     values,
+                              std::size_t const                 stride,
+                              std::span<Vector3D<double>> const results,
+                              BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+
+    /// transform each point (i.e. including the translation), equivalent to results[i] = transform * Vector3D{points[i], 1}
+    /// @param[in]  transform The transform to apply
+    /// @param[in]  points    The source points
+    /// @param[out] results   The transformed points, must be the same size as points (or the same span, i.e. in-place)
+    /// @param[in]  store     How to write the results
+    /// @relates MatrixTransform2D
+    void transform_points(MatrixTransform2D<float> const &       transform,
+                          std::span<Vector2D<float> const> const points,
+                          std::span<Vector2D<float>> const       results,
+                          BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_points(MatrixTransform2D<double> const &       transform,
+                          std::span<Vector2D<double> const> const points,
+                          std::span<Vector2D<double>> const       results,
+                          BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each point, for the points of an interleaved vertex buffer
+    /// @param[in]  transform The transform to apply
+    /// @param[in]  values    The vertex buffer, point i is values[i * stride + 0, 1]
+    /// @param[in]  stride    The number of elements from one point to the next, at least 2
+    /// @param[out] results   The transformed points, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates MatrixTransform2D
+    void transform_points(MatrixTransform2D<float> const & transform,
+                          std::span<float const> const     values,
+                          std::size_t const                stride,
+                          std::span<Vector2D<float>> const results,
+                          BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_points(MatrixTransform2D<double> const & transform,
+                          std::span<double const> const     values,
+                          std::size_t const                 stride,
+                          std::span<Vector2D<double>> const results,
+                          BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+
+    /// transform each direction (i.e. excluding the translation), equivalent to results[i] = transform * Vector3D{directions[i], 0}
+    /// @param[in]  transform  The transform to apply
+    /// @param[in]  directions The source directions
+    /// @param[out] results    The transformed directions, must be the same size as directions (or the same span, i.e. in-place)
+    /// @param[in]  store      How to write the results
+    /// @relates MatrixTransform2D
+    void transform_directions(MatrixTransform2D<float> const &       transform,
+                              std::span<Vector2D<float> const> const directions,
+                              std::span<Vector2D<float>> const       results,
+                              BatchStore const                       store = BatchStore::Cached) noexcept;
+    void transform_directions(MatrixTransform2D<double> const &       transform,
+                              std::span<Vector2D<double> const> const directions,
+                              std::span<Vector2D<double>> const       results,
+                              BatchStore const                        store = BatchStore::Cached) noexcept;
+
+    /// transform each direction, for the directions of an interleaved vertex buffer
+    /// @param[in]  transform The transform to apply
+    /// @param[in]  values    The vertex buffer, direction i is values[i * stride + 0, 1]
+    /// @param[in]  stride    The number of elements from one direction to the next, at least 2
+    /// @param[out] results   The transformed directions, must not overlap values
+    /// @param[in]  store     How to write the results
+    /// @relates MatrixTransform2D
+    void transform_directions(MatrixTransform2D<float> const & transform,
+                              std::span<float const> const     values,
+                              std::size_t const                stride,
+                              std::span<Vector2D<float>> const results,
+                              BatchStore const                 store = BatchStore::Cached) noexcept;
+    void transform_directions(MatrixTransform2D<double> const & transform,
+                              std::span<double const> const     values,
+                              std::size_t const                 stride,
+                              std::span<Vector2D<double>> const results,
+                              BatchStore const                  store = BatchStore::Cached) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_MATRIX_TRANSFORM_BATCH_H
@@ -0,0 +1,296 @@
+#pragma once
+#ifndef GGM_MATRIX_TRANSFORM_HIERARCHY_H
+#define GGM_MATRIX_TRANSFORM_HIERARCHY_H
+
+#include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtilSimd.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// =============================================================================
+/// @addtogroup MatrixTransform
+/// @{
+/// @details
+///
+/// Local-to-world propagation of transform hierarchies (e.g. skeletons & scene graphs), i.e. a local transform
+/// & a parent index per node, in topological order (each parent before its children), where
+/// world[i] = transform(world[parents[i]], locals[i]), or locals[i] for the roots (TransformHierarchy_NoParent).
+///
+/// The nodes of each level (i.e. depth) of the hierarchy only read the world transforms of the previous level,
+/// so make_transform_hierarchy_levels lists the nodes of each level (a serial counting sort, which can be reused
+/// while the parents don't change), & disjoint ranges of a level can be processed by separate threads (with
+/// the nodes overloads) without atomics or locks, as long as each level finishes before the next one starts.
+/// The results don't depend on the split, & are the same as the serial (topological order) overloads.
+///
+/// Each node is concatenated with transform_simd for float & double (& the generic transform otherwise), so
+/// every translation unit gets the same function regardless of what else it includes.
+///
+/// note: the nodes of a level aren't batched across SIMD lanes. Gathering the parents & locals of a level into
+/// packets & scattering the results costs as much as the generic transform itself (e.g. 41us with packets of 8
+/// vs 34us per node, for 4096 float nodes), while transform_simd per node takes ~15us, see
+/// BenchMatrixUtilSimd.cpp
+///
+/// Syntax                                            | Description
+/// ------                                            | -----------
+/// make_transform_hierarchy_levels(parents, levels)  | list the nodes of each level of the hierarchy
+/// world_transforms(locals, parents, ws)             | the world transform of each node (in topological order)
+/// world_transforms(locals, parents, ws, iws)        | the world transform & its inverse of each node
+/// world_transforms(locals, parents, nodes, ws)      | the world transforms of the given nodes of a level
+/// world_transforms(locals, parents, nodes, ws, iws) | the world transforms & their inverses of the given nodes of a level
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // TransformHierarchyLevels
+    // =============================================================================
+
+    /// The parent index of the root nodes of a transform hierarchy
+    constexpr std::uint32_t TransformHierarchy_NoParent = ~std::uint32_t{ 0 };
+
+    /// The nodes of each level of a transform hierarchy, see @ref make_transform_hierarchy_levels
+    /// @details
+    /// The nodes of level l are nodes[offsets[l]] to nodes[offsets[l + 1] - 1], in increasing order, where
+    /// level 0 are the roots & the parent of each node of level l + 1 is a node of level l.
+    struct TransformHierarchyLevels
+    {
+        // members:
+        std::vector<std::uint32_t> offsets; // level count + 1
+        std::vector<std::uint32_t> nodes;   // node count
+    };
+
+    // =============================================================================
+    // levels:
+    // =============================================================================
+
+    /// list the nodes of each level of the hierarchy
+    /// @param[in]  parents The parent of each node, less than the node (or TransformHierarchy_NoParent for roots)
+    /// @param[out] result  The nodes of each level
+    constexpr void make_transform_hierarchy_levels(std::span<std::uint32_t const> const parents,
+                                                   TransformHierarchyLevels &           result);
+
+    // =============================================================================
+    // world transforms:
+    // =============================================================================
+
+    /// the world transform of each node, i.e. results[i] = transform(results[parents[i]], locals[i]) (or
+    /// locals[i] for roots), in topological order
+    /// @param[in]  locals  The local transform of each node, relative to its parent
+    /// @param[in]  parents The parent of each node, less than the node (or TransformHierarchy_NoParent for roots)
+    /// @param[out] results The world transform of each node, must be the same size as locals
+    /// @relates MatrixTransform3D
+    template <typename T>
+    constexpr void world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                    std::span<std::uint32_t const> const        parents,
+                                    std::span<MatrixTransform3D<T>> const       results) noexcept;
+
+    /// the world transform & its inverse of each node, in topological order
+    /// @param[in]  locals         The local transform of each node, relative to its parent
+    /// @param[in]  parents        The parent of each node, less than the node (or TransformHierarchy_NoParent for roots)
+    /// @param[out] results        The world transform of each node, must be the same size as locals
+    /// @param[out] inverseResults The inverse of each world transform, must be the same size as locals
+    /// @relates MatrixTransform3D
+    template <typename T>
+    constexpr void world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                    std::span<std::uint32_t const> const        parents,
+                                    std::span<MatrixTransform3D<T>> const       results,
+                                    std::span<MatrixTransform3D<T>> const       inverseResults) noexcept;
+
+    /// the world transform of the given nodes of a level, which reads the world transforms of their parents
+    /// (i.e. of the previous level), so the previous levels must be complete
+    /// @param[in]  locals  The local transform of each node, relative to its parent
+    /// @param[in]  parents The parent of each node, less than the node (or TransformHierarchy_NoParent for roots)
+    /// @param[in]  nodes   The nodes to update, e.g. a range of the nodes of a level of @ref TransformHierarchyLevels
+    /// @param[out] results The world transform of each node (only results[nodes[i]] are written), must be the
+    ///                     same size as locals
+    /// @relates MatrixTransform3D
+    template <typename T>
+    constexpr void world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                    std::span<std::uint32_t const> const        parents,
+                                    std::span<std::uint32_t const> const        nodes,
+                                    std::span<MatrixTransform3D<T>> const       results) noexcept;
+
+    /// the world transform & its inverse of the given nodes of a level
+    /// @param[in]  locals         The local transform of each node, relative to its parent
+    /// @param[in]  parents        The parent of each node, less than the node (or TransformHierarchy_NoParent for roots)
+    /// @param[in]  nodes          The nodes to update, e.g. a range of the nodes of a level of @ref TransformHierarchyLevels
+    /// @param[out] results        The world transform of each node (only results[nodes[i]] are written), must be
+    ///                            the same size as locals
+    /// @param[out] inverseResults The inverse of each world transform (only inverseResults[nodes[i]] are written),
+    ///                            must be the same size as locals
+    /// @relates MatrixTransform3D
+    template <typename T>
+    constexpr void world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                    std::span<std::uint32_t const> const        parents,
+                                    std::span<std::uint32_t const> const        nodes,
+                                    std::span<MatrixTransform3D<T>> const       results,
+                                    std::span<MatrixTransform3D<T>> const       inverseResults) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::TransformHierarchyImpl
+{
+    // =============================================================================
+
+    /// the world transform of node from the (complete) world transform of its parent
+    template <typename T>
+    constexpr MatrixTransform3D<T> world_transform(std::span<MatrixTransform3D<T> const> const locals,
+                                                   std::span<std::uint32_t const> const        parents,
+                                                   std::span<MatrixTransform3D<T> const> const results,
+                                                   std::size_t const                           node) noexcept
+    {
+        std::uint32_t const parent = parents[node];
+        if (parent == TransformHierarchy_NoParent)
+        {
+            return locals[node];
+        }
+
+        assert(parent < node);
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            return transform_simd(results[parent], locals[node]);
+        }
+        else
+        {
+            return transform(results[parent], locals[node]);
+        }
+    }
+
+    // =============================================================================
+} // namespace ggm::TransformHierarchyImpl
+
+// =============================================================================
+// levels:
+// =============================================================================
+
+constexpr void ggm::make_transform_hierarchy_levels(std::span<std::uint32_t const> const parents,
+                                                    TransformHierarchyLevels &           result)
+{
+    // the level of each node is 1 more than its parent's (whose level is known, by the topological order)
+    std::size_t const          nodeCount = parents.size();
+    std::vector<std::uint32_t> levels(nodeCount);
+    std::uint32_t              levelCount = 0;
+    for (std::size_t node = 0; node < nodeCount; ++node)
+    {
+        std::uint32_t const parent = parents[node];
+        assert((parent == TransformHierarchy_NoParent) || (parent < node));
+
+        levels[node] = (parent == TransformHierarchy_NoParent) ? 0u : levels[parent] + 1u;
+        levelCount   = (levels[node] < levelCount) ? levelCount : levels[node] + 1u;
+    }
+
+    // count the nodes of each level, the offsets are the prefix sums of the counts
+    result.offsets.assign(levelCount + 1u, 0u);
+    for (std::uint32_t const level : levels)
+    {
+        ++result.offsets[level + 1u];
+    }
+
+    for (std::size_t level = 0; level < levelCount; ++level)
+    {
+        result.offsets[level + 1u] += result.offsets[level];
+    }
+
+    // note: fills each level's nodes in increasing order (via a running copy of the offsets), so neighboring
+    // nodes of a level are also close in memory
+    std::vector<std::uint32_t> next(result.offsets.begin(), result.offsets.end() - 1);
+    result.nodes.resize(nodeCount);
+
+    for (std::size_t node = 0; node < nodeCount; ++node)
+    {
+        result.nodes[next[levels[node]]++] = static_cast<std::uint32_t>(node);
+    }
+}
+
+// =============================================================================
+// world transforms:
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                     std::span<std::uint32_t const> const        parents,
+                                     std::span<MatrixTransform3D<T>> const       results) noexcept
+{
+    assert(parents.size() == locals.size());
+    assert(results.size() == locals.size());
+
+    std::size_t const count = locals.size();
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        results[node] = TransformHierarchyImpl::world_transform<T>(locals, parents, results, node);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                     std::span<std::uint32_t const> const        parents,
+                                     std::span<MatrixTransform3D<T>> const       results,
+                                     std::span<MatrixTransform3D<T>> const       inverseResults) noexcept
+{
+    assert(parents.size() == locals.size());
+    assert(results.size() == locals.size());
+    assert(inverseResults.size() == locals.size());
+
+    std::size_t const count = locals.size();
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        results[node]        = TransformHierarchyImpl::world_transform<T>(locals, parents, results, node);
+        inverseResults[node] = inverse(results[node]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                     std::span<std::uint32_t const> const        parents,
+                                     std::span<std::uint32_t const> const        nodes,
+                                     std::span<MatrixTransform3D<T>> const       results) noexcept
+{
+    assert(parents.size() == locals.size());
+    assert(results.size() == locals.size());
+
+    for (std::uint32_t const node : nodes)
+    {
+        results[node] = TransformHierarchyImpl::world_transform<T>(locals, parents, results, node);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::world_transforms(std::span<MatrixTransform3D<T> const> const locals,
+                                     std::span<std::uint32_t const> const        parents,
+                                     std::span<std::uint32_t const> const        nodes,
+                                     std::span<MatrixTransform3D<T>> const       results,
+                                     std::span<MatrixTransform3D<T>> const       inverseResults) noexcept
+{
+    assert(parents.size() == locals.size());
+    assert(results.size() == locals.size());
+    assert(inverseResults.size() == locals.size());
+
+    for (std::uint32_t const node : nodes)
+    {
+        results[node]        = TransformHierarchyImpl::world_transform<T>(locals, parents, results, node);
+        inverseResults[node] = inverse(results[node]);
+    }
+}
+
+// =============================================================================
+
+#endif // GGM_MATRIX_TRANSFORM_HIERARCHY_H
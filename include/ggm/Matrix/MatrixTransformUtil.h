@@ -9,6 +9,7 @@
 #include "ggm/Numeric/NumericUtil.h"
 #include "ggm/Vector/Vector.h"
 
+#include <cassert>
 #include <cmath>
 
 // =============================================================================
@@ -30,6 +31,8 @@
 /// b = is_invertible(t)                                      | true if matrix2x2|matrix3x3 submatrix can be inverted, i.e. determinant != 0
 /// b = is_orthogonal(t)                                      | true if matrix2x2|matrix3x3 submatrix rows and cols are orthonormal vectors
 /// t1 = inverse(t2)                                          | calculate inverse as if matrix3x3|matrix4x4
+/// t1 = inverse_rigid(t2)                                    | calculate inverse of a rotation & translation, i.e. transpose & negated rotated translation
+/// t1 = inverse_uniform_scale(t2)                            | calculate inverse of a uniform scale, rotation & translation
 /// t = transform2D_from_scale(s)                             | create a transform matrix with the given scale as the diagonal elements
 /// t = transform3D_from_scale(s)                             | create a transform matrix with the given scale as the diagonal elements
 /// t = transform2D_from_rotation(r)                          | create a transform matrix from the given rotation matrix
@@ -95,42 +98,80 @@ namespace ggm
     /// true if matrix2x2 submatrix can be inverted, i.e. determinant != 0
     /// @relates MatrixTransform2D
     template <typename T>
-    inline bool is_invertible(MatrixTransform2D<T> const & value,
-                              T const &                    epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_invertible(MatrixTransform2D<T> const & value,
+                                 T const &                    epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if matrix3x3 submatrix can be inverted, i.e. determinant != 0
     /// @relates MatrixTransform3D
     template <typename T>
-    inline bool is_invertible(MatrixTransform3D<T> const & value,
-                              T const &                    epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_invertible(MatrixTransform3D<T> const & value,
+                                 T const &                    epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
     /// true if matrix2x2 submatrix rows and cols are orthonormal vectors
     /// @relates MatrixTransform2D
     template <typename T>
-    inline bool is_orthogonal(MatrixTransform2D<T> const & value,
-                              T const &                    epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_orthogonal(MatrixTransform2D<T> const & value,
+                                 T const &                    epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if matrix3x3 submatrix rows and cols are orthonormal vectors
     /// @relates MatrixTransform3D
     template <typename T>
-    inline bool is_orthogonal(MatrixTransform3D<T> const & value,
-                              T const &                    epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_orthogonal(MatrixTransform3D<T> const & value,
+                                 T const &                    epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
     /// calculate inverse as if matrix3x3
     /// @relates MatrixTransform2D
     template <typename T>
-    inline MatrixTransform2D<T> inverse(MatrixTransform2D<T> const & value,
-                                        T const &                    epsilon = DefaultTolerance<T>) noexcept;
+    constexpr MatrixTransform2D<T> inverse(MatrixTransform2D<T> const & value,
+                                           T const &                    epsilon = DefaultTolerance<T>) noexcept;
 
     /// calculate inverse as if matrix4x4
     /// @relates MatrixTransform3D
     template <typename T>
-    inline MatrixTransform3D<T> inverse(MatrixTransform3D<T> const & value,
-                                        T const &                    epsilon = DefaultTolerance<T>) noexcept;
+    constexpr MatrixTransform3D<T> inverse(MatrixTransform3D<T> const & value,
+                                           T const &                    epsilon = DefaultTolerance<T>) noexcept;
+
+    // =============================================================================
+
+    /// calculate inverse of a rigid transform (rotation & translation), i.e. the transposed matrix2x2 submatrix
+    /// & the negated translation rotated by it
+    /// @details
+    /// value must be orthogonal (checked with is_orthogonal & epsilon when assertions are enabled)
+    /// @relates MatrixTransform2D
+    template <typename T>
+    constexpr MatrixTransform2D<T> inverse_rigid(MatrixTransform2D<T> const & value,
+                                                 T const &                    epsilon = DefaultTolerance<T>) noexcept;
+
+    /// calculate inverse of a rigid transform (rotation & translation), i.e. the transposed matrix3x3 submatrix
+    /// & the negated translation rotated by it
+    /// @details
+    /// value must be orthogonal (checked with is_orthogonal & epsilon when assertions are enabled)
+    /// @relates MatrixTransform3D
+    template <typename T>
+    constexpr MatrixTransform3D<T> inverse_rigid(MatrixTransform3D<T> const & value,
+                                                 T const &                    epsilon = DefaultTolerance<T>) noexcept;
+
+    /// calculate inverse of a uniform scale, rotation & translation, i.e. the transposed matrix2x2 submatrix
+    /// divided by scale^2 (the squared length of its rows) & the negated translation transformed by it
+    /// @details
+    /// value divided by its scale must be orthogonal (checked with is_orthogonal & epsilon when assertions are enabled)
+    /// @relates MatrixTransform2D
+    template <typename T>
+    constexpr MatrixTransform2D<T> inverse_uniform_scale(MatrixTransform2D<T> const & value,
+                                                         T const &                    epsilon = DefaultTolerance<T>) noexcept;
+
+    /// calculate inverse of a uniform scale, rotation & translation, i.e. the transposed matrix3x3 submatrix
+    /// divided by scale^2 (the squared length of its rows) & the negated translation transformed by it
+    /// @details
+    /// value divided by its scale must be orthogonal (checked with is_orthogonal & epsilon when assertions are enabled)
+    /// @relates MatrixTransform3D
+    template <typename T>
+    constexpr MatrixTransform3D<T> inverse_uniform_scale(MatrixTransform3D<T> const & value,
+                                                         T const &                    epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
@@ -247,13 +288,13 @@ constexpr ggm::MatrixTransform2D<T> ggm::transform(MatrixTransform2D<T> const &
 
     return MatrixTransform2D<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + lhs.m02,
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12) + lhs.m02,
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + lhs.m12,
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12) + lhs.m12,
     };
 }
 
@@ -277,20 +318,20 @@ constexpr ggm::MatrixTransform3D<T> ggm::transform(MatrixTransform3D<T> const &
 
     return MatrixTransform3D<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23) + lhs.m03,
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23) + lhs.m03,
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23) + lhs.m13,
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23) + lhs.m13,
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23) + lhs.m23,
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13, lhs.m22, rhs.m23) + lhs.m23,
     };
 }
 
@@ -332,7 +373,7 @@ constexpr T ggm::determinant(MatrixTransform2D<T> const & value) noexcept
     // | m10 m11 m12 | == | m10 m11 |
     // |  0   0   1  |
 
-    return value.m00 * value.m11 - value.m01 * value.m10;
+    return sum_of_products(value.m00, value.m11, value.m01, -value.m10);
 }
 
 // -----------------------------------------------------------------------------
@@ -345,20 +386,20 @@ constexpr T ggm::determinant(MatrixTransform3D<T> const & value) noexcept
     // | m20 m21 m22 m23 |     | m20 m21 m22 |
     // |  0   0   0   1  |
 
-    T const detMinor00 = value.m11 * value.m22 - value.m12 * value.m21;
-    T const detMinor01 = value.m10 * value.m22 - value.m12 * value.m20;
-    T const detMinor02 = value.m11 * value.m21 - value.m11 * value.m20;
+    T const detMinor00 = sum_of_products(value.m11, value.m22, value.m12, -value.m21);
+    T const detMinor01 = sum_of_products(value.m10, value.m22, value.m12, -value.m20);
+    T const detMinor02 = sum_of_products(value.m10, value.m21, value.m11, -value.m20);
 
-    return value.m00 * detMinor00 -
-           value.m01 * detMinor01 +
-           value.m02 * detMinor02;
+    return sum_of_products(value.m00, detMinor00,
+                           value.m01, -detMinor01,
+                           value.m02, detMinor02);
 }
 
 // =============================================================================
 
 template <typename T>
-inline bool ggm::is_invertible(MatrixTransform2D<T> const & value,
-                               T const &                    epsilon) noexcept
+constexpr bool ggm::is_invertible(MatrixTransform2D<T> const & value,
+                                  T const &                    epsilon) noexcept
 {
     return !is_close(determinant(value), T{ 0 }, epsilon);
 }
@@ -366,8 +407,8 @@ inline bool ggm::is_invertible(MatrixTransform2D<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_invertible(MatrixTransform3D<T> const & value,
-                               T const &                    epsilon) noexcept
+constexpr bool ggm::is_invertible(MatrixTransform3D<T> const & value,
+                                  T const &                    epsilon) noexcept
 {
     return !is_close(determinant(value), T{ 0 }, epsilon);
 }
@@ -375,8 +416,8 @@ inline bool ggm::is_invertible(MatrixTransform3D<T> const & value,
 // =============================================================================
 
 template <typename T>
-inline bool ggm::is_orthogonal(MatrixTransform2D<T> const & value,
-                               T const &                    epsilon) noexcept
+constexpr bool ggm::is_orthogonal(MatrixTransform2D<T> const & value,
+                                  T const &                    epsilon) noexcept
 {
     // check if value * transpose(value) == identity:
     //
@@ -396,8 +437,8 @@ inline bool ggm::is_orthogonal(MatrixTransform2D<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_orthogonal(MatrixTransform3D<T> const & value,
-                               T const &                    epsilon) noexcept
+constexpr bool ggm::is_orthogonal(MatrixTransform3D<T> const & value,
+                                  T const &                    epsilon) noexcept
 {
     // check if value * transpose(value) == identity:
     //
@@ -429,13 +470,13 @@ inline bool ggm::is_orthogonal(MatrixTransform3D<T> const & value,
 // =============================================================================
 
 template <typename T>
-inline ggm::MatrixTransform2D<T> ggm::inverse(MatrixTransform2D<T> const & value,
-                                              T const &                    epsilon) noexcept
+constexpr ggm::MatrixTransform2D<T> ggm::inverse(MatrixTransform2D<T> const & value,
+                                                 T const &                    epsilon) noexcept
 {
-    T const detMinor20 = value.m01 * value.m12 - value.m02 * value.m11;
-    T const detMinor21 = value.m00 * value.m12 - value.m02 * value.m10;
+    T const detMinor20 = sum_of_products(value.m01, value.m12, value.m02, -value.m11);
+    T const detMinor21 = sum_of_products(value.m00, value.m12, value.m02, -value.m10);
 
-    T const det = value.m00 * value.m11 - value.m01 * value.m10;
+    T const det = sum_of_products(value.m00, value.m11, value.m01, -value.m10);
 
     T const invDet = reciprocal(det, T{ 0 }, epsilon);
 
@@ -452,32 +493,32 @@ inline ggm::MatrixTransform2D<T> ggm::inverse(MatrixTransform2D<T> const & value
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::MatrixTransform3D<T> ggm::inverse(MatrixTransform3D<T> const & value,
-                                              T const &                    epsilon) noexcept
+constexpr ggm::MatrixTransform3D<T> ggm::inverse(MatrixTransform3D<T> const & value,
+                                                 T const &                    epsilon) noexcept
 {
-    T const detSubMinor07 = value.m02 * value.m13 - value.m03 * value.m12;
-    T const detSubMinor08 = value.m01 * value.m13 - value.m03 * value.m11;
-    T const detSubMinor09 = value.m01 * value.m12 - value.m02 * value.m11;
-    T const detSubMinor10 = value.m00 * value.m13 - value.m03 * value.m10;
-    T const detSubMinor11 = value.m00 * value.m12 - value.m02 * value.m10;
-    T const detSubMinor12 = value.m00 * value.m11 - value.m01 * value.m10;
-
-    T const detMinor00 = value.m11 * value.m22 - value.m12 * value.m21;
-    T const detMinor01 = value.m10 * value.m22 - value.m12 * value.m20;
-    T const detMinor02 = value.m10 * value.m21 - value.m11 * value.m20;
-    T const detMinor10 = value.m01 * value.m22 - value.m02 * value.m21;
-    T const detMinor11 = value.m00 * value.m22 - value.m02 * value.m20;
-    T const detMinor12 = value.m00 * value.m21 - value.m01 * value.m20;
+    T const detSubMinor07 = sum_of_products(value.m02, value.m13, value.m03, -value.m12);
+    T const detSubMinor08 = sum_of_products(value.m01, value.m13, value.m03, -value.m11);
+    T const detSubMinor09 = sum_of_products(value.m01, value.m12, value.m02, -value.m11);
+    T const detSubMinor10 = sum_of_products(value.m00, value.m13, value.m03, -value.m10);
+    T const detSubMinor11 = sum_of_products(value.m00, value.m12, value.m02, -value.m10);
+    T const detSubMinor12 = sum_of_products(value.m00, value.m11, value.m01, -value.m10);
+
+    T const detMinor00 = sum_of_products(value.m11, value.m22, value.m12, -value.m21);
+    T const detMinor01 = sum_of_products(value.m10, value.m22, value.m12, -value.m20);
+    T const detMinor02 = sum_of_products(value.m10, value.m21, value.m11, -value.m20);
+    T const detMinor10 = sum_of_products(value.m01, value.m22, value.m02, -value.m21);
+    T const detMinor11 = sum_of_products(value.m00, value.m22, value.m02, -value.m20);
+    T const detMinor12 = sum_of_products(value.m00, value.m21, value.m01, -value.m20);
     T const detMinor20 = detSubMinor09;
     T const detMinor21 = detSubMinor11;
     T const detMinor22 = detSubMinor12;
-    T const detMinor30 = value.m21 * detSubMinor07 - value.m22 * detSubMinor08 + value.m23 * detSubMinor09;
-    T const detMinor31 = value.m20 * detSubMinor07 - value.m22 * detSubMinor10 + value.m23 * detSubMinor11;
-    T const detMinor32 = value.m20 * detSubMinor08 - value.m21 * detSubMinor10 + value.m23 * detSubMinor12;
+    T const detMinor30 = sum_of_products(value.m21, detSubMinor07, value.m22, -detSubMinor08, value.m23, detSubMinor09);
+    T const detMinor31 = sum_of_products(value.m20, detSubMinor07, value.m22, -detSubMinor10, value.m23, detSubMinor11);
+    T const detMinor32 = sum_of_products(value.m20, detSubMinor08, value.m21, -detSubMinor10, value.m23, detSubMinor12);
 
-    T const det = value.m00 * detMinor00 -
-                  value.m01 * detMinor01 +
-                  value.m02 * detMinor02;
+    T const det = sum_of_products(value.m00, detMinor00,
+                                  value.m01, -detMinor01,
+                                  value.m02, detMinor02);
 
     T const invDet = reciprocal(det, T{ 0 }, epsilon);
 
@@ -499,6 +540,121 @@ inline ggm::MatrixTransform3D<T> ggm::inverse(MatrixTransform3D<T> const & value
 
 // =============================================================================
 
+template <typename T>
+constexpr ggm::MatrixTransform2D<T> ggm::inverse_rigid(MatrixTransform2D<T> const & value,
+                                                       T const &                    epsilon) noexcept
+{
+    assert(is_orthogonal(value, epsilon));
+    static_cast<void>(epsilon);
+
+    // { R  t }^-1 == { R^T  -R^T * t }
+
+    return MatrixTransform2D<T>{
+        /*.m00 = */ value.m00,
+        /*.m01 = */ value.m10,
+        /*.m02 = */ -sum_of_products(value.m00, value.m02, value.m10, value.m12),
+        /*.m10 = */ value.m01,
+        /*.m11 = */ value.m11,
+        /*.m12 = */ -sum_of_products(value.m01, value.m02, value.m11, value.m12),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::MatrixTransform3D<T> ggm::inverse_rigid(MatrixTransform3D<T> const & value,
+                                                       T const &                    epsilon) noexcept
+{
+    assert(is_orthogonal(value, epsilon));
+    static_cast<void>(epsilon);
+
+    // { R  t }^-1 == { R^T  -R^T * t }
+
+    return MatrixTransform3D<T>{
+        /*.m00 = */ value.m00,
+        /*.m01 = */ value.m10,
+        /*.m02 = */ value.m20,
+        /*.m03 = */ -sum_of_products(value.m00, value.m03, value.m10, value.m13, value.m20, value.m23),
+        /*.m10 = */ value.m01,
+        /*.m11 = */ value.m11,
+        /*.m12 = */ value.m21,
+        /*.m13 = */ -sum_of_products(value.m01, value.m03, value.m11, value.m13, value.m21, value.m23),
+        /*.m20 = */ value.m02,
+        /*.m21 = */ value.m12,
+        /*.m22 = */ value.m22,
+        /*.m23 = */ -sum_of_products(value.m02, value.m03, value.m12, value.m13, value.m22, value.m23),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::MatrixTransform2D<T> ggm::inverse_uniform_scale(MatrixTransform2D<T> const & value,
+                                                               T const &                    epsilon) noexcept
+{
+    // { s * R  t }^-1 == { R^T / s  -R^T / s * t }, where R^T / s == (s * R)^T / s^2
+
+    T const scaleSquared = sum_of_products(value.m00, value.m00, value.m01, value.m01);
+    T const invScaleSq   = reciprocal(scaleSquared, T{ 0 }, epsilon);
+
+    assert(is_orthogonal(transform(transform2D_from_scale(reciprocal_sqrt(scaleSquared)), value), epsilon));
+
+    T const m00 = value.m00 * invScaleSq;
+    T const m01 = value.m10 * invScaleSq;
+    T const m10 = value.m01 * invScaleSq;
+    T const m11 = value.m11 * invScaleSq;
+
+    return MatrixTransform2D<T>{
+        /*.m00 = */ m00,
+        /*.m01 = */ m01,
+        /*.m02 = */ -sum_of_products(m00, value.m02, m01, value.m12),
+        /*.m10 = */ m10,
+        /*.m11 = */ m11,
+        /*.m12 = */ -sum_of_products(m10, value.m02, m11, value.m12),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::MatrixTransform3D<T> ggm::inverse_uniform_scale(MatrixTransform3D<T> const & value,
+                                                               T const &                    epsilon) noexcept
+{
+    // { s * R  t }^-1 == { R^T / s  -R^T / s * t }, where R^T / s == (s * R)^T / s^2
+
+    T const scaleSquared = sum_of_products(value.m00, value.m00, value.m01, value.m01, value.m02, value.m02);
+    T const invScaleSq   = reciprocal(scaleSquared, T{ 0 }, epsilon);
+
+    assert(is_orthogonal(transform(transform3D_from_scale(reciprocal_sqrt(scaleSquared)), value), epsilon));
+
+    T const m00 = value.m00 * invScaleSq;
+    T const m01 = value.m10 * invScaleSq;
+    T const m02 = value.m20 * invScaleSq;
+    T const m10 = value.m01 * invScaleSq;
+    T const m11 = value.m11 * invScaleSq;
+    T const m12 = value.m21 * invScaleSq;
+    T const m20 = value.m02 * invScaleSq;
+    T const m21 = value.m12 * invScaleSq;
+    T const m22 = value.m22 * invScaleSq;
+
+    return MatrixTransform3D<T>{
+        /*.m00 = */ m00,
+        /*.m01 = */ m01,
+        /*.m02 = */ m02,
+        /*.m03 = */ -sum_of_products(m00, value.m03, m01, value.m13, m02, value.m23),
+        /*.m10 = */ m10,
+        /*.m11 = */ m11,
+        /*.m12 = */ m12,
+        /*.m13 = */ -sum_of_products(m10, value.m03, m11, value.m13, m12, value.m23),
+        /*.m20 = */ m20,
+        /*.m21 = */ m21,
+        /*.m22 = */ m22,
+        /*.m23 = */ -sum_of_products(m20, value.m03, m21, value.m13, m22, value.m23),
+    };
+}
+
+// =============================================================================
+
 template <typename T>
 constexpr ggm::MatrixTransform2D<T> ggm::transform2D_from_scale(T const & scale) noexcept
 {
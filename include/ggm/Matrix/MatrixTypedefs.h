@@ -3,6 +3,7 @@
 #define GGM_MATRIX_TYPEDEFS_H
 
 #include "ggm/Matrix/MatrixFwd.h"
+#include "ggm/Numeric/Half.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -24,6 +25,7 @@ namespace ggm
     typedef Matrix1x1<unsigned long>      Matrix1x1lu;
     typedef Matrix1x1<long long>          Matrix1x1lli;
     typedef Matrix1x1<unsigned long long> Matrix1x1llu;
+    typedef Matrix1x1<half>               Matrix1x1h;
     typedef Matrix1x1<float>              Matrix1x1f;
     typedef Matrix1x1<double>             Matrix1x1lf;
     typedef Matrix1x1<long double>        Matrix1x1Lf;
@@ -50,6 +52,7 @@ namespace ggm
     typedef Matrix1x2<unsigned long>      Matrix1x2lu;
     typedef Matrix1x2<long long>          Matrix1x2lli;
     typedef Matrix1x2<unsigned long long> Matrix1x2llu;
+    typedef Matrix1x2<half>               Matrix1x2h;
     typedef Matrix1x2<float>              Matrix1x2f;
     typedef Matrix1x2<double>             Matrix1x2lf;
     typedef Matrix1x2<long double>        Matrix1x2Lf;
@@ -76,6 +79,7 @@ namespace ggm
     typedef Matrix1x3<unsigned long>      Matrix1x3lu;
     typedef Matrix1x3<long long>          Matrix1x3lli;
     typedef Matrix1x3<unsigned long long> Matrix1x3llu;
+    typedef Matrix1x3<half>               Matrix1x3h;
     typedef Matrix1x3<float>              Matrix1x3f;
     typedef Matrix1x3<double>             Matrix1x3lf;
     typedef Matrix1x3<long double>        Matrix1x3Lf;
@@ -102,6 +106,7 @@ namespace ggm
     typedef Matrix1x4<unsigned long>      Matrix1x4lu;
     typedef Matrix1x4<long long>          Matrix1x4lli;
     typedef Matrix1x4<unsigned long long> Matrix1x4llu;
+    typedef Matrix1x4<half>               Matrix1x4h;
     typedef Matrix1x4<float>              Matrix1x4f;
     typedef Matrix1x4<double>             Matrix1x4lf;
     typedef Matrix1x4<long double>        Matrix1x4Lf;
@@ -128,6 +133,7 @@ namespace ggm
     typedef Matrix2x1<unsigned long>      Matrix2x1lu;
     typedef Matrix2x1<long long>          Matrix2x1lli;
     typedef Matrix2x1<unsigned long long> Matrix2x1llu;
+    typedef Matrix2x1<half>               Matrix2x1h;
     typedef Matrix2x1<float>              Matrix2x1f;
     typedef Matrix2x1<double>             Matrix2x1lf;
     typedef Matrix2x1<long double>        Matrix2x1Lf;
@@ -154,6 +160,7 @@ namespace ggm
     typedef Matrix2x2<unsigned long>      Matrix2x2lu;
     typedef Matrix2x2<long long>          Matrix2x2lli;
     typedef Matrix2x2<unsigned long long> Matrix2x2llu;
+    typedef Matrix2x2<half>               Matrix2x2h;
     typedef Matrix2x2<float>              Matrix2x2f;
     typedef Matrix2x2<double>             Matrix2x2lf;
     typedef Matrix2x2<long double>        Matrix2x2Lf;
@@ -180,6 +187,7 @@ namespace ggm
     typedef Matrix2x3<unsigned long>      Matrix2x3lu;
     typedef Matrix2x3<long long>          Matrix2x3lli;
     typedef Matrix2x3<unsigned long long> Matrix2x3llu;
+    typedef Matrix2x3<half>               Matrix2x3h;
     typedef Matrix2x3<float>              Matrix2x3f;
     typedef Matrix2x3<double>             Matrix2x3lf;
     typedef Matrix2x3<long double>        Matrix2x3Lf;
@@ -206,6 +214,7 @@ namespace ggm
     typedef Matrix2x4<unsigned long>      Matrix2x4lu;
     typedef Matrix2x4<long long>          Matrix2x4lli;
     typedef Matrix2x4<unsigned long long> Matrix2x4llu;
+    typedef Matrix2x4<half>               Matrix2x4h;
     typedef Matrix2x4<float>              Matrix2x4f;
     typedef Matrix2x4<double>             Matrix2x4lf;
     typedef Matrix2x4<long double>        Matrix2x4Lf;
@@ -232,6 +241,7 @@ namespace ggm
     typedef Matrix3x1<unsigned long>      Matrix3x1lu;
     typedef Matrix3x1<long long>          Matrix3x1lli;
     typedef Matrix3x1<unsigned long long> Matrix3x1llu;
+    typedef Matrix3x1<half>               Matrix3x1h;
     typedef Matrix3x1<float>              Matrix3x1f;
     typedef Matrix3x1<double>             Matrix3x1lf;
     typedef Matrix3x1<long double>        Matrix3x1Lf;
@@ -258,6 +268,7 @@ namespace ggm
     typedef Matrix3x2<unsigned long>      Matrix3x2lu;
     typedef Matrix3x2<long long>          Matrix3x2lli;
     typedef Matrix3x2<unsigned long long> Matrix3x2llu;
+    typedef Matrix3x2<half>               Matrix3x2h;
     typedef Matrix3x2<float>              Matrix3x2f;
     typedef Matrix3x2<double>             Matrix3x2lf;
     typedef Matrix3x2<long double>        Matrix3x2Lf;
@@ -284,6 +295,7 @@ namespace ggm
     typedef Matrix3x3<unsigned long>      Matrix3x3lu;
     typedef Matrix3x3<long long>          Matrix3x3lli;
     typedef Matrix3x3<unsigned long long> Matrix3x3llu;
+    typedef Matrix3x3<half>               Matrix3x3h;
     typedef Matrix3x3<float>              Matrix3x3f;
     typedef Matrix3x3<double>             Matrix3x3lf;
     typedef Matrix3x3<long double>        Matrix3x3Lf;
@@ -310,6 +322,7 @@ namespace ggm
     typedef Matrix3x4<unsigned long>      Matrix3x4lu;
     typedef Matrix3x4<long long>          Matrix3x4lli;
     typedef Matrix3x4<unsigned long long> Matrix3x4llu;
+    typedef Matrix3x4<half>               Matrix3x4h;
     typedef Matrix3x4<float>              Matrix3x4f;
     typedef Matrix3x4<double>             Matrix3x4lf;
     typedef Matrix3x4<long double>        Matrix3x4Lf;
@@ -336,6 +349,7 @@ namespace ggm
     typedef Matrix4x1<unsigned long>      Matrix4x1lu;
     typedef Matrix4x1<long long>          Matrix4x1lli;
     typedef Matrix4x1<unsigned long long> Matrix4x1llu;
+    typedef Matrix4x1<half>               Matrix4x1h;
     typedef Matrix4x1<float>              Matrix4x1f;
     typedef Matrix4x1<double>             Matrix4x1lf;
     typedef Matrix4x1<long double>        Matrix4x1Lf;
@@ -362,6 +376,7 @@ namespace ggm
     typedef Matrix4x2<unsigned long>      Matrix4x2lu;
     typedef Matrix4x2<long long>          Matrix4x2lli;
     typedef Matrix4x2<unsigned long long> Matrix4x2llu;
+    typedef Matrix4x2<half>               Matrix4x2h;
     typedef Matrix4x2<float>              Matrix4x2f;
     typedef Matrix4x2<double>             Matrix4x2lf;
     typedef Matrix4x2<long double>        Matrix4x2Lf;
@@ -388,6 +403,7 @@ namespace ggm
     typedef Matrix4x3<unsigned long>      Matrix4x3lu;
     typedef Matrix4x3<long long>          Matrix4x3lli;
     typedef Matrix4x3<unsigned long long> Matrix4x3llu;
+    typedef Matrix4x3<half>               Matrix4x3h;
     typedef Matrix4x3<float>              Matrix4x3f;
     typedef Matrix4x3<double>             Matrix4x3lf;
     typedef Matrix4x3<long double>        Matrix4x3Lf;
@@ -414,6 +430,7 @@ namespace ggm
     typedef Matrix4x4<unsigned long>      Matrix4x4lu;
     typedef Matrix4x4<long long>          Matrix4x4lli;
     typedef Matrix4x4<unsigned long long> Matrix4x4llu;
+    typedef Matrix4x4<half>               Matrix4x4h;
     typedef Matrix4x4<float>              Matrix4x4f;
     typedef Matrix4x4<double>             Matrix4x4lf;
     typedef Matrix4x4<long double>        Matrix4x4Lf;
@@ -76,6 +76,7 @@
 /// m = matrix_from_rows(r0, ..., rN)            | create a matrix from the given row vectors
 /// m1 = matrix_drop_col<C>(m2)                  | create a submatrix by removing the specified col
 /// m1 = matrix_drop_row<R>(m2)                  | create a submatrix by removing the specified row
+/// m1 = select(b, m2, m3)                       | element-wise select, i.e. b ? m2 : m3 (branch-free)
 ///
 /// comparisons:
 /// ------------
@@ -86,6 +87,7 @@
 /// b = any_of(m);                | true if any bool elements are true
 /// b = none_of(m);               | true if all bool elements are false
 /// b = is_close(m1, m2);         | element-wise is_close
+/// b = is_close_ulps(m1, m2);    | element-wise is_close_ulps
 /// b = is_equal(m1, m2);         | element-wise ==
 /// b = is_greater(m1, m2);       | element-wise >
 /// b = is_greater_equal(m1, m2); | element-wise >=
@@ -1943,78 +1945,78 @@ namespace ggm
     /// true if square matrix can be inverted, i.e. determinant != 0
     /// @relates Matrix1x1
     template <typename T>
-    inline bool is_invertible(Matrix1x1<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_invertible(Matrix1x1<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if square matrix can be inverted, i.e. determinant != 0
     /// @relates Matrix2x2
     template <typename T>
-    inline bool is_invertible(Matrix2x2<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_invertible(Matrix2x2<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if square matrix can be inverted, i.e. determinant != 0
     /// @relates Matrix3x3
     template <typename T>
-    inline bool is_invertible(Matrix3x3<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_invertible(Matrix3x3<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if square matrix can be inverted, i.e. determinant != 0
     /// @relates Matrix4x4
     template <typename T>
-    inline bool is_invertible(Matrix4x4<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_invertible(Matrix4x4<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
     /// true if square matrix rows and cols are orthonormal vectors
     /// @relates Matrix1x1
     template <typename T>
-    inline bool is_orthogonal(Matrix1x1<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_orthogonal(Matrix1x1<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if square matrix rows and cols are orthonormal vectors
     /// @relates Matrix2x2
     template <typename T>
-    inline bool is_orthogonal(Matrix2x2<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_orthogonal(Matrix2x2<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if square matrix rows and cols are orthonormal vectors
     /// @relates Matrix3x3
     template <typename T>
-    inline bool is_orthogonal(Matrix3x3<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_orthogonal(Matrix3x3<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if square matrix rows and cols are orthonormal vectors
     /// @relates Matrix4x4
     template <typename T>
-    inline bool is_orthogonal(Matrix4x4<T> const & value,
-                              T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_orthogonal(Matrix4x4<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
     /// calculate inverse of square matrix
     /// @relates Matrix1x1
     template <typename T>
-    inline Matrix1x1<T> inverse(Matrix1x1<T> const & value,
-                                T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix1x1<T> inverse(Matrix1x1<T> const & value,
+                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// calculate inverse of square matrix
     /// @relates Matrix2x2
     template <typename T>
-    inline Matrix2x2<T> inverse(Matrix2x2<T> const & value,
-                                T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix2x2<T> inverse(Matrix2x2<T> const & value,
+                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// calculate inverse of square matrix
     /// @relates Matrix3x3
     template <typename T>
-    inline Matrix3x3<T> inverse(Matrix3x3<T> const & value,
-                                T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix3x3<T> inverse(Matrix3x3<T> const & value,
+                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// calculate inverse of square matrix
     /// @relates Matrix4x4
     template <typename T>
-    inline Matrix4x4<T> inverse(Matrix4x4<T> const & value,
-                                T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix4x4<T> inverse(Matrix4x4<T> const & value,
+                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
     /// return the transpose of the matrix
@@ -2495,6 +2497,120 @@ namespace ggm
               typename T>
     constexpr Matrix3x4<T> matrix_drop_row(Matrix4x4<T> const & value) noexcept;
 
+    // =============================================================================
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix1x1
+    template <typename T>
+    constexpr Matrix1x1<T> select(Matrix1x1<bool> const & mask,
+                                  Matrix1x1<T> const &    lhs,
+                                  Matrix1x1<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix1x2
+    template <typename T>
+    constexpr Matrix1x2<T> select(Matrix1x2<bool> const & mask,
+                                  Matrix1x2<T> const &    lhs,
+                                  Matrix1x2<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix1x3
+    template <typename T>
+    constexpr Matrix1x3<T> select(Matrix1x3<bool> const & mask,
+                                  Matrix1x3<T> const &    lhs,
+                                  Matrix1x3<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix1x4
+    template <typename T>
+    constexpr Matrix1x4<T> select(Matrix1x4<bool> const & mask,
+                                  Matrix1x4<T> const &    lhs,
+                                  Matrix1x4<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix2x1
+    template <typename T>
+    constexpr Matrix2x1<T> select(Matrix2x1<bool> const & mask,
+                                  Matrix2x1<T> const &    lhs,
+                                  Matrix2x1<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix2x2
+    template <typename T>
+    constexpr Matrix2x2<T> select(Matrix2x2<bool> const & mask,
+                                  Matrix2x2<T> const &    lhs,
+                                  Matrix2x2<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix2x3
+    template <typename T>
+    constexpr Matrix2x3<T> select(Matrix2x3<bool> const & mask,
+                                  Matrix2x3<T> const &    lhs,
+                                  Matrix2x3<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix2x4
+    template <typename T>
+    constexpr Matrix2x4<T> select(Matrix2x4<bool> const & mask,
+                                  Matrix2x4<T> const &    lhs,
+                                  Matrix2x4<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix3x1
+    template <typename T>
+    constexpr Matrix3x1<T> select(Matrix3x1<bool> const & mask,
+                                  Matrix3x1<T> const &    lhs,
+                                  Matrix3x1<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix3x2
+    template <typename T>
+    constexpr Matrix3x2<T> select(Matrix3x2<bool> const & mask,
+                                  Matrix3x2<T> const &    lhs,
+                                  Matrix3x2<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix3x3
+    template <typename T>
+    constexpr Matrix3x3<T> select(Matrix3x3<bool> const & mask,
+                                  Matrix3x3<T> const &    lhs,
+                                  Matrix3x3<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix3x4
+    template <typename T>
+    constexpr Matrix3x4<T> select(Matrix3x4<bool> const & mask,
+                                  Matrix3x4<T> const &    lhs,
+                                  Matrix3x4<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix4x1
+    template <typename T>
+    constexpr Matrix4x1<T> select(Matrix4x1<bool> const & mask,
+                                  Matrix4x1<T> const &    lhs,
+                                  Matrix4x1<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix4x2
+    template <typename T>
+    constexpr Matrix4x2<T> select(Matrix4x2<bool> const & mask,
+                                  Matrix4x2<T> const &    lhs,
+                                  Matrix4x2<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix4x3
+    template <typename T>
+    constexpr Matrix4x3<T> select(Matrix4x3<bool> const & mask,
+                                  Matrix4x3<T> const &    lhs,
+                                  Matrix4x3<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Matrix4x4
+    template <typename T>
+    constexpr Matrix4x4<T> select(Matrix4x4<bool> const & mask,
+                                  Matrix4x4<T> const &    lhs,
+                                  Matrix4x4<T> const &    rhs) noexcept;
+
     // =============================================================================
     // comparisons:
     // =============================================================================
@@ -2700,114 +2816,228 @@ namespace ggm
     /// element-wise is_close
     /// @relates Matrix1x1
     template <typename T>
-    inline Matrix1x1<bool> is_close(Matrix1x1<T> const & lhs,
-                                    Matrix1x1<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix1x1<bool> is_close(Matrix1x1<T> const & lhs,
+                                       Matrix1x1<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix1x2
     template <typename T>
-    inline Matrix1x2<bool> is_close(Matrix1x2<T> const & lhs,
-                                    Matrix1x2<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix1x2<bool> is_close(Matrix1x2<T> const & lhs,
+                                       Matrix1x2<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix1x3
     template <typename T>
-    inline Matrix1x3<bool> is_close(Matrix1x3<T> const & lhs,
-                                    Matrix1x3<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix1x3<bool> is_close(Matrix1x3<T> const & lhs,
+                                       Matrix1x3<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix1x4
     template <typename T>
-    inline Matrix1x4<bool> is_close(Matrix1x4<T> const & lhs,
-                                    Matrix1x4<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix1x4<bool> is_close(Matrix1x4<T> const & lhs,
+                                       Matrix1x4<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix2x1
     template <typename T>
-    inline Matrix2x1<bool> is_close(Matrix2x1<T> const & lhs,
-                                    Matrix2x1<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix2x1<bool> is_close(Matrix2x1<T> const & lhs,
+                                       Matrix2x1<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix2x2
     template <typename T>
-    inline Matrix2x2<bool> is_close(Matrix2x2<T> const & lhs,
-                                    Matrix2x2<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix2x2<bool> is_close(Matrix2x2<T> const & lhs,
+                                       Matrix2x2<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix2x3
     template <typename T>
-    inline Matrix2x3<bool> is_close(Matrix2x3<T> const & lhs,
-                                    Matrix2x3<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix2x3<bool> is_close(Matrix2x3<T> const & lhs,
+                                       Matrix2x3<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix2x4
     template <typename T>
-    inline Matrix2x4<bool> is_close(Matrix2x4<T> const & lhs,
-                                    Matrix2x4<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix2x4<bool> is_close(Matrix2x4<T> const & lhs,
+                                       Matrix2x4<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix3x1
     template <typename T>
-    inline Matrix3x1<bool> is_close(Matrix3x1<T> const & lhs,
-                                    Matrix3x1<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix3x1<bool> is_close(Matrix3x1<T> const & lhs,
+                                       Matrix3x1<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix3x2
     template <typename T>
-    inline Matrix3x2<bool> is_close(Matrix3x2<T> const & lhs,
-                                    Matrix3x2<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix3x2<bool> is_close(Matrix3x2<T> const & lhs,
+                                       Matrix3x2<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix3x3
     template <typename T>
-    inline Matrix3x3<bool> is_close(Matrix3x3<T> const & lhs,
-                                    Matrix3x3<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix3x3<bool> is_close(Matrix3x3<T> const & lhs,
+                                       Matrix3x3<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix3x4
     template <typename T>
-    inline Matrix3x4<bool> is_close(Matrix3x4<T> const & lhs,
-                                    Matrix3x4<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix3x4<bool> is_close(Matrix3x4<T> const & lhs,
+                                       Matrix3x4<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix4x1
     template <typename T>
-    inline Matrix4x1<bool> is_close(Matrix4x1<T> const & lhs,
-                                    Matrix4x1<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix4x1<bool> is_close(Matrix4x1<T> const & lhs,
+                                       Matrix4x1<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix4x2
     template <typename T>
-    inline Matrix4x2<bool> is_close(Matrix4x2<T> const & lhs,
-                                    Matrix4x2<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix4x2<bool> is_close(Matrix4x2<T> const & lhs,
+                                       Matrix4x2<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix4x3
     template <typename T>
-    inline Matrix4x3<bool> is_close(Matrix4x3<T> const & lhs,
-                                    Matrix4x3<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix4x3<bool> is_close(Matrix4x3<T> const & lhs,
+                                       Matrix4x3<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Matrix4x4
     template <typename T>
-    inline Matrix4x4<bool> is_close(Matrix4x4<T> const & lhs,
-                                    Matrix4x4<T> const & rhs,
-                                    T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Matrix4x4<bool> is_close(Matrix4x4<T> const & lhs,
+                                       Matrix4x4<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
+
+    // =============================================================================
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix1x1
+    template <typename T>
+    constexpr Matrix1x1<bool> is_close_ulps(Matrix1x1<T> const & lhs,
+                                            Matrix1x1<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix1x2
+    template <typename T>
+    constexpr Matrix1x2<bool> is_close_ulps(Matrix1x2<T> const & lhs,
+                                            Matrix1x2<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix1x3
+    template <typename T>
+    constexpr Matrix1x3<bool> is_close_ulps(Matrix1x3<T> const & lhs,
+                                            Matrix1x3<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix1x4
+    template <typename T>
+    constexpr Matrix1x4<bool> is_close_ulps(Matrix1x4<T> const & lhs,
+                                            Matrix1x4<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix2x1
+    template <typename T>
+    constexpr Matrix2x1<bool> is_close_ulps(Matrix2x1<T> const & lhs,
+                                            Matrix2x1<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix2x2
+    template <typename T>
+    constexpr Matrix2x2<bool> is_close_ulps(Matrix2x2<T> const & lhs,
+                                            Matrix2x2<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix2x3
+    template <typename T>
+    constexpr Matrix2x3<bool> is_close_ulps(Matrix2x3<T> const & lhs,
+                                            Matrix2x3<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix2x4
+    template <typename T>
+    constexpr Matrix2x4<bool> is_close_ulps(Matrix2x4<T> const & lhs,
+                                            Matrix2x4<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix3x1
+    template <typename T>
+    constexpr Matrix3x1<bool> is_close_ulps(Matrix3x1<T> const & lhs,
+                                            Matrix3x1<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix3x2
+    template <typename T>
+    constexpr Matrix3x2<bool> is_close_ulps(Matrix3x2<T> const & lhs,
+                                            Matrix3x2<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix3x3
+    template <typename T>
+    constexpr Matrix3x3<bool> is_close_ulps(Matrix3x3<T> const & lhs,
+                                            Matrix3x3<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix3x4
+    template <typename T>
+    constexpr Matrix3x4<bool> is_close_ulps(Matrix3x4<T> const & lhs,
+                                            Matrix3x4<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix4x1
+    template <typename T>
+    constexpr Matrix4x1<bool> is_close_ulps(Matrix4x1<T> const & lhs,
+                                            Matrix4x1<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix4x2
+    template <typename T>
+    constexpr Matrix4x2<bool> is_close_ulps(Matrix4x2<T> const & lhs,
+                                            Matrix4x2<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix4x3
+    template <typename T>
+    constexpr Matrix4x3<bool> is_close_ulps(Matrix4x3<T> const & lhs,
+                                            Matrix4x3<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Matrix4x4
+    template <typename T>
+    constexpr Matrix4x4<bool> is_close_ulps(Matrix4x4<T> const & lhs,
+                                            Matrix4x4<T> const & rhs,
+                                            unsigned int const   maxUlps = DefaultToleranceUlps) noexcept;
 
     // =============================================================================
 
@@ -5965,7 +6195,7 @@ constexpr ggm::Matrix1x1<T> ggm::operator*(Matrix1x2<T> const & lhs,
 {
     return Matrix1x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
     };
 }
 
@@ -5977,7 +6207,7 @@ constexpr ggm::Matrix1x1<T> ggm::operator*(Matrix1x3<T> const & lhs,
 {
     return Matrix1x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
     };
 }
 
@@ -5989,7 +6219,7 @@ constexpr ggm::Matrix1x1<T> ggm::operator*(Matrix1x4<T> const & lhs,
 {
     return Matrix1x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
     };
 }
 
@@ -6016,8 +6246,8 @@ constexpr ggm::Matrix1x2<T> ggm::operator*(Matrix1x2<T> const & lhs,
 {
     return Matrix1x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
     };
 }
 
@@ -6029,8 +6259,8 @@ constexpr ggm::Matrix1x2<T> ggm::operator*(Matrix1x3<T> const & lhs,
 {
     return Matrix1x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
     };
 }
 
@@ -6042,8 +6272,8 @@ constexpr ggm::Matrix1x2<T> ggm::operator*(Matrix1x4<T> const & lhs,
 {
     return Matrix1x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
     };
 }
 
@@ -6071,9 +6301,9 @@ constexpr ggm::Matrix1x3<T> ggm::operator*(Matrix1x2<T> const & lhs,
 {
     return Matrix1x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
     };
 }
 
@@ -6085,9 +6315,9 @@ constexpr ggm::Matrix1x3<T> ggm::operator*(Matrix1x3<T> const & lhs,
 {
     return Matrix1x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
     };
 }
 
@@ -6099,9 +6329,9 @@ constexpr ggm::Matrix1x3<T> ggm::operator*(Matrix1x4<T> const & lhs,
 {
     return Matrix1x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
     };
 }
 
@@ -6130,10 +6360,10 @@ constexpr ggm::Matrix1x4<T> ggm::operator*(Matrix1x2<T> const & lhs,
 {
     return Matrix1x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13),
     };
 }
 
@@ -6145,10 +6375,10 @@ constexpr ggm::Matrix1x4<T> ggm::operator*(Matrix1x3<T> const & lhs,
 {
     return Matrix1x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23),
     };
 }
 
@@ -6160,10 +6390,10 @@ constexpr ggm::Matrix1x4<T> ggm::operator*(Matrix1x4<T> const & lhs,
 {
     return Matrix1x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23) + (lhs.m03 * rhs.m33),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23, lhs.m03, rhs.m33),
     };
 }
 
@@ -6191,9 +6421,9 @@ constexpr ggm::Matrix2x1<T> ggm::operator*(Matrix2x2<T> const & lhs,
 {
     return Matrix2x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
     };
 }
 
@@ -6205,9 +6435,9 @@ constexpr ggm::Matrix2x1<T> ggm::operator*(Matrix2x3<T> const & lhs,
 {
     return Matrix2x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
     };
 }
 
@@ -6219,9 +6449,9 @@ constexpr ggm::Matrix2x1<T> ggm::operator*(Matrix2x4<T> const & lhs,
 {
     return Matrix2x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
     };
 }
 
@@ -6259,11 +6489,11 @@ constexpr ggm::Matrix2x2<T> ggm::operator*(Matrix2x2<T> const & lhs,
 
     return Matrix2x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
     };
 }
 
@@ -6275,11 +6505,11 @@ constexpr ggm::Matrix2x2<T> ggm::operator*(Matrix2x3<T> const & lhs,
 {
     return Matrix2x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
     };
 }
 
@@ -6291,11 +6521,11 @@ constexpr ggm::Matrix2x2<T> ggm::operator*(Matrix2x4<T> const & lhs,
 {
     return Matrix2x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
     };
 }
 
@@ -6327,13 +6557,13 @@ constexpr ggm::Matrix2x3<T> ggm::operator*(Matrix2x2<T> const & lhs,
 {
     return Matrix2x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12),
     };
 }
 
@@ -6345,13 +6575,13 @@ constexpr ggm::Matrix2x3<T> ggm::operator*(Matrix2x3<T> const & lhs,
 {
     return Matrix2x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
     };
 }
 
@@ -6363,13 +6593,13 @@ constexpr ggm::Matrix2x3<T> ggm::operator*(Matrix2x4<T> const & lhs,
 {
     return Matrix2x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22, lhs.m13, rhs.m32),
     };
 }
 
@@ -6405,15 +6635,15 @@ constexpr ggm::Matrix2x4<T> ggm::operator*(Matrix2x2<T> const & lhs,
 {
     return Matrix2x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13),
     };
 }
 
@@ -6425,15 +6655,15 @@ constexpr ggm::Matrix2x4<T> ggm::operator*(Matrix2x3<T> const & lhs,
 {
     return Matrix2x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23),
     };
 }
 
@@ -6445,15 +6675,15 @@ constexpr ggm::Matrix2x4<T> ggm::operator*(Matrix2x4<T> const & lhs,
 {
     return Matrix2x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23) + (lhs.m03 * rhs.m33),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23, lhs.m03, rhs.m33),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23) + (lhs.m13 * rhs.m33),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22, lhs.m13, rhs.m32),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23, lhs.m13, rhs.m33),
     };
 }
 
@@ -6483,11 +6713,11 @@ constexpr ggm::Matrix3x1<T> ggm::operator*(Matrix3x2<T> const & lhs,
 {
     return Matrix3x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
     };
 }
 
@@ -6499,11 +6729,11 @@ constexpr ggm::Matrix3x1<T> ggm::operator*(Matrix3x3<T> const & lhs,
 {
     return Matrix3x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
     };
 }
 
@@ -6515,11 +6745,11 @@ constexpr ggm::Matrix3x1<T> ggm::operator*(Matrix3x4<T> const & lhs,
 {
     return Matrix3x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
     };
 }
 
@@ -6552,14 +6782,14 @@ constexpr ggm::Matrix3x2<T> ggm::operator*(Matrix3x2<T> const & lhs,
 {
     return Matrix3x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11),
     };
 }
 
@@ -6571,14 +6801,14 @@ constexpr ggm::Matrix3x2<T> ggm::operator*(Matrix3x3<T> const & lhs,
 {
     return Matrix3x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
     };
 }
 
@@ -6590,14 +6820,14 @@ constexpr ggm::Matrix3x2<T> ggm::operator*(Matrix3x4<T> const & lhs,
 {
     return Matrix3x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21, lhs.m23, rhs.m31),
     };
 }
 
@@ -6633,17 +6863,17 @@ constexpr ggm::Matrix3x3<T> ggm::operator*(Matrix3x2<T> const & lhs,
 {
     return Matrix3x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12),
     };
 }
 
@@ -6665,17 +6895,17 @@ constexpr ggm::Matrix3x3<T> ggm::operator*(Matrix3x3<T> const & lhs,
 
     return Matrix3x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22),
     };
 }
 
@@ -6687,17 +6917,17 @@ constexpr ggm::Matrix3x3<T> ggm::operator*(Matrix3x4<T> const & lhs,
 {
     return Matrix3x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22, lhs.m13, rhs.m32),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22) + (lhs.m23 * rhs.m32),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21, lhs.m23, rhs.m31),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22, lhs.m23, rhs.m32),
     };
 }
 
@@ -6736,20 +6966,20 @@ constexpr ggm::Matrix3x4<T> ggm::operator*(Matrix3x2<T> const & lhs,
 {
     return Matrix3x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13),
     };
 }
 
@@ -6761,20 +6991,20 @@ constexpr ggm::Matrix3x4<T> ggm::operator*(Matrix3x3<T> const & lhs,
 {
     return Matrix3x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13, lhs.m22, rhs.m23),
     };
 }
 
@@ -6786,20 +7016,20 @@ constexpr ggm::Matrix3x4<T> ggm::operator*(Matrix3x4<T> const & lhs,
 {
     return Matrix3x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23) + (lhs.m03 * rhs.m33),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23, lhs.m03, rhs.m33),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23) + (lhs.m13 * rhs.m33),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22, lhs.m13, rhs.m32),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23, lhs.m13, rhs.m33),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22) + (lhs.m23 * rhs.m32),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23) + (lhs.m23 * rhs.m33),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21, lhs.m23, rhs.m31),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22, lhs.m23, rhs.m32),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13, lhs.m22, rhs.m23, lhs.m23, rhs.m33),
     };
 }
 
@@ -6831,13 +7061,13 @@ constexpr ggm::Matrix4x1<T> ggm::operator*(Matrix4x2<T> const & lhs,
 {
     return Matrix4x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10),
     };
 }
 
@@ -6849,13 +7079,13 @@ constexpr ggm::Matrix4x1<T> ggm::operator*(Matrix4x3<T> const & lhs,
 {
     return Matrix4x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20),
     };
 }
 
@@ -6867,13 +7097,13 @@ constexpr ggm::Matrix4x1<T> ggm::operator*(Matrix4x4<T> const & lhs,
 {
     return Matrix4x1<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20) + (lhs.m33 * rhs.m30),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20, lhs.m33, rhs.m30),
     };
 }
 
@@ -6909,17 +7139,17 @@ constexpr ggm::Matrix4x2<T> ggm::operator*(Matrix4x2<T> const & lhs,
 {
     return Matrix4x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11),
     };
 }
 
@@ -6931,17 +7161,17 @@ constexpr ggm::Matrix4x2<T> ggm::operator*(Matrix4x3<T> const & lhs,
 {
     return Matrix4x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11, lhs.m32, rhs.m21),
     };
 }
 
@@ -6953,17 +7183,17 @@ constexpr ggm::Matrix4x2<T> ggm::operator*(Matrix4x4<T> const & lhs,
 {
     return Matrix4x2<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21, lhs.m23, rhs.m31),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20) + (lhs.m33 * rhs.m30),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21) + (lhs.m33 * rhs.m31),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20, lhs.m33, rhs.m30),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11, lhs.m32, rhs.m21, lhs.m33, rhs.m31),
     };
 }
 
@@ -7003,21 +7233,21 @@ constexpr ggm::Matrix4x3<T> ggm::operator*(Matrix4x2<T> const & lhs,
 {
     return Matrix4x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11),
-        (lhs.m30 * rhs.m02) + (lhs.m31 * rhs.m12),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11),
+        sum_of_products(lhs.m30, rhs.m02, lhs.m31, rhs.m12),
     };
 }
 
@@ -7029,21 +7259,21 @@ constexpr ggm::Matrix4x3<T> ggm::operator*(Matrix4x3<T> const & lhs,
 {
     return Matrix4x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21),
-        (lhs.m30 * rhs.m02) + (lhs.m31 * rhs.m12) + (lhs.m32 * rhs.m22),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11, lhs.m32, rhs.m21),
+        sum_of_products(lhs.m30, rhs.m02, lhs.m31, rhs.m12, lhs.m32, rhs.m22),
     };
 }
 
@@ -7055,21 +7285,21 @@ constexpr ggm::Matrix4x3<T> ggm::operator*(Matrix4x4<T> const & lhs,
 {
     return Matrix4x3<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22, lhs.m13, rhs.m32),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22) + (lhs.m23 * rhs.m32),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21, lhs.m23, rhs.m31),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22, lhs.m23, rhs.m32),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20) + (lhs.m33 * rhs.m30),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21) + (lhs.m33 * rhs.m31),
-        (lhs.m30 * rhs.m02) + (lhs.m31 * rhs.m12) + (lhs.m32 * rhs.m22) + (lhs.m33 * rhs.m32),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20, lhs.m33, rhs.m30),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11, lhs.m32, rhs.m21, lhs.m33, rhs.m31),
+        sum_of_products(lhs.m30, rhs.m02, lhs.m31, rhs.m12, lhs.m32, rhs.m22, lhs.m33, rhs.m32),
     };
 }
 
@@ -7113,25 +7343,25 @@ constexpr ggm::Matrix4x4<T> ggm::operator*(Matrix4x2<T> const & lhs,
 {
     return Matrix4x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11),
-        (lhs.m30 * rhs.m02) + (lhs.m31 * rhs.m12),
-        (lhs.m30 * rhs.m03) + (lhs.m31 * rhs.m13),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11),
+        sum_of_products(lhs.m30, rhs.m02, lhs.m31, rhs.m12),
+        sum_of_products(lhs.m30, rhs.m03, lhs.m31, rhs.m13),
     };
 }
 
@@ -7143,25 +7373,25 @@ constexpr ggm::Matrix4x4<T> ggm::operator*(Matrix4x3<T> const & lhs,
 {
     return Matrix4x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13, lhs.m22, rhs.m23),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21),
-        (lhs.m30 * rhs.m02) + (lhs.m31 * rhs.m12) + (lhs.m32 * rhs.m22),
-        (lhs.m30 * rhs.m03) + (lhs.m31 * rhs.m13) + (lhs.m32 * rhs.m23),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11, lhs.m32, rhs.m21),
+        sum_of_products(lhs.m30, rhs.m02, lhs.m31, rhs.m12, lhs.m32, rhs.m22),
+        sum_of_products(lhs.m30, rhs.m03, lhs.m31, rhs.m13, lhs.m32, rhs.m23),
     };
 }
 
@@ -7185,25 +7415,25 @@ constexpr ggm::Matrix4x4<T> ggm::operator*(Matrix4x4<T> const & lhs,
 
     return Matrix4x4<T>{
         // row0:
-        (lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10) + (lhs.m02 * rhs.m20) + (lhs.m03 * rhs.m30),
-        (lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11) + (lhs.m02 * rhs.m21) + (lhs.m03 * rhs.m31),
-        (lhs.m00 * rhs.m02) + (lhs.m01 * rhs.m12) + (lhs.m02 * rhs.m22) + (lhs.m03 * rhs.m32),
-        (lhs.m00 * rhs.m03) + (lhs.m01 * rhs.m13) + (lhs.m02 * rhs.m23) + (lhs.m03 * rhs.m33),
+        sum_of_products(lhs.m00, rhs.m00, lhs.m01, rhs.m10, lhs.m02, rhs.m20, lhs.m03, rhs.m30),
+        sum_of_products(lhs.m00, rhs.m01, lhs.m01, rhs.m11, lhs.m02, rhs.m21, lhs.m03, rhs.m31),
+        sum_of_products(lhs.m00, rhs.m02, lhs.m01, rhs.m12, lhs.m02, rhs.m22, lhs.m03, rhs.m32),
+        sum_of_products(lhs.m00, rhs.m03, lhs.m01, rhs.m13, lhs.m02, rhs.m23, lhs.m03, rhs.m33),
         // row1:
-        (lhs.m10 * rhs.m00) + (lhs.m11 * rhs.m10) + (lhs.m12 * rhs.m20) + (lhs.m13 * rhs.m30),
-        (lhs.m10 * rhs.m01) + (lhs.m11 * rhs.m11) + (lhs.m12 * rhs.m21) + (lhs.m13 * rhs.m31),
-        (lhs.m10 * rhs.m02) + (lhs.m11 * rhs.m12) + (lhs.m12 * rhs.m22) + (lhs.m13 * rhs.m32),
-        (lhs.m10 * rhs.m03) + (lhs.m11 * rhs.m13) + (lhs.m12 * rhs.m23) + (lhs.m13 * rhs.m33),
+        sum_of_products(lhs.m10, rhs.m00, lhs.m11, rhs.m10, lhs.m12, rhs.m20, lhs.m13, rhs.m30),
+        sum_of_products(lhs.m10, rhs.m01, lhs.m11, rhs.m11, lhs.m12, rhs.m21, lhs.m13, rhs.m31),
+        sum_of_products(lhs.m10, rhs.m02, lhs.m11, rhs.m12, lhs.m12, rhs.m22, lhs.m13, rhs.m32),
+        sum_of_products(lhs.m10, rhs.m03, lhs.m11, rhs.m13, lhs.m12, rhs.m23, lhs.m13, rhs.m33),
         // row2:
-        (lhs.m20 * rhs.m00) + (lhs.m21 * rhs.m10) + (lhs.m22 * rhs.m20) + (lhs.m23 * rhs.m30),
-        (lhs.m20 * rhs.m01) + (lhs.m21 * rhs.m11) + (lhs.m22 * rhs.m21) + (lhs.m23 * rhs.m31),
-        (lhs.m20 * rhs.m02) + (lhs.m21 * rhs.m12) + (lhs.m22 * rhs.m22) + (lhs.m23 * rhs.m32),
-        (lhs.m20 * rhs.m03) + (lhs.m21 * rhs.m13) + (lhs.m22 * rhs.m23) + (lhs.m23 * rhs.m33),
+        sum_of_products(lhs.m20, rhs.m00, lhs.m21, rhs.m10, lhs.m22, rhs.m20, lhs.m23, rhs.m30),
+        sum_of_products(lhs.m20, rhs.m01, lhs.m21, rhs.m11, lhs.m22, rhs.m21, lhs.m23, rhs.m31),
+        sum_of_products(lhs.m20, rhs.m02, lhs.m21, rhs.m12, lhs.m22, rhs.m22, lhs.m23, rhs.m32),
+        sum_of_products(lhs.m20, rhs.m03, lhs.m21, rhs.m13, lhs.m22, rhs.m23, lhs.m23, rhs.m33),
         // row3:
-        (lhs.m30 * rhs.m00) + (lhs.m31 * rhs.m10) + (lhs.m32 * rhs.m20) + (lhs.m33 * rhs.m30),
-        (lhs.m30 * rhs.m01) + (lhs.m31 * rhs.m11) + (lhs.m32 * rhs.m21) + (lhs.m33 * rhs.m31),
-        (lhs.m30 * rhs.m02) + (lhs.m31 * rhs.m12) + (lhs.m32 * rhs.m22) + (lhs.m33 * rhs.m32),
-        (lhs.m30 * rhs.m03) + (lhs.m31 * rhs.m13) + (lhs.m32 * rhs.m23) + (lhs.m33 * rhs.m33),
+        sum_of_products(lhs.m30, rhs.m00, lhs.m31, rhs.m10, lhs.m32, rhs.m20, lhs.m33, rhs.m30),
+        sum_of_products(lhs.m30, rhs.m01, lhs.m31, rhs.m11, lhs.m32, rhs.m21, lhs.m33, rhs.m31),
+        sum_of_products(lhs.m30, rhs.m02, lhs.m31, rhs.m12, lhs.m32, rhs.m22, lhs.m33, rhs.m32),
+        sum_of_products(lhs.m30, rhs.m03, lhs.m31, rhs.m13, lhs.m32, rhs.m23, lhs.m33, rhs.m33),
     };
 }
 
@@ -7939,7 +8169,7 @@ constexpr T ggm::determinant(Matrix2x2<T> const & value) noexcept
     // | m00  m01 |
     // | m10  m11 |
 
-    return value.m00 * value.m11 - value.m01 * value.m10;
+    return sum_of_products(value.m00, value.m11, value.m01, -value.m10);
 }
 
 // -----------------------------------------------------------------------------
@@ -7951,13 +8181,13 @@ constexpr T ggm::determinant(Matrix3x3<T> const & value) noexcept
     // | m10 m11 m12 |
     // | m20 m21 m22 |
 
-    T const detMinor00 = value.m11 * value.m22 - value.m12 * value.m21;
-    T const detMinor01 = value.m10 * value.m22 - value.m12 * value.m20;
-    T const detMinor02 = value.m11 * value.m21 - value.m11 * value.m20;
+    T const detMinor00 = sum_of_products(value.m11, value.m22, value.m12, -value.m21);
+    T const detMinor01 = sum_of_products(value.m10, value.m22, value.m12, -value.m20);
+    T const detMinor02 = sum_of_products(value.m10, value.m21, value.m11, -value.m20);
 
-    return value.m00 * detMinor00 -
-           value.m01 * detMinor01 +
-           value.m02 * detMinor02;
+    return sum_of_products(value.m00, detMinor00,
+                           value.m01, -detMinor01,
+                           value.m02, detMinor02);
 }
 
 // -----------------------------------------------------------------------------
@@ -7970,40 +8200,40 @@ constexpr T ggm::determinant(Matrix4x4<T> const & value) noexcept
     // | m20 m21 m22 m23 |
     // | m30 m31 m32 m33 |
 
-    T const detSubMinor0 = value.m22 * value.m33 - value.m23 * value.m32;
-    T const detSubMinor1 = value.m21 * value.m33 - value.m23 * value.m31;
-    T const detSubMinor2 = value.m21 * value.m32 - value.m22 * value.m31;
-    T const detSubMinor3 = value.m20 * value.m33 - value.m23 * value.m30;
-    T const detSubMinor4 = value.m20 * value.m32 - value.m22 * value.m30;
-    T const detSubMinor5 = value.m20 * value.m31 - value.m21 * value.m30;
+    T const detSubMinor0 = sum_of_products(value.m22, value.m33, value.m23, -value.m32);
+    T const detSubMinor1 = sum_of_products(value.m21, value.m33, value.m23, -value.m31);
+    T const detSubMinor2 = sum_of_products(value.m21, value.m32, value.m22, -value.m31);
+    T const detSubMinor3 = sum_of_products(value.m20, value.m33, value.m23, -value.m30);
+    T const detSubMinor4 = sum_of_products(value.m20, value.m32, value.m22, -value.m30);
+    T const detSubMinor5 = sum_of_products(value.m20, value.m31, value.m21, -value.m30);
 
-    T const detMinor00 = value.m11 * detSubMinor0 -
-                         value.m12 * detSubMinor1 +
-                         value.m13 * detSubMinor2;
+    T const detMinor00 = sum_of_products(value.m11, detSubMinor0,
+                                         value.m12, -detSubMinor1,
+                                         value.m13, detSubMinor2);
 
-    T const detMinor01 = value.m10 * detSubMinor0 -
-                         value.m12 * detSubMinor3 +
-                         value.m13 * detSubMinor4;
+    T const detMinor01 = sum_of_products(value.m10, detSubMinor0,
+                                         value.m12, -detSubMinor3,
+                                         value.m13, detSubMinor4);
 
-    T const detMinor02 = value.m10 * detSubMinor1 -
-                         value.m11 * detSubMinor3 +
-                         value.m13 * detSubMinor5;
+    T const detMinor02 = sum_of_products(value.m10, detSubMinor1,
+                                         value.m11, -detSubMinor3,
+                                         value.m13, detSubMinor5);
 
-    T const detMinor03 = value.m10 * detSubMinor2 -
-                         value.m11 * detSubMinor4 +
-                         value.m12 * detSubMinor5;
+    T const detMinor03 = sum_of_products(value.m10, detSubMinor2,
+                                         value.m11, -detSubMinor4,
+                                         value.m12, detSubMinor5);
 
-    return value.m00 * detMinor00 -
-           value.m01 * detMinor01 +
-           value.m02 * detMinor02 -
-           value.m03 * detMinor03;
+    return sum_of_products(value.m00, detMinor00,
+                           value.m01, -detMinor01,
+                           value.m02, detMinor02,
+                           value.m03, -detMinor03);
 }
 
 // =============================================================================
 
 template <typename T>
-inline bool ggm::is_invertible(Matrix1x1<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_invertible(Matrix1x1<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     return !is_close(determinant(value), T{ 0 }, epsilon);
 }
@@ -8011,8 +8241,8 @@ inline bool ggm::is_invertible(Matrix1x1<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_invertible(Matrix2x2<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_invertible(Matrix2x2<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     return !is_close(determinant(value), T{ 0 }, epsilon);
 }
@@ -8020,8 +8250,8 @@ inline bool ggm::is_invertible(Matrix2x2<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_invertible(Matrix3x3<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_invertible(Matrix3x3<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     return !is_close(determinant(value), T{ 0 }, epsilon);
 }
@@ -8029,8 +8259,8 @@ inline bool ggm::is_invertible(Matrix3x3<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_invertible(Matrix4x4<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_invertible(Matrix4x4<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     return !is_close(determinant(value), T{ 0 }, epsilon);
 }
@@ -8038,8 +8268,8 @@ inline bool ggm::is_invertible(Matrix4x4<T> const & value,
 // =============================================================================
 
 template <typename T>
-inline bool ggm::is_orthogonal(Matrix1x1<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_orthogonal(Matrix1x1<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     // check if value * transpose(value) == identity:
     //
@@ -8053,8 +8283,8 @@ inline bool ggm::is_orthogonal(Matrix1x1<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_orthogonal(Matrix2x2<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_orthogonal(Matrix2x2<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     // check if value * transpose(value) == identity:
     //
@@ -8074,8 +8304,8 @@ inline bool ggm::is_orthogonal(Matrix2x2<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_orthogonal(Matrix3x3<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_orthogonal(Matrix3x3<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     // check if value * transpose(value) == identity:
     //
@@ -8107,8 +8337,8 @@ inline bool ggm::is_orthogonal(Matrix3x3<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_orthogonal(Matrix4x4<T> const & value,
-                               T const &            epsilon) noexcept
+constexpr bool ggm::is_orthogonal(Matrix4x4<T> const & value,
+                                  T const &            epsilon) noexcept
 {
     // check if value * transpose(value) == identity:
     //
@@ -8155,32 +8385,32 @@ inline bool ggm::is_orthogonal(Matrix4x4<T> const & value,
 // =============================================================================
 
 template <typename T>
-inline ggm::Matrix1x1<T> ggm::inverse(Matrix1x1<T> const & value,
-                                      T const &            epsilon) noexcept
+constexpr ggm::Matrix1x1<T> ggm::inverse(Matrix1x1<T> const & value,
+                                         T const &            epsilon) noexcept
 {
     T const det = value.m00;
 
     T const invDet = reciprocal(det, T{ 0 }, epsilon);
 
     return Matrix1x1<T>{
-        /*.m00 = */ value.m00 * invDet,
+        /*.m00 = */ invDet,
     };
 }
 
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix2x2<T> ggm::inverse(Matrix2x2<T> const & value,
-                                      T const &            epsilon) noexcept
+constexpr ggm::Matrix2x2<T> ggm::inverse(Matrix2x2<T> const & value,
+                                         T const &            epsilon) noexcept
 {
-    T const det = value.m00 * value.m11 - value.m01 * value.m10;
+    T const det = sum_of_products(value.m00, value.m11, value.m01, -value.m10);
 
     T const invDet = reciprocal(det, T{ 0 }, epsilon);
 
     return Matrix2x2<T>{
         /*.m00 = */ +value.m11 * invDet,
-        /*.m01 = */ -value.m10 * invDet,
-        /*.m10 = */ -value.m01 * invDet,
+        /*.m01 = */ -value.m01 * invDet,
+        /*.m10 = */ -value.m10 * invDet,
         /*.m11 = */ +value.m00 * invDet,
     };
 }
@@ -8188,22 +8418,22 @@ inline ggm::Matrix2x2<T> ggm::inverse(Matrix2x2<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix3x3<T> ggm::inverse(Matrix3x3<T> const & value,
-                                      T const &            epsilon) noexcept
+constexpr ggm::Matrix3x3<T> ggm::inverse(Matrix3x3<T> const & value,
+                                         T const &            epsilon) noexcept
 {
-    T const detMinor00 = value.m11 * value.m22 - value.m12 * value.m21;
-    T const detMinor01 = value.m10 * value.m22 - value.m12 * value.m20;
-    T const detMinor02 = value.m10 * value.m21 - value.m11 * value.m20;
-    T const detMinor10 = value.m01 * value.m22 - value.m02 * value.m21;
-    T const detMinor11 = value.m00 * value.m22 - value.m02 * value.m20;
-    T const detMinor12 = value.m00 * value.m21 - value.m01 * value.m20;
-    T const detMinor20 = value.m01 * value.m12 - value.m02 * value.m11;
-    T const detMinor21 = value.m00 * value.m12 - value.m02 * value.m10;
-    T const detMinor22 = value.m00 * value.m11 - value.m01 * value.m10;
+    T const detMinor00 = sum_of_products(value.m11, value.m22, value.m12, -value.m21);
+    T const detMinor01 = sum_of_products(value.m10, value.m22, value.m12, -value.m20);
+    T const detMinor02 = sum_of_products(value.m10, value.m21, value.m11, -value.m20);
+    T const detMinor10 = sum_of_products(value.m01, value.m22, value.m02, -value.m21);
+    T const detMinor11 = sum_of_products(value.m00, value.m22, value.m02, -value.m20);
+    T const detMinor12 = sum_of_products(value.m00, value.m21, value.m01, -value.m20);
+    T const detMinor20 = sum_of_products(value.m01, value.m12, value.m02, -value.m11);
+    T const detMinor21 = sum_of_products(value.m00, value.m12, value.m02, -value.m10);
+    T const detMinor22 = sum_of_products(value.m00, value.m11, value.m01, -value.m10);
 
-    T const det = value.m00 * detMinor00 -
-                  value.m01 * detMinor01 +
-                  value.m02 * detMinor02;
+    T const det = sum_of_products(value.m00, detMinor00,
+                                  value.m01, -detMinor01,
+                                  value.m02, detMinor02);
 
     T const invDet = reciprocal(det, T{ 0 }, epsilon);
 
@@ -8223,43 +8453,43 @@ inline ggm::Matrix3x3<T> ggm::inverse(Matrix3x3<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix4x4<T> ggm::inverse(Matrix4x4<T> const & value,
-                                      T const &            epsilon) noexcept
-{
-    T const detSubMinor01 = value.m22 * value.m33 - value.m23 * value.m32;
-    T const detSubMinor02 = value.m21 * value.m33 - value.m23 * value.m31;
-    T const detSubMinor03 = value.m21 * value.m32 - value.m22 * value.m31;
-    T const detSubMinor04 = value.m20 * value.m33 - value.m23 * value.m30;
-    T const detSubMinor05 = value.m20 * value.m32 - value.m22 * value.m30;
-    T const detSubMinor06 = value.m20 * value.m31 - value.m21 * value.m30;
-    T const detSubMinor07 = value.m02 * value.m13 - value.m03 * value.m12;
-    T const detSubMinor08 = value.m01 * value.m13 - value.m03 * value.m11;
-    T const detSubMinor09 = value.m01 * value.m12 - value.m02 * value.m11;
-    T const detSubMinor10 = value.m00 * value.m13 - value.m03 * value.m10;
-    T const detSubMinor11 = value.m00 * value.m12 - value.m02 * value.m10;
-    T const detSubMinor12 = value.m00 * value.m11 - value.m01 * value.m10;
-
-    T const detMinor00 = value.m11 * detSubMinor01 - value.m12 * detSubMinor02 + value.m13 * detSubMinor03;
-    T const detMinor01 = value.m10 * detSubMinor01 - value.m12 * detSubMinor04 + value.m13 * detSubMinor05;
-    T const detMinor02 = value.m10 * detSubMinor02 - value.m11 * detSubMinor04 + value.m13 * detSubMinor06;
-    T const detMinor03 = value.m10 * detSubMinor03 - value.m11 * detSubMinor05 + value.m12 * detSubMinor06;
-    T const detMinor10 = value.m01 * detSubMinor01 - value.m02 * detSubMinor02 + value.m03 * detSubMinor03;
-    T const detMinor11 = value.m00 * detSubMinor01 - value.m02 * detSubMinor04 + value.m03 * detSubMinor05;
-    T const detMinor12 = value.m00 * detSubMinor02 - value.m01 * detSubMinor04 + value.m03 * detSubMinor06;
-    T const detMinor13 = value.m00 * detSubMinor03 - value.m01 * detSubMinor05 + value.m02 * detSubMinor06;
-    T const detMinor20 = value.m31 * detSubMinor07 - value.m32 * detSubMinor08 + value.m33 * detSubMinor09;
-    T const detMinor21 = value.m30 * detSubMinor07 - value.m32 * detSubMinor10 + value.m33 * detSubMinor11;
-    T const detMinor22 = value.m30 * detSubMinor08 - value.m31 * detSubMinor10 + value.m33 * detSubMinor12;
-    T const detMinor23 = value.m30 * detSubMinor09 - value.m31 * detSubMinor11 + value.m32 * detSubMinor12;
-    T const detMinor30 = value.m21 * detSubMinor07 - value.m22 * detSubMinor08 + value.m23 * detSubMinor09;
-    T const detMinor31 = value.m20 * detSubMinor07 - value.m22 * detSubMinor10 + value.m23 * detSubMinor11;
-    T const detMinor32 = value.m20 * detSubMinor08 - value.m21 * detSubMinor10 + value.m23 * detSubMinor12;
-    T const detMinor33 = value.m20 * detSubMinor09 - value.m21 * detSubMinor11 + value.m22 * detSubMinor12;
-
-    T const det = value.m00 * detMinor00 -
-                  value.m01 * detMinor01 +
-                  value.m02 * detMinor02 -
-                  value.m03 * detMinor03;
+constexpr ggm::Matrix4x4<T> ggm::inverse(Matrix4x4<T> const & value,
+                                         T const &            epsilon) noexcept
+{
+    T const detSubMinor01 = sum_of_products(value.m22, value.m33, value.m23, -value.m32);
+    T const detSubMinor02 = sum_of_products(value.m21, value.m33, value.m23, -value.m31);
+    T const detSubMinor03 = sum_of_products(value.m21, value.m32, value.m22, -value.m31);
+    T const detSubMinor04 = sum_of_products(value.m20, value.m33, value.m23, -value.m30);
+    T const detSubMinor05 = sum_of_products(value.m20, value.m32, value.m22, -value.m30);
+    T const detSubMinor06 = sum_of_products(value.m20, value.m31, value.m21, -value.m30);
+    T const detSubMinor07 = sum_of_products(value.m02, value.m13, value.m03, -value.m12);
+    T const detSubMinor08 = sum_of_products(value.m01, value.m13, value.m03, -value.m11);
+    T const detSubMinor09 = sum_of_products(value.m01, value.m12, value.m02, -value.m11);
+    T const detSubMinor10 = sum_of_products(value.m00, value.m13, value.m03, -value.m10);
+    T const detSubMinor11 = sum_of_products(value.m00, value.m12, value.m02, -value.m10);
+    T const detSubMinor12 = sum_of_products(value.m00, value.m11, value.m01, -value.m10);
+
+    T const detMinor00 = sum_of_products(value.m11, detSubMinor01, value.m12, -detSubMinor02, value.m13, detSubMinor03);
+    T const detMinor01 = sum_of_products(value.m10, detSubMinor01, value.m12, -detSubMinor04, value.m13, detSubMinor05);
+    T const detMinor02 = sum_of_products(value.m10, detSubMinor02, value.m11, -detSubMinor04, value.m13, detSubMinor06);
+    T const detMinor03 = sum_of_products(value.m10, detSubMinor03, value.m11, -detSubMinor05, value.m12, detSubMinor06);
+    T const detMinor10 = sum_of_products(value.m01, detSubMinor01, value.m02, -detSubMinor02, value.m03, detSubMinor03);
+    T const detMinor11 = sum_of_products(value.m00, detSubMinor01, value.m02, -detSubMinor04, value.m03, detSubMinor05);
+    T const detMinor12 = sum_of_products(value.m00, detSubMinor02, value.m01, -detSubMinor04, value.m03, detSubMinor06);
+    T const detMinor13 = sum_of_products(value.m00, detSubMinor03, value.m01, -detSubMinor05, value.m02, detSubMinor06);
+    T const detMinor20 = sum_of_products(value.m31, detSubMinor07, value.m32, -detSubMinor08, value.m33, detSubMinor09);
+    T const detMinor21 = sum_of_products(value.m30, detSubMinor07, value.m32, -detSubMinor10, value.m33, detSubMinor11);
+    T const detMinor22 = sum_of_products(value.m30, detSubMinor08, value.m31, -detSubMinor10, value.m33, detSubMinor12);
+    T const detMinor23 = sum_of_products(value.m30, detSubMinor09, value.m31, -detSubMinor11, value.m32, detSubMinor12);
+    T const detMinor30 = sum_of_products(value.m21, detSubMinor07, value.m22, -detSubMinor08, value.m23, detSubMinor09);
+    T const detMinor31 = sum_of_products(value.m20, detSubMinor07, value.m22, -detSubMinor10, value.m23, detSubMinor11);
+    T const detMinor32 = sum_of_products(value.m20, detSubMinor08, value.m21, -detSubMinor10, value.m23, detSubMinor12);
+    T const detMinor33 = sum_of_products(value.m20, detSubMinor09, value.m21, -detSubMinor11, value.m22, detSubMinor12);
+
+    T const det = sum_of_products(value.m00, detMinor00,
+                                  value.m01, -detMinor01,
+                                  value.m02, detMinor02,
+                                  value.m03, -detMinor03);
 
     T const invDet = reciprocal(det, T{ 0 }, epsilon);
 
@@ -9975,6 +10205,282 @@ constexpr ggm::Matrix3x4<T> ggm::matrix_drop_row(Matrix4x4<T> const & value) noe
 
 // =============================================================================
 
+template <typename T>
+constexpr ggm::Matrix1x1<T> ggm::select(Matrix1x1<bool> const & mask,
+                                        Matrix1x1<T> const &    lhs,
+                                        Matrix1x1<T> const &    rhs) noexcept
+{
+    return Matrix1x1<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix1x2<T> ggm::select(Matrix1x2<bool> const & mask,
+                                        Matrix1x2<T> const &    lhs,
+                                        Matrix1x2<T> const &    rhs) noexcept
+{
+    return Matrix1x2<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix1x3<T> ggm::select(Matrix1x3<bool> const & mask,
+                                        Matrix1x3<T> const &    lhs,
+                                        Matrix1x3<T> const &    rhs) noexcept
+{
+    return Matrix1x3<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix1x4<T> ggm::select(Matrix1x4<bool> const & mask,
+                                        Matrix1x4<T> const &    lhs,
+                                        Matrix1x4<T> const &    rhs) noexcept
+{
+    return Matrix1x4<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m03 ? lhs.m03 : rhs.m03,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x1<T> ggm::select(Matrix2x1<bool> const & mask,
+                                        Matrix2x1<T> const &    lhs,
+                                        Matrix2x1<T> const &    rhs) noexcept
+{
+    return Matrix2x1<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m10 ? lhs.m10 : rhs.m10,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x2<T> ggm::select(Matrix2x2<bool> const & mask,
+                                        Matrix2x2<T> const &    lhs,
+                                        Matrix2x2<T> const &    rhs) noexcept
+{
+    return Matrix2x2<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x3<T> ggm::select(Matrix2x3<bool> const & mask,
+                                        Matrix2x3<T> const &    lhs,
+                                        Matrix2x3<T> const &    rhs) noexcept
+{
+    return Matrix2x3<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m12 ? lhs.m12 : rhs.m12,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x4<T> ggm::select(Matrix2x4<bool> const & mask,
+                                        Matrix2x4<T> const &    lhs,
+                                        Matrix2x4<T> const &    rhs) noexcept
+{
+    return Matrix2x4<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m03 ? lhs.m03 : rhs.m03,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m12 ? lhs.m12 : rhs.m12,
+        mask.m13 ? lhs.m13 : rhs.m13,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x1<T> ggm::select(Matrix3x1<bool> const & mask,
+                                        Matrix3x1<T> const &    lhs,
+                                        Matrix3x1<T> const &    rhs) noexcept
+{
+    return Matrix3x1<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m20 ? lhs.m20 : rhs.m20,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x2<T> ggm::select(Matrix3x2<bool> const & mask,
+                                        Matrix3x2<T> const &    lhs,
+                                        Matrix3x2<T> const &    rhs) noexcept
+{
+    return Matrix3x2<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m21 ? lhs.m21 : rhs.m21,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x3<T> ggm::select(Matrix3x3<bool> const & mask,
+                                        Matrix3x3<T> const &    lhs,
+                                        Matrix3x3<T> const &    rhs) noexcept
+{
+    return Matrix3x3<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m12 ? lhs.m12 : rhs.m12,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m21 ? lhs.m21 : rhs.m21,
+        mask.m22 ? lhs.m22 : rhs.m22,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x4<T> ggm::select(Matrix3x4<bool> const & mask,
+                                        Matrix3x4<T> const &    lhs,
+                                        Matrix3x4<T> const &    rhs) noexcept
+{
+    return Matrix3x4<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m03 ? lhs.m03 : rhs.m03,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m12 ? lhs.m12 : rhs.m12,
+        mask.m13 ? lhs.m13 : rhs.m13,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m21 ? lhs.m21 : rhs.m21,
+        mask.m22 ? lhs.m22 : rhs.m22,
+        mask.m23 ? lhs.m23 : rhs.m23,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x1<T> ggm::select(Matrix4x1<bool> const & mask,
+                                        Matrix4x1<T> const &    lhs,
+                                        Matrix4x1<T> const &    rhs) noexcept
+{
+    return Matrix4x1<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m30 ? lhs.m30 : rhs.m30,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x2<T> ggm::select(Matrix4x2<bool> const & mask,
+                                        Matrix4x2<T> const &    lhs,
+                                        Matrix4x2<T> const &    rhs) noexcept
+{
+    return Matrix4x2<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m21 ? lhs.m21 : rhs.m21,
+        mask.m30 ? lhs.m30 : rhs.m30,
+        mask.m31 ? lhs.m31 : rhs.m31,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x3<T> ggm::select(Matrix4x3<bool> const & mask,
+                                        Matrix4x3<T> const &    lhs,
+                                        Matrix4x3<T> const &    rhs) noexcept
+{
+    return Matrix4x3<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m12 ? lhs.m12 : rhs.m12,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m21 ? lhs.m21 : rhs.m21,
+        mask.m22 ? lhs.m22 : rhs.m22,
+        mask.m30 ? lhs.m30 : rhs.m30,
+        mask.m31 ? lhs.m31 : rhs.m31,
+        mask.m32 ? lhs.m32 : rhs.m32,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x4<T> ggm::select(Matrix4x4<bool> const & mask,
+                                        Matrix4x4<T> const &    lhs,
+                                        Matrix4x4<T> const &    rhs) noexcept
+{
+    return Matrix4x4<T>{
+        mask.m00 ? lhs.m00 : rhs.m00,
+        mask.m01 ? lhs.m01 : rhs.m01,
+        mask.m02 ? lhs.m02 : rhs.m02,
+        mask.m03 ? lhs.m03 : rhs.m03,
+        mask.m10 ? lhs.m10 : rhs.m10,
+        mask.m11 ? lhs.m11 : rhs.m11,
+        mask.m12 ? lhs.m12 : rhs.m12,
+        mask.m13 ? lhs.m13 : rhs.m13,
+        mask.m20 ? lhs.m20 : rhs.m20,
+        mask.m21 ? lhs.m21 : rhs.m21,
+        mask.m22 ? lhs.m22 : rhs.m22,
+        mask.m23 ? lhs.m23 : rhs.m23,
+        mask.m30 ? lhs.m30 : rhs.m30,
+        mask.m31 ? lhs.m31 : rhs.m31,
+        mask.m32 ? lhs.m32 : rhs.m32,
+        mask.m33 ? lhs.m33 : rhs.m33,
+    };
+}
+
+// =============================================================================
+
 constexpr bool ggm::all_of(Matrix1x1<bool> const & value) noexcept
 {
     return value.m00;
@@ -9984,7 +10490,7 @@ constexpr bool ggm::all_of(Matrix1x1<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix1x2<bool> const & value) noexcept
 {
-    return value.m00 &&
+    return value.m00 &
            value.m01;
 }
 
@@ -9992,8 +10498,8 @@ constexpr bool ggm::all_of(Matrix1x2<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix1x3<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
+    return value.m00 &
+           value.m01 &
            value.m02;
 }
 
@@ -10001,9 +10507,9 @@ constexpr bool ggm::all_of(Matrix1x3<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix1x4<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
            value.m03;
 }
 
@@ -10011,7 +10517,7 @@ constexpr bool ggm::all_of(Matrix1x4<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix2x1<bool> const & value) noexcept
 {
-    return value.m00 &&
+    return value.m00 &
            value.m10;
 }
 
@@ -10019,9 +10525,9 @@ constexpr bool ggm::all_of(Matrix2x1<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix2x2<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m10 &&
+    return value.m00 &
+           value.m01 &
+           value.m10 &
            value.m11;
 }
 
@@ -10029,11 +10535,11 @@ constexpr bool ggm::all_of(Matrix2x2<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix2x3<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
-           value.m10 &&
-           value.m11 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
+           value.m10 &
+           value.m11 &
            value.m12;
 }
 
@@ -10041,13 +10547,13 @@ constexpr bool ggm::all_of(Matrix2x3<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix2x4<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
-           value.m03 &&
-           value.m10 &&
-           value.m11 &&
-           value.m12 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
+           value.m03 &
+           value.m10 &
+           value.m11 &
+           value.m12 &
            value.m13;
 }
 
@@ -10055,8 +10561,8 @@ constexpr bool ggm::all_of(Matrix2x4<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix3x1<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m10 &&
+    return value.m00 &
+           value.m10 &
            value.m20;
 }
 
@@ -10064,11 +10570,11 @@ constexpr bool ggm::all_of(Matrix3x1<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix3x2<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m10 &&
-           value.m11 &&
-           value.m20 &&
+    return value.m00 &
+           value.m01 &
+           value.m10 &
+           value.m11 &
+           value.m20 &
            value.m21;
 }
 
@@ -10076,14 +10582,14 @@ constexpr bool ggm::all_of(Matrix3x2<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix3x3<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
-           value.m10 &&
-           value.m11 &&
-           value.m12 &&
-           value.m20 &&
-           value.m21 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
+           value.m10 &
+           value.m11 &
+           value.m12 &
+           value.m20 &
+           value.m21 &
            value.m22;
 }
 
@@ -10091,17 +10597,17 @@ constexpr bool ggm::all_of(Matrix3x3<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix3x4<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
-           value.m03 &&
-           value.m10 &&
-           value.m11 &&
-           value.m12 &&
-           value.m13 &&
-           value.m20 &&
-           value.m21 &&
-           value.m22 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
+           value.m03 &
+           value.m10 &
+           value.m11 &
+           value.m12 &
+           value.m13 &
+           value.m20 &
+           value.m21 &
+           value.m22 &
            value.m23;
 }
 
@@ -10109,9 +10615,9 @@ constexpr bool ggm::all_of(Matrix3x4<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix4x1<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m10 &&
-           value.m20 &&
+    return value.m00 &
+           value.m10 &
+           value.m20 &
            value.m30;
 }
 
@@ -10119,13 +10625,13 @@ constexpr bool ggm::all_of(Matrix4x1<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix4x2<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m10 &&
-           value.m11 &&
-           value.m20 &&
-           value.m21 &&
-           value.m30 &&
+    return value.m00 &
+           value.m01 &
+           value.m10 &
+           value.m11 &
+           value.m20 &
+           value.m21 &
+           value.m30 &
            value.m31;
 }
 
@@ -10133,17 +10639,17 @@ constexpr bool ggm::all_of(Matrix4x2<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix4x3<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
-           value.m10 &&
-           value.m11 &&
-           value.m12 &&
-           value.m20 &&
-           value.m21 &&
-           value.m22 &&
-           value.m30 &&
-           value.m31 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
+           value.m10 &
+           value.m11 &
+           value.m12 &
+           value.m20 &
+           value.m21 &
+           value.m22 &
+           value.m30 &
+           value.m31 &
            value.m32;
 }
 
@@ -10151,21 +10657,21 @@ constexpr bool ggm::all_of(Matrix4x3<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Matrix4x4<bool> const & value) noexcept
 {
-    return value.m00 &&
-           value.m01 &&
-           value.m02 &&
-           value.m03 &&
-           value.m10 &&
-           value.m11 &&
-           value.m12 &&
-           value.m13 &&
-           value.m20 &&
-           value.m21 &&
-           value.m22 &&
-           value.m23 &&
-           value.m30 &&
-           value.m31 &&
-           value.m32 &&
+    return value.m00 &
+           value.m01 &
+           value.m02 &
+           value.m03 &
+           value.m10 &
+           value.m11 &
+           value.m12 &
+           value.m13 &
+           value.m20 &
+           value.m21 &
+           value.m22 &
+           value.m23 &
+           value.m30 &
+           value.m31 &
+           value.m32 &
            value.m33;
 }
 
@@ -10180,7 +10686,7 @@ constexpr bool ggm::any_of(Matrix1x1<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix1x2<bool> const & value) noexcept
 {
-    return value.m00 ||
+    return value.m00 |
            value.m01;
 }
 
@@ -10188,8 +10694,8 @@ constexpr bool ggm::any_of(Matrix1x2<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix1x3<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
+    return value.m00 |
+           value.m01 |
            value.m02;
 }
 
@@ -10197,9 +10703,9 @@ constexpr bool ggm::any_of(Matrix1x3<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix1x4<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
            value.m03;
 }
 
@@ -10207,7 +10713,7 @@ constexpr bool ggm::any_of(Matrix1x4<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix2x1<bool> const & value) noexcept
 {
-    return value.m00 ||
+    return value.m00 |
            value.m10;
 }
 
@@ -10215,9 +10721,9 @@ constexpr bool ggm::any_of(Matrix2x1<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix2x2<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m10 ||
+    return value.m00 |
+           value.m01 |
+           value.m10 |
            value.m11;
 }
 
@@ -10225,11 +10731,11 @@ constexpr bool ggm::any_of(Matrix2x2<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix2x3<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
-           value.m10 ||
-           value.m11 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
+           value.m10 |
+           value.m11 |
            value.m12;
 }
 
@@ -10237,13 +10743,13 @@ constexpr bool ggm::any_of(Matrix2x3<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix2x4<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
-           value.m03 ||
-           value.m10 ||
-           value.m11 ||
-           value.m12 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
+           value.m03 |
+           value.m10 |
+           value.m11 |
+           value.m12 |
            value.m13;
 }
 
@@ -10251,8 +10757,8 @@ constexpr bool ggm::any_of(Matrix2x4<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix3x1<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m10 ||
+    return value.m00 |
+           value.m10 |
            value.m20;
 }
 
@@ -10260,11 +10766,11 @@ constexpr bool ggm::any_of(Matrix3x1<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix3x2<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m10 ||
-           value.m11 ||
-           value.m20 ||
+    return value.m00 |
+           value.m01 |
+           value.m10 |
+           value.m11 |
+           value.m20 |
            value.m21;
 }
 
@@ -10272,14 +10778,14 @@ constexpr bool ggm::any_of(Matrix3x2<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix3x3<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
-           value.m10 ||
-           value.m11 ||
-           value.m12 ||
-           value.m20 ||
-           value.m21 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
+           value.m10 |
+           value.m11 |
+           value.m12 |
+           value.m20 |
+           value.m21 |
            value.m22;
 }
 
@@ -10287,17 +10793,17 @@ constexpr bool ggm::any_of(Matrix3x3<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix3x4<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
-           value.m03 ||
-           value.m10 ||
-           value.m11 ||
-           value.m12 ||
-           value.m13 ||
-           value.m20 ||
-           value.m21 ||
-           value.m22 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
+           value.m03 |
+           value.m10 |
+           value.m11 |
+           value.m12 |
+           value.m13 |
+           value.m20 |
+           value.m21 |
+           value.m22 |
            value.m23;
 }
 
@@ -10305,9 +10811,9 @@ constexpr bool ggm::any_of(Matrix3x4<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix4x1<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m10 ||
-           value.m20 ||
+    return value.m00 |
+           value.m10 |
+           value.m20 |
            value.m30;
 }
 
@@ -10315,13 +10821,13 @@ constexpr bool ggm::any_of(Matrix4x1<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix4x2<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m10 ||
-           value.m11 ||
-           value.m20 ||
-           value.m21 ||
-           value.m30 ||
+    return value.m00 |
+           value.m01 |
+           value.m10 |
+           value.m11 |
+           value.m20 |
+           value.m21 |
+           value.m30 |
            value.m31;
 }
 
@@ -10329,17 +10835,17 @@ constexpr bool ggm::any_of(Matrix4x2<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix4x3<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
-           value.m10 ||
-           value.m11 ||
-           value.m12 ||
-           value.m20 ||
-           value.m21 ||
-           value.m22 ||
-           value.m30 ||
-           value.m31 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
+           value.m10 |
+           value.m11 |
+           value.m12 |
+           value.m20 |
+           value.m21 |
+           value.m22 |
+           value.m30 |
+           value.m31 |
            value.m32;
 }
 
@@ -10347,21 +10853,21 @@ constexpr bool ggm::any_of(Matrix4x3<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Matrix4x4<bool> const & value) noexcept
 {
-    return value.m00 ||
-           value.m01 ||
-           value.m02 ||
-           value.m03 ||
-           value.m10 ||
-           value.m11 ||
-           value.m12 ||
-           value.m13 ||
-           value.m20 ||
-           value.m21 ||
-           value.m22 ||
-           value.m23 ||
-           value.m30 ||
-           value.m31 ||
-           value.m32 ||
+    return value.m00 |
+           value.m01 |
+           value.m02 |
+           value.m03 |
+           value.m10 |
+           value.m11 |
+           value.m12 |
+           value.m13 |
+           value.m20 |
+           value.m21 |
+           value.m22 |
+           value.m23 |
+           value.m30 |
+           value.m31 |
+           value.m32 |
            value.m33;
 }
 
@@ -10376,7 +10882,7 @@ constexpr bool ggm::none_of(Matrix1x1<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix1x2<bool> const & value) noexcept
 {
-    return !value.m00 &&
+    return !value.m00 &
            !value.m01;
 }
 
@@ -10384,8 +10890,8 @@ constexpr bool ggm::none_of(Matrix1x2<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix1x3<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
+    return !value.m00 &
+           !value.m01 &
            !value.m02;
 }
 
@@ -10393,9 +10899,9 @@ constexpr bool ggm::none_of(Matrix1x3<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix1x4<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
            !value.m03;
 }
 
@@ -10403,7 +10909,7 @@ constexpr bool ggm::none_of(Matrix1x4<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix2x1<bool> const & value) noexcept
 {
-    return !value.m00 &&
+    return !value.m00 &
            !value.m10;
 }
 
@@ -10411,9 +10917,9 @@ constexpr bool ggm::none_of(Matrix2x1<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix2x2<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m10 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m10 &
            !value.m11;
 }
 
@@ -10421,11 +10927,11 @@ constexpr bool ggm::none_of(Matrix2x2<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix2x3<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
-           !value.m10 &&
-           !value.m11 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
+           !value.m10 &
+           !value.m11 &
            !value.m12;
 }
 
@@ -10433,13 +10939,13 @@ constexpr bool ggm::none_of(Matrix2x3<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix2x4<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
-           !value.m03 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m12 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
+           !value.m03 &
+           !value.m10 &
+           !value.m11 &
+           !value.m12 &
            !value.m13;
 }
 
@@ -10447,8 +10953,8 @@ constexpr bool ggm::none_of(Matrix2x4<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix3x1<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m10 &&
+    return !value.m00 &
+           !value.m10 &
            !value.m20;
 }
 
@@ -10456,11 +10962,11 @@ constexpr bool ggm::none_of(Matrix3x1<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix3x2<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m20 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m10 &
+           !value.m11 &
+           !value.m20 &
            !value.m21;
 }
 
@@ -10468,14 +10974,14 @@ constexpr bool ggm::none_of(Matrix3x2<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix3x3<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m12 &&
-           !value.m20 &&
-           !value.m21 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
+           !value.m10 &
+           !value.m11 &
+           !value.m12 &
+           !value.m20 &
+           !value.m21 &
            !value.m22;
 }
 
@@ -10483,17 +10989,17 @@ constexpr bool ggm::none_of(Matrix3x3<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix3x4<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
-           !value.m03 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m12 &&
-           !value.m13 &&
-           !value.m20 &&
-           !value.m21 &&
-           !value.m22 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
+           !value.m03 &
+           !value.m10 &
+           !value.m11 &
+           !value.m12 &
+           !value.m13 &
+           !value.m20 &
+           !value.m21 &
+           !value.m22 &
            !value.m23;
 }
 
@@ -10501,9 +11007,9 @@ constexpr bool ggm::none_of(Matrix3x4<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix4x1<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m10 &&
-           !value.m20 &&
+    return !value.m00 &
+           !value.m10 &
+           !value.m20 &
            !value.m30;
 }
 
@@ -10511,13 +11017,13 @@ constexpr bool ggm::none_of(Matrix4x1<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix4x2<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m20 &&
-           !value.m21 &&
-           !value.m30 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m10 &
+           !value.m11 &
+           !value.m20 &
+           !value.m21 &
+           !value.m30 &
            !value.m31;
 }
 
@@ -10525,17 +11031,17 @@ constexpr bool ggm::none_of(Matrix4x2<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix4x3<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m12 &&
-           !value.m20 &&
-           !value.m21 &&
-           !value.m22 &&
-           !value.m30 &&
-           !value.m31 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
+           !value.m10 &
+           !value.m11 &
+           !value.m12 &
+           !value.m20 &
+           !value.m21 &
+           !value.m22 &
+           !value.m30 &
+           !value.m31 &
            !value.m32;
 }
 
@@ -10543,30 +11049,30 @@ constexpr bool ggm::none_of(Matrix4x3<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Matrix4x4<bool> const & value) noexcept
 {
-    return !value.m00 &&
-           !value.m01 &&
-           !value.m02 &&
-           !value.m03 &&
-           !value.m10 &&
-           !value.m11 &&
-           !value.m12 &&
-           !value.m13 &&
-           !value.m20 &&
-           !value.m21 &&
-           !value.m22 &&
-           !value.m23 &&
-           !value.m30 &&
-           !value.m31 &&
-           !value.m32 &&
+    return !value.m00 &
+           !value.m01 &
+           !value.m02 &
+           !value.m03 &
+           !value.m10 &
+           !value.m11 &
+           !value.m12 &
+           !value.m13 &
+           !value.m20 &
+           !value.m21 &
+           !value.m22 &
+           !value.m23 &
+           !value.m30 &
+           !value.m31 &
+           !value.m32 &
            !value.m33;
 }
 
 // =============================================================================
 
 template <typename T>
-inline ggm::Matrix1x1<bool> ggm::is_close(Matrix1x1<T> const & lhs,
-                                          Matrix1x1<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix1x1<bool> ggm::is_close(Matrix1x1<T> const & lhs,
+                                             Matrix1x1<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix1x1<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10576,9 +11082,9 @@ inline ggm::Matrix1x1<bool> ggm::is_close(Matrix1x1<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix1x2<bool> ggm::is_close(Matrix1x2<T> const & lhs,
-                                          Matrix1x2<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix1x2<bool> ggm::is_close(Matrix1x2<T> const & lhs,
+                                             Matrix1x2<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix1x2<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10589,9 +11095,9 @@ inline ggm::Matrix1x2<bool> ggm::is_close(Matrix1x2<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix1x3<bool> ggm::is_close(Matrix1x3<T> const & lhs,
-                                          Matrix1x3<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix1x3<bool> ggm::is_close(Matrix1x3<T> const & lhs,
+                                             Matrix1x3<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix1x3<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10603,9 +11109,9 @@ inline ggm::Matrix1x3<bool> ggm::is_close(Matrix1x3<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix1x4<bool> ggm::is_close(Matrix1x4<T> const & lhs,
-                                          Matrix1x4<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix1x4<bool> ggm::is_close(Matrix1x4<T> const & lhs,
+                                             Matrix1x4<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix1x4<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10618,9 +11124,9 @@ inline ggm::Matrix1x4<bool> ggm::is_close(Matrix1x4<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix2x1<bool> ggm::is_close(Matrix2x1<T> const & lhs,
-                                          Matrix2x1<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix2x1<bool> ggm::is_close(Matrix2x1<T> const & lhs,
+                                             Matrix2x1<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix2x1<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10631,9 +11137,9 @@ inline ggm::Matrix2x1<bool> ggm::is_close(Matrix2x1<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix2x2<bool> ggm::is_close(Matrix2x2<T> const & lhs,
-                                          Matrix2x2<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix2x2<bool> ggm::is_close(Matrix2x2<T> const & lhs,
+                                             Matrix2x2<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix2x2<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10646,9 +11152,9 @@ inline ggm::Matrix2x2<bool> ggm::is_close(Matrix2x2<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix2x3<bool> ggm::is_close(Matrix2x3<T> const & lhs,
-                                          Matrix2x3<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix2x3<bool> ggm::is_close(Matrix2x3<T> const & lhs,
+                                             Matrix2x3<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix2x3<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10663,9 +11169,9 @@ inline ggm::Matrix2x3<bool> ggm::is_close(Matrix2x3<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix2x4<bool> ggm::is_close(Matrix2x4<T> const & lhs,
-                                          Matrix2x4<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix2x4<bool> ggm::is_close(Matrix2x4<T> const & lhs,
+                                             Matrix2x4<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix2x4<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10682,9 +11188,9 @@ inline ggm::Matrix2x4<bool> ggm::is_close(Matrix2x4<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix3x1<bool> ggm::is_close(Matrix3x1<T> const & lhs,
-                                          Matrix3x1<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix3x1<bool> ggm::is_close(Matrix3x1<T> const & lhs,
+                                             Matrix3x1<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix3x1<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10696,9 +11202,9 @@ inline ggm::Matrix3x1<bool> ggm::is_close(Matrix3x1<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix3x2<bool> ggm::is_close(Matrix3x2<T> const & lhs,
-                                          Matrix3x2<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix3x2<bool> ggm::is_close(Matrix3x2<T> const & lhs,
+                                             Matrix3x2<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix3x2<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10713,9 +11219,9 @@ inline ggm::Matrix3x2<bool> ggm::is_close(Matrix3x2<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix3x3<bool> ggm::is_close(Matrix3x3<T> const & lhs,
-                                          Matrix3x3<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix3x3<bool> ggm::is_close(Matrix3x3<T> const & lhs,
+                                             Matrix3x3<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix3x3<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10733,9 +11239,9 @@ inline ggm::Matrix3x3<bool> ggm::is_close(Matrix3x3<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix3x4<bool> ggm::is_close(Matrix3x4<T> const & lhs,
-                                          Matrix3x4<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix3x4<bool> ggm::is_close(Matrix3x4<T> const & lhs,
+                                             Matrix3x4<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix3x4<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10756,9 +11262,9 @@ inline ggm::Matrix3x4<bool> ggm::is_close(Matrix3x4<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix4x1<bool> ggm::is_close(Matrix4x1<T> const & lhs,
-                                          Matrix4x1<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix4x1<bool> ggm::is_close(Matrix4x1<T> const & lhs,
+                                             Matrix4x1<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix4x1<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10771,9 +11277,9 @@ inline ggm::Matrix4x1<bool> ggm::is_close(Matrix4x1<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix4x2<bool> ggm::is_close(Matrix4x2<T> const & lhs,
-                                          Matrix4x2<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix4x2<bool> ggm::is_close(Matrix4x2<T> const & lhs,
+                                             Matrix4x2<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix4x2<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10790,9 +11296,9 @@ inline ggm::Matrix4x2<bool> ggm::is_close(Matrix4x2<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix4x3<bool> ggm::is_close(Matrix4x3<T> const & lhs,
-                                          Matrix4x3<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix4x3<bool> ggm::is_close(Matrix4x3<T> const & lhs,
+                                             Matrix4x3<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix4x3<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10813,9 +11319,9 @@ inline ggm::Matrix4x3<bool> ggm::is_close(Matrix4x3<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Matrix4x4<bool> ggm::is_close(Matrix4x4<T> const & lhs,
-                                          Matrix4x4<T> const & rhs,
-                                          T const &            epsilon) noexcept
+constexpr ggm::Matrix4x4<bool> ggm::is_close(Matrix4x4<T> const & lhs,
+                                             Matrix4x4<T> const & rhs,
+                                             T const &            epsilon) noexcept
 {
     return Matrix4x4<bool>{
         is_close(lhs.m00, rhs.m00, epsilon),
@@ -10839,6 +11345,282 @@ inline ggm::Matrix4x4<bool> ggm::is_close(Matrix4x4<T> const & lhs,
 
 // =============================================================================
 
+template <typename T>
+constexpr ggm::Matrix1x1<bool> ggm::is_close_ulps(Matrix1x1<T> const & lhs,
+                                                  Matrix1x1<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix1x1<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix1x2<bool> ggm::is_close_ulps(Matrix1x2<T> const & lhs,
+                                                  Matrix1x2<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix1x2<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix1x3<bool> ggm::is_close_ulps(Matrix1x3<T> const & lhs,
+                                                  Matrix1x3<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix1x3<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix1x4<bool> ggm::is_close_ulps(Matrix1x4<T> const & lhs,
+                                                  Matrix1x4<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix1x4<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m03, rhs.m03, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x1<bool> ggm::is_close_ulps(Matrix2x1<T> const & lhs,
+                                                  Matrix2x1<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix2x1<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x2<bool> ggm::is_close_ulps(Matrix2x2<T> const & lhs,
+                                                  Matrix2x2<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix2x2<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x3<bool> ggm::is_close_ulps(Matrix2x3<T> const & lhs,
+                                                  Matrix2x3<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix2x3<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m12, rhs.m12, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix2x4<bool> ggm::is_close_ulps(Matrix2x4<T> const & lhs,
+                                                  Matrix2x4<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix2x4<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m03, rhs.m03, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m12, rhs.m12, maxUlps),
+        is_close_ulps(lhs.m13, rhs.m13, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x1<bool> ggm::is_close_ulps(Matrix3x1<T> const & lhs,
+                                                  Matrix3x1<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix3x1<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x2<bool> ggm::is_close_ulps(Matrix3x2<T> const & lhs,
+                                                  Matrix3x2<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix3x2<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m21, rhs.m21, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x3<bool> ggm::is_close_ulps(Matrix3x3<T> const & lhs,
+                                                  Matrix3x3<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix3x3<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m12, rhs.m12, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m21, rhs.m21, maxUlps),
+        is_close_ulps(lhs.m22, rhs.m22, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix3x4<bool> ggm::is_close_ulps(Matrix3x4<T> const & lhs,
+                                                  Matrix3x4<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix3x4<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m03, rhs.m03, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m12, rhs.m12, maxUlps),
+        is_close_ulps(lhs.m13, rhs.m13, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m21, rhs.m21, maxUlps),
+        is_close_ulps(lhs.m22, rhs.m22, maxUlps),
+        is_close_ulps(lhs.m23, rhs.m23, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x1<bool> ggm::is_close_ulps(Matrix4x1<T> const & lhs,
+                                                  Matrix4x1<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix4x1<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m30, rhs.m30, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x2<bool> ggm::is_close_ulps(Matrix4x2<T> const & lhs,
+                                                  Matrix4x2<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix4x2<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m21, rhs.m21, maxUlps),
+        is_close_ulps(lhs.m30, rhs.m30, maxUlps),
+        is_close_ulps(lhs.m31, rhs.m31, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x3<bool> ggm::is_close_ulps(Matrix4x3<T> const & lhs,
+                                                  Matrix4x3<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix4x3<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m12, rhs.m12, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m21, rhs.m21, maxUlps),
+        is_close_ulps(lhs.m22, rhs.m22, maxUlps),
+        is_close_ulps(lhs.m30, rhs.m30, maxUlps),
+        is_close_ulps(lhs.m31, rhs.m31, maxUlps),
+        is_close_ulps(lhs.m32, rhs.m32, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Matrix4x4<bool> ggm::is_close_ulps(Matrix4x4<T> const & lhs,
+                                                  Matrix4x4<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Matrix4x4<bool>{
+        is_close_ulps(lhs.m00, rhs.m00, maxUlps),
+        is_close_ulps(lhs.m01, rhs.m01, maxUlps),
+        is_close_ulps(lhs.m02, rhs.m02, maxUlps),
+        is_close_ulps(lhs.m03, rhs.m03, maxUlps),
+        is_close_ulps(lhs.m10, rhs.m10, maxUlps),
+        is_close_ulps(lhs.m11, rhs.m11, maxUlps),
+        is_close_ulps(lhs.m12, rhs.m12, maxUlps),
+        is_close_ulps(lhs.m13, rhs.m13, maxUlps),
+        is_close_ulps(lhs.m20, rhs.m20, maxUlps),
+        is_close_ulps(lhs.m21, rhs.m21, maxUlps),
+        is_close_ulps(lhs.m22, rhs.m22, maxUlps),
+        is_close_ulps(lhs.m23, rhs.m23, maxUlps),
+        is_close_ulps(lhs.m30, rhs.m30, maxUlps),
+        is_close_ulps(lhs.m31, rhs.m31, maxUlps),
+        is_close_ulps(lhs.m32, rhs.m32, maxUlps),
+        is_close_ulps(lhs.m33, rhs.m33, maxUlps),
+    };
+}
+
+// =============================================================================
+
 template <typename T>
 constexpr ggm::Matrix1x1<bool> ggm::is_equal(Matrix1x1<T> const & lhs,
                                              Matrix1x1<T> const & rhs) noexcept
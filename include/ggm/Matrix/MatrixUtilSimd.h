@@ -0,0 +1,705 @@
+#pragma once
+#ifndef GGM_MATRIX_UTIL_SIMD_H
+#define GGM_MATRIX_UTIL_SIMD_H
+
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Numeric/NumericConstants.h"
+#include "ggm/Numeric/NumericUtil.h"
+
+#include <type_traits>
+
+// the functions use SSE2 (the x86-64 baseline) when the target has it, otherwise they call the generic templates.
+// double also uses AVX2 when the target has it (e.g. -mavx2, -march=haswell, /arch:AVX2), AVX alone has no
+// cross-lane permute for the swizzles of inverse. both use the FMA3 instructions when the GGM_USE_FMA option is
+// enabled & the target has them (e.g. -mfma, -march=haswell, /arch:AVX2), like multiply_add
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define GGM_SSE2() 1
+#include <immintrin.h>
+#else
+#define GGM_SSE2() 0
+#endif
+
+#if GGM_SSE2() && defined(__AVX2__)
+#define GGM_AVX2() 1
+#else
+#define GGM_AVX2() 0
+#endif
+
+#if GGM_SSE2() && defined(GGM_USE_FMA) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define GGM_SIMD_FMA() 1
+#else
+#define GGM_SIMD_FMA() 0
+#endif
+
+// =============================================================================
+/// @addtogroup Matrix
+/// @{
+/// @details
+///
+/// SIMD versions of the 4x4 & affine matrix-matrix functions for float & double, which the auto vectorizer
+/// often fails to vectorize in the generic templates.
+///
+/// - the functions have their own names (rather than overloading operator*, inverse & transform), so including
+///   this header doesn't change which function any other call resolves to, & call the generic templates in
+///   constant evaluation
+/// - multiply_simd & transform_simd compute the same products as the generic templates, accumulated in the same
+///   order, so they are equal to the generic templates within tolerance: the compiler may contract the products
+///   & sums of the generic templates into FMA instructions (e.g. GCC with -mfma, which differs by up to 9.5e-7
+///   for float), but not the intrinsics here (which only fuse with GGM_USE_FMA)
+/// - inverse_simd uses the 2x2 block (Schur complement) method, i.e. the same cofactors as the generic template
+///   with the products grouped differently, so it is equal to the generic template within tolerance
+///
+/// Syntax                       | Description
+/// ------                       | -----------
+/// m1 = multiply_simd(m2, m3);  | Matrix4x4<float|double> matrix-matrix multiplication
+/// m1 = inverse_simd(m2);       | Matrix4x4<float|double> inverse, the zero matrix if not invertible
+/// t1 = transform_simd(t2, t3); | MatrixTransform3D<float|double> concatenation
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+
+    /// matrix-matrix multiplication, with SSE2
+    /// @relates Matrix4x4
+    constexpr Matrix4x4<float> multiply_simd(Matrix4x4<float> const & lhs,
+                                             Matrix4x4<float> const & rhs) noexcept;
+
+    /// matrix-matrix multiplication, with SSE2 or AVX2
+    /// @relates Matrix4x4
+    constexpr Matrix4x4<double> multiply_simd(Matrix4x4<double> const & lhs,
+                                              Matrix4x4<double> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// calculate inverse, with SSE2
+    /// @relates Matrix4x4
+    constexpr Matrix4x4<float> inverse_simd(Matrix4x4<float> const & value,
+                                            float const &            epsilon = DefaultTolerance<float>) noexcept;
+
+    /// calculate inverse, with SSE2 or AVX2
+    /// @relates Matrix4x4
+    constexpr Matrix4x4<double> inverse_simd(Matrix4x4<double> const & value,
+                                             double const &            epsilon = DefaultTolerance<double>) noexcept;
+
+    // =============================================================================
+
+    /// matrix-matrix multiplication (transform concatentation), with SSE2
+    /// @relates MatrixTransform3D
+    constexpr MatrixTransform3D<float> transform_simd(MatrixTransform3D<float> const & lhs,
+                                                      MatrixTransform3D<float> const & rhs) noexcept;
+
+    /// matrix-matrix multiplication (transform concatentation), with SSE2 or AVX2
+    /// @relates MatrixTransform3D
+    constexpr MatrixTransform3D<double> transform_simd(MatrixTransform3D<double> const & lhs,
+                                                       MatrixTransform3D<double> const & rhs) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+#if GGM_SSE2()
+
+namespace ggm::MatrixSimdImpl
+{
+    // =============================================================================
+    // registers of 4 lanes:
+    // =============================================================================
+
+    /// 4 floats in an SSE register
+    struct Float4
+    {
+        typedef float  Value;
+        typedef __m128 Register;
+
+        static Register load(float const * const values) noexcept
+        {
+            return _mm_loadu_ps(values);
+        }
+
+        static void store(float * const values,
+                          Register const value) noexcept
+        {
+            _mm_storeu_ps(values, value);
+        }
+
+        static Register set1(float const value) noexcept
+        {
+            return _mm_set1_ps(value);
+        }
+
+        static Register setr(float const value0,
+                             float const value1,
+                             float const value2,
+                             float const value3) noexcept
+        {
+            return _mm_setr_ps(value0, value1, value2, value3);
+        }
+
+        static Register add(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return _mm_add_ps(lhs, rhs);
+        }
+
+        static Register sub(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return _mm_sub_ps(lhs, rhs);
+        }
+
+        static Register mul(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return _mm_mul_ps(lhs, rhs);
+        }
+
+        static Register multiply_add(Register const lhs,
+                                     Register const rhs,
+                                     Register const addend) noexcept
+        {
+#if GGM_SIMD_FMA()
+            return _mm_fmadd_ps(lhs, rhs, addend);
+#else
+            return _mm_add_ps(_mm_mul_ps(lhs, rhs), addend);
+#endif
+        }
+
+        /// { value[I0], value[I1], value[I2], value[I3] }
+        template <int I0, int I1, int I2, int I3>
+        static Register swizzle(Register const value) noexcept
+        {
+            return _mm_shuffle_ps(value, value, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        /// { lhs[I0], lhs[I1], rhs[I2], rhs[I3] }
+        template <int I0, int I1, int I2, int I3>
+        static Register shuffle(Register const lhs,
+                                Register const rhs) noexcept
+        {
+            return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        static float first(Register const value) noexcept
+        {
+            return _mm_cvtss_f32(value);
+        }
+    };
+
+    // -----------------------------------------------------------------------------
+
+#if GGM_AVX2()
+
+    /// 4 doubles in an AVX2 register
+    struct Double4
+    {
+        typedef double  Value;
+        typedef __m256d Register;
+
+        static Register load(double const * const values) noexcept
+        {
+            return _mm256_loadu_pd(values);
+        }
+
+        static void store(double * const values,
+                          Register const value) noexcept
+        {
+            _mm256_storeu_pd(values, value);
+        }
+
+        static Register set1(double const value) noexcept
+        {
+            return _mm256_set1_pd(value);
+        }
+
+        static Register setr(double const value0,
+                             double const value1,
+                             double const value2,
+                             double const value3) noexcept
+        {
+            return _mm256_setr_pd(value0, value1, value2, value3);
+        }
+
+        static Register add(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return _mm256_add_pd(lhs, rhs);
+        }
+
+        static Register sub(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return _mm256_sub_pd(lhs, rhs);
+        }
+
+        static Register mul(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return _mm256_mul_pd(lhs, rhs);
+        }
+
+        static Register multiply_add(Register const lhs,
+                                     Register const rhs,
+                                     Register const addend) noexcept
+        {
+#if GGM_SIMD_FMA()
+            return _mm256_fmadd_pd(lhs, rhs, addend);
+#else
+            return _mm256_add_pd(_mm256_mul_pd(lhs, rhs), addend);
+#endif
+        }
+
+        /// { value[I0], value[I1], value[I2], value[I3] }
+        template <int I0, int I1, int I2, int I3>
+        static Register swizzle(Register const value) noexcept
+        {
+            return _mm256_permute4x64_pd(value, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        /// { lhs[I0], lhs[I1], rhs[I2], rhs[I3] }
+        template <int I0, int I1, int I2, int I3>
+        static Register shuffle(Register const lhs,
+                                Register const rhs) noexcept
+        {
+            return _mm256_blend_pd(swizzle<I0, I1, I0, I1>(lhs), swizzle<I2, I3, I2, I3>(rhs), 0b1100);
+        }
+
+        static double first(Register const value) noexcept
+        {
+            return _mm256_cvtsd_f64(value);
+        }
+    };
+
+#else
+
+    /// a pair of SSE2 registers, the Register of Double4 without AVX2
+    struct Double2x2
+    {
+        __m128d low;  // uninitialized
+        __m128d high; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// 4 doubles in a pair of SSE2 registers
+    struct Double4
+    {
+        typedef double    Value;
+        typedef Double2x2 Register;
+
+        static Register load(double const * const values) noexcept
+        {
+            return Register{ _mm_loadu_pd(values), _mm_loadu_pd(values + 2) };
+        }
+
+        static void store(double * const values,
+                          Register const value) noexcept
+        {
+            _mm_storeu_pd(values, value.low);
+            _mm_storeu_pd(values + 2, value.high);
+        }
+
+        static Register set1(double const value) noexcept
+        {
+            return Register{ _mm_set1_pd(value), _mm_set1_pd(value) };
+        }
+
+        static Register setr(double const value0,
+                             double const value1,
+                             double const value2,
+                             double const value3) noexcept
+        {
+            return Register{ _mm_setr_pd(value0, value1), _mm_setr_pd(value2, value3) };
+        }
+
+        static Register add(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return Register{ _mm_add_pd(lhs.low, rhs.low), _mm_add_pd(lhs.high, rhs.high) };
+        }
+
+        static Register sub(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return Register{ _mm_sub_pd(lhs.low, rhs.low), _mm_sub_pd(lhs.high, rhs.high) };
+        }
+
+        static Register mul(Register const lhs,
+                            Register const rhs) noexcept
+        {
+            return Register{ _mm_mul_pd(lhs.low, rhs.low), _mm_mul_pd(lhs.high, rhs.high) };
+        }
+
+        static Register multiply_add(Register const lhs,
+                                     Register const rhs,
+                                     Register const addend) noexcept
+        {
+#if GGM_SIMD_FMA()
+            return Register{ _mm_fmadd_pd(lhs.low, rhs.low, addend.low), _mm_fmadd_pd(lhs.high, rhs.high, addend.high) };
+#else
+            return add(mul(lhs, rhs), addend);
+#endif
+        }
+
+        /// { value[I0], value[I1] }
+        template <int I0, int I1>
+        static __m128d pick(Register const value) noexcept
+        {
+            __m128d const lhs = (I0 < 2) ? value.low : value.high;
+            __m128d const rhs = (I1 < 2) ? value.low : value.high;
+            return _mm_shuffle_pd(lhs, rhs, (I0 & 1) | ((I1 & 1) << 1));
+        }
+
+        /// { value[I0], value[I1], value[I2], value[I3] }
+        template <int I0, int I1, int I2, int I3>
+        static Register swizzle(Register const value) noexcept
+        {
+            return Register{ pick<I0, I1>(value), pick<I2, I3>(value) };
+        }
+
+        /// { lhs[I0], lhs[I1], rhs[I2], rhs[I3] }
+        template <int I0, int I1, int I2, int I3>
+        static Register shuffle(Register const lhs,
+                                Register const rhs) noexcept
+        {
+            return Register{ pick<I0, I1>(lhs), pick<I2, I3>(rhs) };
+        }
+
+        static double first(Register const value) noexcept
+        {
+            return _mm_cvtsd_f64(value.low);
+        }
+    };
+
+#endif
+
+    // =============================================================================
+
+    /// the rows of a Matrix4x4 or MatrixTransform3D, one register per row
+    template <typename Lanes, int RowCount>
+    struct Rows
+    {
+        typename Lanes::Register rows[RowCount]; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    // note: the rows are loaded & stored with unaligned loads & stores, rather than std::bit_cast of the whole
+    // matrix, which compilers copy through the stack (& the mismatched store & load sizes then stall store
+    // forwarding)
+
+    template <typename Lanes>
+    Rows<Lanes, 4> load_rows(Matrix4x4<typename Lanes::Value> const & value) noexcept
+    {
+        return Rows<Lanes, 4>{ { Lanes::load(&value.m00), Lanes::load(&value.m10), Lanes::load(&value.m20), Lanes::load(&value.m30) } };
+    }
+
+    template <typename Lanes>
+    Rows<Lanes, 3> load_rows(MatrixTransform3D<typename Lanes::Value> const & value) noexcept
+    {
+        return Rows<Lanes, 3>{ { Lanes::load(&value.m00), Lanes::load(&value.m10), Lanes::load(&value.m20) } };
+    }
+
+    template <typename Lanes>
+    Matrix4x4<typename Lanes::Value> store_rows(Rows<Lanes, 4> const & rows) noexcept
+    {
+        Matrix4x4<typename Lanes::Value> result;
+        Lanes::store(&result.m00, rows.rows[0]);
+        Lanes::store(&result.m10, rows.rows[1]);
+        Lanes::store(&result.m20, rows.rows[2]);
+        Lanes::store(&result.m30, rows.rows[3]);
+        return result;
+    }
+
+    template <typename Lanes>
+    MatrixTransform3D<typename Lanes::Value> store_rows(Rows<Lanes, 3> const & rows) noexcept
+    {
+        MatrixTransform3D<typename Lanes::Value> result;
+        Lanes::store(&result.m00, rows.rows[0]);
+        Lanes::store(&result.m10, rows.rows[1]);
+        Lanes::store(&result.m20, rows.rows[2]);
+        return result;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// lhs0 * rhs.row0 + lhs1 * rhs.row1 + lhs2 * rhs.row2, accumulated like sum_of_products
+    template <typename Lanes, int RowCount>
+    typename Lanes::Register row_product(typename Lanes::Value const lhs0,
+                                         typename Lanes::Value const lhs1,
+                                         typename Lanes::Value const lhs2,
+                                         Rows<Lanes, RowCount> const & rhs) noexcept
+    {
+        typename Lanes::Register const product = Lanes::mul(Lanes::set1(lhs0), rhs.rows[0]);
+        return Lanes::multiply_add(Lanes::set1(lhs2), rhs.rows[2], Lanes::multiply_add(Lanes::set1(lhs1), rhs.rows[1], product));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// lhs0 * rhs.row0 + lhs1 * rhs.row1 + lhs2 * rhs.row2 + lhs3 * rhs.row3, accumulated like sum_of_products
+    template <typename Lanes>
+    typename Lanes::Register row_product(typename Lanes::Value const lhs0,
+                                         typename Lanes::Value const lhs1,
+                                         typename Lanes::Value const lhs2,
+                                         typename Lanes::Value const lhs3,
+                                         Rows<Lanes, 4> const &      rhs) noexcept
+    {
+        return Lanes::multiply_add(Lanes::set1(lhs3), rhs.rows[3], row_product<Lanes, 4>(lhs0, lhs1, lhs2, rhs));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename Lanes>
+    inline Matrix4x4<typename Lanes::Value> multiply(Matrix4x4<typename Lanes::Value> const & lhs,
+                                                     Matrix4x4<typename Lanes::Value> const & rhs) noexcept
+    {
+        Rows<Lanes, 4> const rhsRows = load_rows<Lanes>(rhs);
+
+        return store_rows<Lanes>(Rows<Lanes, 4>{ {
+            row_product<Lanes>(lhs.m00, lhs.m01, lhs.m02, lhs.m03, rhsRows),
+            row_product<Lanes>(lhs.m10, lhs.m11, lhs.m12, lhs.m13, rhsRows),
+            row_product<Lanes>(lhs.m20, lhs.m21, lhs.m22, lhs.m23, rhsRows),
+            row_product<Lanes>(lhs.m30, lhs.m31, lhs.m32, lhs.m33, rhsRows),
+        } });
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename Lanes>
+    inline MatrixTransform3D<typename Lanes::Value> transform(MatrixTransform3D<typename Lanes::Value> const & lhs,
+                                                              MatrixTransform3D<typename Lanes::Value> const & rhs) noexcept
+    {
+        typedef typename Lanes::Value T;
+
+        // the implicit 4th row of rhs is { 0, 0, 0, 1 }, so lhs.m03 * rhs.row3 only adds lhs.m03 to col3
+        Rows<Lanes, 3> const rhsRows = load_rows<Lanes>(rhs);
+
+        return store_rows<Lanes>(Rows<Lanes, 3>{ {
+            Lanes::add(row_product<Lanes, 3>(lhs.m00, lhs.m01, lhs.m02, rhsRows), Lanes::setr(T{ 0 }, T{ 0 }, T{ 0 }, lhs.m03)),
+            Lanes::add(row_product<Lanes, 3>(lhs.m10, lhs.m11, lhs.m12, rhsRows), Lanes::setr(T{ 0 }, T{ 0 }, T{ 0 }, lhs.m13)),
+            Lanes::add(row_product<Lanes, 3>(lhs.m20, lhs.m21, lhs.m22, rhsRows), Lanes::setr(T{ 0 }, T{ 0 }, T{ 0 }, lhs.m23)),
+        } });
+    }
+
+    // =============================================================================
+    // 2x2 matrices, as the 4 lanes of a register in row-major order:
+    // =============================================================================
+
+    /// lhs * rhs
+    template <typename Lanes>
+    typename Lanes::Register matrix2x2_multiply(typename Lanes::Register const lhs,
+                                                typename Lanes::Register const rhs) noexcept
+    {
+        return Lanes::add(Lanes::mul(lhs, Lanes::template swizzle<0, 3, 0, 3>(rhs)),
+                          Lanes::mul(Lanes::template swizzle<1, 0, 3, 2>(lhs), Lanes::template swizzle<2, 1, 2, 1>(rhs)));
+    }
+
+    /// adjugate(lhs) * rhs
+    template <typename Lanes>
+    typename Lanes::Register matrix2x2_adjugate_multiply(typename Lanes::Register const lhs,
+                                                         typename Lanes::Register const rhs) noexcept
+    {
+        return Lanes::sub(Lanes::mul(Lanes::template swizzle<3, 3, 0, 0>(lhs), rhs),
+                          Lanes::mul(Lanes::template swizzle<1, 1, 2, 2>(lhs), Lanes::template swizzle<2, 3, 0, 1>(rhs)));
+    }
+
+    /// lhs * adjugate(rhs)
+    template <typename Lanes>
+    typename Lanes::Register matrix2x2_multiply_adjugate(typename Lanes::Register const lhs,
+                                                         typename Lanes::Register const rhs) noexcept
+    {
+        return Lanes::sub(Lanes::mul(lhs, Lanes::template swizzle<3, 0, 3, 0>(rhs)),
+                          Lanes::mul(Lanes::template swizzle<1, 0, 3, 2>(lhs), Lanes::template swizzle<2, 1, 2, 1>(rhs)));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename Lanes>
+    inline Matrix4x4<typename Lanes::Value> inverse(Matrix4x4<typename Lanes::Value> const & value,
+                                                    typename Lanes::Value const              epsilon) noexcept
+    {
+        typedef typename Lanes::Value    T;
+        typedef typename Lanes::Register Register;
+
+        // blockwise inversion, with value = | A B | for the 2x2 matrices A, B, C & D & # for the adjugate:
+        //                                 | C D |
+        //
+        // inverse(value) = 1/det * | X Y |, where X# = det(D) A - B (D# C)    Y# = det(B) C - D (A# B)#
+        //                          | Z W |        Z# = det(C) B - A (D# C)#   W# = det(A) D - C (A# B)
+        //
+        // & det = det(A) det(D) + det(B) det(C) - trace((A# B) (D# C)),
+        // see https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+
+        Rows<Lanes, 4> const rows = load_rows<Lanes>(value);
+
+        Register const a = Lanes::template shuffle<0, 1, 0, 1>(rows.rows[0], rows.rows[1]);
+        Register const b = Lanes::template shuffle<2, 3, 2, 3>(rows.rows[0], rows.rows[1]);
+        Register const c = Lanes::template shuffle<0, 1, 0, 1>(rows.rows[2], rows.rows[3]);
+        Register const d = Lanes::template shuffle<2, 3, 2, 3>(rows.rows[2], rows.rows[3]);
+
+        // { det(A), det(B), det(C), det(D) }
+        Register const detSub = Lanes::sub(Lanes::mul(Lanes::template shuffle<0, 2, 0, 2>(rows.rows[0], rows.rows[2]),
+                                                      Lanes::template shuffle<1, 3, 1, 3>(rows.rows[1], rows.rows[3])),
+                                           Lanes::mul(Lanes::template shuffle<1, 3, 1, 3>(rows.rows[0], rows.rows[2]),
+                                                      Lanes::template shuffle<0, 2, 0, 2>(rows.rows[1], rows.rows[3])));
+
+        Register const detA = Lanes::template swizzle<0, 0, 0, 0>(detSub);
+        Register const detB = Lanes::template swizzle<1, 1, 1, 1>(detSub);
+        Register const detC = Lanes::template swizzle<2, 2, 2, 2>(detSub);
+        Register const detD = Lanes::template swizzle<3, 3, 3, 3>(detSub);
+
+        Register const adjDC = matrix2x2_adjugate_multiply<Lanes>(d, c);
+        Register const adjAB = matrix2x2_adjugate_multiply<Lanes>(a, b);
+
+        Register const x = Lanes::sub(Lanes::mul(detD, a), matrix2x2_multiply<Lanes>(b, adjDC));
+        Register const w = Lanes::sub(Lanes::mul(detA, d), matrix2x2_multiply<Lanes>(c, adjAB));
+        Register const y = Lanes::sub(Lanes::mul(detB, c), matrix2x2_multiply_adjugate<Lanes>(d, adjAB));
+        Register const z = Lanes::sub(Lanes::mul(detC, b), matrix2x2_multiply_adjugate<Lanes>(a, adjDC));
+
+        // trace(adj(A) B adj(D) C), summed across the lanes
+        Register const traceProducts = Lanes::mul(adjAB, Lanes::template swizzle<0, 2, 1, 3>(adjDC));
+        Register const tracePairs    = Lanes::add(traceProducts, Lanes::template swizzle<1, 0, 3, 2>(traceProducts));
+        Register const trace         = Lanes::add(tracePairs, Lanes::template swizzle<2, 3, 0, 1>(tracePairs));
+
+        Register const detProducts = Lanes::add(Lanes::mul(detA, detD), Lanes::mul(detB, detC));
+        T const        det         = Lanes::first(Lanes::sub(detProducts, trace));
+
+        T const        invDet       = reciprocal(det, T{ 0 }, epsilon);
+        Register const signedInvDet = Lanes::setr(invDet, -invDet, -invDet, invDet);
+
+        Register const invX = Lanes::mul(x, signedInvDet);
+        Register const invY = Lanes::mul(y, signedInvDet);
+        Register const invZ = Lanes::mul(z, signedInvDet);
+        Register const invW = Lanes::mul(w, signedInvDet);
+
+        // the adjugate of each block, combined with the transpose of the blocks back into rows
+        return store_rows<Lanes>(Rows<Lanes, 4>{ {
+            Lanes::template shuffle<3, 1, 3, 1>(invX, invY),
+            Lanes::template shuffle<2, 0, 2, 0>(invX, invY),
+            Lanes::template shuffle<3, 1, 3, 1>(invZ, invW),
+            Lanes::template shuffle<2, 0, 2, 0>(invZ, invW),
+        } });
+    }
+
+    // =============================================================================
+} // namespace ggm::MatrixSimdImpl
+
+#endif // GGM_SSE2()
+
+// =============================================================================
+
+constexpr ggm::Matrix4x4<float> ggm::multiply_simd(Matrix4x4<float> const & lhs,
+                                                   Matrix4x4<float> const & rhs) noexcept
+{
+#if GGM_SSE2()
+    if (std::is_constant_evaluated())
+    {
+        return operator*<float>(lhs, rhs);
+    }
+
+    return MatrixSimdImpl::multiply<MatrixSimdImpl::Float4>(lhs, rhs);
+#else
+    return operator*<float>(lhs, rhs);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Matrix4x4<double> ggm::multiply_simd(Matrix4x4<double> const & lhs,
+                                                    Matrix4x4<double> const & rhs) noexcept
+{
+#if GGM_SSE2()
+    if (std::is_constant_evaluated())
+    {
+        return operator*<double>(lhs, rhs);
+    }
+
+    return MatrixSimdImpl::multiply<MatrixSimdImpl::Double4>(lhs, rhs);
+#else
+    return operator*<double>(lhs, rhs);
+#endif
+}
+
+// =============================================================================
+
+constexpr ggm::Matrix4x4<float> ggm::inverse_simd(Matrix4x4<float> const & value,
+                                                  float const &            epsilon) noexcept
+{
+#if GGM_SSE2()
+    if (std::is_constant_evaluated())
+    {
+        return inverse<float>(value, epsilon);
+    }
+
+    return MatrixSimdImpl::inverse<MatrixSimdImpl::Float4>(value, epsilon);
+#else
+    return inverse<float>(value, epsilon);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Matrix4x4<double> ggm::inverse_simd(Matrix4x4<double> const & value,
+                                                   double const &            epsilon) noexcept
+{
+#if GGM_SSE2()
+    if (std::is_constant_evaluated())
+    {
+        return inverse<double>(value, epsilon);
+    }
+
+    return MatrixSimdImpl::inverse<MatrixSimdImpl::Double4>(value, epsilon);
+#else
+    return inverse<double>(value, epsilon);
+#endif
+}
+
+// =============================================================================
+
+constexpr ggm::MatrixTransform3D<float> ggm::transform_simd(MatrixTransform3D<float> const & lhs,
+                                                            MatrixTransform3D<float> const & rhs) noexcept
+{
+#if GGM_SSE2()
+    if (std::is_constant_evaluated())
+    {
+        return transform<float>(lhs, rhs);
+    }
+
+    return MatrixSimdImpl::transform<MatrixSimdImpl::Float4>(lhs, rhs);
+#else
+    return transform<float>(lhs, rhs);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::MatrixTransform3D<double> ggm::transform_simd(MatrixTransform3D<double> const & lhs,
+                                                             MatrixTransform3D<double> const & rhs) noexcept
+{
+#if GGM_SSE2()
+    if (std::is_constant_evaluated())
+    {
+        return transform<double>(lhs, rhs);
+    }
+
+    return MatrixSimdImpl::transform<MatrixSimdImpl::Double4>(lhs, rhs);
+#else
+    return transform<double>(lhs, rhs);
+#endif
+}
+
+// =============================================================================
+
+#undef GGM_SSE2
+#undef GGM_AVX2
+#undef GGM_SIMD_FMA
+
+#endif // GGM_MATRIX_UTIL_SIMD_H
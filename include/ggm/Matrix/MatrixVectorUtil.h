@@ -653,49 +653,49 @@ namespace ggm
     /// @relates Vector2D
     /// @relates Matrix1x2
     template <typename T>
-    inline Vector2D<bool> is_close(Vector2D<T> const &  lhs,
-                                   Matrix1x2<T> const & rhs,
-                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector2D<bool> is_close(Vector2D<T> const &  lhs,
+                                      Matrix1x2<T> const & rhs,
+                                      T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// matrix-vector equality
     /// @relates Matrix1x2
     /// @relates Vector2D
     template <typename T>
-    inline Vector2D<bool> is_close(Matrix1x2<T> const & lhs,
-                                   Vector2D<T> const &  rhs,
-                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector2D<bool> is_close(Matrix1x2<T> const & lhs,
+                                      Vector2D<T> const &  rhs,
+                                      T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Vector3D
     /// @relates Matrix1x3
     template <typename T>
-    inline Vector3D<bool> is_close(Vector3D<T> const &  lhs,
-                                   Matrix1x3<T> const & rhs,
-                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector3D<bool> is_close(Vector3D<T> const &  lhs,
+                                      Matrix1x3<T> const & rhs,
+                                      T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// matrix-vector equality
     /// @relates Matrix1x3
     /// @relates Vector3D
     template <typename T>
-    inline Vector3D<bool> is_close(Matrix1x3<T> const & lhs,
-                                   Vector3D<T> const &  rhs,
-                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector3D<bool> is_close(Matrix1x3<T> const & lhs,
+                                      Vector3D<T> const &  rhs,
+                                      T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Vector4D
     /// @relates Matrix1x4
     template <typename T>
-    inline Vector4D<bool> is_close(Vector4D<T> const &  lhs,
-                                   Matrix1x4<T> const & rhs,
-                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector4D<bool> is_close(Vector4D<T> const &  lhs,
+                                      Matrix1x4<T> const & rhs,
+                                      T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     /// matrix-vector equality
     /// @relates Matrix1x4
     /// @relates Vector4D
     template <typename T>
-    inline Vector4D<bool> is_close(Matrix1x4<T> const & lhs,
-                                   Vector4D<T> const &  rhs,
-                                   T const &            epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector4D<bool> is_close(Matrix1x4<T> const & lhs,
+                                      Vector4D<T> const &  rhs,
+                                      T const &            epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
@@ -977,8 +977,8 @@ constexpr ggm::Vector2D<T> ggm::operator*(Vector2D<T> const &  lhs,
                                           Matrix2x2<T> const & rhs) noexcept
 {
     return Vector2D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11),
     };
 }
 
@@ -989,8 +989,8 @@ constexpr ggm::Vector2D<T> ggm::operator*(Vector3D<T> const &  lhs,
                                           Matrix3x2<T> const & rhs) noexcept
 {
     return Vector2D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10) + (lhs.z * rhs.m20),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11) + (lhs.z * rhs.m21),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10, lhs.z, rhs.m20),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11, lhs.z, rhs.m21),
     };
 }
 
@@ -1001,8 +1001,8 @@ constexpr ggm::Vector2D<T> ggm::operator*(Vector4D<T> const &  lhs,
                                           Matrix4x2<T> const & rhs) noexcept
 {
     return Vector2D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10) + (lhs.z * rhs.m20) + (lhs.w * rhs.m30),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11) + (lhs.z * rhs.m21) + (lhs.w * rhs.m31),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10, lhs.z, rhs.m20, lhs.w, rhs.m30),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11, lhs.z, rhs.m21, lhs.w, rhs.m31),
     };
 }
 
@@ -1015,9 +1015,9 @@ constexpr ggm::Vector3D<T> ggm::operator*(Vector2D<T> const &  lhs,
                                           Matrix2x3<T> const & rhs) noexcept
 {
     return Vector3D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11),
-        (lhs.x * rhs.m02) + (lhs.y * rhs.m12),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11),
+        sum_of_products(lhs.x, rhs.m02, lhs.y, rhs.m12),
     };
 }
 
@@ -1028,9 +1028,9 @@ constexpr ggm::Vector3D<T> ggm::operator*(Vector3D<T> const &  lhs,
                                           Matrix3x3<T> const & rhs) noexcept
 {
     return Vector3D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10) + (lhs.z * rhs.m20),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11) + (lhs.z * rhs.m21),
-        (lhs.x * rhs.m02) + (lhs.y * rhs.m12) + (lhs.z * rhs.m22),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10, lhs.z, rhs.m20),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11, lhs.z, rhs.m21),
+        sum_of_products(lhs.x, rhs.m02, lhs.y, rhs.m12, lhs.z, rhs.m22),
     };
 }
 
@@ -1041,9 +1041,9 @@ constexpr ggm::Vector3D<T> ggm::operator*(Vector4D<T> const &  lhs,
                                           Matrix4x3<T> const & rhs) noexcept
 {
     return Vector3D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10) + (lhs.z * rhs.m20) + (lhs.w * rhs.m30),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11) + (lhs.z * rhs.m21) + (lhs.w * rhs.m31),
-        (lhs.x * rhs.m02) + (lhs.y * rhs.m12) + (lhs.z * rhs.m22) + (lhs.w * rhs.m32),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10, lhs.z, rhs.m20, lhs.w, rhs.m30),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11, lhs.z, rhs.m21, lhs.w, rhs.m31),
+        sum_of_products(lhs.x, rhs.m02, lhs.y, rhs.m12, lhs.z, rhs.m22, lhs.w, rhs.m32),
     };
 }
 
@@ -1056,10 +1056,10 @@ constexpr ggm::Vector4D<T> ggm::operator*(Vector2D<T> const &  lhs,
                                           Matrix2x4<T> const & rhs) noexcept
 {
     return Vector4D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11),
-        (lhs.x * rhs.m02) + (lhs.y * rhs.m12),
-        (lhs.x * rhs.m03) + (lhs.y * rhs.m13),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11),
+        sum_of_products(lhs.x, rhs.m02, lhs.y, rhs.m12),
+        sum_of_products(lhs.x, rhs.m03, lhs.y, rhs.m13),
     };
 }
 
@@ -1070,10 +1070,10 @@ constexpr ggm::Vector4D<T> ggm::operator*(Vector3D<T> const &  lhs,
                                           Matrix3x4<T> const & rhs) noexcept
 {
     return Vector4D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10) + (lhs.z * rhs.m20),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11) + (lhs.z * rhs.m21),
-        (lhs.x * rhs.m02) + (lhs.y * rhs.m12) + (lhs.z * rhs.m22),
-        (lhs.x * rhs.m03) + (lhs.y * rhs.m13) + (lhs.z * rhs.m23),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10, lhs.z, rhs.m20),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11, lhs.z, rhs.m21),
+        sum_of_products(lhs.x, rhs.m02, lhs.y, rhs.m12, lhs.z, rhs.m22),
+        sum_of_products(lhs.x, rhs.m03, lhs.y, rhs.m13, lhs.z, rhs.m23),
     };
 }
 
@@ -1084,10 +1084,10 @@ constexpr ggm::Vector4D<T> ggm::operator*(Vector4D<T> const &  lhs,
                                           Matrix4x4<T> const & rhs) noexcept
 {
     return Vector4D<T>{
-        (lhs.x * rhs.m00) + (lhs.y * rhs.m10) + (lhs.z * rhs.m20) + (lhs.w * rhs.m30),
-        (lhs.x * rhs.m01) + (lhs.y * rhs.m11) + (lhs.z * rhs.m21) + (lhs.w * rhs.m31),
-        (lhs.x * rhs.m02) + (lhs.y * rhs.m12) + (lhs.z * rhs.m22) + (lhs.w * rhs.m32),
-        (lhs.x * rhs.m03) + (lhs.y * rhs.m13) + (lhs.z * rhs.m23) + (lhs.w * rhs.m33),
+        sum_of_products(lhs.x, rhs.m00, lhs.y, rhs.m10, lhs.z, rhs.m20, lhs.w, rhs.m30),
+        sum_of_products(lhs.x, rhs.m01, lhs.y, rhs.m11, lhs.z, rhs.m21, lhs.w, rhs.m31),
+        sum_of_products(lhs.x, rhs.m02, lhs.y, rhs.m12, lhs.z, rhs.m22, lhs.w, rhs.m32),
+        sum_of_products(lhs.x, rhs.m03, lhs.y, rhs.m13, lhs.z, rhs.m23, lhs.w, rhs.m33),
     };
 }
 
@@ -1100,8 +1100,8 @@ constexpr ggm::Vector2D<T> ggm::operator*(Matrix2x2<T> const & lhs,
                                           Vector2D<T> const &  rhs) noexcept
 {
     return Vector2D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y),
     };
 }
 
@@ -1112,8 +1112,8 @@ constexpr ggm::Vector2D<T> ggm::operator*(Matrix2x3<T> const & lhs,
                                           Vector3D<T> const &  rhs) noexcept
 {
     return Vector2D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y) + (lhs.m02 * rhs.z),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y) + (lhs.m12 * rhs.z),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y, lhs.m02, rhs.z),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y, lhs.m12, rhs.z),
     };
 }
 
@@ -1124,8 +1124,8 @@ constexpr ggm::Vector2D<T> ggm::operator*(Matrix2x4<T> const & lhs,
                                           Vector4D<T> const &  rhs) noexcept
 {
     return Vector2D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y) + (lhs.m02 * rhs.z) + (lhs.m03 * rhs.w),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y) + (lhs.m12 * rhs.z) + (lhs.m13 * rhs.w),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y, lhs.m02, rhs.z, lhs.m03, rhs.w),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y, lhs.m12, rhs.z, lhs.m13, rhs.w),
     };
 }
 
@@ -1138,9 +1138,9 @@ constexpr ggm::Vector3D<T> ggm::operator*(Matrix3x2<T> const & lhs,
                                           Vector2D<T> const &  rhs) noexcept
 {
     return Vector3D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y),
-        (lhs.m20 * rhs.x) + (lhs.m21 * rhs.y),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y),
+        sum_of_products(lhs.m20, rhs.x, lhs.m21, rhs.y),
     };
 }
 
@@ -1151,9 +1151,9 @@ constexpr ggm::Vector3D<T> ggm::operator*(Matrix3x3<T> const & lhs,
                                           Vector3D<T> const &  rhs) noexcept
 {
     return Vector3D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y) + (lhs.m02 * rhs.z),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y) + (lhs.m12 * rhs.z),
-        (lhs.m20 * rhs.x) + (lhs.m21 * rhs.y) + (lhs.m22 * rhs.z),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y, lhs.m02, rhs.z),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y, lhs.m12, rhs.z),
+        sum_of_products(lhs.m20, rhs.x, lhs.m21, rhs.y, lhs.m22, rhs.z),
     };
 }
 
@@ -1164,9 +1164,9 @@ constexpr ggm::Vector3D<T> ggm::operator*(Matrix3x4<T> const & lhs,
                                           Vector4D<T> const &  rhs) noexcept
 {
     return Vector3D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y) + (lhs.m02 * rhs.z) + (lhs.m03 * rhs.w),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y) + (lhs.m12 * rhs.z) + (lhs.m13 * rhs.w),
-        (lhs.m20 * rhs.x) + (lhs.m21 * rhs.y) + (lhs.m22 * rhs.z) + (lhs.m23 * rhs.w),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y, lhs.m02, rhs.z, lhs.m03, rhs.w),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y, lhs.m12, rhs.z, lhs.m13, rhs.w),
+        sum_of_products(lhs.m20, rhs.x, lhs.m21, rhs.y, lhs.m22, rhs.z, lhs.m23, rhs.w),
     };
 }
 
@@ -1179,10 +1179,10 @@ constexpr ggm::Vector4D<T> ggm::operator*(Matrix4x2<T> const & lhs,
                                           Vector2D<T> const &  rhs) noexcept
 {
     return Vector4D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y),
-        (lhs.m20 * rhs.x) + (lhs.m21 * rhs.y),
-        (lhs.m30 * rhs.x) + (lhs.m31 * rhs.y),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y),
+        sum_of_products(lhs.m20, rhs.x, lhs.m21, rhs.y),
+        sum_of_products(lhs.m30, rhs.x, lhs.m31, rhs.y),
     };
 }
 
@@ -1193,10 +1193,10 @@ constexpr ggm::Vector4D<T> ggm::operator*(Matrix4x3<T> const & lhs,
                                           Vector3D<T> const &  rhs) noexcept
 {
     return Vector4D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y) + (lhs.m02 * rhs.z),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y) + (lhs.m12 * rhs.z),
-        (lhs.m20 * rhs.x) + (lhs.m21 * rhs.y) + (lhs.m22 * rhs.z),
-        (lhs.m30 * rhs.x) + (lhs.m31 * rhs.y) + (lhs.m32 * rhs.z),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y, lhs.m02, rhs.z),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y, lhs.m12, rhs.z),
+        sum_of_products(lhs.m20, rhs.x, lhs.m21, rhs.y, lhs.m22, rhs.z),
+        sum_of_products(lhs.m30, rhs.x, lhs.m31, rhs.y, lhs.m32, rhs.z),
     };
 }
 
@@ -1207,10 +1207,10 @@ constexpr ggm::Vector4D<T> ggm::operator*(Matrix4x4<T> const & lhs,
                                           Vector4D<T> const &  rhs) noexcept
 {
     return Vector4D<T>{
-        (lhs.m00 * rhs.x) + (lhs.m01 * rhs.y) + (lhs.m02 * rhs.z) + (lhs.m03 * rhs.w),
-        (lhs.m10 * rhs.x) + (lhs.m11 * rhs.y) + (lhs.m12 * rhs.z) + (lhs.m13 * rhs.w),
-        (lhs.m20 * rhs.x) + (lhs.m21 * rhs.y) + (lhs.m22 * rhs.z) + (lhs.m23 * rhs.w),
-        (lhs.m30 * rhs.x) + (lhs.m31 * rhs.y) + (lhs.m32 * rhs.z) + (lhs.m33 * rhs.w),
+        sum_of_products(lhs.m00, rhs.x, lhs.m01, rhs.y, lhs.m02, rhs.z, lhs.m03, rhs.w),
+        sum_of_products(lhs.m10, rhs.x, lhs.m11, rhs.y, lhs.m12, rhs.z, lhs.m13, rhs.w),
+        sum_of_products(lhs.m20, rhs.x, lhs.m21, rhs.y, lhs.m22, rhs.z, lhs.m23, rhs.w),
+        sum_of_products(lhs.m30, rhs.x, lhs.m31, rhs.y, lhs.m32, rhs.z, lhs.m33, rhs.w),
     };
 }
 
@@ -2477,9 +2477,9 @@ constexpr ggm::Vector4D<T> ggm::vector_from_row(Matrix4x4<T> const & m) noexcept
 // =============================================================================
 
 template <typename T>
-inline ggm::Vector2D<bool> ggm::is_close(Vector2D<T> const &  lhs,
-                                         Matrix1x2<T> const & rhs,
-                                         T const &            epsilon) noexcept
+constexpr ggm::Vector2D<bool> ggm::is_close(Vector2D<T> const &  lhs,
+                                            Matrix1x2<T> const & rhs,
+                                            T const &            epsilon) noexcept
 {
     return Vector2D<bool>{
         is_close(lhs.x, rhs.m00, epsilon),
@@ -2490,9 +2490,9 @@ inline ggm::Vector2D<bool> ggm::is_close(Vector2D<T> const &  lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector2D<bool> ggm::is_close(Matrix1x2<T> const & lhs,
-                                         Vector2D<T> const &  rhs,
-                                         T const &            epsilon) noexcept
+constexpr ggm::Vector2D<bool> ggm::is_close(Matrix1x2<T> const & lhs,
+                                            Vector2D<T> const &  rhs,
+                                            T const &            epsilon) noexcept
 {
     return Vector2D<bool>{
         is_close(lhs.m00, rhs.x, epsilon),
@@ -2503,9 +2503,9 @@ inline ggm::Vector2D<bool> ggm::is_close(Matrix1x2<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector3D<bool> ggm::is_close(Vector3D<T> const &  lhs,
-                                         Matrix1x3<T> const & rhs,
-                                         T const &            epsilon) noexcept
+constexpr ggm::Vector3D<bool> ggm::is_close(Vector3D<T> const &  lhs,
+                                            Matrix1x3<T> const & rhs,
+                                            T const &            epsilon) noexcept
 {
     return Vector3D<bool>{
         is_close(lhs.x, rhs.m00, epsilon),
@@ -2517,9 +2517,9 @@ inline ggm::Vector3D<bool> ggm::is_close(Vector3D<T> const &  lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector3D<bool> ggm::is_close(Matrix1x3<T> const & lhs,
-                                         Vector3D<T> const &  rhs,
-                                         T const &            epsilon) noexcept
+constexpr ggm::Vector3D<bool> ggm::is_close(Matrix1x3<T> const & lhs,
+                                            Vector3D<T> const &  rhs,
+                                            T const &            epsilon) noexcept
 {
     return Vector3D<bool>{
         is_close(lhs.m00, rhs.x, epsilon),
@@ -2531,9 +2531,9 @@ inline ggm::Vector3D<bool> ggm::is_close(Matrix1x3<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector4D<bool> ggm::is_close(Vector4D<T> const &  lhs,
-                                         Matrix1x4<T> const & rhs,
-                                         T const &            epsilon) noexcept
+constexpr ggm::Vector4D<bool> ggm::is_close(Vector4D<T> const &  lhs,
+                                            Matrix1x4<T> const & rhs,
+                                            T const &            epsilon) noexcept
 {
     return Vector4D<bool>{
         is_close(lhs.x, rhs.m00, epsilon),
@@ -2546,9 +2546,9 @@ inline ggm::Vector4D<bool> ggm::is_close(Vector4D<T> const &  lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector4D<bool> ggm::is_close(Matrix1x4<T> const & lhs,
-                                         Vector4D<T> const &  rhs,
-                                         T const &            epsilon) noexcept
+constexpr ggm::Vector4D<bool> ggm::is_close(Matrix1x4<T> const & lhs,
+                                            Vector4D<T> const &  rhs,
+                                            T const &            epsilon) noexcept
 {
     return Vector4D<bool>{
         is_close(lhs.m00, rhs.x, epsilon),
@@ -3,17 +3,24 @@
 #define GGM_MATRIX_ALL_H
 
 #include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixBatch.h"
 #include "ggm/Matrix/MatrixConstants.h"
+#include "ggm/Matrix/MatrixPacket.h"
+#include "ggm/Matrix/MatrixPacketUtil.h"
 #include "ggm/Matrix/MatrixRotation.h"
+#include "ggm/Matrix/MatrixRotationBatch.h"
 #include "ggm/Matrix/MatrixRotationFwd.h"
 #include "ggm/Matrix/MatrixRotationTypedefs.h"
 #include "ggm/Matrix/MatrixRotationUtil.h"
 #include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Matrix/MatrixTransformBatch.h"
 #include "ggm/Matrix/MatrixTransformConstants.h"
+#include "ggm/Matrix/MatrixTransformHierarchy.h"
 #include "ggm/Matrix/MatrixTransformTypedefs.h"
 #include "ggm/Matrix/MatrixTransformUtil.h"
 #include "ggm/Matrix/MatrixTypedefs.h"
 #include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixUtilSimd.h"
 #include "ggm/Matrix/MatrixVectorUtil.h"
 
 #endif // GGM_MATRIX_ALL_H
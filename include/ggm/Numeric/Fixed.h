@@ -0,0 +1,113 @@
+#pragma once
+#ifndef GGM_FIXED_H
+#define GGM_FIXED_H
+
+#include <cstdint>
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // Fixed
+    // =============================================================================
+
+    /// Signed binary fixed-point number, i.e. the integer bits / 2^FracBits
+    /// @details
+    /// Arithmetic (see FixedUtil.h) only uses integer operations, so results are bit-identical on every
+    /// platform & compiler, e.g. for deterministic lockstep simulation. Fixed can be used as the T of the
+    /// Vector & Matrix templates.
+    ///
+    /// The integer constructor allows the generic code to use T{ 0 } & T{ 1 }.
+    /// @tparam IntBits  The number of integer bits, including the sign bit
+    /// @tparam FracBits The number of fractional bits, i.e. the resolution is 2^-FracBits
+    template <int IntBits, int FracBits>
+    struct Fixed
+    {
+        static_assert(IntBits >= 2, "Fixed requires a sign bit & at least one integer bit (i.e. to represent 1)");
+        static_assert(FracBits >= 1, "Fixed requires at least one fractional bit");
+        static_assert(IntBits + FracBits <= 32, "Fixed is limited to 32 bits, so that products fit in 64 bits");
+
+        typedef std::int32_t  IntType;  ///< The type of bits.
+        typedef std::uint32_t UIntType; ///< Unsigned integer type with the same size as bits.
+        typedef std::int64_t  WideType; ///< Intermediate type of multiply & divide.
+
+        static constexpr IntType One = IntType{ 1 } << FracBits; ///< The bits of 1.
+
+        Fixed() noexcept = default;
+
+        /// exact conversion from an integer, value must be in range
+        explicit constexpr Fixed(int const value) noexcept;
+
+        /// conversion to the nearest fixed-point value, value must be in range
+        explicit constexpr Fixed(float const value) noexcept;
+        explicit constexpr Fixed(double const value) noexcept;
+
+        explicit constexpr operator float() const noexcept;
+        explicit constexpr operator double() const noexcept;
+
+        /// the value with the given bits, i.e. bits / 2^FracBits
+        static constexpr Fixed from_bits(IntType const value) noexcept;
+
+        // members:
+        IntType bits; // uninitialized
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// ggm::Fixed:
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits>::Fixed(int const value) noexcept
+    : bits{ static_cast<IntType>(static_cast<UIntType>(value) << FracBits) }
+{
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits>::Fixed(float const value) noexcept
+    : Fixed{ static_cast<double>(value) }
+{
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits>::Fixed(double const value) noexcept
+    : bits{ static_cast<IntType>(value * static_cast<double>(One) + ((value < 0.0) ? -0.5 : 0.5)) }
+{
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits>::operator float() const noexcept
+{
+    return static_cast<float>(bits) / static_cast<float>(One);
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits>::operator double() const noexcept
+{
+    return static_cast<double>(bits) / static_cast<double>(One);
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::Fixed<IntBits, FracBits>::from_bits(IntType const value) noexcept
+{
+    Fixed result{};
+    result.bits = value;
+    return result;
+}
+
+// =============================================================================
+
+#endif // GGM_FIXED_H
@@ -0,0 +1,912 @@
+#pragma once
+#ifndef GGM_FIXED_UTIL_H
+#define GGM_FIXED_UTIL_H
+
+#include "ggm/Numeric/Fixed.h"
+#include "ggm/Numeric/NumericConstants.h"
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Numeric/SinCos.h"
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+
+// =============================================================================
+/// Fixed-point operators & utility functions:
+/// ----------
+///
+/// Overloads of the NumericUtil.h functions for Fixed, so that the Vector & Matrix utilities (e.g. normalize,
+/// inverse, rotation3D_from_angle_axis) work with Fixed elements.
+///
+/// Every function only uses integer operations (no floating point, no lookup dependent on the platform) so
+/// the results are bit-identical everywhere. Overflow wraps (two's complement) rather than being undefined.
+///
+/// Syntax                       | Description
+/// --------                     | -----------
+/// z = x + y;                   | Addition.
+/// z = x - y;                   | Subtraction.
+/// z = x * y;                   | Multiplication, rounded to nearest.
+/// z = x / y;                   | Division, rounded towards zero.
+/// b = x < y; (etc.)            | Comparison.
+/// y = abs(x);                  | Compute the absolute value.
+/// y = ceil(x);                 | Compute the least integral value >= value.
+/// y = clamp(x, min, max);      | Clamp value to [minValue, maxValue].
+/// y = cos(x);                  | Compute the cosine of an angle (radians), table-driven.
+/// y = floor(x);                | Compute the greatest integral value <= value.
+/// y = fract(x);                | The fractional component of value, i.e. value - floor(value).
+/// y = inverse_lerp(x0, x1, x); | Inverse of linear interpolation.
+/// b = is_close(x, y, k);       | Compare for approximate equality with specified epsilon.
+/// y = lerp(x0, x1, t);         | Linear interpolation between two values.
+/// y = linear_step(e0, e1, v);  | Linearly interpolate from 0 to 1 as value progresses from edge0 to edge1.
+/// z = max(x, y)                | Get the maximum of two numbers
+/// z = min(x, y)                | Get the minimum of two numbers
+/// y = reciprocal(x, def, k);   | A safe reciprocal function.
+/// y = reciprocal_sqrt(x, def); | A safe reciprocal square-root function.
+/// y = saturate(x);             | Clamp value to [0, 1].
+/// y = sin(x);                  | Compute the sine of an angle (radians), table-driven.
+/// r = sincos(x);               | Compute the sine & cosine of an angle (radians) together, table-driven.
+/// y = smooth_step(e0, e1, x);  | Hermite cubic interpolation from 0 to 1 as value progresses from edge0 to edge1.
+/// y = sqrt(x);                 | Compute the square root, rounded to nearest.
+/// y = trunc(x);                | Round towards zero.
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+
+    /// Generic constant to use when testing fixed-point approximate equality (i.e. @ref is_close), 4 units
+    /// of the last place (to match @ref DefaultToleranceUlps)
+    template <int IntBits, int FracBits>
+    inline constexpr Fixed<IntBits, FracBits> DefaultTolerance<Fixed<IntBits, FracBits>> = Fixed<IntBits, FracBits>::from_bits(static_cast<std::int32_t>(DefaultToleranceUlps));
+
+    // =============================================================================
+    /// Arithmetic operators.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> operator+(Fixed<IntBits, FracBits> const value) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> operator-(Fixed<IntBits, FracBits> const value) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> operator+(Fixed<IntBits, FracBits> const lhs,
+                                                 Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> operator-(Fixed<IntBits, FracBits> const lhs,
+                                                 Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    /// rounded to nearest (ties away from zero for positive products)
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> operator*(Fixed<IntBits, FracBits> const lhs,
+                                                 Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    /// rounded towards zero, rhs must not be 0
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> operator/(Fixed<IntBits, FracBits> const lhs,
+                                                 Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> & operator+=(Fixed<IntBits, FracBits> &       lhs,
+                                                    Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> & operator-=(Fixed<IntBits, FracBits> &       lhs,
+                                                    Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> & operator*=(Fixed<IntBits, FracBits> &       lhs,
+                                                    Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> & operator/=(Fixed<IntBits, FracBits> &       lhs,
+                                                    Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    // =============================================================================
+    /// Comparison operators.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr bool operator==(Fixed<IntBits, FracBits> const lhs,
+                              Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr bool operator!=(Fixed<IntBits, FracBits> const lhs,
+                              Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr bool operator<(Fixed<IntBits, FracBits> const lhs,
+                             Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr bool operator<=(Fixed<IntBits, FracBits> const lhs,
+                              Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr bool operator>(Fixed<IntBits, FracBits> const lhs,
+                             Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    template <int IntBits, int FracBits>
+    constexpr bool operator>=(Fixed<IntBits, FracBits> const lhs,
+                              Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    // =============================================================================
+    /// Compute the absolute value.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> abs(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Compute the least integral value >= value.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> ceil(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Clamp value to [minValue, maxValue].
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> clamp(Fixed<IntBits, FracBits> const value,
+                                             Fixed<IntBits, FracBits> const minValue,
+                                             Fixed<IntBits, FracBits> const maxValue) noexcept;
+
+    // =============================================================================
+    /// Compute the cosine of an angle (radians).
+    /// @details
+    /// Equivalent to sincos(angleRadians).cos, see @ref sincos for accuracy.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> cos(Fixed<IntBits, FracBits> const angleRadians) noexcept;
+
+    // =============================================================================
+    /// Compute the greatest integral value <= value.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> floor(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// The fractional component of value, i.e. value - floor(value).
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> fract(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Inverse of linear interpolation.
+    /// @details
+    /// Calculate the parameter 't' such that lerp(value0, value1, t) == value
+    /// @param[in] value0 The value for t = 0, i.e. the beginning of the interpolation
+    /// @param[in] value1 The value for t = 1, i.e. the ending of the interpolation, must be != value0
+    /// @param[in] value  The current interpolation value
+    /// @result The interpolation parameter: (value - value0) / (value1 - value0)
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> inverse_lerp(Fixed<IntBits, FracBits> const value0,
+                                                    Fixed<IntBits, FracBits> const value1,
+                                                    Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Compare fixed-point numbers for approximate equality, i.e. abs(lhs - rhs) <= epsilon.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr bool is_close(Fixed<IntBits, FracBits> const lhs,
+                            Fixed<IntBits, FracBits> const rhs,
+                            Fixed<IntBits, FracBits> const epsilon = DefaultTolerance<Fixed<IntBits, FracBits>>) noexcept;
+
+    // =============================================================================
+    /// Linear interpolation between two values, i.e. value0 + (value1 - value0) * t.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> lerp(Fixed<IntBits, FracBits> const value0,
+                                            Fixed<IntBits, FracBits> const value1,
+                                            Fixed<IntBits, FracBits> const t) noexcept;
+
+    // =============================================================================
+    /// Linearly interpolate from 0 to 1 as value progresses from edge0 to edge1.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> linear_step(Fixed<IntBits, FracBits> const edge0,
+                                                   Fixed<IntBits, FracBits> const edge1,
+                                                   Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Get the maximum of two numbers.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> max(Fixed<IntBits, FracBits> const lhs,
+                                           Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    // =============================================================================
+    /// Get the minimum of two numbers.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> min(Fixed<IntBits, FracBits> const lhs,
+                                           Fixed<IntBits, FracBits> const rhs) noexcept;
+
+    // =============================================================================
+    /// A safe reciprocal function.
+    /// @param[in] value        The value to compute the reciprocal of
+    /// @param[in] defaultValue The value to return if value is close to 0
+    /// @param[in] epsilon      The tolerance used to compare value with 0
+    /// @result 1 / value, rounded towards zero, or defaultValue
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> reciprocal(Fixed<IntBits, FracBits> const value,
+                                                  Fixed<IntBits, FracBits> const defaultValue = Fixed<IntBits, FracBits>{ 0 },
+                                                  Fixed<IntBits, FracBits> const epsilon      = DefaultTolerance<Fixed<IntBits, FracBits>>) noexcept;
+
+    // =============================================================================
+    /// A safe reciprocal square-root function.
+    /// @param[in] value        The value to compute the reciprocal square-root of
+    /// @param[in] defaultValue The value to return if value is <= 0
+    /// @result 1 / sqrt(value) or defaultValue
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> reciprocal_sqrt(Fixed<IntBits, FracBits> const value,
+                                                       Fixed<IntBits, FracBits> const defaultValue = Fixed<IntBits, FracBits>{ 0 }) noexcept;
+
+    // =============================================================================
+    /// Clamp value to [0, 1].
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> saturate(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Compute the sine of an angle (radians).
+    /// @details
+    /// Equivalent to sincos(angleRadians).sin, see @ref sincos for accuracy.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> sin(Fixed<IntBits, FracBits> const angleRadians) noexcept;
+
+    // =============================================================================
+    /// Compute the sine & cosine of an angle (radians) together.
+    /// @details
+    /// The angle is reduced to a 32-bit fraction of a turn, then the sine & cosine are linearly interpolated
+    /// from a quarter-wave table (1025 entries with 30 fractional bits, built at compile time). The absolute
+    /// error is < 3e-7 plus the rounding to FracBits (which must be <= 30).
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr SinCos<Fixed<IntBits, FracBits>> sincos(Fixed<IntBits, FracBits> const angleRadians) noexcept;
+
+    // =============================================================================
+    /// Hermite cubic interpolation from 0 to 1 as value progresses from edge0 to edge1.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> smooth_step(Fixed<IntBits, FracBits> const edge0,
+                                                   Fixed<IntBits, FracBits> const edge1,
+                                                   Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Compute the square root, rounded to nearest.
+    /// @details
+    /// Computed with integer Newton-Raphson iterations from a table estimate, negative values give 0.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> sqrt(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+    /// Round towards zero.
+    // =============================================================================
+
+    template <int IntBits, int FracBits>
+    constexpr Fixed<IntBits, FracBits> trunc(Fixed<IntBits, FracBits> const value) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+namespace ggm::FixedImpl
+{
+    // =============================================================================
+    // sincos:
+    // =============================================================================
+
+    inline constexpr int SinTableBits  = 10;                          ///< log2 of the entries per quarter turn
+    inline constexpr int SinTableShift = 30 - SinTableBits;           ///< quarter turn bits below the table index
+    inline constexpr int SinTableSize  = (1 << SinTableBits) + 2;     ///< the last entry is only read with a 0 weight
+    inline constexpr int SinValueBits  = 30;                          ///< fractional bits of the table values
+
+    struct SinTable
+    {
+        // members:
+        std::int32_t values[SinTableSize]; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// sin(i / 2^SinTableBits * pi / 2) with SinValueBits fractional bits, computed at compile time from the
+    /// constexpr (double) sincos, so the table is identical on every platform
+    consteval SinTable make_sin_table() noexcept
+    {
+        constexpr double QuarterTurn = 1.57079632679489661923; // pi / 2
+
+        SinTable table{};
+        for (int i = 0; i < SinTableSize; ++i)
+        {
+            double const angle = QuarterTurn * static_cast<double>(i) / static_cast<double>(1 << SinTableBits);
+            double const value = ggm::sincos(angle).sin * static_cast<double>(std::int32_t{ 1 } << SinValueBits);
+            table.values[i]    = static_cast<std::int32_t>(value + 0.5);
+        }
+
+        return table;
+    }
+
+    inline constexpr SinTable QuarterSinTable = make_sin_table();
+
+    // -----------------------------------------------------------------------------
+
+    /// sin of a position within the first quarter turn, in [0, 2^30] (i.e. [0, pi/2]), with SinValueBits fractional bits
+    constexpr std::int32_t quarter_sin(std::uint32_t const position) noexcept
+    {
+        constexpr std::uint32_t WeightMask = (std::uint32_t{ 1 } << SinTableShift) - 1u;
+
+        std::uint32_t const index  = position >> SinTableShift;
+        std::int64_t const  weight = static_cast<std::int64_t>(position & WeightMask);
+        std::int64_t const  value0 = QuarterSinTable.values[index];
+        std::int64_t const  value1 = QuarterSinTable.values[index + 1];
+
+        return static_cast<std::int32_t>(value0 + (((value1 - value0) * weight) >> SinTableShift));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// sine & cosine with SinValueBits fractional bits of a fraction of a turn (i.e. 2^32 == 2 pi)
+    constexpr SinCos<std::int32_t> sincos_turn(std::uint32_t const turn) noexcept
+    {
+        constexpr std::uint32_t QuarterMask = (std::uint32_t{ 1 } << 30) - 1u;
+
+        std::uint32_t const quadrant = turn >> 30;
+        std::uint32_t const position = turn & QuarterMask;
+
+        std::int32_t const sinQ = quarter_sin(position);
+        std::int32_t const cosQ = quarter_sin((QuarterMask + 1u) - position);
+
+        // quadrant: 0 => (sin, cos), 1 => (cos, -sin), 2 => (-sin, -cos), 3 => (-cos, sin)
+        std::int32_t const swapMask    = -static_cast<std::int32_t>(quadrant & 1u);
+        std::int32_t const sinSignMask = -static_cast<std::int32_t>((quadrant >> 1) & 1u);
+        std::int32_t const cosSignMask = -static_cast<std::int32_t>(((quadrant + 1u) >> 1) & 1u);
+
+        std::int32_t const sinValue = (sinQ & ~swapMask) | (cosQ & swapMask);
+        std::int32_t const cosValue = (cosQ & ~swapMask) | (sinQ & swapMask);
+
+        return SinCos<std::int32_t>{
+            (sinValue ^ sinSignMask) - sinSignMask,
+            (cosValue ^ cosSignMask) - cosSignMask,
+        };
+    }
+
+    // =============================================================================
+    // sqrt:
+    // =============================================================================
+
+    struct SqrtTable
+    {
+        // members:
+        std::uint8_t values[64]; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// ceil(sqrt(i + 1) * 16), i.e. an upper bound of the square root of values with i as the leading 6 bits
+    consteval SqrtTable make_sqrt_table() noexcept
+    {
+        SqrtTable table{};
+        for (int i = 0; i < 64; ++i)
+        {
+            int root = 0;
+            while (root * root < (i + 1) * 256)
+            {
+                ++root;
+            }
+
+            table.values[i] = static_cast<std::uint8_t>(root);
+        }
+
+        return table;
+    }
+
+    inline constexpr SqrtTable SqrtEstimateTable = make_sqrt_table();
+
+    // -----------------------------------------------------------------------------
+
+    /// The integer square root of value (which must be < 2^62), rounded to nearest.
+    /// @details
+    /// The leading bits of value index a table for an estimate >= the root (within ~5%), which 3 Newton-Raphson
+    /// iterations refine to floor(sqrt(value)) or one more. That is ~4x faster than computing the root bit by bit.
+    constexpr std::uint64_t sqrt(std::uint64_t const value) noexcept
+    {
+        // 0 is computed as 1 & masked at the end, so that the divisor is never 0
+        std::uint64_t const nonZero   = static_cast<std::uint64_t>(value != 0);
+        std::uint64_t const safeValue = value | (nonZero ^ 1u);
+
+        int const           width = std::bit_width(safeValue);
+        int const           shift = (width > 6) ? ((width - 5) & ~1) : 0; // even, so that the root shift is exact
+        std::uint64_t const top   = SqrtEstimateTable.values[safeValue >> shift];
+
+        std::uint64_t root = ((top << (shift / 2)) + 15u) >> 4;
+        root               = (root + safeValue / root) >> 1;
+        root               = (root + safeValue / root) >> 1;
+        root               = (root + safeValue / root) >> 1;
+        root -= static_cast<std::uint64_t>(root * root > safeValue);
+
+        // the remainder is value - root^2, so rounding up is closer if remainder > root
+        root += static_cast<std::uint64_t>(safeValue - root * root > root);
+        return root * nonZero;
+    }
+
+    // =============================================================================
+} // namespace ggm::FixedImpl
+
+// =============================================================================
+// ggm::Fixed operators
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::operator+(Fixed<IntBits, FracBits> const value) noexcept
+{
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::operator-(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::UIntType UIntType;
+
+    return FixedType::from_bits(static_cast<IntType>(UIntType{ 0 } - static_cast<UIntType>(value.bits)));
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::operator+(Fixed<IntBits, FracBits> const lhs,
+                                                       Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::UIntType UIntType;
+
+    return FixedType::from_bits(static_cast<IntType>(static_cast<UIntType>(lhs.bits) + static_cast<UIntType>(rhs.bits)));
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::operator-(Fixed<IntBits, FracBits> const lhs,
+                                                       Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::UIntType UIntType;
+
+    return FixedType::from_bits(static_cast<IntType>(static_cast<UIntType>(lhs.bits) - static_cast<UIntType>(rhs.bits)));
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::operator*(Fixed<IntBits, FracBits> const lhs,
+                                                       Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::WideType WideType;
+
+    constexpr WideType Half = WideType{ 1 } << (FracBits - 1);
+
+    WideType const product = static_cast<WideType>(lhs.bits) * static_cast<WideType>(rhs.bits);
+    return FixedType::from_bits(static_cast<IntType>((product + Half) >> FracBits));
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::operator/(Fixed<IntBits, FracBits> const lhs,
+                                                       Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::WideType WideType;
+
+    assert(rhs.bits != 0);
+    return FixedType::from_bits(static_cast<IntType>((static_cast<WideType>(lhs.bits) * FixedType::One) / rhs.bits));
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> & ggm::operator+=(Fixed<IntBits, FracBits> &       lhs,
+                                                          Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    lhs = lhs + rhs;
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> & ggm::operator-=(Fixed<IntBits, FracBits> &       lhs,
+                                                          Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    lhs = lhs - rhs;
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> & ggm::operator*=(Fixed<IntBits, FracBits> &       lhs,
+                                                          Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    lhs = lhs * rhs;
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> & ggm::operator/=(Fixed<IntBits, FracBits> &       lhs,
+                                                          Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    lhs = lhs / rhs;
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::operator==(Fixed<IntBits, FracBits> const lhs,
+                               Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return lhs.bits == rhs.bits;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::operator!=(Fixed<IntBits, FracBits> const lhs,
+                               Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return lhs.bits != rhs.bits;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::operator<(Fixed<IntBits, FracBits> const lhs,
+                              Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return lhs.bits < rhs.bits;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::operator<=(Fixed<IntBits, FracBits> const lhs,
+                               Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return lhs.bits <= rhs.bits;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::operator>(Fixed<IntBits, FracBits> const lhs,
+                              Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return lhs.bits > rhs.bits;
+}
+
+// -----------------------------------------------------------------------------
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::operator>=(Fixed<IntBits, FracBits> const lhs,
+                               Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return lhs.bits >= rhs.bits;
+}
+
+// =============================================================================
+// ggm::abs
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::abs(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::UIntType UIntType;
+
+    UIntType const signMask = static_cast<UIntType>(value.bits >> 31); // all ones if negative, else 0
+    return FixedType::from_bits(static_cast<IntType>((static_cast<UIntType>(value.bits) ^ signMask) - signMask));
+}
+
+// =============================================================================
+// ggm::ceil
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::ceil(Fixed<IntBits, FracBits> const value) noexcept
+{
+    return -floor(-value);
+}
+
+// =============================================================================
+// ggm::clamp
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::clamp(Fixed<IntBits, FracBits> const value,
+                                                   Fixed<IntBits, FracBits> const minValue,
+                                                   Fixed<IntBits, FracBits> const maxValue) noexcept
+{
+    assert(minValue <= maxValue);
+    return min(max(value, minValue), maxValue);
+}
+
+// =============================================================================
+// ggm::cos
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::cos(Fixed<IntBits, FracBits> const angleRadians) noexcept
+{
+    return sincos(angleRadians).cos;
+}
+
+// =============================================================================
+// ggm::floor
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::floor(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits> FixedType;
+
+    return FixedType::from_bits(value.bits & ~(FixedType::One - 1));
+}
+
+// =============================================================================
+// ggm::fract
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::fract(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits> FixedType;
+
+    return FixedType::from_bits(value.bits & (FixedType::One - 1));
+}
+
+// =============================================================================
+// ggm::inverse_lerp
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::inverse_lerp(Fixed<IntBits, FracBits> const value0,
+                                                          Fixed<IntBits, FracBits> const value1,
+                                                          Fixed<IntBits, FracBits> const value) noexcept
+{
+    assert(value0 != value1);
+    return (value - value0) / (value1 - value0);
+}
+
+// =============================================================================
+// ggm::is_close
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr bool ggm::is_close(Fixed<IntBits, FracBits> const lhs,
+                             Fixed<IntBits, FracBits> const rhs,
+                             Fixed<IntBits, FracBits> const epsilon) noexcept
+{
+    typedef typename Fixed<IntBits, FracBits>::WideType WideType;
+
+    // note: the difference is computed in WideType, so that it can't wrap around
+    WideType const difference = static_cast<WideType>(lhs.bits) - static_cast<WideType>(rhs.bits);
+    return (difference <= epsilon.bits) && (-difference <= epsilon.bits);
+}
+
+// =============================================================================
+// ggm::lerp
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::lerp(Fixed<IntBits, FracBits> const value0,
+                                                  Fixed<IntBits, FracBits> const value1,
+                                                  Fixed<IntBits, FracBits> const t) noexcept
+{
+    return value0 + (value1 - value0) * t;
+}
+
+// =============================================================================
+// ggm::linear_step
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::linear_step(Fixed<IntBits, FracBits> const edge0,
+                                                         Fixed<IntBits, FracBits> const edge1,
+                                                         Fixed<IntBits, FracBits> const value) noexcept
+{
+    assert(edge0 < edge1);
+    return saturate(inverse_lerp(edge0, edge1, value));
+}
+
+// =============================================================================
+// ggm::max
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::max(Fixed<IntBits, FracBits> const lhs,
+                                                 Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return (lhs < rhs) ? rhs : lhs;
+}
+
+// =============================================================================
+// ggm::min
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::min(Fixed<IntBits, FracBits> const lhs,
+                                                 Fixed<IntBits, FracBits> const rhs) noexcept
+{
+    return (rhs < lhs) ? rhs : lhs;
+}
+
+// =============================================================================
+// ggm::reciprocal
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::reciprocal(Fixed<IntBits, FracBits> const value,
+                                                        Fixed<IntBits, FracBits> const defaultValue,
+                                                        Fixed<IntBits, FracBits> const epsilon) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::WideType WideType;
+
+    constexpr WideType OneSquared = static_cast<WideType>(FixedType::One) * FixedType::One;
+
+    return is_close(value, FixedType{ 0 }, epsilon) ? defaultValue
+                             : FixedType::from_bits(static_cast<IntType>(OneSquared / value.bits));
+}
+
+// =============================================================================
+// ggm::reciprocal_sqrt
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::reciprocal_sqrt(Fixed<IntBits, FracBits> const value,
+                                                             Fixed<IntBits, FracBits> const defaultValue) noexcept
+{
+    typedef Fixed<IntBits, FracBits> FixedType;
+
+    return (value.bits > 0) ? reciprocal(sqrt(value), defaultValue, FixedType{ 0 })
+                            : defaultValue;
+}
+
+// =============================================================================
+// ggm::saturate
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::saturate(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits> FixedType;
+
+    return clamp(value, FixedType{ 0 }, FixedType{ 1 });
+}
+
+// =============================================================================
+// ggm::sin
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::sin(Fixed<IntBits, FracBits> const angleRadians) noexcept
+{
+    return sincos(angleRadians).sin;
+}
+
+// =============================================================================
+// ggm::sincos
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::SinCos<ggm::Fixed<IntBits, FracBits>> ggm::sincos(Fixed<IntBits, FracBits> const angleRadians) noexcept
+{
+    static_assert(FracBits <= FixedImpl::SinValueBits, "sincos requires FracBits <= 30");
+
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+    typedef typename FixedType::WideType WideType;
+
+    constexpr WideType TurnsPerRadian = 683565276; // round(2^32 / (2 pi)), i.e. radians to a 32-bit fraction of a turn
+    constexpr int      ValueShift     = FixedImpl::SinValueBits - FracBits;
+    constexpr IntType  ValueHalf      = (ValueShift > 0) ? (IntType{ 1 } << (ValueShift - 1)) : 0;
+
+    // note: the conversion to uint32 wraps the angle to [0, 2 pi)
+    std::uint32_t const turn = static_cast<std::uint32_t>((static_cast<WideType>(angleRadians.bits) * TurnsPerRadian) >> FracBits);
+
+    SinCos<std::int32_t> const values = FixedImpl::sincos_turn(turn);
+    return SinCos<FixedType>{
+        FixedType::from_bits((values.sin + ValueHalf) >> ValueShift),
+        FixedType::from_bits((values.cos + ValueHalf) >> ValueShift),
+    };
+}
+
+// =============================================================================
+// ggm::smooth_step
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::smooth_step(Fixed<IntBits, FracBits> const edge0,
+                                                         Fixed<IntBits, FracBits> const edge1,
+                                                         Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits> FixedType;
+
+    FixedType const t = linear_step(edge0, edge1, value);
+    return t * t * (FixedType{ 3 } - FixedType{ 2 } * t);
+}
+
+// =============================================================================
+// ggm::sqrt
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::sqrt(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+
+    // sqrt(bits / 2^F) * 2^F == sqrt(bits * 2^F), negative values are masked to 0
+    std::uint64_t const positiveBits = static_cast<std::uint64_t>(max(value.bits, IntType{ 0 }));
+    return FixedType::from_bits(static_cast<IntType>(FixedImpl::sqrt(positiveBits << FracBits)));
+}
+
+// =============================================================================
+// ggm::trunc
+// =============================================================================
+
+template <int IntBits, int FracBits>
+constexpr ggm::Fixed<IntBits, FracBits> ggm::trunc(Fixed<IntBits, FracBits> const value) noexcept
+{
+    typedef Fixed<IntBits, FracBits>          FixedType;
+    typedef typename FixedType::IntType  IntType;
+
+    // round the magnitude down, i.e. floor for positive values & ceil for negative values
+    IntType const signMask = value.bits >> 31; // all ones if negative, else 0
+    IntType const bits     = (value.bits ^ signMask) - signMask;
+    IntType const truncBits = bits & ~(FixedType::One - 1);
+    return FixedType::from_bits((truncBits ^ signMask) - signMask);
+}
+
+// =============================================================================
+
+#endif // GGM_FIXED_UTIL_H
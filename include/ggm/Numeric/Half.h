@@ -0,0 +1,30 @@
+#pragma once
+#ifndef GGM_HALF_H
+#define GGM_HALF_H
+
+#include <cstdint>
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // half
+    // =============================================================================
+
+    /// IEEE-754 binary16 (half precision) floating point value, for storage only
+    /// @details
+    /// There is no arithmetic on half, convert to float first (see @ref float_from_half & @ref half_from_float).
+    /// The layout matches the GPU 16-bit float formats (e.g. DXGI_FORMAT_R16_FLOAT, VK_FORMAT_R16_SFLOAT).
+    struct half
+    {
+        // members:
+        std::uint16_t bits; // uninitialized
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_HALF_H
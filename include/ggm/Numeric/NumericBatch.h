@@ -0,0 +1,1368 @@
+#pragma once
+#ifndef GGM_NUMERIC_BATCH_H
+#define GGM_NUMERIC_BATCH_H
+
+#include "ggm/Numeric/NumericUtil.h"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+// =============================================================================
+/// Numeric batch functions:
+/// ----------
+///
+/// Apply a numeric utility function to each element of a span, writing the results to output
+/// span(s) of the same size. Each loop is a plain indexed loop over branch-free scalar functions, so
+/// compilers are able to auto-vectorize it (e.g. GCC & Clang at -O3, or -O2 with -ftree-vectorize).
+///
+/// note: for double, the floor, ceil, fract & repeat loops rely on per-lane 64-bit variable shifts (which
+/// not every compiler vectorizes) & the saturate, linear_step & smooth_step loops need 64-bit compare masks
+/// (e.g. SSE4.2)
+///
+/// note: float_from_half & half_from_float use the scalar F16C instructions when the target has them, else
+/// branch-free integer operations (which vectorize), see NumericUtil.h
+///
+/// Unless noted otherwise the output span may be the same as the input span (i.e. in-place).
+///
+/// Syntax                          | Description
+/// --------                        | -----------
+/// abs(xs, ys);                    | Compute the absolute value of each value.
+/// ceil(xs, ys);                   | Compute the least integral value >= each value.
+/// clamp(xs, min, max, ys);        | Clamp each value to [minValue, maxValue].
+/// cos(xs, ys);                    | Compute the cosine of each angle (radians).
+/// float_from_half(hs, ys);        | Convert each half to float (exact).
+/// floor(xs, ys);                  | Compute the greatest integral value <= each value.
+/// fract(xs, ys);                  | The fractional component of each value, i.e. value - floor(value).
+/// half_from_float(xs, hs);        | Convert each float to the nearest half.
+/// inverse_lerp(x0, x1, xs, ys);   | Inverse of linear interpolation for each value.
+/// lerp(x0, x1, ts, ys);           | Linear interpolation between two values for each t.
+/// lerp(x0s, x1s, t, ys);          | Linear interpolation between each pair of values with the same t.
+/// lerp(x0s, x1s, ts, ys);         | Linear interpolation between each pair of values with the corresponding t.
+/// linear_step(e0, e1, xs, ys);    | Linearly interpolate from 0 to 1 as each value progresses from edge0 to edge1.
+/// max(xs, zs, ys);                | Get the maximum of each pair of values.
+/// max(xs, z, ys);                 | Get the maximum of each value and a single value.
+/// min(xs, zs, ys);                | Get the minimum of each pair of values.
+/// min(xs, z, ys);                 | Get the minimum of each value and a single value.
+/// repeat(xs, min, max, ys);       | Wraps each value to [minValue, endValue).
+/// saturate(xs, ys);               | Clamp each value to [0, 1].
+/// sin(xs, ys);                    | Compute the sine of each angle (radians).
+/// sincos(xs, ys, zs);             | Compute the sine & cosine of each angle (radians) together.
+/// smooth_step(e0, e1, xs, ys);    | Hermite cubic interpolation from 0 to 1 as each value progresses from edge0 to edge1.
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    /// Compute the absolute value of each value.
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void abs(std::span<float const> const values,
+                       std::span<float> const       results) noexcept;
+    constexpr void abs(std::span<double const> const values,
+                       std::span<double> const       results) noexcept;
+    constexpr void abs(std::span<long double const> const values,
+                       std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Compute the least integral value >= each value.
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void ceil(std::span<float const> const values,
+                        std::span<float> const       results) noexcept;
+    constexpr void ceil(std::span<double const> const values,
+                        std::span<double> const       results) noexcept;
+    constexpr void ceil(std::span<long double const> const values,
+                        std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Clamp each value to [minValue, maxValue].
+    /// @param[in]  values   The source values
+    /// @param[in]  minValue The lower bound of the range
+    /// @param[in]  maxValue The upper bound of the range, must be > minValue
+    /// @param[out] results  The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void clamp(std::span<float const> const values,
+                         float const                  minValue,
+                         float const                  maxValue,
+                         std::span<float> const       results) noexcept;
+    constexpr void clamp(std::span<double const> const values,
+                         double const                  minValue,
+                         double const                  maxValue,
+                         std::span<double> const       results) noexcept;
+    constexpr void clamp(std::span<long double const> const values,
+                         long double const                  minValue,
+                         long double const                  maxValue,
+                         std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Compute the cosine of each angle (radians).
+    /// @param[in]  angleRadians The angles in radians
+    /// @param[out] cosValues    The cosine of each angle, must be the same size as angleRadians
+    // =============================================================================
+
+    constexpr void cos(std::span<float const> const angleRadians,
+                       std::span<float> const       cosValues) noexcept;
+    constexpr void cos(std::span<double const> const angleRadians,
+                       std::span<double> const       cosValues) noexcept;
+    constexpr void cos(std::span<long double const> const angleRadians,
+                       std::span<long double> const       cosValues) noexcept;
+
+    // =============================================================================
+    /// Convert each half to float (exact).
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void float_from_half(std::span<half const> const values,
+                                   std::span<float> const      results) noexcept;
+
+    // =============================================================================
+    /// Compute the greatest integral value <= each value.
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void floor(std::span<float const> const values,
+                         std::span<float> const       results) noexcept;
+    constexpr void floor(std::span<double const> const values,
+                         std::span<double> const       results) noexcept;
+    constexpr void floor(std::span<long double const> const values,
+                         std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// The fractional component of each value, i.e. value - floor(value).
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void fract(std::span<float const> const values,
+                         std::span<float> const       results) noexcept;
+    constexpr void fract(std::span<double const> const values,
+                         std::span<double> const       results) noexcept;
+    constexpr void fract(std::span<long double const> const values,
+                         std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Convert each float to the nearest half (round to nearest even).
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void half_from_float(std::span<float const> const values,
+                                   std::span<half> const        results) noexcept;
+
+    // =============================================================================
+    /// Inverse of linear interpolation for each value, i.e. the t s.t. lerp(value0, value1, t) == value.
+    /// @param[in]  value0  The value that maps to 0
+    /// @param[in]  value1  The value that maps to 1, must be != value0
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void inverse_lerp(float const                  value0,
+                                float const                  value1,
+                                std::span<float const> const values,
+                                std::span<float> const       results) noexcept;
+    constexpr void inverse_lerp(double const                  value0,
+                                double const                  value1,
+                                std::span<double const> const values,
+                                std::span<double> const       results) noexcept;
+    constexpr void inverse_lerp(long double const                  value0,
+                                long double const                  value1,
+                                std::span<long double const> const values,
+                                std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Linear interpolation between two values for each interpolation parameter.
+    /// @param[in]  value0  The value at t == 0
+    /// @param[in]  value1  The value at t == 1
+    /// @param[in]  ts      The interpolation parameters
+    /// @param[out] results The results, must be the same size as ts
+    // =============================================================================
+
+    constexpr void lerp(float const                  value0,
+                        float const                  value1,
+                        std::span<float const> const ts,
+                        std::span<float> const       results) noexcept;
+    constexpr void lerp(double const                  value0,
+                        double const                  value1,
+                        std::span<double const> const ts,
+                        std::span<double> const       results) noexcept;
+    constexpr void lerp(long double const                  value0,
+                        long double const                  value1,
+                        std::span<long double const> const ts,
+                        std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Linear interpolation between each pair of values with the same interpolation parameter.
+    /// @param[in]  values0 The values at t == 0
+    /// @param[in]  values1 The values at t == 1, must be the same size as values0
+    /// @param[in]  t       The interpolation parameter
+    /// @param[out] results The results, must be the same size as values0
+    // =============================================================================
+
+    constexpr void lerp(std::span<float const> const values0,
+                        std::span<float const> const values1,
+                        float const                  t,
+                        std::span<float> const       results) noexcept;
+    constexpr void lerp(std::span<double const> const values0,
+                        std::span<double const> const values1,
+                        double const                  t,
+                        std::span<double> const       results) noexcept;
+    constexpr void lerp(std::span<long double const> const values0,
+                        std::span<long double const> const values1,
+                        long double const                  t,
+                        std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Linear interpolation between each pair of values with the corresponding interpolation parameter.
+    /// @param[in]  values0 The values at t == 0
+    /// @param[in]  values1 The values at t == 1, must be the same size as values0
+    /// @param[in]  ts      The interpolation parameters, must be the same size as values0
+    /// @param[out] results The results, must be the same size as values0
+    // =============================================================================
+
+    constexpr void lerp(std::span<float const> const values0,
+                        std::span<float const> const values1,
+                        std::span<float const> const ts,
+                        std::span<float> const       results) noexcept;
+    constexpr void lerp(std::span<double const> const values0,
+                        std::span<double const> const values1,
+                        std::span<double const> const ts,
+                        std::span<double> const       results) noexcept;
+    constexpr void lerp(std::span<long double const> const values0,
+                        std::span<long double const> const values1,
+                        std::span<long double const> const ts,
+                        std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Linearly interpolate from 0 to 1 as each value progresses from edge0 to edge1.
+    /// @param[in]  edge0   The lower edge of the function
+    /// @param[in]  edge1   The upper edge of the function, must be > edge0
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void linear_step(float const                  edge0,
+                               float const                  edge1,
+                               std::span<float const> const values,
+                               std::span<float> const       results) noexcept;
+    constexpr void linear_step(double const                  edge0,
+                               double const                  edge1,
+                               std::span<double const> const values,
+                               std::span<double> const       results) noexcept;
+    constexpr void linear_step(long double const                  edge0,
+                               long double const                  edge1,
+                               std::span<long double const> const values,
+                               std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Get the maximum of each pair of values.
+    /// @param[in]  lhs     The first values
+    /// @param[in]  rhs     The second values, must be the same size as lhs
+    /// @param[out] results The results, must be the same size as lhs
+    // =============================================================================
+
+    constexpr void max(std::span<float const> const lhs,
+                       std::span<float const> const rhs,
+                       std::span<float> const       results) noexcept;
+    constexpr void max(std::span<double const> const lhs,
+                       std::span<double const> const rhs,
+                       std::span<double> const       results) noexcept;
+    constexpr void max(std::span<long double const> const lhs,
+                       std::span<long double const> const rhs,
+                       std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Get the maximum of each value and a single value.
+    /// @param[in]  lhs     The first values
+    /// @param[in]  rhs     The second value
+    /// @param[out] results The results, must be the same size as lhs
+    // =============================================================================
+
+    constexpr void max(std::span<float const> const lhs,
+                       float const                  rhs,
+                       std::span<float> const       results) noexcept;
+    constexpr void max(std::span<double const> const lhs,
+                       double const                  rhs,
+                       std::span<double> const       results) noexcept;
+    constexpr void max(std::span<long double const> const lhs,
+                       long double const                  rhs,
+                       std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Get the minimum of each pair of values.
+    /// @param[in]  lhs     The first values
+    /// @param[in]  rhs     The second values, must be the same size as lhs
+    /// @param[out] results The results, must be the same size as lhs
+    // =============================================================================
+
+    constexpr void min(std::span<float const> const lhs,
+                       std::span<float const> const rhs,
+                       std::span<float> const       results) noexcept;
+    constexpr void min(std::span<double const> const lhs,
+                       std::span<double const> const rhs,
+                       std::span<double> const       results) noexcept;
+    constexpr void min(std::span<long double const> const lhs,
+                       std::span<long double const> const rhs,
+                       std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Get the minimum of each value and a single value.
+    /// @param[in]  lhs     The first values
+    /// @param[in]  rhs     The second value
+    /// @param[out] results The results, must be the same size as lhs
+    // =============================================================================
+
+    constexpr void min(std::span<float const> const lhs,
+                       float const                  rhs,
+                       std::span<float> const       results) noexcept;
+    constexpr void min(std::span<double const> const lhs,
+                       double const                  rhs,
+                       std::span<double> const       results) noexcept;
+    constexpr void min(std::span<long double const> const lhs,
+                       long double const                  rhs,
+                       std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Wraps each value to [minValue, endValue).
+    /// @param[in]  values   The source values
+    /// @param[in]  minValue The lower bound (inclusive) of the range
+    /// @param[in]  endValue The upper bound (exclusive) of the range, must be > minValue
+    /// @param[out] results  The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void repeat(std::span<float const> const values,
+                          float const                  minValue,
+                          float const                  endValue,
+                          std::span<float> const       results) noexcept;
+    constexpr void repeat(std::span<double const> const values,
+                          double const                  minValue,
+                          double const                  endValue,
+                          std::span<double> const       results) noexcept;
+    constexpr void repeat(std::span<long double const> const values,
+                          long double const                  minValue,
+                          long double const                  endValue,
+                          std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Clamp each value to [0, 1].
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void saturate(std::span<float const> const values,
+                            std::span<float> const       results) noexcept;
+    constexpr void saturate(std::span<double const> const values,
+                            std::span<double> const       results) noexcept;
+    constexpr void saturate(std::span<long double const> const values,
+                            std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+    /// Compute the sine of each angle (radians).
+    /// @param[in]  angleRadians The angles in radians
+    /// @param[out] sinValues    The sine of each angle, must be the same size as angleRadians
+    // =============================================================================
+
+    constexpr void sin(std::span<float const> const angleRadians,
+                       std::span<float> const       sinValues) noexcept;
+    constexpr void sin(std::span<double const> const angleRadians,
+                       std::span<double> const       sinValues) noexcept;
+    constexpr void sin(std::span<long double const> const angleRadians,
+                       std::span<long double> const       sinValues) noexcept;
+
+    // =============================================================================
+    /// Compute the sine & cosine of each angle (radians) together.
+    /// @details
+    /// The results are written to separate spans (rather than a span of SinCos) so that the stores
+    /// are contiguous in the vectorized loop.
+    /// @param[in]  angleRadians The angles in radians
+    /// @param[out] sinValues    The sine of each angle, must be the same size as angleRadians
+    /// @param[out] cosValues    The cosine of each angle, must be the same size as angleRadians
+    // =============================================================================
+
+    constexpr void sincos(std::span<float const> const angleRadians,
+                          std::span<float> const       sinValues,
+                          std::span<float> const       cosValues) noexcept;
+    constexpr void sincos(std::span<double const> const angleRadians,
+                          std::span<double> const       sinValues,
+                          std::span<double> const       cosValues) noexcept;
+    constexpr void sincos(std::span<long double const> const angleRadians,
+                          std::span<long double> const       sinValues,
+                          std::span<long double> const       cosValues) noexcept;
+
+    // =============================================================================
+    /// Hermite cubic interpolation from 0 to 1 as each value progresses from edge0 to edge1.
+    /// @param[in]  edge0   The lower edge of the function
+    /// @param[in]  edge1   The upper edge of the function, must be > edge0
+    /// @param[in]  values  The source values
+    /// @param[out] results The results, must be the same size as values
+    // =============================================================================
+
+    constexpr void smooth_step(float const                  edge0,
+                               float const                  edge1,
+                               std::span<float const> const values,
+                               std::span<float> const       results) noexcept;
+    constexpr void smooth_step(double const                  edge0,
+                               double const                  edge1,
+                               std::span<double const> const values,
+                               std::span<double> const       results) noexcept;
+    constexpr void smooth_step(long double const                  edge0,
+                               long double const                  edge1,
+                               std::span<long double const> const values,
+                               std::span<long double> const       results) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+namespace ggm::NumericBatchImpl
+{
+    // =============================================================================
+
+    template <typename T>
+    constexpr void abs(std::span<T const> const values,
+                       std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::abs(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void ceil(std::span<T const> const values,
+                        std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::ceil(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void clamp(std::span<T const> const values,
+                         T const                  minValue,
+                         T const                  maxValue,
+                         std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::clamp(values[i], minValue, maxValue);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void cos(std::span<T const> const angleRadians,
+                       std::span<T> const       cosValues) noexcept
+    {
+        assert(cosValues.size() == angleRadians.size());
+
+        std::size_t const count = angleRadians.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            cosValues[i] = ggm::cos(angleRadians[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void floor(std::span<T const> const values,
+                         std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::floor(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void fract(std::span<T const> const values,
+                         std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::fract(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void inverse_lerp(T const                  value0,
+                                T const                  value1,
+                                std::span<T const> const values,
+                                std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::inverse_lerp(value0, value1, values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void lerp(T const                  value0,
+                        T const                  value1,
+                        std::span<T const> const ts,
+                        std::span<T> const       results) noexcept
+    {
+        assert(results.size() == ts.size());
+
+        std::size_t const count = ts.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::lerp(value0, value1, ts[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void lerp(std::span<T const> const values0,
+                        std::span<T const> const values1,
+                        T const                  t,
+                        std::span<T> const       results) noexcept
+    {
+        assert(values1.size() == values0.size());
+        assert(results.size() == values0.size());
+
+        std::size_t const count = values0.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::lerp(values0[i], values1[i], t);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void lerp(std::span<T const> const values0,
+                        std::span<T const> const values1,
+                        std::span<T const> const ts,
+                        std::span<T> const       results) noexcept
+    {
+        assert(values1.size() == values0.size());
+        assert(ts.size() == values0.size());
+        assert(results.size() == values0.size());
+
+        std::size_t const count = values0.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::lerp(values0[i], values1[i], ts[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void linear_step(T const                  edge0,
+                               T const                  edge1,
+                               std::span<T const> const values,
+                               std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::linear_step(edge0, edge1, values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void max(std::span<T const> const lhs,
+                       std::span<T const> const rhs,
+                       std::span<T> const       results) noexcept
+    {
+        assert(rhs.size() == lhs.size());
+        assert(results.size() == lhs.size());
+
+        std::size_t const count = lhs.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::max(lhs[i], rhs[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void max(std::span<T const> const lhs,
+                       T const                  rhs,
+                       std::span<T> const       results) noexcept
+    {
+        assert(results.size() == lhs.size());
+
+        std::size_t const count = lhs.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::max(lhs[i], rhs);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void min(std::span<T const> const lhs,
+                       std::span<T const> const rhs,
+                       std::span<T> const       results) noexcept
+    {
+        assert(rhs.size() == lhs.size());
+        assert(results.size() == lhs.size());
+
+        std::size_t const count = lhs.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::min(lhs[i], rhs[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void min(std::span<T const> const lhs,
+                       T const                  rhs,
+                       std::span<T> const       results) noexcept
+    {
+        assert(results.size() == lhs.size());
+
+        std::size_t const count = lhs.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::min(lhs[i], rhs);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void repeat(std::span<T const> const values,
+                          T const                  minValue,
+                          T const                  endValue,
+                          std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::repeat(values[i], minValue, endValue);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void saturate(std::span<T const> const values,
+                            std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::saturate(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void sin(std::span<T const> const angleRadians,
+                       std::span<T> const       sinValues) noexcept
+    {
+        assert(sinValues.size() == angleRadians.size());
+
+        std::size_t const count = angleRadians.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sinValues[i] = ggm::sin(angleRadians[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void sincos(std::span<T const> const angleRadians,
+                          std::span<T> const       sinValues,
+                          std::span<T> const       cosValues) noexcept
+    {
+        assert(sinValues.size() == angleRadians.size());
+        assert(cosValues.size() == angleRadians.size());
+
+        std::size_t const count = angleRadians.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            SinCos<T> const result = ggm::sincos(angleRadians[i]);
+
+            sinValues[i] = result.sin;
+            cosValues[i] = result.cos;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void smooth_step(T const                  edge0,
+                               T const                  edge1,
+                               std::span<T const> const values,
+                               std::span<T> const       results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::smooth_step(edge0, edge1, values[i]);
+        }
+    }
+
+    // =============================================================================
+} // namespace ggm::NumericBatchImpl
+
+// =============================================================================
+// ggm::abs
+// =============================================================================
+
+constexpr void ggm::abs(std::span<float const> const values,
+                        std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::abs(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::abs(std::span<double const> const values,
+                        std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::abs(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::abs(std::span<long double const> const values,
+                        std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::abs(values, results);
+}
+
+// =============================================================================
+// ggm::ceil
+// =============================================================================
+
+constexpr void ggm::ceil(std::span<float const> const values,
+                         std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::ceil(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::ceil(std::span<double const> const values,
+                         std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::ceil(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::ceil(std::span<long double const> const values,
+                         std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::ceil(values, results);
+}
+
+// =============================================================================
+// ggm::clamp
+// =============================================================================
+
+constexpr void ggm::clamp(std::span<float const> const values,
+                          float const                  minValue,
+                          float const                  maxValue,
+                          std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::clamp(values, minValue, maxValue, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::clamp(std::span<double const> const values,
+                          double const                  minValue,
+                          double const                  maxValue,
+                          std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::clamp(values, minValue, maxValue, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::clamp(std::span<long double const> const values,
+                          long double const                  minValue,
+                          long double const                  maxValue,
+                          std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::clamp(values, minValue, maxValue, results);
+}
+
+// =============================================================================
+// ggm::cos
+// =============================================================================
+
+constexpr void ggm::cos(std::span<float const> const angleRadians,
+                        std::span<float> const       cosValues) noexcept
+{
+    NumericBatchImpl::cos(angleRadians, cosValues);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::cos(std::span<double const> const angleRadians,
+                        std::span<double> const       cosValues) noexcept
+{
+    NumericBatchImpl::cos(angleRadians, cosValues);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::cos(std::span<long double const> const angleRadians,
+                        std::span<long double> const       cosValues) noexcept
+{
+    NumericBatchImpl::cos(angleRadians, cosValues);
+}
+
+// =============================================================================
+// ggm::float_from_half
+// =============================================================================
+
+constexpr void ggm::float_from_half(std::span<half const> const values,
+                                    std::span<float> const      results) noexcept
+{
+    assert(results.size() == values.size());
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = float_from_half(values[i]);
+    }
+}
+
+// =============================================================================
+// ggm::floor
+// =============================================================================
+
+constexpr void ggm::floor(std::span<float const> const values,
+                          std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::floor(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::floor(std::span<double const> const values,
+                          std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::floor(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::floor(std::span<long double const> const values,
+                          std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::floor(values, results);
+}
+
+// =============================================================================
+// ggm::fract
+// =============================================================================
+
+constexpr void ggm::fract(std::span<float const> const values,
+                          std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::fract(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::fract(std::span<double const> const values,
+                          std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::fract(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::fract(std::span<long double const> const values,
+                          std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::fract(values, results);
+}
+
+// =============================================================================
+// ggm::half_from_float
+// =============================================================================
+
+constexpr void ggm::half_from_float(std::span<float const> const values,
+                                    std::span<half> const        results) noexcept
+{
+    assert(results.size() == values.size());
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = half_from_float(values[i]);
+    }
+}
+
+// =============================================================================
+// ggm::inverse_lerp
+// =============================================================================
+
+constexpr void ggm::inverse_lerp(float const                  value0,
+                                 float const                  value1,
+                                 std::span<float const> const values,
+                                 std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::inverse_lerp(value0, value1, values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::inverse_lerp(double const                  value0,
+                                 double const                  value1,
+                                 std::span<double const> const values,
+                                 std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::inverse_lerp(value0, value1, values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::inverse_lerp(long double const                  value0,
+                                 long double const                  value1,
+                                 std::span<long double const> const values,
+                                 std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::inverse_lerp(value0, value1, values, results);
+}
+
+// =============================================================================
+// ggm::lerp
+// =============================================================================
+
+constexpr void ggm::lerp(float const                  value0,
+                         float const                  value1,
+                         std::span<float const> const ts,
+                         std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::lerp(value0, value1, ts, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(double const                  value0,
+                         double const                  value1,
+                         std::span<double const> const ts,
+                         std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::lerp(value0, value1, ts, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(long double const                  value0,
+                         long double const                  value1,
+                         std::span<long double const> const ts,
+                         std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::lerp(value0, value1, ts, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(std::span<float const> const values0,
+                         std::span<float const> const values1,
+                         float const                  t,
+                         std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::lerp(values0, values1, t, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(std::span<double const> const values0,
+                         std::span<double const> const values1,
+                         double const                  t,
+                         std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::lerp(values0, values1, t, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(std::span<long double const> const values0,
+                         std::span<long double const> const values1,
+                         long double const                  t,
+                         std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::lerp(values0, values1, t, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(std::span<float const> const values0,
+                         std::span<float const> const values1,
+                         std::span<float const> const ts,
+                         std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::lerp(values0, values1, ts, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(std::span<double const> const values0,
+                         std::span<double const> const values1,
+                         std::span<double const> const ts,
+                         std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::lerp(values0, values1, ts, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::lerp(std::span<long double const> const values0,
+                         std::span<long double const> const values1,
+                         std::span<long double const> const ts,
+                         std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::lerp(values0, values1, ts, results);
+}
+
+// =============================================================================
+// ggm::linear_step
+// =============================================================================
+
+constexpr void ggm::linear_step(float const                  edge0,
+                                float const                  edge1,
+                                std::span<float const> const values,
+                                std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::linear_step(edge0, edge1, values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::linear_step(double const                  edge0,
+                                double const                  edge1,
+                                std::span<double const> const values,
+                                std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::linear_step(edge0, edge1, values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::linear_step(long double const                  edge0,
+                                long double const                  edge1,
+                                std::span<long double const> const values,
+                                std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::linear_step(edge0, edge1, values, results);
+}
+
+// =============================================================================
+// ggm::max
+// =============================================================================
+
+constexpr void ggm::max(std::span<float const> const lhs,
+                        std::span<float const> const rhs,
+                        std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::max(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::max(std::span<double const> const lhs,
+                        std::span<double const> const rhs,
+                        std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::max(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::max(std::span<long double const> const lhs,
+                        std::span<long double const> const rhs,
+                        std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::max(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::max(std::span<float const> const lhs,
+                        float const                  rhs,
+                        std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::max(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::max(std::span<double const> const lhs,
+                        double const                  rhs,
+                        std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::max(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::max(std::span<long double const> const lhs,
+                        long double const                  rhs,
+                        std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::max(lhs, rhs, results);
+}
+
+// =============================================================================
+// ggm::min
+// =============================================================================
+
+constexpr void ggm::min(std::span<float const> const lhs,
+                        std::span<float const> const rhs,
+                        std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::min(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::min(std::span<double const> const lhs,
+                        std::span<double const> const rhs,
+                        std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::min(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::min(std::span<long double const> const lhs,
+                        std::span<long double const> const rhs,
+                        std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::min(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::min(std::span<float const> const lhs,
+                        float const                  rhs,
+                        std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::min(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::min(std::span<double const> const lhs,
+                        double const                  rhs,
+                        std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::min(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::min(std::span<long double const> const lhs,
+                        long double const                  rhs,
+                        std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::min(lhs, rhs, results);
+}
+
+// =============================================================================
+// ggm::repeat
+// =============================================================================
+
+constexpr void ggm::repeat(std::span<float const> const values,
+                           float const                  minValue,
+                           float const                  endValue,
+                           std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::repeat(values, minValue, endValue, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::repeat(std::span<double const> const values,
+                           double const                  minValue,
+                           double const                  endValue,
+                           std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::repeat(values, minValue, endValue, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::repeat(std::span<long double const> const values,
+                           long double const                  minValue,
+                           long double const                  endValue,
+                           std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::repeat(values, minValue, endValue, results);
+}
+
+// =============================================================================
+// ggm::saturate
+// =============================================================================
+
+constexpr void ggm::saturate(std::span<float const> const values,
+                             std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::saturate(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::saturate(std::span<double const> const values,
+                             std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::saturate(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::saturate(std::span<long double const> const values,
+                             std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::saturate(values, results);
+}
+
+// =============================================================================
+// ggm::sin
+// =============================================================================
+
+constexpr void ggm::sin(std::span<float const> const angleRadians,
+                        std::span<float> const       sinValues) noexcept
+{
+    NumericBatchImpl::sin(angleRadians, sinValues);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::sin(std::span<double const> const angleRadians,
+                        std::span<double> const       sinValues) noexcept
+{
+    NumericBatchImpl::sin(angleRadians, sinValues);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::sin(std::span<long double const> const angleRadians,
+                        std::span<long double> const       sinValues) noexcept
+{
+    NumericBatchImpl::sin(angleRadians, sinValues);
+}
+
+// =============================================================================
+// ggm::sincos
+// =============================================================================
+
+constexpr void ggm::sincos(std::span<float const> const angleRadians,
+                           std::span<float> const       sinValues,
+                           std::span<float> const       cosValues) noexcept
+{
+    NumericBatchImpl::sincos(angleRadians, sinValues, cosValues);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::sincos(std::span<double const> const angleRadians,
+                           std::span<double> const       sinValues,
+                           std::span<double> const       cosValues) noexcept
+{
+    NumericBatchImpl::sincos(angleRadians, sinValues, cosValues);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::sincos(std::span<long double const> const angleRadians,
+                           std::span<long double> const       sinValues,
+                           std::span<long double> const       cosValues) noexcept
+{
+    NumericBatchImpl::sincos(angleRadians, sinValues, cosValues);
+}
+
+// =============================================================================
+// ggm::smooth_step
+// =============================================================================
+
+constexpr void ggm::smooth_step(float const                  edge0,
+                                float const                  edge1,
+                                std::span<float const> const values,
+                                std::span<float> const       results) noexcept
+{
+    NumericBatchImpl::smooth_step(edge0, edge1, values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::smooth_step(double const                  edge0,
+                                double const                  edge1,
+                                std::span<double const> const values,
+                                std::span<double> const       results) noexcept
+{
+    NumericBatchImpl::smooth_step(edge0, edge1, values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::smooth_step(long double const                  edge0,
+                                long double const                  edge1,
+                                std::span<long double const> const values,
+                                std::span<long double> const       results) noexcept
+{
+    NumericBatchImpl::smooth_step(edge0, edge1, values, results);
+}
+
+// =============================================================================
+
+#endif // GGM_NUMERIC_BATCH_H
@@ -22,6 +22,11 @@ namespace ggm
     template <> inline constexpr long double DefaultTolerance<long double> = 0x1p-20l; // 2.0l^-20 == 1.0l / (1024.0l * 1024.0l) == 0.00000095367431640625l ~= 1e-6l
     // clang-format on
 
+    // ----------------------------------------------------------------------------------------------
+
+    /// Generic number of units in the last place to use when testing floating point approximate equality (i.e. @ref is_close_ulps)
+    inline constexpr unsigned int DefaultToleranceUlps = 4;
+
     // =============================================================================
 } // namespace ggm
 
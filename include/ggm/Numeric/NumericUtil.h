@@ -2,10 +2,34 @@
 #ifndef GGM_NUMERIC_UTIL_H
 #define GGM_NUMERIC_UTIL_H
 
+#include "ggm/Numeric/Half.h"
 #include "ggm/Numeric/NumericConstants.h"
+#include "ggm/Numeric/SinCos.h"
 
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
+
+// half <-> float conversions use the F16C instructions when the target has them (e.g. -mf16c, -march=haswell,
+// /arch:AVX2), otherwise the equivalent (bit-identical) integer operations
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define GGM_F16C() 1
+#include <immintrin.h>
+#else
+#define GGM_F16C() 0
+#endif
+
+// multiply_add (& so the Vector & Matrix utilities built on it) uses fma for floating point types when the
+// GGM_USE_FMA option is enabled, see CMakeLists.txt, & the target has FMA instructions (e.g. -mfma,
+// -march=haswell, /arch:AVX2), otherwise std::fma is a library call (far slower than the unfused operations)
+#if defined(GGM_USE_FMA) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define GGM_FMA() 1
+#else
+#define GGM_FMA() 0
+#endif
 
 // =============================================================================
 /// Numeric utility functions:
@@ -16,22 +40,39 @@
 /// y = abs(x);                  | Compute the absolute value.
 /// y = ceil(x);                 | Compute the least integral value >= value.
 /// y = clamp(x, min, max);      | Clamp value to [minValue, maxValue].
+/// y = cos(x);                  | Compute the cosine of an angle (radians).
+/// y = float_from_half(h);      | Convert a half to float (exact).
+/// y = float_from_snorm(i);     | Convert a signed normalized integer to float in [-1, 1].
+/// y = float_from_unorm(i);     | Convert an unsigned normalized integer to float in [0, 1].
 /// y = floor(x);                | Compute the greatest integral value <= value.
+/// y = fma(a, b, c);            | Compute a * b + c with a single rounding.
 /// y = fract(x);                | The fractional component of value, i.e. value - floor(value).
+/// h = half_from_float(x);      | Convert a float to the nearest half.
 /// y = inverse_lerp(x0, x1, x); | Inverse of linear interpolation.
 /// b = is_close(x, y, k);       | Compare floating point numbers to each other for approximate equality with specified epsilon.
+/// b = is_close_ulps(x, y, n);  | Compare floating point numbers to each other for approximate equality within n ulps.
 /// y = lerp(x0, x1, t);         | Linear interpolation between two values.
 /// y = linear_step(e0, e1, v);  | Linearly interpolate from 0 to 1 as value progresses from edge0 to edge1.
 /// z = max(x, y)                | Get the minimum of two numbers
 /// z = max_of(a, b, c, ...)     | Get the minimum of a set of numbers
 /// z = min(x, y)                | Get the minimum of two numbers
 /// z = min_of(a, b, c, ...)     | Get the minimum of a set of numbers
+/// y = multiply_add(a, b, c);   | Compute a * b + c, fused with GGM_USE_FMA on FMA targets.
 /// y = reciprocal(x, def);      | A safe reciprocal function.
 /// y = reciprocal_sqrt(x, def); | A safe reciprocal square-root function.
+/// y = reciprocal_sqrt_fast(x); | A fast approximate reciprocal square-root function.
 /// y = repeat(x, min, max);     | Wraps value to [minValue, endValue).
 /// y = saturate(x);             | Clamp value to [0, 1].
+/// y = sin(x);                  | Compute the sine of an angle (radians).
+/// r = sincos(x);               | Compute the sine & cosine of an angle (radians) together.
 /// y = smooth_step(e0, e1, x);  | Hermite cubic interpolation from 0 to 1 as value progresses from edge0 to edge1.
+/// i = snorm8_from_float(x);    | Convert a float to the nearest 8-bit signed normalized integer (saturating).
+/// i = snorm16_from_float(x);   | Convert a float to the nearest 16-bit signed normalized integer (saturating).
+/// y = sqrt(x);                 | Compute the square root.
+/// y = sum_of_products(...);    | Compute a0 * b0 + a1 * b1 + ..., accumulated with multiply_add.
 /// y = trunc(x);                | Compute greatest integral value s.t. abs(trunc(value)) <= abs(value), i.e. round towards zero.
+/// i = unorm8_from_float(x);    | Convert a float to the nearest 8-bit unsigned normalized integer (saturating).
+/// i = unorm16_from_float(x);   | Convert a float to the nearest 16-bit unsigned normalized integer (saturating).
 // =============================================================================
 
 namespace ggm
@@ -54,6 +95,8 @@ namespace ggm
 
     // =============================================================================
     /// Compute the least integral value >= value.
+    /// @details
+    /// Correct for the full range of value & branch-free, see @ref trunc.
     // =============================================================================
 
     constexpr float       ceil(float const value) noexcept;
@@ -98,14 +141,72 @@ namespace ggm
                                        long double const minValue,
                                        long double const maxValue) noexcept;
 
+    // =============================================================================
+    /// Compute the cosine of an angle (radians).
+    /// @details
+    /// Equivalent to sincos(angleRadians).cos, see @ref sincos for accuracy.
+    // =============================================================================
+
+    constexpr float       cos(float const angleRadians) noexcept;
+    constexpr double      cos(double const angleRadians) noexcept;
+    constexpr long double cos(long double const angleRadians) noexcept;
+
+    // =============================================================================
+    /// Convert a half to float.
+    /// @details
+    /// Exact, as every half value is representable as a float (nan payloads are kept & quieted, as F16C does).
+    // =============================================================================
+
+    constexpr float float_from_half(half const value) noexcept;
+
+    // =============================================================================
+    /// Convert a signed normalized (SNORM) integer to float, i.e. value / max, in [-1, 1].
+    /// @details
+    /// Correctly rounded. Both min & min + 1 give -1 (so that the range is symmetric & 0 is exact), as the
+    /// D3D & Vulkan SNORM formats do.
+    // =============================================================================
+
+    constexpr float float_from_snorm(std::int8_t const value) noexcept;
+    constexpr float float_from_snorm(std::int16_t const value) noexcept;
+
+    // =============================================================================
+    /// Convert an unsigned normalized (UNORM) integer to float, i.e. value / max, in [0, 1].
+    /// @details
+    /// Correctly rounded, so 0 & max are exactly 0 & 1.
+    // =============================================================================
+
+    constexpr float float_from_unorm(std::uint8_t const value) noexcept;
+    constexpr float float_from_unorm(std::uint16_t const value) noexcept;
+
     // =============================================================================
     /// Compute the greatest integral value <= value.
+    /// @details
+    /// Correct for the full range of value & branch-free, see @ref trunc.
     // =============================================================================
 
     constexpr float       floor(float const value) noexcept;
     constexpr double      floor(double const value) noexcept;
     constexpr long double floor(long double const value) noexcept;
 
+    // =============================================================================
+    /// Compute lhs * rhs + addend with a single rounding (fused multiply-add).
+    /// @details
+    /// Uses std::fma at runtime, which is a single instruction when the target has FMA (e.g. -mfma,
+    /// /arch:AVX2), otherwise a (slower) library call with the same result. During constant evaluation
+    /// (where <cmath> is not constexpr) float & double are emulated exactly (for finite results, barring
+    /// underflow), long double may differ from std::fma by 1 ulp.
+    // =============================================================================
+
+    constexpr float       fma(float const lhs,
+                              float const rhs,
+                              float const addend) noexcept;
+    constexpr double      fma(double const lhs,
+                              double const rhs,
+                              double const addend) noexcept;
+    constexpr long double fma(long double const lhs,
+                              long double const rhs,
+                              long double const addend) noexcept;
+
     // =============================================================================
     /// The fractional component of value, i.e. value - floor(value).
     // =============================================================================
@@ -114,6 +215,15 @@ namespace ggm
     constexpr double      fract(double const value) noexcept;
     constexpr long double fract(long double const value) noexcept;
 
+    // =============================================================================
+    /// Convert a float to the nearest half.
+    /// @details
+    /// Rounds to nearest even, magnitudes too large for half give infinity & magnitudes too small give
+    /// (signed) zero or a denormal. Matches the F16C instructions bit for bit (including nan payloads).
+    // =============================================================================
+
+    constexpr half half_from_float(float const value) noexcept;
+
     // =============================================================================
     /// Inverse of linear interpolation.
     /// @details
@@ -151,17 +261,43 @@ namespace ggm
     /// The intent is to account for floating point precision degrading further from zero, in a way
     /// consistent with the fact that the distance between representable real numbers doubles every
     /// power-of-two.
+    ///
+    /// For float & double the power-of-two scale is read directly from the exponent bits of lhs & rhs
+    /// (rather than via std::ilogb & std::scalbn), which is branch-free and vectorizable.
     // =============================================================================
 
-    bool is_close(float const lhs,
-                  float const rhs,
-                  float const epsilon = DefaultTolerance<float>) noexcept;
-    bool is_close(double const lhs,
-                  double const rhs,
-                  double const epsilon = DefaultTolerance<double>) noexcept;
-    bool is_close(long double const lhs,
-                  long double const rhs,
-                  long double const epsilon = DefaultTolerance<long double>) noexcept;
+    constexpr bool is_close(float const lhs,
+                            float const rhs,
+                            float const epsilon = DefaultTolerance<float>) noexcept;
+    constexpr bool is_close(double const lhs,
+                            double const rhs,
+                            double const epsilon = DefaultTolerance<double>) noexcept;
+    constexpr bool is_close(long double const lhs,
+                            long double const rhs,
+                            long double const epsilon = DefaultTolerance<long double>) noexcept;
+
+    // =============================================================================
+    /// Compare floating point numbers to each other for approximate equality within maxUlps units in
+    /// the last place.
+    /// @details
+    /// The bit patterns of lhs & rhs are mapped to integers s.t. adjacent representable values map to
+    /// adjacent integers, so the integer distance is the number of representable values between lhs & rhs:
+    /// @code
+    /// is_close_ulps(1.0f, std::nextafter(1.0f, 2.0f), 1) == true
+    /// is_close_ulps(0.0f, -0.0f, 0)                      == true
+    /// is_close_ulps(nan, nan, n)                         == false
+    /// is_close_ulps(inf, max, 1)                         == true
+    /// @endcode
+    /// The comparison is done entirely with integer operations, it is branch-free and vectorizable.
+    /// @note long double is not supported since it has no portable same-sized integer type.
+    // =============================================================================
+
+    constexpr bool is_close_ulps(float const        lhs,
+                                 float const        rhs,
+                                 unsigned int const maxUlps = DefaultToleranceUlps) noexcept;
+    constexpr bool is_close_ulps(double const       lhs,
+                                 double const       rhs,
+                                 unsigned int const maxUlps = DefaultToleranceUlps) noexcept;
 
     // =============================================================================
     /// Linear interpolation between two values.
@@ -170,7 +306,7 @@ namespace ggm
     /// @param[in] value0 The value for t = 0, i.e. the beginning of the interpolation
     /// @param[in] value1 The value for t = 1, i.e. the ending of the interpolation
     /// @param[in] t      The interpolation parameter, usually [0, 1] (but not required)
-    /// @return The interpolated result: value0 + t * (value1 - value0)
+    /// @return The interpolated result: value0 + t * (value1 - value0), computed with @ref multiply_add
     // =============================================================================
 
     constexpr float       lerp(float const value0,
@@ -331,48 +467,90 @@ namespace ggm
     constexpr auto && min_of(T0 && value0,
                              TN &&... valueN) noexcept;
 
+    // =============================================================================
+    /// Compute lhs * rhs + addend.
+    /// @details
+    /// For floating point types, when GGM_USE_FMA is defined & the target has FMA instructions (e.g. -mfma,
+    /// /arch:AVX2) this is @ref fma, so the result is rounded once & is the same with every compiler. Otherwise
+    /// the product & sum are written separately, & whether they are fused depends on the compiler's floating
+    /// point contraction (e.g. -ffp-contract). Other types (e.g. integers, Fixed) always compute
+    /// lhs * rhs + addend. T is deduced from lhs only.
+    // =============================================================================
+
+    template <typename T>
+    constexpr T multiply_add(T const &                       lhs,
+                             std::type_identity_t<T> const & rhs,
+                             std::type_identity_t<T> const & addend) noexcept;
+
     // =============================================================================
     /// A safe reciprocal function.
     /// @returns 1 / value if value is not 0, else defaultValue
     // =============================================================================
 
-    constexpr float    reciprocal(short const value,
-                                  float const defaultValue = 0.0f) noexcept;
-    constexpr float    reciprocal(unsigned short const value,
-                                  float const          defaultValue = 0.0f) noexcept;
-    constexpr float    reciprocal(int const   value,
-                                  float const defaultValue = 0.0f) noexcept;
-    constexpr float    reciprocal(unsigned int const value,
-                                  float const        defaultValue = 0.0f) noexcept;
-    constexpr float    reciprocal(long const  value,
-                                  float const defaultValue = 0.0f) noexcept;
-    constexpr float    reciprocal(unsigned long const value,
-                                  float const         defaultValue = 0.0f) noexcept;
-    constexpr double   reciprocal(long long const value,
-                                  double const    defaultValue = 0.0) noexcept;
-    constexpr double   reciprocal(unsigned long long const value,
-                                  double const             defaultValue = 0.0) noexcept;
-    inline float       reciprocal(float const value,
-                                  float const defaultValue = 0.0f,
-                                  float const epsilon      = DefaultTolerance<float>) noexcept;
-    inline double      reciprocal(double const value,
-                                  double const defaultValue = 0.0,
-                                  double const epsilon      = DefaultTolerance<double>) noexcept;
-    inline long double reciprocal(long double const value,
-                                  long double const defaultValue = 0.0l,
-                                  long double const epsilon      = DefaultTolerance<long double>) noexcept;
+    constexpr float       reciprocal(short const value,
+                                     float const defaultValue = 0.0f) noexcept;
+    constexpr float       reciprocal(unsigned short const value,
+                                     float const          defaultValue = 0.0f) noexcept;
+    constexpr float       reciprocal(int const   value,
+                                     float const defaultValue = 0.0f) noexcept;
+    constexpr float       reciprocal(unsigned int const value,
+                                     float const        defaultValue = 0.0f) noexcept;
+    constexpr float       reciprocal(long const  value,
+                                     float const defaultValue = 0.0f) noexcept;
+    constexpr float       reciprocal(unsigned long const value,
+                                     float const         defaultValue = 0.0f) noexcept;
+    constexpr double      reciprocal(long long const value,
+                                     double const    defaultValue = 0.0) noexcept;
+    constexpr double      reciprocal(unsigned long long const value,
+                                     double const             defaultValue = 0.0) noexcept;
+    constexpr float       reciprocal(float const value,
+                                     float const defaultValue = 0.0f,
+                                     float const epsilon      = DefaultTolerance<float>) noexcept;
+    constexpr double      reciprocal(double const value,
+                                     double const defaultValue = 0.0,
+                                     double const epsilon      = DefaultTolerance<double>) noexcept;
+    constexpr long double reciprocal(long double const value,
+                                     long double const defaultValue = 0.0l,
+                                     long double const epsilon      = DefaultTolerance<long double>) noexcept;
 
     // =============================================================================
     /// A safe reciprocal square-root function.
     /// @returns 1 / sqrt(value) if value > 0, else defaultValue
     // =============================================================================
 
-    float       reciprocal_sqrt(float const value,
-                                float const defaultValue = 0.0f) noexcept;
-    double      reciprocal_sqrt(double const value,
-                                double const defaultValue = 0.0) noexcept;
-    long double reciprocal_sqrt(long double const value,
-                                long double const defaultValue = 0.0l) noexcept;
+    constexpr float       reciprocal_sqrt(float const value,
+                                          float const defaultValue = 0.0f) noexcept;
+    constexpr double      reciprocal_sqrt(double const value,
+                                          double const defaultValue = 0.0) noexcept;
+    constexpr long double reciprocal_sqrt(long double const value,
+                                          long double const defaultValue = 0.0l) noexcept;
+
+    // =============================================================================
+    /// A fast approximate reciprocal square-root function.
+    /// @details
+    /// An initial estimate is computed directly from the floating point bits of value, which is then
+    /// refined with Steps iterations. For Steps >= 1 the estimate uses the magic constant from Moroz et al.
+    /// 2018, "Fast calculation of inverse square root with the use of magic constant", & the first iteration
+    /// is a minimax quadratic in value * estimate^2 (1 more product than a Newton-Raphson iteration, for
+    /// ~15.9 bits instead of ~10.6), the others are Newton-Raphson iterations.
+    ///
+    /// Maximum relative error vs. 1 / sqrt(value), measured over all normal float values:
+    /// Steps | Max relative error | Bits of precision
+    /// ----- | ------------------ | -----------------
+    /// 0     | 3.5e-2             | ~4.9
+    /// 1     | 1.7e-5             | ~15.9
+    /// 2     | 1.9e-7             | ~22.4 (i.e. within 4 ulp of reciprocal_sqrt)
+    /// 3     | 1.6e-7             | ~22.6
+    ///
+    /// The computation is branch-free, so it is suitable for auto-vectorized loops.
+    /// @param[in] value        The value to compute the reciprocal square-root of, must be finite & not subnormal.
+    /// @param[in] defaultValue The value to return if value <= 0
+    /// @returns ~1 / sqrt(value) if value > 0, else defaultValue
+    // =============================================================================
+
+    template <unsigned int Steps = 2>
+    constexpr float reciprocal_sqrt_fast(float const value,
+                                         float const defaultValue = 0.0f) noexcept;
 
     // =============================================================================
     /// Wraps value to [minValue, endValue).
@@ -422,6 +600,47 @@ namespace ggm
     constexpr double      saturate(double const value) noexcept;
     constexpr long double saturate(long double const value) noexcept;
 
+    // =============================================================================
+    /// Compute the sine of an angle (radians).
+    /// @details
+    /// Equivalent to sincos(angleRadians).sin, see @ref sincos for accuracy.
+    // =============================================================================
+
+    constexpr float       sin(float const angleRadians) noexcept;
+    constexpr double      sin(double const angleRadians) noexcept;
+    constexpr long double sin(long double const angleRadians) noexcept;
+
+    // =============================================================================
+    /// Compute the sine & cosine of an angle (radians) together.
+    /// @details
+    /// The angle is reduced once to r in [-pi/4, pi/4] & a quadrant (Cody-Waite reduction by pi/2),
+    /// then sin(r) & cos(r) are evaluated with minimax polynomials & swapped/negated per quadrant.
+    /// Unlike std::sin & std::cos this is usable during constant evaluation, and it is branch-free
+    /// so it is suitable for auto-vectorized loops.
+    ///
+    /// Maximum absolute error vs. std::sin & std::cos (of the angle converted to the next wider type):
+    /// Type        | Angle range        | Max absolute error
+    /// ----        | -----------        | ------------------
+    /// float       | abs(angle) <= 1e4  | 9.4e-8 (< 1 ulp of 1.0f)
+    /// float       | abs(angle) <= 1e5  | 9.6e-7
+    /// float       | abs(angle) <= 1e6  | 3.2e-2
+    /// double      | abs(angle) <= 1e6  | 2.1e-16 (< 1 ulp of 1.0)
+    /// double      | abs(angle) <= 1e9  | 6.0e-8
+    /// double      | abs(angle) <= 1e12 | 6.2e-5
+    /// long double | abs(angle) <= 1e6  | evaluated with the double kernel
+    ///
+    /// The error grows in proportion to abs(angle) beyond those ranges (the Cody-Waite reduction is
+    /// only exact while quadrant * pi/2 fits in the mantissa), results are meaningless once abs(angle)
+    /// exceeds 2^22 * pi/2 (float, ~6.6e6) or 2^51 * pi/2 (double, ~3.5e15), but every finite angle
+    /// returns sin & cos in [-1, 1]. nan & inf return nan.
+    /// @param[in] angleRadians The angle in radians
+    /// @returns { sin(angleRadians), cos(angleRadians) }
+    // =============================================================================
+
+    constexpr SinCos<float>       sincos(float const angleRadians) noexcept;
+    constexpr SinCos<double>      sincos(double const angleRadians) noexcept;
+    constexpr SinCos<long double> sincos(long double const angleRadians) noexcept;
+
     // =============================================================================
     /// Hermite cubic interpolation from 0 to 1 as value progresses from edge0 to edge1.
     /// @details
@@ -451,24 +670,853 @@ namespace ggm
                                       long double const value) noexcept;
 
     // =============================================================================
-    // square root
+    /// Convert a float to the nearest signed normalized (SNORM) integer, i.e. round(clamp(value, -1, 1) * max).
+    /// @details
+    /// The exact product value * max is rounded to the nearest integer (ties away from zero), values outside
+    /// [-1, 1] saturate (so there is no need to clamp first) & nan gives 0, as the GPU conversions do.
+    /// Branch-free, so it is suitable for auto-vectorized loops.
     // =============================================================================
 
-    float       sqrt(float const value) noexcept;
-    double      sqrt(double const value) noexcept;
-    long double sqrt(long double const value) noexcept;
+    constexpr std::int8_t  snorm8_from_float(float const value) noexcept;
+    constexpr std::int16_t snorm16_from_float(float const value) noexcept;
+
+    // =============================================================================
+    /// Compute the sum of the products of each pair, i.e. lhs0 * rhs0 + lhs1 * rhs1 + ...
+    /// @details
+    /// Accumulated in order with @ref multiply_add, i.e. multiply_add(lhs1, rhs1, lhs0 * rhs0) for 2 pairs,
+    /// which is the building block of dot products, matrix products, determinants & inverses.
+    /// T is deduced from lhs0 only, so that the other values may be negated (which promotes small integers).
+    // =============================================================================
+
+    template <typename T>
+    constexpr T sum_of_products(T const &                       lhs0, std::type_identity_t<T> const & rhs0,
+                                std::type_identity_t<T> const & lhs1, std::type_identity_t<T> const & rhs1) noexcept;
+
+    template <typename T>
+    constexpr T sum_of_products(T const &                       lhs0, std::type_identity_t<T> const & rhs0,
+                                std::type_identity_t<T> const & lhs1, std::type_identity_t<T> const & rhs1,
+                                std::type_identity_t<T> const & lhs2, std::type_identity_t<T> const & rhs2) noexcept;
+
+    template <typename T>
+    constexpr T sum_of_products(T const &                       lhs0, std::type_identity_t<T> const & rhs0,
+                                std::type_identity_t<T> const & lhs1, std::type_identity_t<T> const & rhs1,
+                                std::type_identity_t<T> const & lhs2, std::type_identity_t<T> const & rhs2,
+                                std::type_identity_t<T> const & lhs3, std::type_identity_t<T> const & rhs3) noexcept;
+
+    // =============================================================================
+    /// Compute the square root.
+    /// @details
+    /// Uses std::sqrt at runtime. During constant evaluation (where <cmath> is not constexpr) a
+    /// Newton-Raphson iteration is used instead, which may differ from std::sqrt by 1 ulp.
+    // =============================================================================
+
+    constexpr float       sqrt(float const value) noexcept;
+    constexpr double      sqrt(double const value) noexcept;
+    constexpr long double sqrt(long double const value) noexcept;
 
     // =============================================================================
     /// Compute greatest integral value s.t. abs(trunc(value)) <= abs(value), i.e. round towards zero.
+    /// @details
+    /// Every value is supported (inf & nan are returned as-is, -0.5 truncates to -0). For float & double
+    /// the computation is branch-free bit manipulation (float only converts through int32 for the
+    /// magnitudes where that is exact), so it is vectorizable. long double uses std::trunc at runtime.
     // =============================================================================
 
     constexpr float       trunc(float const value) noexcept;
     constexpr double      trunc(double const value) noexcept;
     constexpr long double trunc(long double const value) noexcept;
 
+    // =============================================================================
+    /// Convert a float to the nearest unsigned normalized (UNORM) integer, i.e. round(saturate(value) * max).
+    /// @details
+    /// The exact product value * max is rounded to the nearest integer (ties up), values outside [0, 1]
+    /// saturate (so there is no need to saturate first) & nan gives 0, as the GPU conversions do.
+    /// Branch-free, so it is suitable for auto-vectorized loops.
+    // =============================================================================
+
+    constexpr std::uint8_t  unorm8_from_float(float const value) noexcept;
+    constexpr std::uint16_t unorm16_from_float(float const value) noexcept;
+
     // =============================================================================
 } // namespace ggm
 
+namespace ggm::NumericImpl
+{
+    // =============================================================================
+    // sqrt:
+    //
+    // note: when constexpr <cmath> is available (C++26) constexpr_sqrt can be replaced
+    // by std::sqrt
+    // =============================================================================
+
+    /// Newton-Raphson square root, usable during constant evaluation.
+    template <typename T>
+    constexpr T constexpr_sqrt(T const value) noexcept
+    {
+        typedef std::numeric_limits<T> limits;
+
+        if (!(value >= T{ 0 })) // negative or nan
+        {
+            return limits::quiet_NaN();
+        }
+
+        if ((value == T{ 0 }) || (value == limits::infinity()))
+        {
+            return value;
+        }
+
+        // start at or above the root so that the iteration decreases monotonically, then stop
+        // as soon as it no longer makes progress
+        T current = (value > T{ 1 }) ? value : T{ 1 };
+        T next    = T{ 0.5 } * (current + value / current);
+        while (next < current)
+        {
+            current = next;
+            next    = T{ 0.5 } * (current + value / current);
+        }
+
+        return current;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr T sqrt(T const value) noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return constexpr_sqrt(value);
+        }
+
+        return std::sqrt(value);
+    }
+
+    // =============================================================================
+    // FloatTraits:
+    // =============================================================================
+
+    /// metatype to query the binary layout of an IEEE-754 floating point type
+    template <typename T>
+    struct FloatTraits;
+
+    // -----------------------------------------------------------------------------
+
+    template <>
+    struct FloatTraits<float>
+    {
+        static_assert(std::numeric_limits<float>::is_iec559);
+
+        typedef std::int32_t  IntType;  ///< Signed integer type with the same size as float.
+        typedef std::uint32_t UIntType; ///< Unsigned integer type with the same size as float.
+
+        static constexpr UIntType ExponentMask  = 0x7F800000u; ///< Biased exponent bits, also the bits of +infinity.
+        static constexpr UIntType MagnitudeMask = 0x7FFFFFFFu; ///< All bits except for the sign bit.
+        static constexpr UIntType MantissaMask  = 0x007FFFFFu; ///< Explicit mantissa bits.
+
+        static constexpr IntType MantissaBits = 23;  ///< Number of explicit mantissa bits.
+        static constexpr IntType ExponentBias = 127; ///< Biased exponent of 1.0f.
+    };
+
+    // -----------------------------------------------------------------------------
+
+    template <>
+    struct FloatTraits<double>
+    {
+        static_assert(std::numeric_limits<double>::is_iec559);
+
+        typedef std::int64_t  IntType;  ///< Signed integer type with the same size as double.
+        typedef std::uint64_t UIntType; ///< Unsigned integer type with the same size as double.
+
+        static constexpr UIntType ExponentMask  = 0x7FF0000000000000u; ///< Biased exponent bits, also the bits of +infinity.
+        static constexpr UIntType MagnitudeMask = 0x7FFFFFFFFFFFFFFFu; ///< All bits except for the sign bit.
+        static constexpr UIntType MantissaMask  = 0x000FFFFFFFFFFFFFu; ///< Explicit mantissa bits.
+
+        static constexpr IntType MantissaBits = 52;   ///< Number of explicit mantissa bits.
+        static constexpr IntType ExponentBias = 1023; ///< Biased exponent of 1.0.
+    };
+
+    // =============================================================================
+    // fma:
+    //
+    // note: when constexpr <cmath> is available (C++26) constexpr_fma can be replaced
+    // by std::fma
+    // =============================================================================
+
+    /// An unevaluated sum, i.e. the exact result of an operation is value + error
+    template <typename T>
+    struct ExactTerms
+    {
+        // members:
+        T value; // uninitialized
+        T error; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// Knuth's TwoSum, exact (barring overflow) for any lhs & rhs.
+    template <typename T>
+    constexpr ExactTerms<T> exact_sum(T const lhs,
+                                      T const rhs) noexcept
+    {
+        T const value     = lhs + rhs;
+        T const rhsApprox = value - lhs;
+        T const lhsApprox = value - rhsApprox;
+
+        return ExactTerms<T>{ value, (lhs - lhsApprox) + (rhs - rhsApprox) };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Dekker's TwoProduct with Veltkamp splitting, exact barring overflow & underflow.
+    template <typename T>
+    constexpr ExactTerms<T> exact_product(T const lhs,
+                                          T const rhs) noexcept
+    {
+        // 2^ceil(digits / 2) + 1, splits a value into 2 halves which each have products that are exact
+        constexpr T Splitter = [] {
+            T scale = T{ 1 };
+            for (int i = 0; i < (std::numeric_limits<T>::digits + 1) / 2; ++i)
+            {
+                scale *= T{ 2 };
+            }
+            return scale + T{ 1 };
+        }();
+
+        T const lhsScaled = Splitter * lhs;
+        T const lhsHi     = lhsScaled - (lhsScaled - lhs);
+        T const lhsLo     = lhs - lhsHi;
+        T const rhsScaled = Splitter * rhs;
+        T const rhsHi     = rhsScaled - (rhsScaled - rhs);
+        T const rhsLo     = rhs - rhsHi;
+
+        T const value = lhs * rhs;
+        T const error = (((lhsHi * rhsHi - value) + lhsHi * rhsLo) + lhsLo * rhsHi) + lhsLo * rhsLo;
+
+        return ExactTerms<T>{ value, error };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Round the exact sum to odd, i.e. if it is inexact, the neighbour of terms.value (towards the exact sum)
+    /// with an odd mantissa. Rounding to odd & then to nearest is a correct rounding to nearest for any narrower
+    /// type (by at least 2 bits), see Boldo & Melquiond "Emulation of FMA and correctly rounded sums".
+    template <typename T>
+    constexpr T round_to_odd(ExactTerms<T> const terms) noexcept
+    {
+        typedef typename FloatTraits<T>::UIntType UIntType;
+
+        UIntType const bits = std::bit_cast<UIntType>(terms.value);
+        if ((terms.error == T{ 0 }) || ((bits & 1u) != 0))
+        {
+            return terms.value;
+        }
+
+        // moving towards the error increases the magnitude if it has the same sign as value
+        bool const isAway = (terms.error < T{ 0 }) == (terms.value < T{ 0 });
+        return std::bit_cast<T>(isAway ? (bits + 1u) : (bits - 1u));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Fused multiply-add, usable during constant evaluation.
+    template <typename T>
+    constexpr T constexpr_fma(T const lhs,
+                              T const rhs,
+                              T const addend) noexcept
+    {
+        typedef std::numeric_limits<T> limits;
+
+        // inf & nan results (including overflow) don't need the exact computation
+        T const unfused = lhs * rhs + addend;
+        if (!((unfused >= -limits::max()) && (unfused <= limits::max())))
+        {
+            return unfused;
+        }
+
+        if constexpr (limits::digits == std::numeric_limits<float>::digits)
+        {
+            // the product is exact as double, so the only rounding is of the sum
+            double const product = static_cast<double>(lhs) * static_cast<double>(rhs);
+            return static_cast<T>(round_to_odd(exact_sum(product, static_cast<double>(addend))));
+        }
+        else
+        {
+            // product + addend == sum.value + sum.error + product.error exactly, which is rounded once
+            // (when the tail can be rounded to odd, i.e. T has the layout of double)
+            ExactTerms<T> const product = exact_product(lhs, rhs);
+            ExactTerms<T> const sum     = exact_sum(product.value, addend);
+            ExactTerms<T> const tail    = exact_sum(sum.error, product.error);
+
+            if constexpr (limits::digits == std::numeric_limits<double>::digits)
+            {
+                return sum.value + static_cast<T>(round_to_odd(ExactTerms<double>{ static_cast<double>(tail.value), static_cast<double>(tail.error) }));
+            }
+            else
+            {
+                return sum.value + tail.value;
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr T fma(T const lhs,
+                    T const rhs,
+                    T const addend) noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return constexpr_fma(lhs, rhs, addend);
+        }
+
+        return std::fma(lhs, rhs, addend);
+    }
+
+    // =============================================================================
+    // trunc:
+    // =============================================================================
+
+    /// Mask of the magnitude bits of a value that are below 2^0, i.e. the bits cleared by trunc.
+    /// @details
+    /// Magnitudes < 1 give all the magnitude bits (so trunc gives +-0), magnitudes large enough to have
+    /// no fractional bits (including inf & nan) give 0.
+    ///
+    /// note: every step is plain integer arithmetic (the shift is clamped before use & the < 1 case is
+    /// derived from the sign of the exponent), so compilers are able to vectorize it without any selects
+    /// on targets with per-lane variable shifts (e.g. AVX2)
+    template <typename T>
+    constexpr typename FloatTraits<T>::UIntType fraction_mask(typename FloatTraits<T>::UIntType const bits) noexcept
+    {
+        typedef FloatTraits<T>            Traits;
+        typedef typename Traits::IntType  IntType;
+        typedef typename Traits::UIntType UIntType;
+
+        constexpr int SignShift = std::numeric_limits<UIntType>::digits - 1;
+
+        IntType const  exponent   = static_cast<IntType>((bits & Traits::ExponentMask) >> Traits::MantissaBits) - Traits::ExponentBias;
+        UIntType const shift      = static_cast<UIntType>(min(max(exponent, IntType{ 0 }), Traits::MantissaBits));
+        UIntType const isBelowOne = UIntType{ 0 } - (static_cast<UIntType>(exponent) >> SignShift); // all ones if exponent < 0, else 0
+
+        return (Traits::MantissaMask >> shift) | (isBelowOne & Traits::MagnitudeMask);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Round towards zero through an int32 conversion, which is exact (& vectorizable as cvttps2dq/cvtdq2ps)
+    /// for |value| < 2^23. Larger magnitudes (including inf & nan) are already integral so are returned as-is.
+    /// @details
+    /// Larger magnitudes are masked to 0 before the conversion, so the conversion is never out of range, & the
+    /// sign bit is restored afterwards so that -0.5f truncates to -0.0f (as std::trunc does).
+    constexpr float trunc(float const value) noexcept
+    {
+        typedef FloatTraits<float> Traits;
+        typedef Traits::UIntType   UIntType;
+
+        constexpr UIntType IntegralBits = std::bit_cast<UIntType>(0x1p23f); // smallest magnitude with no fractional bits
+
+        UIntType const bits       = std::bit_cast<UIntType>(value);
+        UIntType const signBits   = bits & ~Traits::MagnitudeMask;
+        UIntType const isFraction = UIntType{ 0 } - static_cast<UIntType>((bits & Traits::MagnitudeMask) < IntegralBits);
+
+        float const    smallValue = std::bit_cast<float>(bits & isFraction);
+        UIntType const truncBits  = std::bit_cast<UIntType>(static_cast<float>(static_cast<std::int32_t>(smallValue))) | signBits;
+        return std::bit_cast<float>((truncBits & isFraction) | (bits & ~isFraction));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Round towards zero by clearing the fractional mantissa bits.
+    /// @details
+    /// Unlike float, there is no conversion that covers every double with fractional bits (vectorized int64
+    /// conversions require AVX-512) so clear the bits directly.
+    constexpr double trunc(double const value) noexcept
+    {
+        typedef FloatTraits<double>::UIntType UIntType;
+
+        UIntType const bits = std::bit_cast<UIntType>(value);
+        return std::bit_cast<double>(bits & ~fraction_mask<double>(bits));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// trunc, then subtract 1 from values that were rounded up (i.e. negative values with fractional bits).
+    template <typename T>
+    constexpr T floor(T const value) noexcept
+    {
+        typedef FloatTraits<T>            Traits;
+        typedef typename Traits::UIntType UIntType;
+
+        constexpr UIntType OneBits = std::bit_cast<UIntType>(T{ 1 });
+
+        T const        truncValue   = trunc(value);
+        UIntType const isRoundedUp  = UIntType{ 0 } - static_cast<UIntType>(value < truncValue); // all ones or 0 (so -0 - 0 stays -0)
+        return truncValue - std::bit_cast<T>(OneBits & isRoundedUp);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// ceil(value) == -floor(-value), where negation is exact & preserves the sign of zero.
+    template <typename T>
+    constexpr T ceil(T const value) noexcept
+    {
+        return -floor(-value);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// long double has no portable bit layout, so use <cmath> (or the equivalent rounding during constant evaluation).
+    constexpr long double trunc(long double const value) noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            typedef std::numeric_limits<long double> limits;
+            static_assert(limits::radix == 2);
+
+            // every long double with magnitude >= 2^(digits - 1) is integral
+            long double integralMin = 1.0l;
+            for (int i = 1; i < limits::digits; ++i)
+            {
+                integralMin *= 2.0l;
+            }
+
+            long double const magnitude = abs(value);
+            if (!(magnitude < integralMin)) // integral, inf or nan
+            {
+                return value;
+            }
+
+            if (magnitude < 1.0l)
+            {
+                return value * 0.0l; // +-0 with the sign of value
+            }
+
+            // adding integralMin rounds to the nearest integer, then step back towards zero if needed
+            long double rounded = (magnitude + integralMin) - integralMin;
+            if (rounded > magnitude)
+            {
+                rounded -= 1.0l;
+            }
+
+            return (value < 0.0l) ? -rounded : rounded;
+        }
+
+        return std::trunc(value);
+    }
+
+    // =============================================================================
+    // saturate:
+    // =============================================================================
+
+    /// Select 0, 1 or value using integer masks rather than ternaries.
+    /// @details
+    /// With ternaries the selected constants are visible to the optimizer, which then (e.g. via partial
+    /// redundancy elimination) specializes the following arithmetic for each case, introducing control
+    /// flow that prevents vectorization of loops such as smooth_step. nan is still returned as-is.
+    template <typename T>
+    constexpr T saturate(T const value) noexcept
+    {
+        typedef typename FloatTraits<T>::UIntType UIntType;
+
+        constexpr UIntType OneBits = std::bit_cast<UIntType>(T{ 1 });
+
+        UIntType const isBelow = UIntType{ 0 } - static_cast<UIntType>(value <= T{ 0 }); // all ones or 0
+        UIntType const isAbove = UIntType{ 0 } - static_cast<UIntType>(value > T{ 1 });  // all ones or 0
+        UIntType const bits    = std::bit_cast<UIntType>(value);
+        return std::bit_cast<T>((bits & ~(isBelow | isAbove)) | (OneBits & isAbove));
+    }
+
+    // =============================================================================
+    // is_close:
+    // =============================================================================
+
+    /// Equivalent to scalbn(epsilon, max(ilogb(lhs), ilogb(rhs))) when that exponent is > 0, else epsilon.
+    /// @details
+    /// Masking the exponent bits of a value gives 2^ilogb(value) for normal values, 0 for zero &
+    /// subnormal values and infinity for inf & nan, so no branches or <cmath> calls are needed.
+    template <typename T>
+    constexpr T is_close_tolerance(T const lhs,
+                                   T const rhs,
+                                   T const epsilon) noexcept
+    {
+        typedef FloatTraits<T>            Traits;
+        typedef typename Traits::UIntType UIntType;
+
+        // note: max with the bits of 1 (rather than max(scale, T{ 1 }) as floats) keeps the select in
+        // the integer domain, which compilers vectorize without having to consider fp exceptions
+        constexpr UIntType OneBits = std::bit_cast<UIntType>(T{ 1 });
+
+        UIntType const lhsExponentBits = std::bit_cast<UIntType>(lhs) & Traits::ExponentMask;
+        UIntType const rhsExponentBits = std::bit_cast<UIntType>(rhs) & Traits::ExponentMask;
+        UIntType const maxExponentBits = max(max(lhsExponentBits, rhsExponentBits), OneBits);
+        return epsilon * std::bit_cast<T>(maxExponentBits);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// long double has no portable bit layout, so use <cmath> (or an equivalent loop during constant evaluation).
+    constexpr long double is_close_tolerance(long double const lhs,
+                                             long double const rhs,
+                                             long double const epsilon) noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            long double magnitude = max(abs(lhs), abs(rhs));
+            if (magnitude == std::numeric_limits<long double>::infinity())
+            {
+                return magnitude;
+            }
+
+            long double tolerance = epsilon;
+            while (magnitude >= 2.0l)
+            {
+                magnitude *= 0.5l;
+                tolerance *= 2.0l;
+            }
+
+            return tolerance;
+        }
+
+        int const lhsExp = std::ilogb(lhs);
+        int const rhsExp = std::ilogb(rhs);
+        int const maxExp = max(lhsExp, rhsExp);
+        return (maxExp > 0) ? std::scalbn(epsilon, maxExp) : epsilon;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr bool is_close(T const lhs,
+                            T const rhs,
+                            T const epsilon) noexcept
+    {
+        return abs(lhs - rhs) <= is_close_tolerance(lhs, rhs, epsilon);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Map the bits of value to a signed integer s.t. the integers are ordered the same as the
+    /// floating point values and adjacent floating point values map to adjacent integers
+    /// (both +0 and -0 map to 0).
+    template <typename T>
+    constexpr typename FloatTraits<T>::IntType to_ordered_int(T const value) noexcept
+    {
+        typedef FloatTraits<T>           Traits;
+        typedef typename Traits::IntType IntType;
+
+        constexpr int SignShift = std::numeric_limits<IntType>::digits;
+
+        IntType const bits      = std::bit_cast<IntType>(value);
+        IntType const magnitude = bits & static_cast<IntType>(Traits::MagnitudeMask);
+        IntType const signMask  = bits >> SignShift; // 0 if positive, -1 if negative
+        return (magnitude ^ signMask) - signMask;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// true if value is not nan, i.e. its magnitude bits are <= those of infinity.
+    template <typename T>
+    constexpr bool is_ordered(T const value) noexcept
+    {
+        typedef FloatTraits<T>            Traits;
+        typedef typename Traits::UIntType UIntType;
+
+        return (std::bit_cast<UIntType>(value) & Traits::MagnitudeMask) <= Traits::ExponentMask;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr bool is_close_ulps(T const            lhs,
+                                 T const            rhs,
+                                 unsigned int const maxUlps) noexcept
+    {
+        typedef FloatTraits<T>            Traits;
+        typedef typename Traits::IntType  IntType;
+        typedef typename Traits::UIntType UIntType;
+
+        IntType const lhsInt = to_ordered_int(lhs);
+        IntType const rhsInt = to_ordered_int(rhs);
+
+        // abs(lhsInt - rhsInt) evaluated with unsigned arithmetic so it can not overflow
+        UIntType const ulps = (lhsInt < rhsInt) ? static_cast<UIntType>(rhsInt) - static_cast<UIntType>(lhsInt)
+                                                : static_cast<UIntType>(lhsInt) - static_cast<UIntType>(rhsInt);
+
+        // note: bitwise & (rather than &&) so that no branches are introduced
+        return (ulps <= maxUlps) & is_ordered(lhs) & is_ordered(rhs);
+    }
+
+    // =============================================================================
+    // sincos:
+    // =============================================================================
+
+    /// metatype with the range reduction constants for sincos
+    template <typename T>
+    struct SinCosTraits;
+
+    // -----------------------------------------------------------------------------
+
+    template <>
+    struct SinCosTraits<float>
+    {
+        static constexpr float TwoOverPi    = 0.636619772367581343076f; ///< 2 / pi
+        static constexpr float RoundingBias = 0x1.8p23f;                ///< Adding rounds to an integer held in the low mantissa bits.
+
+        // pi / 2 split into parts with trailing zero bits, s.t. quadrant * PiOver2Hi & quadrant * PiOver2Mid are exact
+        static constexpr float PiOver2Hi  = 1.5703125f;
+        static constexpr float PiOver2Mid = 4.837512969970703125e-4f;
+        static constexpr float PiOver2Lo  = 7.54978995489188216e-8f;
+    };
+
+    // -----------------------------------------------------------------------------
+
+    template <>
+    struct SinCosTraits<double>
+    {
+        static constexpr double TwoOverPi    = 0.636619772367581343076; ///< 2 / pi
+        static constexpr double RoundingBias = 0x1.8p52;                ///< Adding rounds to an integer held in the low mantissa bits.
+
+        // pi / 2 split into 33-bit parts, s.t. quadrant * PiOver2Hi & quadrant * PiOver2Mid are exact
+        static constexpr double PiOver2Hi  = 1.57079632673412561417e+00;
+        static constexpr double PiOver2Mid = 6.07710050630396597660e-11;
+        static constexpr double PiOver2Lo  = 2.02226624871116645580e-21;
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// minimax polynomial for sin(r), r in [-pi/4, pi/4] (coefficients from Cephes sinf)
+    constexpr float sin_kernel(float const r) noexcept
+    {
+        float const r2 = r * r;
+        return r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// minimax polynomial for sin(r), r in [-pi/4, pi/4] (coefficients from fdlibm __kernel_sin)
+    constexpr double sin_kernel(double const r) noexcept
+    {
+        double const r2 = r * r;
+        return r + r * r2 * (-1.66666666666666324348e-01 +
+                             r2 * (8.33333333332248946124e-03 +
+                                   r2 * (-1.98412698298579493134e-04 +
+                                         r2 * (2.75573137070700676789e-06 +
+                                               r2 * (-2.50507602534068634195e-08 +
+                                                     r2 * 1.58969099521155010221e-10)))));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// minimax polynomial for cos(r), r in [-pi/4, pi/4] (coefficients from Cephes cosf)
+    constexpr float cos_kernel(float const r) noexcept
+    {
+        float const r2 = r * r;
+        return 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// minimax polynomial for cos(r), r in [-pi/4, pi/4] (coefficients from fdlibm __kernel_cos)
+    constexpr double cos_kernel(double const r) noexcept
+    {
+        double const r2 = r * r;
+        return 1.0 - 0.5 * r2 + r2 * r2 * (4.16666666666666019037e-02 +
+                                           r2 * (-1.38888888888741095749e-03 +
+                                                 r2 * (2.48015872894767294178e-05 +
+                                                       r2 * (-2.75573143513906633035e-07 +
+                                                             r2 * (2.08757232129817482790e-09 +
+                                                                   r2 * -1.13596475577881948265e-11)))));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr SinCos<T> sincos(T const angleRadians) noexcept
+    {
+        typedef FloatTraits<T>            Traits;
+        typedef SinCosTraits<T>           Constants;
+        typedef typename Traits::UIntType UIntType;
+
+        constexpr int      SignShift        = std::numeric_limits<UIntType>::digits - 2; // moves bit 1 to the sign bit
+        constexpr UIntType RoundingBiasBits = std::bit_cast<UIntType>(Constants::RoundingBias);
+
+        // nearest quadrant, read from the integer bits rather than via a float -> int conversion so
+        // that it is well-defined for nan & inf
+        // note: the quadrant value is recovered by subtracting the bias (exact) rather than converting the bits, so it
+        // isn't truncated to 32 bits for double & no int64 -> double conversion (not vectorizable before AVX-512)
+        T const        biased       = angleRadians * Constants::TwoOverPi + Constants::RoundingBias;
+        UIntType const quadrantBits = std::bit_cast<UIntType>(biased) - RoundingBiasBits;
+        T const        quadrant     = biased - Constants::RoundingBias;
+
+        // note: once the quadrant no longer fits in the mantissa (see sincos in ggm) the quadrant is garbage &
+        // the reduction is unbounded, clamp s.t. the polynomials still return values in [-1, 1] for any finite angle
+        // (the bound is above pi/4 so that it never changes an in-range reduction, nan passes through the comparisons)
+        constexpr T MaxReduced = T{ 1 };
+
+        T const unclamped = ((angleRadians - quadrant * Constants::PiOver2Hi) - quadrant * Constants::PiOver2Mid) - quadrant * Constants::PiOver2Lo;
+        T const reduced   = (unclamped < -MaxReduced) ? -MaxReduced : ((unclamped > MaxReduced) ? MaxReduced : unclamped);
+
+        // note: inf would otherwise reduce to inf & the polynomials are not guaranteed to give nan, so set
+        // the nan bits for any non-finite angle (with integer operations, which keeps the loop vectorizable)
+        constexpr UIntType NanBits = std::bit_cast<UIntType>(std::numeric_limits<T>::quiet_NaN());
+
+        UIntType const nonFiniteMask = UIntType{ 0 } - static_cast<UIntType>((std::bit_cast<UIntType>(angleRadians) & Traits::MagnitudeMask) >= Traits::ExponentMask);
+        T const        r             = std::bit_cast<T>(std::bit_cast<UIntType>(reduced) | (nonFiniteMask & NanBits));
+
+        T const sinR = sin_kernel(r);
+        T const cosR = cos_kernel(r);
+
+        // quadrant: 0 => (sin, cos), 1 => (cos, -sin), 2 => (-sin, -cos), 3 => (-cos, sin)
+        bool const     isSwapped = (quadrantBits & 1u) != 0;
+        UIntType const sinSign   = (quadrantBits & 2u) << SignShift;
+        UIntType const cosSign   = ((quadrantBits + 1u) & 2u) << SignShift;
+
+        T const sinValue = isSwapped ? cosR : sinR;
+        T const cosValue = isSwapped ? sinR : cosR;
+
+        return SinCos<T>{
+            std::bit_cast<T>(std::bit_cast<UIntType>(sinValue) ^ sinSign),
+            std::bit_cast<T>(std::bit_cast<UIntType>(cosValue) ^ cosSign),
+        };
+    }
+
+    // =============================================================================
+    // half:
+    // =============================================================================
+
+    /// Branch-free float -> half, equivalent to F16C vcvtps2ph with round to nearest even.
+    /// @details
+    /// Each case (normal, denormal, inf/nan) is computed & the result is selected with integer masks, so
+    /// compilers are able to vectorize it.
+    constexpr half half_from_float(float const value) noexcept
+    {
+        typedef FloatTraits<float>::UIntType UIntType;
+
+        constexpr UIntType SignMask          = 0x80000000u;
+        constexpr UIntType OverflowBits      = std::bit_cast<UIntType>(0x1p16f);  // smallest magnitude that can't round to a finite half
+        constexpr UIntType NormalBits        = std::bit_cast<UIntType>(0x1p-14f); // smallest normal half
+        constexpr UIntType RebiasBits        = static_cast<UIntType>(15 - 127) << 23;
+        constexpr UIntType DenormalMagicBits = std::bit_cast<UIntType>(0.5f); // ulp(0.5f) == smallest denormal half
+
+        UIntType const bits      = std::bit_cast<UIntType>(value);
+        UIntType const signBits  = (bits & SignMask) >> 16;
+        UIntType const magnitude = bits & ~SignMask;
+
+        // normal: rebias the exponent & round the 13 dropped mantissa bits to nearest even
+        UIntType const isOdd      = (magnitude >> 13) & 1u;
+        UIntType const normalBits = (magnitude + RebiasBits + 0x0FFFu + isOdd) >> 13;
+
+        // denormal: adding 0.5f aligns the value so that the float addition rounds to the half denormal bits
+        UIntType const denormalBits = std::bit_cast<UIntType>(std::bit_cast<float>(magnitude) + 0.5f) - DenormalMagicBits;
+
+        // inf & nan: nan is quieted & keeps the high payload bits
+        UIntType const isNaN      = UIntType{ 0 } - static_cast<UIntType>(magnitude > FloatTraits<float>::ExponentMask);
+        UIntType const infNaNBits = 0x7C00u | (isNaN & (0x0200u | ((magnitude >> 13) & 0x03FFu)));
+
+        UIntType const isOverflow = UIntType{ 0 } - static_cast<UIntType>(magnitude >= OverflowBits);
+        UIntType const isDenormal = UIntType{ 0 } - static_cast<UIntType>(magnitude < NormalBits);
+        UIntType const isNormal   = ~(isOverflow | isDenormal);
+
+        return half{ static_cast<std::uint16_t>(signBits | (isOverflow & infNaNBits) | (isDenormal & denormalBits) | (isNormal & normalBits)) };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// Branch-free half -> float, equivalent to F16C vcvtph2ps.
+    constexpr float float_from_half(half const value) noexcept
+    {
+        typedef FloatTraits<float>::UIntType UIntType;
+
+        constexpr UIntType ExponentMask      = 0x7C00u << 13; // half exponent, shifted to the float exponent
+        constexpr UIntType RebiasBits        = static_cast<UIntType>(127 - 15) << 23;
+        constexpr UIntType QuietBit          = 0x00400000u;
+        constexpr UIntType DenormalMagicBits = std::bit_cast<UIntType>(0x1p-14f); // smallest normal half
+
+        UIntType const bits     = value.bits;
+        UIntType const signBits = (bits & 0x8000u) << 16;
+        UIntType const shifted  = (bits & 0x7FFFu) << 13;
+        UIntType const exponent = shifted & ExponentMask;
+
+        // normal: rebias the exponent
+        UIntType const normalBits = shifted + RebiasBits;
+
+        // denormal: the float subtraction normalizes the mantissa
+        UIntType const denormalBits = std::bit_cast<UIntType>(std::bit_cast<float>(shifted + DenormalMagicBits) - 0x1p-14f);
+
+        // inf & nan: rebias to the max float exponent, nan is quieted
+        UIntType const isNaN      = UIntType{ 0 } - static_cast<UIntType>(shifted > ExponentMask);
+        UIntType const infNaNBits = (normalBits + RebiasBits) | (isNaN & QuietBit);
+
+        UIntType const isInfNaN   = UIntType{ 0 } - static_cast<UIntType>(exponent == ExponentMask);
+        UIntType const isDenormal = UIntType{ 0 } - static_cast<UIntType>(exponent == 0);
+        UIntType const isNormal   = ~(isInfNaN | isDenormal);
+
+        return std::bit_cast<float>(signBits | (isInfNaN & infNaNBits) | (isDenormal & denormalBits) | (isNormal & normalBits));
+    }
+
+    // =============================================================================
+    // normalized integers:
+    //
+    // MaxValue is the integer that represents 1, so that narrower formats (e.g. 10:10:10:2) can be stored
+    // in wider integers.
+    //
+    // note: the product is computed in double, where it is exact (a 24-bit mantissa times a scale of at most
+    // 16 bits), so it is only rounded once, by the truncation of scaled +/- 0.5 (which is also exact for the
+    // in-range products, i.e. it can't reach the next integer from just below k + 0.5). Rounding the float
+    // product & then adding 0.5 in float rounds twice, which gives k + 1 for some inputs just below k + 0.5.
+    //
+    // note: the value is rounded before it is clamped & nan is replaced last, so that every operation is
+    // unconditional (compilers don't vectorize loops where a conversion or product is only computed for
+    // some of the cases)
+    // =============================================================================
+
+    template <typename IntType, IntType MaxValue = std::numeric_limits<IntType>::max()>
+    constexpr IntType snorm_from_float(float const value) noexcept
+    {
+        constexpr double Scale = static_cast<double>(MaxValue);
+
+        double const scaled  = static_cast<double>(value) * Scale;
+        double const rounded = scaled + ((scaled < 0.0) ? -0.5 : 0.5);
+        double const clamped = clamp(rounded, -Scale, Scale);
+        return static_cast<IntType>((clamped == clamped) ? clamped : 0.0); // nan gives 0
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename UIntType, UIntType MaxValue = std::numeric_limits<UIntType>::max()>
+    constexpr UIntType unorm_from_float(float const value) noexcept
+    {
+        constexpr double Scale = static_cast<double>(MaxValue);
+
+        double const scaled  = static_cast<double>(value) * Scale;
+        double const rounded = scaled + 0.5;
+        double const clamped = clamp(rounded, 0.0, Scale);
+        return static_cast<UIntType>((clamped == clamped) ? clamped : 0.0); // nan gives 0
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename IntType, IntType MaxValue = std::numeric_limits<IntType>::max()>
+    constexpr float float_from_snorm(IntType const value) noexcept
+    {
+        constexpr float Scale = static_cast<float>(MaxValue);
+
+        return max(static_cast<float>(value) / Scale, -1.0f);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename UIntType, UIntType MaxValue = std::numeric_limits<UIntType>::max()>
+    constexpr float float_from_unorm(UIntType const value) noexcept
+    {
+        constexpr float Scale = static_cast<float>(MaxValue);
+
+        return static_cast<float>(value) / Scale;
+    }
+
+    // =============================================================================
+} // namespace ggm::NumericImpl
+
 // =============================================================================
 // ggm::abs
 // =============================================================================
@@ -554,16 +1602,14 @@ constexpr long double ggm::abs(long double const value) noexcept
 
 constexpr float ggm::ceil(float const value) noexcept
 {
-    float const truncValue = trunc(value);
-    return (value > truncValue) ? (truncValue + 1.0f) : truncValue;
+    return NumericImpl::ceil(value);
 }
 
 // -----------------------------------------------------------------------------
 
 constexpr double ggm::ceil(double const value) noexcept
 {
-    double const truncValue = trunc(value);
-    return (value > truncValue) ? (truncValue + 1.0) : truncValue;
+    return NumericImpl::ceil(value);
 }
 
 // -----------------------------------------------------------------------------
@@ -571,7 +1617,7 @@ constexpr double ggm::ceil(double const value) noexcept
 constexpr long double ggm::ceil(long double const value) noexcept
 {
     long double const truncValue = trunc(value);
-    return (value > truncValue) ? (truncValue + 1.0l) : truncValue;
+    return truncValue + ((value > truncValue) ? 1.0l : -0.0l); // note: x + -0 == x for every x, including -0
 }
 
 // =============================================================================
@@ -708,22 +1754,91 @@ constexpr long double ggm::clamp(long double const value,
                                 : value;
 }
 
+// =============================================================================
+// ggm::cos
+// =============================================================================
+
+constexpr float ggm::cos(float const angleRadians) noexcept
+{
+    return NumericImpl::sincos(angleRadians).cos;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr double ggm::cos(double const angleRadians) noexcept
+{
+    return NumericImpl::sincos(angleRadians).cos;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr long double ggm::cos(long double const angleRadians) noexcept
+{
+    return sincos(angleRadians).cos;
+}
+
+// =============================================================================
+// ggm::float_from_half
+// =============================================================================
+
+constexpr float ggm::float_from_half(half const value) noexcept
+{
+#if GGM_F16C()
+    if (!std::is_constant_evaluated())
+    {
+        return _cvtsh_ss(value.bits);
+    }
+#endif
+
+    return NumericImpl::float_from_half(value);
+}
+
+// =============================================================================
+// ggm::float_from_snorm
+// =============================================================================
+
+constexpr float ggm::float_from_snorm(std::int8_t const value) noexcept
+{
+    return NumericImpl::float_from_snorm(value);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::float_from_snorm(std::int16_t const value) noexcept
+{
+    return NumericImpl::float_from_snorm(value);
+}
+
+// =============================================================================
+// ggm::float_from_unorm
+// =============================================================================
+
+constexpr float ggm::float_from_unorm(std::uint8_t const value) noexcept
+{
+    return NumericImpl::float_from_unorm(value);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::float_from_unorm(std::uint16_t const value) noexcept
+{
+    return NumericImpl::float_from_unorm(value);
+}
+
 // =============================================================================
 // ggm::floor
 // =============================================================================
 
 constexpr float ggm::floor(float const value) noexcept
 {
-    float const truncValue = trunc(value);
-    return (value < truncValue) ? (truncValue - 1.0f) : truncValue;
+    return NumericImpl::floor(value);
 }
 
 // -----------------------------------------------------------------------------
 
 constexpr double ggm::floor(double const value) noexcept
 {
-    double const truncValue = trunc(value);
-    return (value < truncValue) ? (truncValue - 1.0f) : truncValue;
+    return NumericImpl::floor(value);
 }
 
 // -----------------------------------------------------------------------------
@@ -731,7 +1846,36 @@ constexpr double ggm::floor(double const value) noexcept
 constexpr long double ggm::floor(long double const value) noexcept
 {
     long double const truncValue = trunc(value);
-    return (value < truncValue) ? (truncValue - 1.0f) : truncValue;
+    return truncValue - ((value < truncValue) ? 1.0l : 0.0l); // note: x - 0 == x for every x, including -0
+}
+
+// =============================================================================
+// ggm::fma
+// =============================================================================
+
+constexpr float ggm::fma(float const lhs,
+                         float const rhs,
+                         float const addend) noexcept
+{
+    return NumericImpl::fma(lhs, rhs, addend);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr double ggm::fma(double const lhs,
+                          double const rhs,
+                          double const addend) noexcept
+{
+    return NumericImpl::fma(lhs, rhs, addend);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr long double ggm::fma(long double const lhs,
+                               long double const rhs,
+                               long double const addend) noexcept
+{
+    return NumericImpl::fma(lhs, rhs, addend);
 }
 
 // =============================================================================
@@ -757,6 +1901,22 @@ constexpr long double ggm::fract(long double const value) noexcept
     return value - floor(value);
 }
 
+// =============================================================================
+// ggm::half_from_float
+// =============================================================================
+
+constexpr ggm::half ggm::half_from_float(float const value) noexcept
+{
+#if GGM_F16C()
+    if (!std::is_constant_evaluated())
+    {
+        return half{ static_cast<std::uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT)) };
+    }
+#endif
+
+    return NumericImpl::half_from_float(value);
+}
+
 // =============================================================================
 // ggm::inverse_lerp
 // =============================================================================
@@ -789,6 +1949,55 @@ constexpr long double ggm::inverse_lerp(long double const value0,
     return (value - value0) / (value1 - value0);
 }
 
+// =============================================================================
+// ggm::is_close
+// =============================================================================
+
+constexpr bool ggm::is_close(float const lhs,
+                             float const rhs,
+                             float const epsilon) noexcept
+{
+    return NumericImpl::is_close(lhs, rhs, epsilon);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr bool ggm::is_close(double const lhs,
+                             double const rhs,
+                             double const epsilon) noexcept
+{
+    return NumericImpl::is_close(lhs, rhs, epsilon);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr bool ggm::is_close(long double const lhs,
+                             long double const rhs,
+                             long double const epsilon) noexcept
+{
+    return NumericImpl::is_close(lhs, rhs, epsilon);
+}
+
+// =============================================================================
+// ggm::is_close_ulps
+// =============================================================================
+
+constexpr bool ggm::is_close_ulps(float const        lhs,
+                                  float const        rhs,
+                                  unsigned int const maxUlps) noexcept
+{
+    return NumericImpl::is_close_ulps(lhs, rhs, maxUlps);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr bool ggm::is_close_ulps(double const       lhs,
+                                  double const       rhs,
+                                  unsigned int const maxUlps) noexcept
+{
+    return NumericImpl::is_close_ulps(lhs, rhs, maxUlps);
+}
+
 // =============================================================================
 // ggm::lerp
 // =============================================================================
@@ -797,7 +2006,7 @@ constexpr float ggm::lerp(float const value0,
                           float const value1,
                           float const t) noexcept
 {
-    return value0 + t * (value1 - value0);
+    return multiply_add(t, value1 - value0, value0);
 }
 
 // -----------------------------------------------------------------------------
@@ -806,7 +2015,7 @@ constexpr double ggm::lerp(double const value0,
                            double const value1,
                            double const t) noexcept
 {
-    return value0 + t * (value1 - value0);
+    return multiply_add(t, value1 - value0, value0);
 }
 
 // -----------------------------------------------------------------------------
@@ -815,7 +2024,7 @@ constexpr long double ggm::lerp(long double const value0,
                                 long double const value1,
                                 long double const t) noexcept
 {
-    return value0 + t * (value1 - value0);
+    return multiply_add(t, value1 - value0, value0);
 }
 
 // =============================================================================
@@ -1248,6 +2457,25 @@ constexpr auto && ggm::min_of(T0 && value0,
                min_of(static_cast<TN &&>(valueN)...));
 }
 
+// =============================================================================
+// ggm::multiply_add
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::multiply_add(T const &                       lhs,
+                              std::type_identity_t<T> const & rhs,
+                              std::type_identity_t<T> const & addend) noexcept
+{
+    if constexpr (GGM_FMA() && std::is_floating_point_v<T>)
+    {
+        return fma(lhs, rhs, addend);
+    }
+    else
+    {
+        return lhs * rhs + addend;
+    }
+}
+
 // =============================================================================
 // ggm::reciprocal
 // =============================================================================
@@ -1316,31 +2544,96 @@ constexpr double ggm::reciprocal(unsigned long long const value,
 
 // -----------------------------------------------------------------------------
 
-inline float ggm::reciprocal(float const value,
-                             float const defaultValue,
-                             float const epsilon) noexcept
+constexpr float ggm::reciprocal(float const value,
+                                float const defaultValue,
+                                float const epsilon) noexcept
 {
     return is_close(value, 0.0f, epsilon) ? defaultValue : 1.0f / value;
 }
 
 // -----------------------------------------------------------------------------
 
-inline double ggm::reciprocal(double const value,
-                              double const defaultValue,
-                              double const epsilon) noexcept
+constexpr double ggm::reciprocal(double const value,
+                                 double const defaultValue,
+                                 double const epsilon) noexcept
 {
     return is_close(value, 0.0, epsilon) ? defaultValue : 1.0 / value;
 }
 
 // -----------------------------------------------------------------------------
 
-inline long double ggm::reciprocal(long double const value,
-                                   long double const defaultValue,
-                                   long double const epsilon) noexcept
+constexpr long double ggm::reciprocal(long double const value,
+                                      long double const defaultValue,
+                                      long double const epsilon) noexcept
 {
     return is_close(value, 0.0l, epsilon) ? defaultValue : 1.0l / value;
 }
 
+// =============================================================================
+// ggm::reciprocal_sqrt
+// =============================================================================
+
+constexpr float ggm::reciprocal_sqrt(float const value,
+                                     float const defaultValue) noexcept
+{
+    return (value > 0.0f) ? 1.0f / sqrt(value) : defaultValue;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr double ggm::reciprocal_sqrt(double const value,
+                                      double const defaultValue) noexcept
+{
+    return (value > 0.0) ? 1.0 / sqrt(value) : defaultValue;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr long double ggm::reciprocal_sqrt(long double const value,
+                                           long double const defaultValue) noexcept
+{
+    return (value > 0.0l) ? 1.0l / sqrt(value) : defaultValue;
+}
+
+// =============================================================================
+// ggm::reciprocal_sqrt_fast
+// =============================================================================
+
+template <unsigned int Steps>
+constexpr float ggm::reciprocal_sqrt_fast(float const value,
+                                          float const defaultValue) noexcept
+{
+    typedef NumericImpl::FloatTraits<float>::UIntType UIntType;
+
+    // note: compute with a positive value regardless & select the result at the end, which avoids
+    // overflow for values <= 0 while remaining branch-free
+    bool const     isPositive = (value > 0.0f);
+    float const    safeValue  = isPositive ? value : 1.0f;
+    UIntType const valueBits  = std::bit_cast<UIntType>(safeValue);
+
+    if constexpr (Steps == 0)
+    {
+        float const estimate = std::bit_cast<float>(0x5F3759DFu - (valueBits >> 1));
+        return isPositive ? estimate : defaultValue;
+    }
+    else
+    {
+        // note: estimate * p(t) where p is the minimax quadratic of 1 / sqrt(t), t = value * estimate^2,
+        // over the range of t given by the magic constant (i.e. [0.75, 0.84375])
+        float const estimate = std::bit_cast<float>(0x5F1FFFF9u - (valueBits >> 1));
+        float const t        = safeValue * estimate * estimate;
+        float       result   = estimate * (2.1023561f - t * (1.7609315f - t * 0.663154943f));
+
+        float const halfValue = 0.5f * safeValue;
+        for (unsigned int step = 1; step < Steps; ++step)
+        {
+            result = result * (1.5f - halfValue * result * result);
+        }
+
+        return isPositive ? result : defaultValue;
+    }
+}
+
 // =============================================================================
 // ggm::repeat
 // =============================================================================
@@ -1462,18 +2755,14 @@ constexpr long double ggm::repeat(long double const value,
 
 constexpr float ggm::saturate(float const value) noexcept
 {
-    return (value <= 0.0f)  ? 0.0f
-           : (value > 1.0f) ? 1.0f
-                            : value;
+    return NumericImpl::saturate(value);
 }
 
 // -----------------------------------------------------------------------------
 
 constexpr double ggm::saturate(double const value) noexcept
 {
-    return (value <= 0.0)  ? 0.0
-           : (value > 1.0) ? 1.0
-                           : value;
+    return NumericImpl::saturate(value);
 }
 
 // -----------------------------------------------------------------------------
@@ -1485,6 +2774,61 @@ constexpr long double ggm::saturate(long double const value) noexcept
                             : value;
 }
 
+// =============================================================================
+// ggm::sin
+// =============================================================================
+
+constexpr float ggm::sin(float const angleRadians) noexcept
+{
+    return NumericImpl::sincos(angleRadians).sin;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr double ggm::sin(double const angleRadians) noexcept
+{
+    return NumericImpl::sincos(angleRadians).sin;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr long double ggm::sin(long double const angleRadians) noexcept
+{
+    return sincos(angleRadians).sin;
+}
+
+// =============================================================================
+// ggm::sincos
+// =============================================================================
+
+constexpr ggm::SinCos<float> ggm::sincos(float const angleRadians) noexcept
+{
+    return NumericImpl::sincos(angleRadians);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::SinCos<double> ggm::sincos(double const angleRadians) noexcept
+{
+    return NumericImpl::sincos(angleRadians);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::SinCos<long double> ggm::sincos(long double const angleRadians) noexcept
+{
+    // long double has no portable bit layout, so use the double kernel
+    // note: finite angles beyond the range of double are clamped rather than converted to inf (which returns nan)
+    constexpr long double MaxAngle = std::numeric_limits<double>::max();
+    constexpr long double Infinity = std::numeric_limits<long double>::infinity();
+
+    bool const           isBelow = (angleRadians < -MaxAngle) & (angleRadians > -Infinity);
+    bool const           isAbove = (angleRadians > MaxAngle) & (angleRadians < Infinity);
+    long double const    angle   = isBelow ? -MaxAngle : (isAbove ? MaxAngle : angleRadians);
+    SinCos<double> const result  = NumericImpl::sincos(static_cast<double>(angle));
+    return SinCos<long double>{ result.sin, result.cos };
+}
+
 // =============================================================================
 /// ggm::smooth_step
 // =============================================================================
@@ -1494,7 +2838,7 @@ constexpr float ggm::smooth_step(float const edge0,
                                  float const value) noexcept
 {
     assert(edge0 < edge1);
-    float const t = linear_step(edge1, edge1, value);
+    float const t = linear_step(edge0, edge1, value);
     return t * t * (3.0f - 2.0f * t);
 }
 
@@ -1505,7 +2849,7 @@ constexpr double ggm::smooth_step(double const edge0,
                                   double const value) noexcept
 {
     assert(edge0 < edge1);
-    double const t = linear_step(edge1, edge1, value);
+    double const t = linear_step(edge0, edge1, value);
     return t * t * (3.0 - 2.0 * t);
 }
 
@@ -1516,69 +2860,123 @@ constexpr long double ggm::smooth_step(long double const edge0,
                                        long double const value) noexcept
 {
     assert(edge0 < edge1);
-    long double const t = linear_step(edge1, edge1, value);
+    long double const t = linear_step(edge0, edge1, value);
     return t * t * (3.0l - 2.0l * t);
 }
 
 // =============================================================================
-// ggm::trunc
+// ggm::snorm8_from_float / ggm::snorm16_from_float
 // =============================================================================
 
-constexpr float ggm::trunc(float const value) noexcept
+constexpr std::int8_t ggm::snorm8_from_float(float const value) noexcept
 {
-    typedef std::numeric_limits<float> limits;
-    static_assert(limits::radix == 2);
+    return NumericImpl::snorm_from_float<std::int8_t>(value);
+}
 
-    // largest integral value that float can accurately represent
-    // (values larger than this have a distance between adjacent floating point values > 1)
-    //
-    // note: when constexpr <cmath> is available (C++23) then the definition of kMaxValue
-    // can be replaced with std::scalbn(1.0f, limits::digits) and the above static_assert
-    // can be removed
-    constexpr float kMaxValue = (1 << limits::digits);
+// -----------------------------------------------------------------------------
 
-    assert(value <= kMaxValue);
-    return static_cast<float>(static_cast<int>(value));
+constexpr std::int16_t ggm::snorm16_from_float(float const value) noexcept
+{
+    return NumericImpl::snorm_from_float<std::int16_t>(value);
+}
+
+// =============================================================================
+// ggm::sum_of_products
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::sum_of_products(T const &                       lhs0, std::type_identity_t<T> const & rhs0,
+                                 std::type_identity_t<T> const & lhs1, std::type_identity_t<T> const & rhs1) noexcept
+{
+    return multiply_add(lhs1, rhs1, lhs0 * rhs0);
 }
 
 // -----------------------------------------------------------------------------
 
-constexpr double ggm::trunc(double const value) noexcept
+template <typename T>
+constexpr T ggm::sum_of_products(T const &                       lhs0, std::type_identity_t<T> const & rhs0,
+                                 std::type_identity_t<T> const & lhs1, std::type_identity_t<T> const & rhs1,
+                                 std::type_identity_t<T> const & lhs2, std::type_identity_t<T> const & rhs2) noexcept
 {
-    typedef std::numeric_limits<double> limits;
-    static_assert(limits::radix == 2);
+    return multiply_add(lhs2, rhs2, multiply_add(lhs1, rhs1, lhs0 * rhs0));
+}
 
-    // largest integral value that double can accurately represent
-    // (values larger than this have a distance between adjacent floating point values > 1)
-    //
-    // note: when constexpr <cmath> is available (C++23) then the definition of kMaxValue
-    // can be replaced with std::scalbn(1.0, limits::digits) and the above static_assert
-    // can be removed
-    constexpr double kMaxValue = (1ll << limits::digits);
+// -----------------------------------------------------------------------------
 
-    assert(value <= kMaxValue);
-    return static_cast<double>(static_cast<long long>(value));
+template <typename T>
+constexpr T ggm::sum_of_products(T const &                       lhs0, std::type_identity_t<T> const & rhs0,
+                                 std::type_identity_t<T> const & lhs1, std::type_identity_t<T> const & rhs1,
+                                 std::type_identity_t<T> const & lhs2, std::type_identity_t<T> const & rhs2,
+                                 std::type_identity_t<T> const & lhs3, std::type_identity_t<T> const & rhs3) noexcept
+{
+    return multiply_add(lhs3, rhs3, multiply_add(lhs2, rhs2, multiply_add(lhs1, rhs1, lhs0 * rhs0)));
+}
+
+// =============================================================================
+// ggm::sqrt
+// =============================================================================
+
+constexpr float ggm::sqrt(float const value) noexcept
+{
+    return NumericImpl::sqrt(value);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr double ggm::sqrt(double const value) noexcept
+{
+    return NumericImpl::sqrt(value);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr long double ggm::sqrt(long double const value) noexcept
+{
+    return NumericImpl::sqrt(value);
+}
+
+// =============================================================================
+// ggm::trunc
+// =============================================================================
+
+constexpr float ggm::trunc(float const value) noexcept
+{
+    return NumericImpl::trunc(value);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr double ggm::trunc(double const value) noexcept
+{
+    return NumericImpl::trunc(value);
 }
 
 // -----------------------------------------------------------------------------
 
 constexpr long double ggm::trunc(long double const value) noexcept
 {
-    typedef std::numeric_limits<long double> limits;
-    static_assert(limits::radix == 2);
+    return NumericImpl::trunc(value);
+}
 
-    // largest integral value that long double can accurately represent
-    // (values larger than this have a distance between adjacent floating point values > 1)
-    //
-    // note: when constexpr <cmath> is available (C++23) then the definition of kMaxValue
-    // can be replaced with std::scalbn(1.0l, limits::digits) and the above static_assert
-    // can be removed
-    constexpr long double kMaxValue = (1ll << limits::digits);
+// =============================================================================
+// ggm::unorm8_from_float / ggm::unorm16_from_float
+// =============================================================================
 
-    assert(value <= kMaxValue);
-    return static_cast<long double>(static_cast<long long>(value));
+constexpr std::uint8_t ggm::unorm8_from_float(float const value) noexcept
+{
+    return NumericImpl::unorm_from_float<std::uint8_t>(value);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint16_t ggm::unorm16_from_float(float const value) noexcept
+{
+    return NumericImpl::unorm_from_float<std::uint16_t>(value);
 }
 
 // =============================================================================
 
+#undef GGM_F16C
+#undef GGM_FMA
+
 #endif // GGM_NUMERIC_UTIL_H
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef GGM_RANDOM_H
+#define GGM_RANDOM_H
+
+#include <cstdint>
+
+// =============================================================================
+/// Random functions:
+/// ----------
+///
+/// Counter-based random numbers, i.e. the n-th number of a sequence is a hash of (seed, n), rather than the
+/// next state of a sequential generator. So the numbers of a sequence can be generated in any order, in
+/// parallel & with any SIMD width, & the results only depend on the seed & counter (e.g. a particle's
+/// index), see VectorRandom.h for random vectors & VectorBatch.h for the span versions.
+///
+/// The hash is the PCG RXS-M-XS permutation (O'Neill, "PCG: A Family of Simple Fast Space-Efficient
+/// Statistically Good Algorithms for Random Number Generation", 2014), which is a bijection of the
+/// 32-bit values with good statistical quality (Jarzynski & Olano, "Hash Functions for GPU Rendering",
+/// 2020). It only uses 32-bit integer multiplies, xors & shifts, so loops over it are vectorizable.
+///
+/// Syntax                          | Description
+/// --------                        | -----------
+/// h = pcg_hash(x);                | The PCG RXS-M-XS permutation of a 32-bit value.
+/// r = random_uint32(seed, n);     | The n-th random 32-bit value of the sequence of seed.
+/// r = random_float(seed, n);      | The n-th random float in [0, 1) of the sequence of seed.
+/// r = float_from_random_bits(b);  | A float in [0, 1) from the high 24 bits of a random 32-bit value.
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    /// The PCG RXS-M-XS permutation of a 32-bit value (i.e. distinct values give distinct hashes).
+    // =============================================================================
+
+    constexpr std::uint32_t pcg_hash(std::uint32_t const value) noexcept;
+
+    // =============================================================================
+    /// The counter-th random 32-bit value of the sequence of seed, i.e. pcg_hash(counter + pcg_hash(seed)).
+    /// @details
+    /// Each sequence has 2^32 values (the counter wraps around). The sequences of different seeds are
+    /// offsets of each other, so use distinct seeds for independent streams (e.g. per emitter) and distinct
+    /// counters within a stream.
+    // =============================================================================
+
+    constexpr std::uint32_t random_uint32(std::uint32_t const seed,
+                                          std::uint32_t const counter) noexcept;
+
+    // =============================================================================
+    /// The counter-th random float in [0, 1) of the sequence of seed, i.e. a multiple of 2^-24.
+    // =============================================================================
+
+    constexpr float random_float(std::uint32_t const seed,
+                                 std::uint32_t const counter) noexcept;
+
+    // =============================================================================
+    /// A float in [0, 1) from the high 24 bits of a random 32-bit value, i.e. a multiple of 2^-24.
+    // =============================================================================
+
+    constexpr float float_from_random_bits(std::uint32_t const bits) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// ggm::pcg_hash
+// =============================================================================
+
+constexpr std::uint32_t ggm::pcg_hash(std::uint32_t const value) noexcept
+{
+    std::uint32_t const state = value * 747796405u + 2891336453u;
+    std::uint32_t const word  = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// =============================================================================
+// ggm::random_uint32
+// =============================================================================
+
+constexpr std::uint32_t ggm::random_uint32(std::uint32_t const seed,
+                                           std::uint32_t const counter) noexcept
+{
+    return pcg_hash(counter + pcg_hash(seed));
+}
+
+// =============================================================================
+// ggm::random_float
+// =============================================================================
+
+constexpr float ggm::random_float(std::uint32_t const seed,
+                                  std::uint32_t const counter) noexcept
+{
+    return float_from_random_bits(random_uint32(seed, counter));
+}
+
+// =============================================================================
+// ggm::float_from_random_bits
+// =============================================================================
+
+constexpr float ggm::float_from_random_bits(std::uint32_t const bits) noexcept
+{
+    // note: converts through int32 (which is exact for 24 bits), since only signed conversions are vectorizable
+    return static_cast<float>(static_cast<std::int32_t>(bits >> 8u)) * 0x1p-24f;
+}
+
+// =============================================================================
+
+#endif // GGM_RANDOM_H
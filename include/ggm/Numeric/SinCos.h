@@ -0,0 +1,28 @@
+#pragma once
+#ifndef GGM_SIN_COS_H
+#define GGM_SIN_COS_H
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // SinCos
+    // =============================================================================
+
+    /// The sine & cosine of the same angle, i.e. the result of @ref sincos
+    /// @tparam T The type of each value (usually float or double)
+    template <typename T>
+    struct SinCos
+    {
+        // members:
+        T sin; // uninitialized
+        T cos; // uninitialized
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_SIN_COS_H
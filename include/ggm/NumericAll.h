@@ -2,7 +2,13 @@
 #ifndef GGM_NUMERIC_ALL_H
 #define GGM_NUMERIC_ALL_H
 
+#include "ggm/Numeric/Fixed.h"
+#include "ggm/Numeric/FixedUtil.h"
+#include "ggm/Numeric/Half.h"
+#include "ggm/Numeric/NumericBatch.h"
 #include "ggm/Numeric/NumericConstants.h"
 #include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Numeric/Random.h"
+#include "ggm/Numeric/SinCos.h"
 
 #endif // GGM_NUMERIC_ALL_H
@@ -0,0 +1,126 @@
+#pragma once
+#ifndef GGM_VECTOR_ALIGNED_H
+#define GGM_VECTOR_ALIGNED_H
+
+#include "ggm/Vector/Vector.h"
+
+#include <cassert>
+#include <cstddef>
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // Vector3DA
+    // =============================================================================
+
+    /// A 3-dimensional mathematical vector, padded & aligned to the size of 4 elements
+    /// @ingroup Vector
+    /// @details
+    /// A Vector3D<float> is 12 bytes, so in an array most vectors straddle a 16 byte boundary & each one needs
+    /// unaligned or partial loads & stores. A Vector3DA<float> is 16 bytes & 16 byte aligned, so each vector is
+    /// exactly one SSE/NEON register (& a Vector3DA<double> one AVX register), which lets compilers load,
+    /// compute & store all 4 elements at once. The value of the pad element is unspecified, it's never read
+    /// for the x, y & z results (see VectorAlignedUtil.h). Initialize all 4 elements, e.g.
+    /// Vector3DA<float>{ x, y, z, 0.0f }, or convert with vector3DA_from_vector3D.
+    /// @tparam T The type of each vector element (usually float or double)
+    template <typename T>
+    struct alignas(4 * sizeof(T)) Vector3DA
+    {
+        ///< runtime index of component: [0] == .x, [1] == .y, [2] == .z
+        constexpr T & operator[](std::size_t const index) noexcept;
+
+        ///< runtime index of component: [0] == .x, [1] == .y, [2] == .z
+        constexpr T const & operator[](std::size_t const index) const noexcept;
+
+        template <typename U>
+        explicit constexpr operator Vector3DA<U>() const noexcept;
+
+        // members:
+        T x;   // uninitialized
+        T y;   // uninitialized
+        T z;   // uninitialized
+        T pad; // uninitialized
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::VectorImpl
+{
+    // =============================================================================
+    // VectorTraits:
+    // =============================================================================
+
+    template <typename T>
+    struct VectorTraits<Vector3DA<T>>
+    {
+        typedef Vector3DA<T> VectorType; ///< This vector type.
+        typedef T            ValueType;  ///< The type of each vector element.
+
+        static constexpr std::size_t Size = 3; ///< The dimensionality of the vector type (excluding pad).
+
+        /// An array of member variable pointers to each vector element.
+        /// @details
+        /// Used to implement constexpr operator [] in a way compatible with Vector3DA
+        /// having separate named members instead of a single array member.
+        static constexpr T VectorType::* Members[Size] = {
+            &VectorType::x, // [0]
+            &VectorType::y, // [1]
+            &VectorType::z, // [2]
+        };
+    };
+
+    // =============================================================================
+} // namespace ggm::VectorImpl
+
+// =============================================================================
+// ggm::Vector3DA:
+// =============================================================================
+
+template <typename T>
+constexpr T & ggm::Vector3DA<T>::operator[](std::size_t const index) noexcept
+{
+    using namespace VectorImpl;
+    typedef VectorTraits<Vector3DA<T>> VectorTraits;
+
+    assert((0 <= index) && (index < VectorTraits::Size));
+
+    return this->*VectorTraits::Members[index];
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr T const & ggm::Vector3DA<T>::operator[](std::size_t const index) const noexcept
+{
+    using namespace VectorImpl;
+    typedef VectorTraits<Vector3DA<T>> VectorTraits;
+
+    assert((0 <= index) && (index < VectorTraits::Size));
+
+    return this->*VectorTraits::Members[index];
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+template <typename U>
+constexpr ggm::Vector3DA<T>::operator Vector3DA<U>() const noexcept
+{
+    return Vector3DA<U>{
+        static_cast<U>(x),
+        static_cast<U>(y),
+        static_cast<U>(z),
+        U{ 0 },
+    };
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_ALIGNED_H
@@ -0,0 +1,1533 @@
+#pragma once
+#ifndef GGM_VECTOR_ALIGNED_UTIL_H
+#define GGM_VECTOR_ALIGNED_UTIL_H
+
+#include "ggm/Numeric/NumericConstants.h"
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorAligned.h"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Vector3DA versions of every Vector3D operator & function of VectorUtil.h (see its syntax tables), with
+/// the same x, y & z results. The element-wise operators & functions also apply the same operation to the
+/// pad element, so compilers compute all 4 elements with whole register loads, operations & stores (e.g. one
+/// addps for u + v). The other functions (e.g. cross) return a zero pad, & every function ignores the pad of
+/// its arguments otherwise (e.g. ==, dot, length & all_of only use x, y & z).
+///
+/// conversions:
+/// ------------
+///
+/// Syntax                                | Description
+/// ------                                | -----------
+/// a = vector3DA_from_vector3D(v);       | convert a Vector3D to a Vector3DA
+/// v = vector3D_from_vector3DA(a);       | convert a Vector3DA to a Vector3D
+/// vector3DA_from_vector3D(vs, as);      | convert each Vector3D of a span to a Vector3DA
+/// vector3D_from_vector3DA(as, vs);      | convert each Vector3DA of a span to a Vector3D
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // operators:
+    // =============================================================================
+
+    /// vector addition assignment
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> & operator+=(Vector3DA<T> &       lhs,
+                                        Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector subtraction assignment
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> & operator-=(Vector3DA<T> &       lhs,
+                                        Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar multiplication assignment
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> & operator*=(Vector3DA<T> & lhs,
+                                        T const &      rhs) noexcept;
+
+    /// element-wise multiplication assignment
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> & operator*=(Vector3DA<T> &       lhs,
+                                        Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar division assignment
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> & operator/=(Vector3DA<T> & lhs,
+                                        T const &      rhs) noexcept;
+
+    /// element-wise division assignment
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> & operator/=(Vector3DA<T> &       lhs,
+                                        Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise unary plus
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator+(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// vector negation
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator-(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// vector addition
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator+(Vector3DA<T> const & lhs,
+                                     Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector subtraction
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator-(Vector3DA<T> const & lhs,
+                                     Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar multiplication
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator*(T const &            lhs,
+                                     Vector3DA<T> const & rhs) noexcept;
+
+    /// scalar multiplication
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator*(Vector3DA<T> const & lhs,
+                                     T const &            rhs) noexcept;
+
+    /// @relates Vector3DA
+    /// element-wise multiplication
+    template <typename T>
+    constexpr Vector3DA<T> operator*(Vector3DA<T> const & lhs,
+                                     Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar division
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator/(Vector3DA<T> const & lhs,
+                                     T const &            rhs) noexcept;
+
+    /// element-wise division
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> operator/(Vector3DA<T> const & lhs,
+                                     Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector equality
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr bool operator==(Vector3DA<T> const & lhs,
+                              Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector inequality
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr bool operator!=(Vector3DA<T> const & lhs,
+                              Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+    // element access:
+    // =============================================================================
+
+    /// get iterator to first element of vector (enables range-based for loop syntax)
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T * begin(Vector3DA<T> & value) noexcept;
+
+    /// get iterator to first element of vector (enables range-based for loop syntax)
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T const * begin(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// get end iterator of vector (enables range-based for loop syntax)
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T * end(Vector3DA<T> & value) noexcept;
+
+    /// get end iterator of vector (enables range-based for loop syntax)
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T const * end(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+    // functions:
+    // =============================================================================
+
+    /// element-wise abs
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> abs(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ceil
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> ceil(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// clamp
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> clamp(Vector3DA<T> const & value,
+                                 T const &            minValue,
+                                 T const &            maxValue) noexcept;
+
+    /// element-wise clamp
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> clamp(Vector3DA<T> const & value,
+                                 Vector3DA<T> const & minValue,
+                                 Vector3DA<T> const & maxValue) noexcept;
+
+    // =============================================================================
+
+    /// Vector3D cross product
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> cross(Vector3DA<T> const & lhs,
+                                 Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// distance between lhs and rhs
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T distance(Vector3DA<T> const & lhs,
+                         Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// square of the distance between lhs and rhs
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T distance_squared(Vector3DA<T> const & lhs,
+                                 Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector dot product
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T dot(Vector3DA<T> const & lhs,
+                    Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// Orients a vector to point away from a surface as defined by its normal.
+    /// Flips surfaceNormal if incident is facing the same half space as referenceNormal.
+    /// @relates Vector3DA
+    /// @param[in] surfaceNormal   The vector to potentially flip, typically the shading normal (i.e. the normal mapped surface).
+    /// @param[in] incident        The incident vector, typically pointing from the view position to the shading position.
+    /// @param[in] referenceNormal The geometric surface normal vector (i.e. from the triangle definition, not the normal mapped surface)
+    template <typename T>
+    constexpr Vector3DA<T> face_forward(Vector3DA<T> const & surfaceNormal,
+                                        Vector3DA<T> const & incident,
+                                        Vector3DA<T> const & referenceNormal) noexcept;
+
+    // =============================================================================
+
+    /// element-wise floor
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> floor(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise fract
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> fract(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise inverse_lerp
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> inverse_lerp(Vector3DA<T> const & value0,
+                                        Vector3DA<T> const & value1,
+                                        Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// true if length(value) is approximately 1
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr bool is_normalized(Vector3DA<T> const & value,
+                                 T const &            epsilon = DefaultTolerance<T>) noexcept;
+
+    // =============================================================================
+
+    /// vector length of value
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T length(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// square of the vector length of value, i.e. dot(value, value)
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T length_squared(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// vector linear interpolation
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> lerp(Vector3DA<T> const & value0,
+                                Vector3DA<T> const & value1,
+                                T const &            t) noexcept;
+
+    /// element-wise lerp
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> lerp(Vector3DA<T> const & value0,
+                                Vector3DA<T> const & value1,
+                                Vector3DA<T> const & t) noexcept;
+
+    // =============================================================================
+
+    /// element-wise linear_step
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> linear_step(Vector3DA<T> const & edge0,
+                                       Vector3DA<T> const & edge1,
+                                       Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// max of all vector elements
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T & max_element(Vector3DA<T> & value) noexcept;
+
+    /// max of all vector elements
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T max_element(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// min of all vector elements
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T & min_element(Vector3DA<T> & value) noexcept;
+
+    /// min of all vector elements
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr T min_element(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// normalized vector in the direction of value, or zero
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> normalize(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// approximately normalized vector in the direction of value, or zero
+    /// @details
+    /// Uses reciprocal_sqrt_fast<Steps>, see it for error bounds.
+    /// @relates Vector3DA
+    template <unsigned int Steps = 2>
+    constexpr Vector3DA<float> normalize_fast(Vector3DA<float> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise reciprocal
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> reciprocal(Vector3DA<T> const & value,
+                                      Vector3DA<T> const & defaultValue = {}) noexcept;
+
+    // =============================================================================
+
+    /// element-wise reciprocal_sqrt
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> reciprocal_sqrt(Vector3DA<T> const & value,
+                                           Vector3DA<T> const & defaultValue = {}) noexcept;
+
+    // =============================================================================
+
+    /// element-wise reciprocal_sqrt_fast
+    /// @relates Vector3DA
+    template <unsigned int Steps = 2>
+    constexpr Vector3DA<float> reciprocal_sqrt_fast(Vector3DA<float> const & value,
+                                                    Vector3DA<float> const & defaultValue = {}) noexcept;
+
+    // =============================================================================
+
+    /// reflection direction for an incident vector
+    /// @relates Vector3DA
+    /// @param[in] incident      The incident vector.
+    /// @param[in] surfaceNormal The surface normal vector.
+    template <typename T>
+    constexpr Vector3DA<T> reflect(Vector3DA<T> const & incident,
+                                   Vector3DA<T> const & surfaceNormal) noexcept;
+
+    // =============================================================================
+
+    /// refraction direction for an incident vector
+    /// @relates Vector3DA
+    /// @param[in] incident      The incident vector.
+    /// @param[in] surfaceNormal The surface normal vector.
+    /// @param[in] eta           The ratio of indices of refraction.
+    template <typename T>
+    constexpr Vector3DA<T> refract(Vector3DA<T> const & incident,
+                                   Vector3DA<T> const & surfaceNormal,
+                                   T const &            eta) noexcept;
+
+    // =============================================================================
+
+    /// element-wise repeat
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> repeat(Vector3DA<T> const & value,
+                                  Vector3DA<T> const & minValue,
+                                  Vector3DA<T> const & maxValue) noexcept;
+
+    // =============================================================================
+
+    /// element-wise saturate
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> saturate(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> select(Vector3DA<bool> const & mask,
+                                  Vector3DA<T> const &    lhs,
+                                  Vector3DA<T> const &    rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise smooth_step
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> smooth_step(Vector3DA<T> const & edge0,
+                                       Vector3DA<T> const & edge1,
+                                       Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise trunc
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> trunc(Vector3DA<T> const & value) noexcept;
+
+    // =============================================================================
+    // comparisons:
+    // =============================================================================
+
+    /// true if all bool elements are true
+    /// @relates Vector3DA
+    constexpr bool all_of(Vector3DA<bool> const & value) noexcept;
+
+    // =============================================================================
+
+    /// true if any bool elements are true
+    /// @relates Vector3DA
+    constexpr bool any_of(Vector3DA<bool> const & value) noexcept;
+
+    // =============================================================================
+
+    /// true if all bool elements are false
+    /// @relates Vector3DA
+    constexpr bool none_of(Vector3DA<bool> const & value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise is_close
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_close(Vector3DA<T> const & lhs,
+                                       Vector3DA<T> const & rhs,
+                                       T const &            epsilon = DefaultTolerance<T>) noexcept;
+
+    // =============================================================================
+
+    /// element-wise is_close_ulps
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_close_ulps(Vector3DA<T> const &          lhs,
+                                            Vector3DA<T> const &          rhs,
+                                            unsigned int const  maxUlps = DefaultToleranceUlps) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ==
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_equal(Vector3DA<T> const & lhs,
+                                       Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ==
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_greater(Vector3DA<T> const & lhs,
+                                         Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ==
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_greater_equal(Vector3DA<T> const & lhs,
+                                               Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ==
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_less(Vector3DA<T> const & lhs,
+                                      Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ==
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_less_equal(Vector3DA<T> const & lhs,
+                                            Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise ==
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<bool> is_not_equal(Vector3DA<T> const & lhs,
+                                           Vector3DA<T> const & rhs) noexcept;
+
+    // =============================================================================
+    // conversions:
+    // =============================================================================
+
+    /// convert a Vector3D to a Vector3DA
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3DA<T> vector3DA_from_vector3D(Vector3D<T> const & value) noexcept;
+
+    /// convert each Vector3D of values to a Vector3DA
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr void vector3DA_from_vector3D(std::span<Vector3D<T> const> const values,
+                                           std::span<Vector3DA<T>> const      results) noexcept;
+
+    // =============================================================================
+
+    /// convert a Vector3DA to a Vector3D
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr Vector3D<T> vector3D_from_vector3DA(Vector3DA<T> const & value) noexcept;
+
+    /// convert each Vector3DA of values to a Vector3D
+    /// @relates Vector3DA
+    template <typename T>
+    constexpr void vector3D_from_vector3DA(std::span<Vector3DA<T> const> const values,
+                                           std::span<Vector3D<T>> const        results) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> & ggm::operator+=(Vector3DA<T> &       lhs,
+                                              Vector3DA<T> const & rhs) noexcept
+{
+    lhs.x += rhs.x;
+    lhs.y += rhs.y;
+    lhs.z += rhs.z;
+    lhs.pad += rhs.pad;
+    return lhs;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> & ggm::operator-=(Vector3DA<T> &       lhs,
+                                              Vector3DA<T> const & rhs) noexcept
+{
+    lhs.x -= rhs.x;
+    lhs.y -= rhs.y;
+    lhs.z -= rhs.z;
+    lhs.pad -= rhs.pad;
+    return lhs;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> & ggm::operator*=(Vector3DA<T> & lhs,
+                                              T const &      rhs) noexcept
+{
+    lhs.x *= rhs;
+    lhs.y *= rhs;
+    lhs.z *= rhs;
+    lhs.pad *= rhs;
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> & ggm::operator*=(Vector3DA<T> &       lhs,
+                                              Vector3DA<T> const & rhs) noexcept
+{
+    lhs.x *= rhs.x;
+    lhs.y *= rhs.y;
+    lhs.z *= rhs.z;
+    lhs.pad *= rhs.pad;
+    return lhs;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> & ggm::operator/=(Vector3DA<T> & lhs,
+                                              T const &      rhs) noexcept
+{
+    lhs.x /= rhs;
+    lhs.y /= rhs;
+    lhs.z /= rhs;
+    lhs.pad /= rhs;
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> & ggm::operator/=(Vector3DA<T> &       lhs,
+                                              Vector3DA<T> const & rhs) noexcept
+{
+    lhs.x /= rhs.x;
+    lhs.y /= rhs.y;
+    lhs.z /= rhs.z;
+    lhs.pad /= rhs.pad;
+    return lhs;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator+(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        +value.x,
+        +value.y,
+        +value.z,
+        +value.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator-(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        -value.x,
+        -value.y,
+        -value.z,
+        -value.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator+(Vector3DA<T> const & lhs,
+                                           Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.x + rhs.x,
+        lhs.y + rhs.y,
+        lhs.z + rhs.z,
+        lhs.pad + rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator-(Vector3DA<T> const & lhs,
+                                           Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.x - rhs.x,
+        lhs.y - rhs.y,
+        lhs.z - rhs.z,
+        lhs.pad - rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator*(T const &            lhs,
+                                           Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs * rhs.x,
+        lhs * rhs.y,
+        lhs * rhs.z,
+        lhs * rhs.pad,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator*(Vector3DA<T> const & lhs,
+                                           T const &            rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.x * rhs,
+        lhs.y * rhs,
+        lhs.z * rhs,
+        lhs.pad * rhs,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator*(Vector3DA<T> const & lhs,
+                                           Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.x * rhs.x,
+        lhs.y * rhs.y,
+        lhs.z * rhs.z,
+        lhs.pad * rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator/(Vector3DA<T> const & lhs,
+                                           T const &            rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.x / rhs,
+        lhs.y / rhs,
+        lhs.z / rhs,
+        lhs.pad / rhs,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::operator/(Vector3DA<T> const & lhs,
+                                           Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.x / rhs.x,
+        lhs.y / rhs.y,
+        lhs.z / rhs.z,
+        lhs.pad / rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr bool ggm::operator==(Vector3DA<T> const & lhs,
+                               Vector3DA<T> const & rhs) noexcept
+{
+    return (lhs.x == rhs.x) &&
+           (lhs.y == rhs.y) &&
+           (lhs.z == rhs.z);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr bool ggm::operator!=(Vector3DA<T> const & lhs,
+                               Vector3DA<T> const & rhs) noexcept
+{
+    return (lhs.x != rhs.x) ||
+           (lhs.y != rhs.y) ||
+           (lhs.z != rhs.z);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T * ggm::begin(Vector3DA<T> & value) noexcept
+{
+    static_assert(std::is_standard_layout_v<Vector3DA<T>>,
+                  "Implementing begin(Vector3DA) by interpreting as array requires Vector3DA to be standard_layout");
+
+    static_assert(sizeof(Vector3DA<T>) == sizeof(T[4]),
+                  "Implementing begin(Vector3DA) by interpreting as array requires Vector3DA to have the same sizeof as T[4]");
+
+    static_assert(offsetof(Vector3DA<T>, x) == 0 * sizeof(T),
+                  "Implementing begin(Vector3DA) by interpreting as array requires offsetof x to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, y) == 1 * sizeof(T),
+                  "Implementing begin(Vector3DA) by interpreting as array requires offsetof y to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, z) == 2 * sizeof(T),
+                  "Implementing begin(Vector3DA) by interpreting as array requires offsetof z to match array layout");
+
+    return &value.x;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr T const * ggm::begin(Vector3DA<T> const & value) noexcept
+{
+    static_assert(std::is_standard_layout_v<Vector3DA<T>>,
+                  "Implementing begin(Vector3DA) by interpreting as array requires Vector3DA to be standard_layout");
+
+    static_assert(sizeof(Vector3DA<T>) == sizeof(T[4]),
+                  "Implementing begin(Vector3DA) by interpreting as array requires Vector3DA to have the same sizeof as T[4]");
+
+    static_assert(offsetof(Vector3DA<T>, x) == 0 * sizeof(T),
+                  "Implementing begin(Vector3DA) by interpreting as array requires offsetof x to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, y) == 1 * sizeof(T),
+                  "Implementing begin(Vector3DA) by interpreting as array requires offsetof y to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, z) == 2 * sizeof(T),
+                  "Implementing begin(Vector3DA) by interpreting as array requires offsetof z to match array layout");
+
+    return &value.x;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T * ggm::end(Vector3DA<T> & value) noexcept
+{
+    using namespace VectorImpl;
+
+    static_assert(std::is_standard_layout_v<Vector3DA<T>>,
+                  "Implementing end(Vector3DA) by interpreting as array requires Vector3DA to be standard_layout");
+
+    static_assert(sizeof(Vector3DA<T>) == sizeof(T[4]),
+                  "Implementing end(Vector3DA) by interpreting as array requires Vector3DA to have the same sizeof as T[4]");
+
+    static_assert(offsetof(Vector3DA<T>, x) == 0 * sizeof(T),
+                  "Implementing end(Vector3DA) by interpreting as array requires offsetof x to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, y) == 1 * sizeof(T),
+                  "Implementing end(Vector3DA) by interpreting as array requires offsetof y to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, z) == 2 * sizeof(T),
+                  "Implementing end(Vector3DA) by interpreting as array requires offsetof z to match array layout");
+
+    typedef VectorTraits<Vector3DA<T>> VectorTraits;
+
+    return &value.x + VectorTraits::Size;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr T const * ggm::end(Vector3DA<T> const & value) noexcept
+{
+    using namespace VectorImpl;
+
+    static_assert(std::is_standard_layout_v<Vector3DA<T>>,
+                  "Implementing end(Vector3DA) by interpreting as array requires Vector3DA to be standard_layout");
+
+    static_assert(sizeof(Vector3DA<T>) == sizeof(T[4]),
+                  "Implementing end(Vector3DA) by interpreting as array requires Vector3DA to have the same sizeof as T[4]");
+
+    static_assert(offsetof(Vector3DA<T>, x) == 0 * sizeof(T),
+                  "Implementing end(Vector3DA) by interpreting as array requires offsetof x to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, y) == 1 * sizeof(T),
+                  "Implementing end(Vector3DA) by interpreting as array requires offsetof y to match array layout");
+
+    static_assert(offsetof(Vector3DA<T>, z) == 2 * sizeof(T),
+                  "Implementing end(Vector3DA) by interpreting as array requires offsetof z to match array layout");
+
+    typedef VectorTraits<Vector3DA<T>> VectorTraits;
+
+    return &value.x + VectorTraits::Size;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::abs(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        abs(value.x),
+        abs(value.y),
+        abs(value.z),
+        abs(value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::ceil(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        ceil(value.x),
+        ceil(value.y),
+        ceil(value.z),
+        ceil(value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::clamp(Vector3DA<T> const & value,
+                                       T const &            minValue,
+                                       T const &            maxValue) noexcept
+{
+    return Vector3DA<T>{
+        clamp(value.x, minValue, maxValue),
+        clamp(value.y, minValue, maxValue),
+        clamp(value.z, minValue, maxValue),
+        clamp(value.pad, minValue, maxValue),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::clamp(Vector3DA<T> const & value,
+                                       Vector3DA<T> const & minValue,
+                                       Vector3DA<T> const & maxValue) noexcept
+{
+    return Vector3DA<T>{
+        clamp(value.x, minValue.x, maxValue.x),
+        clamp(value.y, minValue.y, maxValue.y),
+        clamp(value.z, minValue.z, maxValue.z),
+        clamp(value.pad, minValue.pad, maxValue.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::cross(Vector3DA<T> const & lhs,
+                                       Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<T>{
+        lhs.y * rhs.z - lhs.z * rhs.y,
+        lhs.z * rhs.x - lhs.x * rhs.z,
+        lhs.x * rhs.y - lhs.y * rhs.x,
+        T{ 0 },
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::distance(Vector3DA<T> const & lhs,
+                          Vector3DA<T> const & rhs) noexcept
+{
+    return sqrt(distance_squared(lhs, rhs));
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::distance_squared(Vector3DA<T> const & lhs,
+                                  Vector3DA<T> const & rhs) noexcept
+{
+    return length_squared(lhs - rhs);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::dot(Vector3DA<T> const & lhs,
+                     Vector3DA<T> const & rhs) noexcept
+{
+    return sum_of_products(lhs.x, rhs.x,
+                           lhs.y, rhs.y,
+                           lhs.z, rhs.z);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::face_forward(Vector3DA<T> const & surfaceNormal,
+                                              Vector3DA<T> const & incident,
+                                              Vector3DA<T> const & referenceNormal) noexcept
+{
+    return (dot(incident, referenceNormal) < T{ 0 }) ? surfaceNormal : -surfaceNormal;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::floor(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        floor(value.x),
+        floor(value.y),
+        floor(value.z),
+        floor(value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::fract(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        fract(value.x),
+        fract(value.y),
+        fract(value.z),
+        fract(value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::inverse_lerp(Vector3DA<T> const & value0,
+                                              Vector3DA<T> const & value1,
+                                              Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        inverse_lerp(value0.x, value1.x, value.x),
+        inverse_lerp(value0.y, value1.y, value.y),
+        inverse_lerp(value0.z, value1.z, value.z),
+        inverse_lerp(value0.pad, value1.pad, value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr bool ggm::is_normalized(Vector3DA<T> const & value,
+                                  T const &            epsilon) noexcept
+{
+    return is_close(length_squared(value), T{ 1 }, epsilon);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::length(Vector3DA<T> const & value) noexcept
+{
+    return sqrt(length_squared(value));
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T ggm::length_squared(Vector3DA<T> const & value) noexcept
+{
+    return dot(value, value);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::lerp(Vector3DA<T> const & value0,
+                                      Vector3DA<T> const & value1,
+                                      T const &            t) noexcept
+{
+    return Vector3DA<T>{
+        lerp(value0.x, value1.x, t),
+        lerp(value0.y, value1.y, t),
+        lerp(value0.z, value1.z, t),
+        lerp(value0.pad, value1.pad, t),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::lerp(Vector3DA<T> const & value0,
+                                      Vector3DA<T> const & value1,
+                                      Vector3DA<T> const & t) noexcept
+{
+    return Vector3DA<T>{
+        lerp(value0.x, value1.x, t.x),
+        lerp(value0.y, value1.y, t.y),
+        lerp(value0.z, value1.z, t.z),
+        lerp(value0.pad, value1.pad, t.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::linear_step(Vector3DA<T> const & edge0,
+                                             Vector3DA<T> const & edge1,
+                                             Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        linear_step(edge0.x, edge1.x, value.x),
+        linear_step(edge0.y, edge1.y, value.y),
+        linear_step(edge0.z, edge1.z, value.z),
+        linear_step(edge0.pad, edge1.pad, value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T & ggm::max_element(Vector3DA<T> & value) noexcept
+{
+    return max_of(value.x,
+                  value.y,
+                  value.z);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr T ggm::max_element(Vector3DA<T> const & value) noexcept
+{
+    return max_of(value.x,
+                  value.y,
+                  value.z);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr T & ggm::min_element(Vector3DA<T> & value) noexcept
+{
+    return min_of(value.x,
+                  value.y,
+                  value.z);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr T ggm::min_element(Vector3DA<T> const & value) noexcept
+{
+    return min_of(value.x,
+                  value.y,
+                  value.z);
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::normalize(Vector3DA<T> const & value) noexcept
+{
+    return value * reciprocal_sqrt(length_squared(value));
+}
+
+// =============================================================================
+
+template <unsigned int Steps>
+constexpr ggm::Vector3DA<float> ggm::normalize_fast(Vector3DA<float> const & value) noexcept
+{
+    return value * reciprocal_sqrt_fast<Steps>(length_squared(value));
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::reciprocal(Vector3DA<T> const & value,
+                                            Vector3DA<T> const & defaultValue) noexcept
+{
+    return Vector3DA<T>{
+        reciprocal(value.x, defaultValue.x),
+        reciprocal(value.y, defaultValue.y),
+        reciprocal(value.z, defaultValue.z),
+        reciprocal(value.pad, defaultValue.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::reciprocal_sqrt(Vector3DA<T> const & value,
+                                                 Vector3DA<T> const & defaultValue) noexcept
+{
+    return Vector3DA<T>{
+        reciprocal_sqrt(value.x, defaultValue.x),
+        reciprocal_sqrt(value.y, defaultValue.y),
+        reciprocal_sqrt(value.z, defaultValue.z),
+        reciprocal_sqrt(value.pad, defaultValue.pad),
+    };
+}
+
+// =============================================================================
+
+template <unsigned int Steps>
+constexpr ggm::Vector3DA<float> ggm::reciprocal_sqrt_fast(Vector3DA<float> const & value,
+                                                          Vector3DA<float> const & defaultValue) noexcept
+{
+    return Vector3DA<float>{
+        reciprocal_sqrt_fast<Steps>(value.x, defaultValue.x),
+        reciprocal_sqrt_fast<Steps>(value.y, defaultValue.y),
+        reciprocal_sqrt_fast<Steps>(value.z, defaultValue.z),
+        reciprocal_sqrt_fast<Steps>(value.pad, defaultValue.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::reflect(Vector3DA<T> const & incident,
+                                         Vector3DA<T> const & surfaceNormal) noexcept
+{
+    return incident - T{ 2 } * dot(incident, surfaceNormal) * surfaceNormal;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::refract(Vector3DA<T> const & incident,
+                                         Vector3DA<T> const & surfaceNormal,
+                                         T const &            eta) noexcept
+{
+    T const nDotI = dot(incident, surfaceNormal);
+    T const k     = T{ 1 } - eta * eta * (T{ 1 } - nDotI * nDotI);
+
+    if (k >= T{ 0 })
+    {
+        return eta * incident - (eta * nDotI + sqrt(k)) * surfaceNormal;
+    }
+
+    return Vector3DA<T>{
+        T{ 0 },
+        T{ 0 },
+        T{ 0 },
+        T{ 0 },
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::repeat(Vector3DA<T> const & value,
+                                        Vector3DA<T> const & minValue,
+                                        Vector3DA<T> const & maxValue) noexcept
+{
+    return Vector3DA<T>{
+        repeat(value.x, minValue.x, maxValue.x),
+        repeat(value.y, minValue.y, maxValue.y),
+        repeat(value.z, minValue.z, maxValue.z),
+        repeat(value.pad, minValue.pad, maxValue.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::saturate(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        saturate(value.x),
+        saturate(value.y),
+        saturate(value.z),
+        saturate(value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::select(Vector3DA<bool> const & mask,
+                                        Vector3DA<T> const &    lhs,
+                                        Vector3DA<T> const &    rhs) noexcept
+{
+    return Vector3DA<T>{
+        mask.x ? lhs.x : rhs.x,
+        mask.y ? lhs.y : rhs.y,
+        mask.z ? lhs.z : rhs.z,
+        mask.pad ? lhs.pad : rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::smooth_step(Vector3DA<T> const & edge0,
+                                             Vector3DA<T> const & edge1,
+                                             Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        smooth_step(edge0.x, edge1.x, value.x),
+        smooth_step(edge0.y, edge1.y, value.y),
+        smooth_step(edge0.z, edge1.z, value.z),
+        smooth_step(edge0.pad, edge1.pad, value.pad),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::trunc(Vector3DA<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        trunc(value.x),
+        trunc(value.y),
+        trunc(value.z),
+        trunc(value.pad),
+    };
+}
+
+// =============================================================================
+// comparisons:
+// =============================================================================
+
+constexpr bool ggm::all_of(Vector3DA<bool> const & value) noexcept
+{
+    return value.x &
+           value.y &
+           value.z;
+}
+
+// =============================================================================
+
+constexpr bool ggm::any_of(Vector3DA<bool> const & value) noexcept
+{
+    return value.x |
+           value.y |
+           value.z;
+}
+
+// =============================================================================
+
+constexpr bool ggm::none_of(Vector3DA<bool> const & value) noexcept
+{
+    return !value.x &
+           !value.y &
+           !value.z;
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_close(Vector3DA<T> const & lhs,
+                                             Vector3DA<T> const & rhs,
+                                             T const &            epsilon) noexcept
+{
+    return Vector3DA<bool>{
+        is_close(lhs.x, rhs.x, epsilon),
+        is_close(lhs.y, rhs.y, epsilon),
+        is_close(lhs.z, rhs.z, epsilon),
+        is_close(lhs.pad, rhs.pad, epsilon),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_close_ulps(Vector3DA<T> const & lhs,
+                                                  Vector3DA<T> const & rhs,
+                                                  unsigned int const   maxUlps) noexcept
+{
+    return Vector3DA<bool>{
+        is_close_ulps(lhs.x, rhs.x, maxUlps),
+        is_close_ulps(lhs.y, rhs.y, maxUlps),
+        is_close_ulps(lhs.z, rhs.z, maxUlps),
+        is_close_ulps(lhs.pad, rhs.pad, maxUlps),
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_equal(Vector3DA<T> const & lhs,
+                                             Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<bool>{
+        lhs.x == rhs.x,
+        lhs.y == rhs.y,
+        lhs.z == rhs.z,
+        lhs.pad == rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_greater(Vector3DA<T> const & lhs,
+                                               Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<bool>{
+        lhs.x > rhs.x,
+        lhs.y > rhs.y,
+        lhs.z > rhs.z,
+        lhs.pad > rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_greater_equal(Vector3DA<T> const & lhs,
+                                                     Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<bool>{
+        lhs.x >= rhs.x,
+        lhs.y >= rhs.y,
+        lhs.z >= rhs.z,
+        lhs.pad >= rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_less(Vector3DA<T> const & lhs,
+                                            Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<bool>{
+        lhs.x < rhs.x,
+        lhs.y < rhs.y,
+        lhs.z < rhs.z,
+        lhs.pad < rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_less_equal(Vector3DA<T> const & lhs,
+                                                  Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<bool>{
+        lhs.x <= rhs.x,
+        lhs.y <= rhs.y,
+        lhs.z <= rhs.z,
+        lhs.pad <= rhs.pad,
+    };
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<bool> ggm::is_not_equal(Vector3DA<T> const & lhs,
+                                                 Vector3DA<T> const & rhs) noexcept
+{
+    return Vector3DA<bool>{
+        lhs.x != rhs.x,
+        lhs.y != rhs.y,
+        lhs.z != rhs.z,
+        lhs.pad != rhs.pad,
+    };
+}
+
+// =============================================================================
+// conversions:
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DA<T> ggm::vector3DA_from_vector3D(Vector3D<T> const & value) noexcept
+{
+    return Vector3DA<T>{
+        value.x,
+        value.y,
+        value.z,
+        T{ 0 }, // pad
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::vector3DA_from_vector3D(std::span<Vector3D<T> const> const values,
+                                            std::span<Vector3DA<T>> const      results) noexcept
+{
+    assert(results.size() == values.size());
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = vector3DA_from_vector3D(values[i]);
+    }
+}
+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3D<T> ggm::vector3D_from_vector3DA(Vector3DA<T> const & value) noexcept
+{
+    return Vector3D<T>{
+        value.x,
+        value.y,
+        value.z,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::vector3D_from_vector3DA(std::span<Vector3DA<T> const> const values,
+                                            std::span<Vector3D<T>> const        results) noexcept
+{
+    assert(results.size() == values.size());
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = vector3D_from_vector3DA(values[i]);
+    }
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_ALIGNED_UTIL_H
@@ -0,0 +1,421 @@
+#pragma once
+#ifndef GGM_VECTOR_BATCH_H
+#define GGM_VECTOR_BATCH_H
+
+#include "ggm/Numeric/Half.h"
+#include "ggm/Vector/Vector.h"
+
+#include <cstdint>
+#include <span>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Functions that apply a vector utility function to each element of a span, writing the results to an
+/// output span of the same size (which may be the same as the input span, i.e. in-place, unless the types differ).
+///
+/// The random_* functions fill a span with samples of a VectorRandom.h shape, where results[i] is the sample
+/// of the random vector first + i of the sequence of seed (e.g. random_in_sphere(seed, first, results) gives
+/// uniform_in_sphere(random_vector3D(seed, first + i))). So the results only depend on the seed & counters,
+/// not on the dispatch level or the SIMD width, & a sequence can be generated in several calls.
+///
+/// These are defined in the ggm library (rather than inline) & dispatch at runtime to the widest
+/// instruction set supported by the machine, see DispatchLevel.h.
+///
+/// functions:
+/// ----------
+///
+/// Syntax                                  | Description
+/// ------                                  | -----------
+/// float_from_half(hs, vs)                 | convert each half vector to a float vector (exact)
+/// float_from_snorm(is, vs)                | convert each snorm vector (Vector2D<std::int16_t>, Vector4D<std::int8_t> or Vector4D<std::int16_t>) to a float vector
+/// float_from_unorm(is, vs)                | convert each unorm vector (Vector2D<std::uint16_t>, Vector4D<std::uint8_t> or Vector4D<std::uint16_t>) to a float vector
+/// half_from_float(vs, hs)                 | convert each float vector to the nearest half vector
+/// hilbert_from_vector2D(min, max, vs, ks) | hilbert key of the grid cell of each position within the bounds
+/// hilbert_from_vector3D(min, max, vs, ks) | hilbert key of the grid cell of each position within the bounds
+/// morton_from_vector2D(min, max, vs, ks)  | morton key of the grid cell of each position within the bounds
+/// morton_from_vector3D(min, max, vs, ks)  | morton key of the grid cell of each position within the bounds
+/// normalize(vs, us)                       | normalized vector in the direction of each vector, or zero
+/// octahedral16_from_vector3D(vs, es)      | encode each unit vector as 2 16-bit signed normalized integers
+/// octahedral8_from_vector3D(vs, es)       | encode each unit vector as 2 8-bit signed normalized integers
+/// perlin_fbm(vs, octaves, l, g, ns)      | perlin_fbm of each Vector2D<float> or Vector3D<float> point
+/// perlin_noise(vs, ns)                    | perlin_noise of each Vector2D<float> or Vector3D<float> point
+/// random_in_box(seed, n, min, max, vs)   | the samples n, n + 1, ... of uniform_in_box (Vector2D, Vector3D or Vector4D)
+/// random_in_cone(seed, n, dir, cos, vs)   | the samples n, n + 1, ... of uniform_in_cone
+/// random_in_disk(seed, n, vs)             | the samples n, n + 1, ... of uniform_in_disk
+/// random_in_hemisphere(seed, n, nrm, vs)  | the samples n, n + 1, ... of uniform_in_hemisphere
+/// random_in_sphere(seed, n, vs)           | the samples n, n + 1, ... of uniform_in_sphere
+/// random_on_sphere(seed, n, vs)           | the samples n, n + 1, ... of uniform_on_sphere
+/// simplex_fbm(vs, octaves, l, g, ns)     | simplex_fbm of each Vector2D<float> or Vector3D<float> point
+/// simplex_noise(vs, ns)                   | simplex_noise of each Vector2D<float> or Vector3D<float> point
+/// snorm1010102_from_vector4D(vs, ps)      | pack each vector as 10:10:10:2 signed normalized integers
+/// snorm8_from_float(vs, is)               | convert each Vector4D<float> to the nearest Vector4D<std::int8_t> snorm vector
+/// snorm16_from_float(vs, is)              | convert each Vector2D<float> or Vector4D<float> to the nearest std::int16_t snorm vector
+/// unorm1010102_from_vector4D(vs, ps)      | pack each vector as 10:10:10:2 unsigned normalized integers
+/// unorm8_from_float(vs, is)               | convert each Vector4D<float> to the nearest Vector4D<std::uint8_t> unorm vector
+/// unorm16_from_float(vs, is)              | convert each Vector2D<float> or Vector4D<float> to the nearest std::uint16_t unorm vector
+/// vector3D_from_octahedral16(es, vs)      | decode each unit vector from 2 16-bit signed normalized integers
+/// vector3D_from_octahedral8(es, vs)       | decode each unit vector from 2 8-bit signed normalized integers
+/// vector4D_from_snorm1010102(ps, vs)      | unpack each vector from 10:10:10:2 signed normalized integers
+/// vector4D_from_unorm1010102(ps, vs)      | unpack each vector from 10:10:10:2 unsigned normalized integers
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+
+    /// convert each half vector to a float vector (exact), see @ref float_from_half(half)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector3D
+    void float_from_half(std::span<Vector3D<half> const> const values,
+                         std::span<Vector3D<float>> const      results) noexcept;
+
+    // =============================================================================
+
+    /// the float value of each element of each signed normalized integer vector, see @ref float_from_snorm(std::int8_t)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector4D
+    void float_from_snorm(std::span<Vector2D<std::int16_t> const> const values,
+                          std::span<Vector2D<float>> const              results) noexcept;
+    void float_from_snorm(std::span<Vector4D<std::int8_t> const> const values,
+                          std::span<Vector4D<float>> const             results) noexcept;
+    void float_from_snorm(std::span<Vector4D<std::int16_t> const> const values,
+                          std::span<Vector4D<float>> const              results) noexcept;
+
+    /// the float value of each element of each unsigned normalized integer vector, see @ref float_from_unorm(std::uint8_t)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector4D
+    void float_from_unorm(std::span<Vector2D<std::uint16_t> const> const values,
+                          std::span<Vector2D<float>> const               results) noexcept;
+    void float_from_unorm(std::span<Vector4D<std::uint8_t> const> const values,
+                          std::span<Vector4D<float>> const              results) noexcept;
+    void float_from_unorm(std::span<Vector4D<std::uint16_t> const> const values,
+                          std::span<Vector4D<float>> const               results) noexcept;
+
+    // =============================================================================
+
+    /// convert each float vector to the nearest half vector, see @ref half_from_float(float)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector3D
+    void half_from_float(std::span<Vector3D<float> const> const values,
+                         std::span<Vector3D<half>> const        results) noexcept;
+
+    // =============================================================================
+
+    /// hilbert key of the grid cell of each position within the bounds, i.e.
+    /// hilbert_from_vector2D(grid_from_vector2D(values[i], boundsMin, boundsMax)), see VectorSpatialKey.h
+    /// @param[in]  boundsMin The minimum corner of the bounds (e.g. of all the values)
+    /// @param[in]  boundsMax The maximum corner of the bounds
+    /// @param[in]  values    The positions
+    /// @param[out] keys      The keys (e.g. to radix sort), must be the same size as values
+    /// @relates Vector2D
+    void hilbert_from_vector2D(Vector2D<float> const &                boundsMin,
+                               Vector2D<float> const &                boundsMax,
+                               std::span<Vector2D<float> const> const values,
+                               std::span<std::uint32_t> const         keys) noexcept;
+
+    /// hilbert key of the grid cell of each position within the bounds, i.e.
+    /// hilbert_from_vector3D(grid_from_vector3D(values[i], boundsMin, boundsMax)), see VectorSpatialKey.h
+    /// @param[in]  boundsMin The minimum corner of the bounds (e.g. of all the values)
+    /// @param[in]  boundsMax The maximum corner of the bounds
+    /// @param[in]  values    The positions
+    /// @param[out] keys      The keys (e.g. to radix sort), must be the same size as values
+    /// @relates Vector3D
+    void hilbert_from_vector3D(Vector3D<float> const &                boundsMin,
+                               Vector3D<float> const &                boundsMax,
+                               std::span<Vector3D<float> const> const values,
+                               std::span<std::uint64_t> const         keys) noexcept;
+
+    // =============================================================================
+
+    /// morton key of the grid cell of each position within the bounds, i.e.
+    /// morton_from_vector2D(grid_from_vector2D(values[i], boundsMin, boundsMax)), see VectorSpatialKey.h
+    /// @param[in]  boundsMin The minimum corner of the bounds (e.g. of all the values)
+    /// @param[in]  boundsMax The maximum corner of the bounds
+    /// @param[in]  values    The positions
+    /// @param[out] keys      The keys (e.g. to radix sort), must be the same size as values
+    /// @relates Vector2D
+    void morton_from_vector2D(Vector2D<float> const &                boundsMin,
+                              Vector2D<float> const &                boundsMax,
+                              std::span<Vector2D<float> const> const values,
+                              std::span<std::uint32_t> const         keys) noexcept;
+
+    /// morton key of the grid cell of each position within the bounds, i.e.
+    /// morton_from_vector3D(grid_from_vector3D(values[i], boundsMin, boundsMax)), see VectorSpatialKey.h
+    /// @param[in]  boundsMin The minimum corner of the bounds (e.g. of all the values)
+    /// @param[in]  boundsMax The maximum corner of the bounds
+    /// @param[in]  values    The positions
+    /// @param[out] keys      The keys (e.g. to radix sort), must be the same size as values
+    /// @relates Vector3D
+    void morton_from_vector3D(Vector3D<float> const &                boundsMin,
+                              Vector3D<float> const &                boundsMax,
+                              std::span<Vector3D<float> const> const values,
+                              std::span<std::uint64_t> const         keys) noexcept;
+
+    // =============================================================================
+
+    /// normalized vector in the direction of each value, or zero
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The normalized vectors, must be the same size as values
+    /// @relates Vector3D
+    void normalize(std::span<Vector3D<float> const> const values,
+                   std::span<Vector3D<float>> const       results) noexcept;
+    void normalize(std::span<Vector3D<double> const> const values,
+                   std::span<Vector3D<double>> const       results) noexcept;
+
+    // =============================================================================
+
+    /// encode each unit vector as 2 16-bit signed normalized integers, see @ref octahedral16_from_vector3D(Vector3D<float> const &)
+    /// @param[in]  values  The source unit vectors
+    /// @param[out] results The encoded vectors, must be the same size as values
+    /// @relates Vector3D
+    void octahedral16_from_vector3D(std::span<Vector3D<float> const> const values,
+                                    std::span<Vector2D<std::int16_t>> const results) noexcept;
+
+    /// encode each unit vector as 2 8-bit signed normalized integers, see @ref octahedral8_from_vector3D(Vector3D<float> const &)
+    /// @param[in]  values  The source unit vectors
+    /// @param[out] results The encoded vectors, must be the same size as values
+    /// @relates Vector3D
+    void octahedral8_from_vector3D(std::span<Vector3D<float> const> const values,
+                                   std::span<Vector2D<std::int8_t>> const  results) noexcept;
+
+    // =============================================================================
+
+    /// improved Perlin noise of each point, see @ref perlin_noise(Vector3D<float> const &)
+    /// @param[in]  values  The points
+    /// @param[out] results The noise of each point, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector3D
+    void perlin_noise(std::span<Vector2D<float> const> const values,
+                      std::span<float> const                 results) noexcept;
+    void perlin_noise(std::span<Vector3D<float> const> const values,
+                      std::span<float> const                 results) noexcept;
+
+    /// octaves of improved Perlin noise of each point, see @ref perlin_fbm(Vector3D<float> const &, int, float, float)
+    /// @param[in]  values     The points
+    /// @param[in]  octaves    The number of octaves
+    /// @param[in]  lacunarity The frequency multiplier of each octave (usually ~2)
+    /// @param[in]  gain       The amplitude multiplier of each octave (usually ~0.5)
+    /// @param[out] results    The noise of each point, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector3D
+    void perlin_fbm(std::span<Vector2D<float> const> const values,
+                    int const                              octaves,
+                    float const                            lacunarity,
+                    float const                            gain,
+                    std::span<float> const                 results) noexcept;
+    void perlin_fbm(std::span<Vector3D<float> const> const values,
+                    int const                              octaves,
+                    float const                            lacunarity,
+                    float const                            gain,
+                    std::span<float> const                 results) noexcept;
+
+    // =============================================================================
+
+    /// uniformly distributed points in the box [boxMin, boxMax], see @ref uniform_in_box & the random_* note above
+    /// @param[in]  seed    The seed of the sequence
+    /// @param[in]  first   The counter of the first sample
+    /// @param[in]  boxMin  The minimum corner of the box
+    /// @param[in]  boxMax  The maximum corner of the box
+    /// @param[out] results The samples
+    /// @relates Vector2D
+    /// @relates Vector3D
+    /// @relates Vector4D
+    void random_in_box(std::uint32_t const        seed,
+                       std::uint32_t const        first,
+                       Vector2D<float> const &    boxMin,
+                       Vector2D<float> const &    boxMax,
+                       std::span<Vector2D<float>> results) noexcept;
+    void random_in_box(std::uint32_t const        seed,
+                       std::uint32_t const        first,
+                       Vector3D<float> const &    boxMin,
+                       Vector3D<float> const &    boxMax,
+                       std::span<Vector3D<float>> results) noexcept;
+    void random_in_box(std::uint32_t const        seed,
+                       std::uint32_t const        first,
+                       Vector4D<float> const &    boxMin,
+                       Vector4D<float> const &    boxMax,
+                       std::span<Vector4D<float>> results) noexcept;
+
+    /// uniformly distributed directions within the cone of direction, see @ref uniform_in_cone & the random_* note above
+    /// @param[in]  seed         The seed of the sequence
+    /// @param[in]  first        The counter of the first sample
+    /// @param[in]  direction    The axis of the cone, must be a unit vector
+    /// @param[in]  cosHalfAngle The cosine of the half angle of the cone, in [-1, 1]
+    /// @param[out] results      The samples
+    /// @relates Vector3D
+    void random_in_cone(std::uint32_t const        seed,
+                        std::uint32_t const        first,
+                        Vector3D<float> const &    direction,
+                        float const                cosHalfAngle,
+                        std::span<Vector3D<float>> results) noexcept;
+
+    /// uniformly distributed points in the unit disk, see @ref uniform_in_disk & the random_* note above
+    /// @param[in]  seed    The seed of the sequence
+    /// @param[in]  first   The counter of the first sample
+    /// @param[out] results The samples
+    /// @relates Vector2D
+    void random_in_disk(std::uint32_t const        seed,
+                        std::uint32_t const        first,
+                        std::span<Vector2D<float>> results) noexcept;
+
+    /// uniformly distributed directions in the hemisphere around normal, see @ref uniform_in_hemisphere & the random_* note above
+    /// @param[in]  seed    The seed of the sequence
+    /// @param[in]  first   The counter of the first sample
+    /// @param[in]  normal  The axis of the hemisphere, must be a unit vector
+    /// @param[out] results The samples
+    /// @relates Vector3D
+    void random_in_hemisphere(std::uint32_t const        seed,
+                              std::uint32_t const        first,
+                              Vector3D<float> const &    normal,
+                              std::span<Vector3D<float>> results) noexcept;
+
+    /// uniformly distributed points in the unit sphere, see @ref uniform_in_sphere & the random_* note above
+    /// @param[in]  seed    The seed of the sequence
+    /// @param[in]  first   The counter of the first sample
+    /// @param[out] results The samples
+    /// @relates Vector3D
+    void random_in_sphere(std::uint32_t const        seed,
+                          std::uint32_t const        first,
+                          std::span<Vector3D<float>> results) noexcept;
+
+    /// uniformly distributed points on the unit sphere (i.e. directions), see @ref uniform_on_sphere & the random_* note above
+    /// @param[in]  seed    The seed of the sequence
+    /// @param[in]  first   The counter of the first sample
+    /// @param[out] results The samples
+    /// @relates Vector3D
+    void random_on_sphere(std::uint32_t const        seed,
+                          std::uint32_t const        first,
+                          std::span<Vector3D<float>> results) noexcept;
+
+    // =============================================================================
+
+    /// simplex noise of each point, see @ref simplex_noise(Vector3D<float> const &)
+    /// @param[in]  values  The points
+    /// @param[out] results The noise of each point, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector3D
+    void simplex_noise(std::span<Vector2D<float> const> const values,
+                       std::span<float> const                 results) noexcept;
+    void simplex_noise(std::span<Vector3D<float> const> const values,
+                       std::span<float> const                 results) noexcept;
+
+    /// octaves of simplex noise of each point, see @ref simplex_fbm(Vector3D<float> const &, int, float, float)
+    /// @param[in]  values     The points
+    /// @param[in]  octaves    The number of octaves
+    /// @param[in]  lacunarity The frequency multiplier of each octave (usually ~2)
+    /// @param[in]  gain       The amplitude multiplier of each octave (usually ~0.5)
+    /// @param[out] results    The noise of each point, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector3D
+    void simplex_fbm(std::span<Vector2D<float> const> const values,
+                     int const                              octaves,
+                     float const                            lacunarity,
+                     float const                            gain,
+                     std::span<float> const                 results) noexcept;
+    void simplex_fbm(std::span<Vector3D<float> const> const values,
+                     int const                              octaves,
+                     float const                            lacunarity,
+                     float const                            gain,
+                     std::span<float> const                 results) noexcept;
+
+    // =============================================================================
+
+    /// pack each vector as 10:10:10:2 signed normalized integers, see @ref snorm1010102_from_vector4D(Vector4D<float> const &)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The packed vectors, must be the same size as values
+    /// @relates Vector4D
+    void snorm1010102_from_vector4D(std::span<Vector4D<float> const> const values,
+                                    std::span<std::uint32_t> const         results) noexcept;
+
+    /// the nearest 8-bit signed normalized integer of each element of each vector, see @ref snorm8_from_float(float)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector4D
+    void snorm8_from_float(std::span<Vector4D<float> const> const values,
+                           std::span<Vector4D<std::int8_t>> const results) noexcept;
+
+    /// the nearest 16-bit signed normalized integer of each element of each vector, see @ref snorm16_from_float(float)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector4D
+    void snorm16_from_float(std::span<Vector2D<float> const> const  values,
+                            std::span<Vector2D<std::int16_t>> const results) noexcept;
+    void snorm16_from_float(std::span<Vector4D<float> const> const  values,
+                            std::span<Vector4D<std::int16_t>> const results) noexcept;
+
+    // =============================================================================
+
+    /// pack each vector as 10:10:10:2 unsigned normalized integers, see @ref unorm1010102_from_vector4D(Vector4D<float> const &)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The packed vectors, must be the same size as values
+    /// @relates Vector4D
+    void unorm1010102_from_vector4D(std::span<Vector4D<float> const> const values,
+                                    std::span<std::uint32_t> const         results) noexcept;
+
+    /// the nearest 8-bit unsigned normalized integer of each element of each vector, see @ref unorm8_from_float(float)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector4D
+    void unorm8_from_float(std::span<Vector4D<float> const> const  values,
+                           std::span<Vector4D<std::uint8_t>> const results) noexcept;
+
+    /// the nearest 16-bit unsigned normalized integer of each element of each vector, see @ref unorm16_from_float(float)
+    /// @param[in]  values  The source vectors
+    /// @param[out] results The converted vectors, must be the same size as values
+    /// @relates Vector2D
+    /// @relates Vector4D
+    void unorm16_from_float(std::span<Vector2D<float> const> const   values,
+                            std::span<Vector2D<std::uint16_t>> const results) noexcept;
+    void unorm16_from_float(std::span<Vector4D<float> const> const   values,
+                            std::span<Vector4D<std::uint16_t>> const results) noexcept;
+
+    // =============================================================================
+
+    /// decode each unit vector from 2 16-bit signed normalized integers, see @ref vector3D_from_octahedral16(Vector2D<std::int16_t> const &)
+    /// @param[in]  values  The encoded vectors
+    /// @param[out] results The decoded unit vectors, must be the same size as values
+    /// @relates Vector3D
+    void vector3D_from_octahedral16(std::span<Vector2D<std::int16_t> const> const values,
+                                    std::span<Vector3D<float>> const              results) noexcept;
+
+    /// decode each unit vector from 2 8-bit signed normalized integers, see @ref vector3D_from_octahedral8(Vector2D<std::int8_t> const &)
+    /// @param[in]  values  The encoded vectors
+    /// @param[out] results The decoded unit vectors, must be the same size as values
+    /// @relates Vector3D
+    void vector3D_from_octahedral8(std::span<Vector2D<std::int8_t> const> const values,
+                                   std::span<Vector3D<float>> const             results) noexcept;
+
+    // =============================================================================
+
+    /// unpack each vector from 10:10:10:2 signed normalized integers, see @ref vector4D_from_snorm1010102(std::uint32_t)
+    /// @param[in]  values  The packed vectors
+    /// @param[out] results The unpacked vectors, must be the same size as values
+    /// @relates Vector4D
+    void vector4D_from_snorm1010102(std::span<std::uint32_t const> const values,
+                                    std::span<Vector4D<float>> const     results) noexcept;
+
+    /// unpack each vector from 10:10:10:2 unsigned normalized integers, see @ref vector4D_from_unorm1010102(std::uint32_t)
+    /// @param[in]  values  The packed vectors
+    /// @param[out] results The unpacked vectors, must be the same size as values
+    /// @relates Vector4D
+    void vector4D_from_unorm1010102(std::span<std::uint32_t const> const values,
+                                    std::span<Vector4D<float>> const     results) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_VECTOR_BATCH_H
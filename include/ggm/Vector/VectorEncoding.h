@@ -0,0 +1,696 @@
+#pragma once
+#ifndef GGM_VECTOR_ENCODING_H
+#define GGM_VECTOR_ENCODING_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include <cstdint>
+#include <limits>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Compact encodings of vectors, see VectorBatch.h for the span versions.
+///
+/// The normalized integer (SNORM & UNORM) conversions quantize each element of a float vector, e.g. colors,
+/// tangents & texture coordinates, the same way as the D3D & Vulkan formats of the same names: a UNORM
+/// integer i represents i / max in [0, 1] & a SNORM integer represents i / max in [-1, 1]. Encoding rounds
+/// to the nearest integer & saturates, so there is no need to saturate or clamp first, see NumericUtil.h.
+///
+/// The 10:10:10:2 formats pack a Vector4D into a std::uint32_t, x in bits 0-9, y in bits 10-19, z in bits
+/// 20-29 & w in bits 30-31 (as DXGI_FORMAT_R10G10B10A2_UNORM & VK_FORMAT_A2B10G10R10_UNORM_PACK32 do), e.g.
+/// a tangent & the sign of its bitangent.
+///
+/// The octahedral encoding projects a unit vector onto the octahedron |x| + |y| + |z| == 1 & unfolds the
+/// lower half (z < 0) over the corners, which maps the sphere to the square [-1, 1]^2 with little
+/// distortion. Each of the 2 coordinates is then stored as a signed normalized integer, so:
+/// - octahedral16 is 4 bytes (3x smaller than Vector3D<float>), with a max error of about 0.004 degrees
+/// - octahedral8 is 2 bytes (6x smaller than Vector3D<float>), with a max error of about 1 degree
+///
+/// Decoding always returns a unit vector. A zero vector encodes to +z.
+///
+/// normalized integers:
+/// --------------------
+///
+/// Syntax                             | Description
+/// ------                             | -----------
+/// i = snorm8_from_float(v);          | element-wise snorm8_from_float, to a std::int8_t vector
+/// i = snorm16_from_float(v);         | element-wise snorm16_from_float, to a std::int16_t vector
+/// i = unorm8_from_float(v);          | element-wise unorm8_from_float, to a std::uint8_t vector
+/// i = unorm16_from_float(v);         | element-wise unorm16_from_float, to a std::uint16_t vector
+/// v = float_from_snorm(i);           | element-wise float_from_snorm, of a std::int8_t or std::int16_t vector
+/// v = float_from_unorm(i);           | element-wise float_from_unorm, of a std::uint8_t or std::uint16_t vector
+///
+/// packed formats:
+/// ---------------
+///
+/// Syntax                             | Description
+/// ------                             | -----------
+/// p = snorm1010102_from_vector4D(v); | pack a vector in [-1, 1] as 10:10:10:2 signed normalized integers
+/// p = unorm1010102_from_vector4D(v); | pack a vector in [0, 1] as 10:10:10:2 unsigned normalized integers
+/// v = vector4D_from_snorm1010102(p); | unpack a vector from 10:10:10:2 signed normalized integers
+/// v = vector4D_from_unorm1010102(p); | unpack a vector from 10:10:10:2 unsigned normalized integers
+///
+/// octahedral:
+/// -----------
+///
+/// Syntax                             | Description
+/// ------                             | -----------
+/// e = octahedral16_from_vector3D(v); | encode a unit vector as 2 16-bit signed normalized integers
+/// v = vector3D_from_octahedral16(e); | decode a unit vector from 2 16-bit signed normalized integers
+/// e = octahedral8_from_vector3D(v);  | encode a unit vector as 2 8-bit signed normalized integers
+/// v = vector3D_from_octahedral8(e);  | decode a unit vector from 2 8-bit signed normalized integers
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // normalized integers:
+    // =============================================================================
+
+    /// the nearest 8-bit signed normalized integer of each element, see @ref snorm8_from_float(float)
+    /// @relates Vector2D
+    constexpr Vector2D<std::int8_t> snorm8_from_float(Vector2D<float> const & value) noexcept;
+
+    /// the nearest 8-bit signed normalized integer of each element, see @ref snorm8_from_float(float)
+    /// @relates Vector3D
+    constexpr Vector3D<std::int8_t> snorm8_from_float(Vector3D<float> const & value) noexcept;
+
+    /// the nearest 8-bit signed normalized integer of each element, see @ref snorm8_from_float(float)
+    /// @relates Vector4D
+    constexpr Vector4D<std::int8_t> snorm8_from_float(Vector4D<float> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the nearest 16-bit signed normalized integer of each element, see @ref snorm16_from_float(float)
+    /// @relates Vector2D
+    constexpr Vector2D<std::int16_t> snorm16_from_float(Vector2D<float> const & value) noexcept;
+
+    /// the nearest 16-bit signed normalized integer of each element, see @ref snorm16_from_float(float)
+    /// @relates Vector3D
+    constexpr Vector3D<std::int16_t> snorm16_from_float(Vector3D<float> const & value) noexcept;
+
+    /// the nearest 16-bit signed normalized integer of each element, see @ref snorm16_from_float(float)
+    /// @relates Vector4D
+    constexpr Vector4D<std::int16_t> snorm16_from_float(Vector4D<float> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the nearest 8-bit unsigned normalized integer of each element, see @ref unorm8_from_float(float)
+    /// @relates Vector2D
+    constexpr Vector2D<std::uint8_t> unorm8_from_float(Vector2D<float> const & value) noexcept;
+
+    /// the nearest 8-bit unsigned normalized integer of each element, see @ref unorm8_from_float(float)
+    /// @relates Vector3D
+    constexpr Vector3D<std::uint8_t> unorm8_from_float(Vector3D<float> const & value) noexcept;
+
+    /// the nearest 8-bit unsigned normalized integer of each element, see @ref unorm8_from_float(float)
+    /// @relates Vector4D
+    constexpr Vector4D<std::uint8_t> unorm8_from_float(Vector4D<float> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the nearest 16-bit unsigned normalized integer of each element, see @ref unorm16_from_float(float)
+    /// @relates Vector2D
+    constexpr Vector2D<std::uint16_t> unorm16_from_float(Vector2D<float> const & value) noexcept;
+
+    /// the nearest 16-bit unsigned normalized integer of each element, see @ref unorm16_from_float(float)
+    /// @relates Vector3D
+    constexpr Vector3D<std::uint16_t> unorm16_from_float(Vector3D<float> const & value) noexcept;
+
+    /// the nearest 16-bit unsigned normalized integer of each element, see @ref unorm16_from_float(float)
+    /// @relates Vector4D
+    constexpr Vector4D<std::uint16_t> unorm16_from_float(Vector4D<float> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the float value of each signed normalized integer, see @ref float_from_snorm(std::int8_t)
+    /// @relates Vector2D
+    constexpr Vector2D<float> float_from_snorm(Vector2D<std::int8_t> const & value) noexcept;
+
+    /// the float value of each signed normalized integer, see @ref float_from_snorm(std::int8_t)
+    /// @relates Vector3D
+    constexpr Vector3D<float> float_from_snorm(Vector3D<std::int8_t> const & value) noexcept;
+
+    /// the float value of each signed normalized integer, see @ref float_from_snorm(std::int8_t)
+    /// @relates Vector4D
+    constexpr Vector4D<float> float_from_snorm(Vector4D<std::int8_t> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the float value of each signed normalized integer, see @ref float_from_snorm(std::int16_t)
+    /// @relates Vector2D
+    constexpr Vector2D<float> float_from_snorm(Vector2D<std::int16_t> const & value) noexcept;
+
+    /// the float value of each signed normalized integer, see @ref float_from_snorm(std::int16_t)
+    /// @relates Vector3D
+    constexpr Vector3D<float> float_from_snorm(Vector3D<std::int16_t> const & value) noexcept;
+
+    /// the float value of each signed normalized integer, see @ref float_from_snorm(std::int16_t)
+    /// @relates Vector4D
+    constexpr Vector4D<float> float_from_snorm(Vector4D<std::int16_t> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the float value of each unsigned normalized integer, see @ref float_from_unorm(std::uint8_t)
+    /// @relates Vector2D
+    constexpr Vector2D<float> float_from_unorm(Vector2D<std::uint8_t> const & value) noexcept;
+
+    /// the float value of each unsigned normalized integer, see @ref float_from_unorm(std::uint8_t)
+    /// @relates Vector3D
+    constexpr Vector3D<float> float_from_unorm(Vector3D<std::uint8_t> const & value) noexcept;
+
+    /// the float value of each unsigned normalized integer, see @ref float_from_unorm(std::uint8_t)
+    /// @relates Vector4D
+    constexpr Vector4D<float> float_from_unorm(Vector4D<std::uint8_t> const & value) noexcept;
+
+    // =============================================================================
+
+    /// the float value of each unsigned normalized integer, see @ref float_from_unorm(std::uint16_t)
+    /// @relates Vector2D
+    constexpr Vector2D<float> float_from_unorm(Vector2D<std::uint16_t> const & value) noexcept;
+
+    /// the float value of each unsigned normalized integer, see @ref float_from_unorm(std::uint16_t)
+    /// @relates Vector3D
+    constexpr Vector3D<float> float_from_unorm(Vector3D<std::uint16_t> const & value) noexcept;
+
+    /// the float value of each unsigned normalized integer, see @ref float_from_unorm(std::uint16_t)
+    /// @relates Vector4D
+    constexpr Vector4D<float> float_from_unorm(Vector4D<std::uint16_t> const & value) noexcept;
+
+    // =============================================================================
+
+    // packed formats:
+    // =============================================================================
+
+    /// pack a vector in [-1, 1] as 10:10:10:2 signed normalized integers, i.e. x, y & z are rounded to the
+    /// nearest i / 511 & w to -1, 0 or 1 (e.g. the sign of a bitangent), saturating as snorm8_from_float does
+    /// @relates Vector4D
+    constexpr std::uint32_t snorm1010102_from_vector4D(Vector4D<float> const & value) noexcept;
+
+    /// pack a vector in [0, 1] as 10:10:10:2 unsigned normalized integers, i.e. x, y & z are rounded to the
+    /// nearest i / 1023 & w to the nearest i / 3, saturating as unorm8_from_float does
+    /// @relates Vector4D
+    constexpr std::uint32_t unorm1010102_from_vector4D(Vector4D<float> const & value) noexcept;
+
+    /// unpack a vector from 10:10:10:2 signed normalized integers, see @ref snorm1010102_from_vector4D
+    /// @relates Vector4D
+    constexpr Vector4D<float> vector4D_from_snorm1010102(std::uint32_t const value) noexcept;
+
+    /// unpack a vector from 10:10:10:2 unsigned normalized integers, see @ref unorm1010102_from_vector4D
+    /// @relates Vector4D
+    constexpr Vector4D<float> vector4D_from_unorm1010102(std::uint32_t const value) noexcept;
+
+    // =============================================================================
+    // octahedral:
+    // =============================================================================
+
+    /// encode a unit vector in the octahedral encoding, as 2 16-bit signed normalized integers
+    /// @relates Vector3D
+    constexpr Vector2D<std::int16_t> octahedral16_from_vector3D(Vector3D<float> const & value) noexcept;
+
+    /// decode a unit vector from the octahedral encoding, as 2 16-bit signed normalized integers
+    /// @relates Vector3D
+    constexpr Vector3D<float> vector3D_from_octahedral16(Vector2D<std::int16_t> const & value) noexcept;
+
+    // =============================================================================
+
+    /// encode a unit vector in the octahedral encoding, as 2 8-bit signed normalized integers
+    /// @relates Vector3D
+    constexpr Vector2D<std::int8_t> octahedral8_from_vector3D(Vector3D<float> const & value) noexcept;
+
+    /// decode a unit vector from the octahedral encoding, as 2 8-bit signed normalized integers
+    /// @relates Vector3D
+    constexpr Vector3D<float> vector3D_from_octahedral8(Vector2D<std::int8_t> const & value) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::VectorEncodingImpl
+{
+    // =============================================================================
+
+    constexpr float sign_not_zero(float const value) noexcept
+    {
+        return (value < 0.0f) ? -1.0f : 1.0f;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// map a unit vector to the square [-1, 1]^2
+    constexpr Vector2D<float> octahedral_from_vector3D(Vector3D<float> const & value) noexcept
+    {
+        // note: every case is computed & selected with ternaries (rather than branches), so compilers are
+        // able to vectorize loops over these functions
+        float const l1Norm    = abs(value.x) + abs(value.y) + abs(value.z);
+        float const l1Inverse = 1.0f / (l1Norm + std::numeric_limits<float>::min()); // a zero vector stays zero
+        float const x         = value.x * l1Inverse;
+        float const y         = value.y * l1Inverse;
+        float const foldedX   = (1.0f - abs(y)) * sign_not_zero(x);
+        float const foldedY   = (1.0f - abs(x)) * sign_not_zero(y);
+        bool const  isLower   = value.z < 0.0f;
+
+        return Vector2D<float>{
+            isLower ? foldedX : x,
+            isLower ? foldedY : y,
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// map a point of the square [-1, 1]^2 to a unit vector
+    constexpr Vector3D<float> vector3D_from_octahedral(Vector2D<float> const & value) noexcept
+    {
+        float const z      = 1.0f - abs(value.x) - abs(value.y);
+        float const folded = (z < 0.0f) ? -z : 0.0f;
+        float const x      = value.x - folded * sign_not_zero(value.x);
+        float const y      = value.y - folded * sign_not_zero(value.y);
+
+        // note: the length is at least 1 / sqrt(3), so no zero check is needed
+        return Vector3D<float>{ x, y, z } / length(Vector3D<float>{ x, y, z });
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the bits of a 10:10:10:2 element, from its (signed or unsigned) integer
+    template <int Shift, int Bits>
+    constexpr std::uint32_t pack_bits(std::int32_t const value) noexcept
+    {
+        constexpr std::uint32_t Mask = (std::uint32_t{ 1 } << Bits) - 1u;
+
+        return (static_cast<std::uint32_t>(value) & Mask) << Shift;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the signed integer of a 10:10:10:2 element, from its bits
+    template <int Shift, int Bits>
+    constexpr std::int32_t unpack_signed_bits(std::uint32_t const value) noexcept
+    {
+        // shift the element to the top bits, then sign extend it with an arithmetic shift
+        return static_cast<std::int32_t>(value << (32 - Shift - Bits)) >> (32 - Bits);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the unsigned integer of a 10:10:10:2 element, from its bits
+    /// note: std::int32_t (rather than std::uint32_t), which compilers are able to convert to float with SIMD
+    /// instructions of every level
+    template <int Shift, int Bits>
+    constexpr std::int32_t unpack_unsigned_bits(std::uint32_t const value) noexcept
+    {
+        constexpr std::uint32_t Mask = (std::uint32_t{ 1 } << Bits) - 1u;
+
+        return static_cast<std::int32_t>((value >> Shift) & Mask);
+    }
+
+    // =============================================================================
+} // namespace ggm::VectorEncodingImpl
+
+// =============================================================================
+// normalized integers:
+// =============================================================================
+
+constexpr ggm::Vector2D<std::int8_t> ggm::snorm8_from_float(Vector2D<float> const & value) noexcept
+{
+    return Vector2D<std::int8_t>{
+        snorm8_from_float(value.x),
+        snorm8_from_float(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<std::int8_t> ggm::snorm8_from_float(Vector3D<float> const & value) noexcept
+{
+    return Vector3D<std::int8_t>{
+        snorm8_from_float(value.x),
+        snorm8_from_float(value.y),
+        snorm8_from_float(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<std::int8_t> ggm::snorm8_from_float(Vector4D<float> const & value) noexcept
+{
+    return Vector4D<std::int8_t>{
+        snorm8_from_float(value.x),
+        snorm8_from_float(value.y),
+        snorm8_from_float(value.z),
+        snorm8_from_float(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<std::int16_t> ggm::snorm16_from_float(Vector2D<float> const & value) noexcept
+{
+    return Vector2D<std::int16_t>{
+        snorm16_from_float(value.x),
+        snorm16_from_float(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<std::int16_t> ggm::snorm16_from_float(Vector3D<float> const & value) noexcept
+{
+    return Vector3D<std::int16_t>{
+        snorm16_from_float(value.x),
+        snorm16_from_float(value.y),
+        snorm16_from_float(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<std::int16_t> ggm::snorm16_from_float(Vector4D<float> const & value) noexcept
+{
+    return Vector4D<std::int16_t>{
+        snorm16_from_float(value.x),
+        snorm16_from_float(value.y),
+        snorm16_from_float(value.z),
+        snorm16_from_float(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<std::uint8_t> ggm::unorm8_from_float(Vector2D<float> const & value) noexcept
+{
+    return Vector2D<std::uint8_t>{
+        unorm8_from_float(value.x),
+        unorm8_from_float(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<std::uint8_t> ggm::unorm8_from_float(Vector3D<float> const & value) noexcept
+{
+    return Vector3D<std::uint8_t>{
+        unorm8_from_float(value.x),
+        unorm8_from_float(value.y),
+        unorm8_from_float(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<std::uint8_t> ggm::unorm8_from_float(Vector4D<float> const & value) noexcept
+{
+    return Vector4D<std::uint8_t>{
+        unorm8_from_float(value.x),
+        unorm8_from_float(value.y),
+        unorm8_from_float(value.z),
+        unorm8_from_float(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<std::uint16_t> ggm::unorm16_from_float(Vector2D<float> const & value) noexcept
+{
+    return Vector2D<std::uint16_t>{
+        unorm16_from_float(value.x),
+        unorm16_from_float(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<std::uint16_t> ggm::unorm16_from_float(Vector3D<float> const & value) noexcept
+{
+    return Vector3D<std::uint16_t>{
+        unorm16_from_float(value.x),
+        unorm16_from_float(value.y),
+        unorm16_from_float(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<std::uint16_t> ggm::unorm16_from_float(Vector4D<float> const & value) noexcept
+{
+    return Vector4D<std::uint16_t>{
+        unorm16_from_float(value.x),
+        unorm16_from_float(value.y),
+        unorm16_from_float(value.z),
+        unorm16_from_float(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::float_from_snorm(Vector2D<std::int8_t> const & value) noexcept
+{
+    return Vector2D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::float_from_snorm(Vector3D<std::int8_t> const & value) noexcept
+{
+    return Vector3D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+        float_from_snorm(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::float_from_snorm(Vector4D<std::int8_t> const & value) noexcept
+{
+    return Vector4D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+        float_from_snorm(value.z),
+        float_from_snorm(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::float_from_snorm(Vector2D<std::int16_t> const & value) noexcept
+{
+    return Vector2D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::float_from_snorm(Vector3D<std::int16_t> const & value) noexcept
+{
+    return Vector3D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+        float_from_snorm(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::float_from_snorm(Vector4D<std::int16_t> const & value) noexcept
+{
+    return Vector4D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+        float_from_snorm(value.z),
+        float_from_snorm(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::float_from_unorm(Vector2D<std::uint8_t> const & value) noexcept
+{
+    return Vector2D<float>{
+        float_from_unorm(value.x),
+        float_from_unorm(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::float_from_unorm(Vector3D<std::uint8_t> const & value) noexcept
+{
+    return Vector3D<float>{
+        float_from_unorm(value.x),
+        float_from_unorm(value.y),
+        float_from_unorm(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::float_from_unorm(Vector4D<std::uint8_t> const & value) noexcept
+{
+    return Vector4D<float>{
+        float_from_unorm(value.x),
+        float_from_unorm(value.y),
+        float_from_unorm(value.z),
+        float_from_unorm(value.w),
+    };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::float_from_unorm(Vector2D<std::uint16_t> const & value) noexcept
+{
+    return Vector2D<float>{
+        float_from_unorm(value.x),
+        float_from_unorm(value.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::float_from_unorm(Vector3D<std::uint16_t> const & value) noexcept
+{
+    return Vector3D<float>{
+        float_from_unorm(value.x),
+        float_from_unorm(value.y),
+        float_from_unorm(value.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::float_from_unorm(Vector4D<std::uint16_t> const & value) noexcept
+{
+    return Vector4D<float>{
+        float_from_unorm(value.x),
+        float_from_unorm(value.y),
+        float_from_unorm(value.z),
+        float_from_unorm(value.w),
+    };
+}
+
+// =============================================================================
+// packed formats:
+// =============================================================================
+
+constexpr std::uint32_t ggm::snorm1010102_from_vector4D(Vector4D<float> const & value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    return pack_bits<0, 10>(NumericImpl::snorm_from_float<std::int32_t, 511>(value.x)) |
+           pack_bits<10, 10>(NumericImpl::snorm_from_float<std::int32_t, 511>(value.y)) |
+           pack_bits<20, 10>(NumericImpl::snorm_from_float<std::int32_t, 511>(value.z)) |
+           pack_bits<30, 2>(NumericImpl::snorm_from_float<std::int32_t, 1>(value.w));
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint32_t ggm::unorm1010102_from_vector4D(Vector4D<float> const & value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    return pack_bits<0, 10>(NumericImpl::unorm_from_float<std::int32_t, 1023>(value.x)) |
+           pack_bits<10, 10>(NumericImpl::unorm_from_float<std::int32_t, 1023>(value.y)) |
+           pack_bits<20, 10>(NumericImpl::unorm_from_float<std::int32_t, 1023>(value.z)) |
+           pack_bits<30, 2>(NumericImpl::unorm_from_float<std::int32_t, 3>(value.w));
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::vector4D_from_snorm1010102(std::uint32_t const value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    return Vector4D<float>{
+        NumericImpl::float_from_snorm<std::int32_t, 511>(unpack_signed_bits<0, 10>(value)),
+        NumericImpl::float_from_snorm<std::int32_t, 511>(unpack_signed_bits<10, 10>(value)),
+        NumericImpl::float_from_snorm<std::int32_t, 511>(unpack_signed_bits<20, 10>(value)),
+        NumericImpl::float_from_snorm<std::int32_t, 1>(unpack_signed_bits<30, 2>(value)),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::vector4D_from_unorm1010102(std::uint32_t const value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    return Vector4D<float>{
+        NumericImpl::float_from_unorm<std::int32_t, 1023>(unpack_unsigned_bits<0, 10>(value)),
+        NumericImpl::float_from_unorm<std::int32_t, 1023>(unpack_unsigned_bits<10, 10>(value)),
+        NumericImpl::float_from_unorm<std::int32_t, 1023>(unpack_unsigned_bits<20, 10>(value)),
+        NumericImpl::float_from_unorm<std::int32_t, 3>(unpack_unsigned_bits<30, 2>(value)),
+    };
+}
+
+// =============================================================================
+// octahedral:
+// =============================================================================
+
+constexpr ggm::Vector2D<std::int16_t> ggm::octahedral16_from_vector3D(Vector3D<float> const & value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    Vector2D<float> const octahedral = octahedral_from_vector3D(value);
+
+    return Vector2D<std::int16_t>{
+        snorm16_from_float(octahedral.x),
+        snorm16_from_float(octahedral.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::vector3D_from_octahedral16(Vector2D<std::int16_t> const & value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    return vector3D_from_octahedral(Vector2D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+    });
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<std::int8_t> ggm::octahedral8_from_vector3D(Vector3D<float> const & value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    Vector2D<float> const octahedral = octahedral_from_vector3D(value);
+
+    return Vector2D<std::int8_t>{
+        snorm8_from_float(octahedral.x),
+        snorm8_from_float(octahedral.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::vector3D_from_octahedral8(Vector2D<std::int8_t> const & value) noexcept
+{
+    using namespace VectorEncodingImpl;
+
+    return vector3D_from_octahedral(Vector2D<float>{
+        float_from_snorm(value.x),
+        float_from_snorm(value.y),
+    });
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_ENCODING_H
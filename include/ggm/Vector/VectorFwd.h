@@ -2,6 +2,8 @@
 #ifndef GGM_VECTOR_FWD_H
 #define GGM_VECTOR_FWD_H
 
+#include <cstddef>
+
 // =============================================================================
 
 namespace ggm
@@ -19,6 +21,39 @@ namespace ggm
     template <typename T>
     struct Vector4D;
 
+    // =============================================================================
+    // Forward declarations for Vector3DA type:
+    // =============================================================================
+
+    template <typename T>
+    struct Vector3DA;
+
+    // =============================================================================
+    // Forward declarations for Vector3DSoA, and Vector4DSoA types:
+    // =============================================================================
+
+    template <typename T>
+    struct Vector3DSoA;
+
+    template <typename T>
+    struct Vector4DSoA;
+
+    // =============================================================================
+    // Forward declarations for Vector3DPacket, Vector4DPacket, Vector3DPacketArray, and Vector4DPacketArray types:
+    // =============================================================================
+
+    template <typename T, std::size_t N>
+    struct Vector3DPacket;
+
+    template <typename T, std::size_t N>
+    struct Vector4DPacket;
+
+    template <typename T, std::size_t N>
+    struct Vector3DPacketArray;
+
+    template <typename T, std::size_t N>
+    struct Vector4DPacketArray;
+
     // =============================================================================
 } // namespace ggm
 
@@ -0,0 +1,244 @@
+#pragma once
+#ifndef GGM_VECTOR_HASH_H
+#define GGM_VECTOR_HASH_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Numeric/Random.h"
+#include "ggm/Vector/Vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Hashing of vectors & of the cells of a uniform grid, e.g. for spatial lookups in hash tables.
+///
+/// The std::hash specializations hash the exact element values (like std::hash of the elements, so +0 & -0
+/// have the same hash), for std::unordered_map etc. with keys that compare equal with ==.
+///
+/// Points within some epsilon of each other generally don't have the same exact hash, so spatial lookups
+/// quantize the points to grid cells (quantize, with cells of size >= epsilon) & hash the cells (cell_hash),
+/// then compare against the points of the neighboring cells too, see weld_vertices in VectorMesh.h.
+///
+/// Syntax                              | Description
+/// ------                              | -----------
+/// h = std::hash<Vector3D<T>>{}(v);    | hash of the exact elements of a Vector2D, Vector3D or Vector4D
+/// c = quantize(v, cellSize);          | the grid cell of a Vector2D<float> or Vector3D<float> point
+/// h = cell_hash(c);                   | 32-bit hash of a Vector2D<std::int32_t> or Vector3D<std::int32_t> cell
+/// h = quantized_hash(v, cellSize);    | cell_hash(quantize(v, cellSize))
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // quantize:
+    // =============================================================================
+
+    /// the grid cell of a point, i.e. floor(value / cellSize)
+    /// @details the cells must be within the range of std::int32_t (asserted), i.e. abs(value) / cellSize < 2^31
+    /// @relates Vector2D
+    constexpr Vector2D<std::int32_t> quantize(Vector2D<float> const & value,
+                                              float const             cellSize) noexcept;
+
+    /// the grid cell of a point, i.e. floor(value / cellSize)
+    /// @details the cells must be within the range of std::int32_t (asserted), i.e. abs(value) / cellSize < 2^31
+    /// @relates Vector3D
+    constexpr Vector3D<std::int32_t> quantize(Vector3D<float> const & value,
+                                              float const             cellSize) noexcept;
+
+    // =============================================================================
+    // hash:
+    // =============================================================================
+
+    /// 32-bit hash of a grid cell
+    /// @relates Vector2D
+    constexpr std::uint32_t cell_hash(Vector2D<std::int32_t> const & cell) noexcept;
+
+    /// 32-bit hash of a grid cell
+    /// @relates Vector3D
+    constexpr std::uint32_t cell_hash(Vector3D<std::int32_t> const & cell) noexcept;
+
+    /// 32-bit hash of the grid cell of a point, i.e. cell_hash(quantize(value, cellSize))
+    /// @relates Vector2D
+    constexpr std::uint32_t quantized_hash(Vector2D<float> const & value,
+                                           float const             cellSize) noexcept;
+
+    /// 32-bit hash of the grid cell of a point, i.e. cell_hash(quantize(value, cellSize))
+    /// @relates Vector3D
+    constexpr std::uint32_t quantized_hash(Vector3D<float> const & value,
+                                           float const             cellSize) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// std::hash:
+// =============================================================================
+
+/// hash of the exact elements of a Vector2D
+template <typename T>
+struct std::hash<ggm::Vector2D<T>>
+{
+    std::size_t operator()(ggm::Vector2D<T> const & value) const noexcept;
+};
+
+/// hash of the exact elements of a Vector3D
+template <typename T>
+struct std::hash<ggm::Vector3D<T>>
+{
+    std::size_t operator()(ggm::Vector3D<T> const & value) const noexcept;
+};
+
+/// hash of the exact elements of a Vector4D
+template <typename T>
+struct std::hash<ggm::Vector4D<T>>
+{
+    std::size_t operator()(ggm::Vector4D<T> const & value) const noexcept;
+};
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::VectorHashImpl
+{
+    // =============================================================================
+
+    /// combine the hash of the next element into seed (boost's hash_combine, with the 64-bit golden ratio)
+    constexpr std::size_t hash_combine(std::size_t const seed,
+                                       std::size_t const hash) noexcept
+    {
+        return seed ^ (hash + static_cast<std::size_t>(0x9E3779B97F4A7C15u) + (seed << 6u) + (seed >> 2u));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the cell coordinate of value * scale
+    constexpr std::int32_t cell_from_float(float const value,
+                                           float const scale) noexcept
+    {
+        // note: the float -> int conversion is undefined beyond the range of std::int32_t (& x86 gives INT_MIN for
+        // all of them, i.e. every such point would be in a single cell)
+        float const cell = floor(value * scale);
+        assert((cell >= -0x1p31f) && (cell < 0x1p31f));
+
+        return static_cast<std::int32_t>(cell);
+    }
+
+    // =============================================================================
+} // namespace ggm::VectorHashImpl
+
+// =============================================================================
+// quantize:
+// =============================================================================
+
+constexpr ggm::Vector2D<std::int32_t> ggm::quantize(Vector2D<float> const & value,
+                                                    float const             cellSize) noexcept
+{
+    assert(cellSize > 0.0f);
+
+    float const scale = 1.0f / cellSize;
+    return Vector2D<std::int32_t>{
+        VectorHashImpl::cell_from_float(value.x, scale),
+        VectorHashImpl::cell_from_float(value.y, scale),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<std::int32_t> ggm::quantize(Vector3D<float> const & value,
+                                                    float const             cellSize) noexcept
+{
+    assert(cellSize > 0.0f);
+
+    float const scale = 1.0f / cellSize;
+    return Vector3D<std::int32_t>{
+        VectorHashImpl::cell_from_float(value.x, scale),
+        VectorHashImpl::cell_from_float(value.y, scale),
+        VectorHashImpl::cell_from_float(value.z, scale),
+    };
+}
+
+// =============================================================================
+// hash:
+// =============================================================================
+
+constexpr std::uint32_t ggm::cell_hash(Vector2D<std::int32_t> const & cell) noexcept
+{
+    // note: nested pcg_hash (rather than combining the coordinates first, e.g. with Teschner et al's primes,
+    // which collide for small coordinates), so distinct cells of each row have distinct hashes
+    std::uint32_t const x = static_cast<std::uint32_t>(cell.x);
+    std::uint32_t const y = static_cast<std::uint32_t>(cell.y);
+    return pcg_hash(y + pcg_hash(x));
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint32_t ggm::cell_hash(Vector3D<std::int32_t> const & cell) noexcept
+{
+    // note: nested pcg_hash (rather than combining the coordinates first, e.g. with Teschner et al's primes,
+    // which collide for small coordinates), so distinct cells of each row have distinct hashes
+    std::uint32_t const x = static_cast<std::uint32_t>(cell.x);
+    std::uint32_t const y = static_cast<std::uint32_t>(cell.y);
+    std::uint32_t const z = static_cast<std::uint32_t>(cell.z);
+    return pcg_hash(z + pcg_hash(y + pcg_hash(x)));
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint32_t ggm::quantized_hash(Vector2D<float> const & value,
+                                            float const             cellSize) noexcept
+{
+    return cell_hash(quantize(value, cellSize));
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint32_t ggm::quantized_hash(Vector3D<float> const & value,
+                                            float const             cellSize) noexcept
+{
+    return cell_hash(quantize(value, cellSize));
+}
+
+// =============================================================================
+// std::hash:
+// =============================================================================
+
+template <typename T>
+std::size_t std::hash<ggm::Vector2D<T>>::operator()(ggm::Vector2D<T> const & value) const noexcept
+{
+    std::hash<T> const elementHash;
+    return ggm::VectorHashImpl::hash_combine(elementHash(value.x), elementHash(value.y));
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+std::size_t std::hash<ggm::Vector3D<T>>::operator()(ggm::Vector3D<T> const & value) const noexcept
+{
+    std::hash<T> const elementHash;
+    std::size_t const  seed = ggm::VectorHashImpl::hash_combine(elementHash(value.x), elementHash(value.y));
+    return ggm::VectorHashImpl::hash_combine(seed, elementHash(value.z));
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+std::size_t std::hash<ggm::Vector4D<T>>::operator()(ggm::Vector4D<T> const & value) const noexcept
+{
+    std::hash<T> const elementHash;
+    std::size_t const  seed0 = ggm::VectorHashImpl::hash_combine(elementHash(value.x), elementHash(value.y));
+    std::size_t const  seed1 = ggm::VectorHashImpl::hash_combine(seed0, elementHash(value.z));
+    return ggm::VectorHashImpl::hash_combine(seed1, elementHash(value.w));
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_HASH_H
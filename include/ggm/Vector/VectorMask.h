@@ -0,0 +1,328 @@
+#pragma once
+#ifndef GGM_VECTOR_MASK_H
+#define GGM_VECTOR_MASK_H
+
+#include "ggm/Vector/Vector.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Bit-packed masks & branch-free mask reductions.
+///
+/// A bitmask packs the elements of a bool vector (e.g. the result of is_less, see VectorUtil.h) into the low
+/// bits of an unsigned int, bit i == element i (like the SSE movemask instructions), so a Vector4D<bool>
+/// becomes a 4-bit integer that can be stored, compared or switched on as a single value.
+///
+/// The span reductions accumulate every element without an early exit (unlike std::all_of etc.), so
+/// compilers are able to auto-vectorize them, e.g. to test a predicate computed for thousands of objects.
+///
+/// bitmasks:
+/// ---------
+///
+/// Syntax                          | Description
+/// ------                          | -----------
+/// bits = bitmask(b);              | pack a bool vector into bits, bit i == element i
+/// b = vector2D_from_bitmask(bits) | unpack the low 2 bits into a bool vector
+/// b = vector3D_from_bitmask(bits) | unpack the low 3 bits into a bool vector
+/// b = vector4D_from_bitmask(bits) | unpack the low 4 bits into a bool vector
+/// bitmask(bs, bits);              | pack each bool vector of a span into bits
+/// bitmask(bs, words);             | pack a span of bools into 64-bit words, bit i of words[j] == bs[64 * j + i]
+///
+/// reductions:
+/// -----------
+///
+/// Syntax                          | Description
+/// ------                          | -----------
+/// b = all_of(bs);                 | true if all bools of a span are true (or the span is empty)
+/// b = any_of(bs);                 | true if any bools of a span are true
+/// b = none_of(bs);                | true if all bools of a span are false (or the span is empty)
+/// n = count_of(bs);               | number of bools of a span that are true
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // bitmasks:
+    // =============================================================================
+
+    /// pack a bool vector into bits, bit i == element i
+    /// @relates Vector2D
+    constexpr unsigned int bitmask(Vector2D<bool> const & value) noexcept;
+
+    /// pack a bool vector into bits, bit i == element i
+    /// @relates Vector3D
+    constexpr unsigned int bitmask(Vector3D<bool> const & value) noexcept;
+
+    /// pack a bool vector into bits, bit i == element i
+    /// @relates Vector4D
+    constexpr unsigned int bitmask(Vector4D<bool> const & value) noexcept;
+
+    /// pack each bool vector of values into bits, bit i == element i
+    /// @param[in]  values  The source bool vectors
+    /// @param[out] results The bitmasks, must be the same size as values
+    /// @relates Vector2D
+    constexpr void bitmask(std::span<Vector2D<bool> const> const values,
+                           std::span<unsigned int> const         results) noexcept;
+
+    /// pack each bool vector of values into bits, bit i == element i
+    /// @param[in]  values  The source bool vectors
+    /// @param[out] results The bitmasks, must be the same size as values
+    /// @relates Vector3D
+    constexpr void bitmask(std::span<Vector3D<bool> const> const values,
+                           std::span<unsigned int> const         results) noexcept;
+
+    /// pack each bool vector of values into bits, bit i == element i
+    /// @param[in]  values  The source bool vectors
+    /// @param[out] results The bitmasks, must be the same size as values
+    /// @relates Vector4D
+    constexpr void bitmask(std::span<Vector4D<bool> const> const values,
+                           std::span<unsigned int> const         results) noexcept;
+
+    /// pack a span of bools into 64-bit words, bit i of results[j] == values[64 * j + i]
+    /// @param[in]  values  The source bools
+    /// @param[out] results The packed bits, must be (values.size() + 63) / 64 words, the unused bits of the last word are zero
+    constexpr void bitmask(std::span<bool const> const    values,
+                           std::span<std::uint64_t> const results) noexcept;
+
+    // =============================================================================
+
+    /// unpack the low 2 bits into a bool vector, element i == bit i
+    /// @relates Vector2D
+    constexpr Vector2D<bool> vector2D_from_bitmask(unsigned int const bits) noexcept;
+
+    /// unpack the low 3 bits into a bool vector, element i == bit i
+    /// @relates Vector3D
+    constexpr Vector3D<bool> vector3D_from_bitmask(unsigned int const bits) noexcept;
+
+    /// unpack the low 4 bits into a bool vector, element i == bit i
+    /// @relates Vector4D
+    constexpr Vector4D<bool> vector4D_from_bitmask(unsigned int const bits) noexcept;
+
+    // =============================================================================
+    // reductions:
+    // =============================================================================
+
+    /// true if all bools of values are true (or values is empty)
+    constexpr bool all_of(std::span<bool const> const values) noexcept;
+
+    /// true if any bools of values are true
+    constexpr bool any_of(std::span<bool const> const values) noexcept;
+
+    /// true if all bools of values are false (or values is empty)
+    constexpr bool none_of(std::span<bool const> const values) noexcept;
+
+    /// number of bools of values that are true
+    constexpr std::size_t count_of(std::span<bool const> const values) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::VectorMaskImpl
+{
+    // =============================================================================
+
+    // note: GCC doesn't vectorize conversions from bool, but does vectorize the same loops over its byte
+    constexpr std::uint8_t byte_from_bool(bool const value) noexcept
+    {
+        return std::bit_cast<std::uint8_t>(value);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr void bitmask(std::span<T const> const      values,
+                           std::span<unsigned int> const results) noexcept
+    {
+        assert(results.size() == values.size());
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = ggm::bitmask(values[i]);
+        }
+    }
+
+    // =============================================================================
+} // namespace ggm::VectorMaskImpl
+
+// =============================================================================
+// bitmasks:
+// =============================================================================
+
+constexpr unsigned int ggm::bitmask(Vector2D<bool> const & value) noexcept
+{
+    return (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.x)) << 0u) |
+           (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.y)) << 1u);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr unsigned int ggm::bitmask(Vector3D<bool> const & value) noexcept
+{
+    return (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.x)) << 0u) |
+           (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.y)) << 1u) |
+           (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.z)) << 2u);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr unsigned int ggm::bitmask(Vector4D<bool> const & value) noexcept
+{
+    return (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.x)) << 0u) |
+           (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.y)) << 1u) |
+           (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.z)) << 2u) |
+           (static_cast<unsigned int>(VectorMaskImpl::byte_from_bool(value.w)) << 3u);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::bitmask(std::span<Vector2D<bool> const> const values,
+                            std::span<unsigned int> const         results) noexcept
+{
+    VectorMaskImpl::bitmask(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::bitmask(std::span<Vector3D<bool> const> const values,
+                            std::span<unsigned int> const         results) noexcept
+{
+    VectorMaskImpl::bitmask(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::bitmask(std::span<Vector4D<bool> const> const values,
+                            std::span<unsigned int> const         results) noexcept
+{
+    VectorMaskImpl::bitmask(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::bitmask(std::span<bool const> const    values,
+                            std::span<std::uint64_t> const results) noexcept
+{
+    assert(results.size() == (values.size() + 63) / 64);
+
+    std::size_t const count     = values.size();
+    std::size_t const wordCount = results.size();
+    for (std::size_t word = 0; word < wordCount; ++word)
+    {
+        std::size_t const first = word * 64;
+        std::size_t const last  = (count - first < 64) ? count : first + 64;
+
+        std::uint64_t bits = 0;
+        for (std::size_t i = first; i < last; ++i)
+        {
+            bits |= static_cast<std::uint64_t>(VectorMaskImpl::byte_from_bool(values[i])) << (i - first);
+        }
+
+        results[word] = bits;
+    }
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<bool> ggm::vector2D_from_bitmask(unsigned int const bits) noexcept
+{
+    return Vector2D<bool>{
+        (bits & 0x1u) != 0,
+        (bits & 0x2u) != 0,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<bool> ggm::vector3D_from_bitmask(unsigned int const bits) noexcept
+{
+    return Vector3D<bool>{
+        (bits & 0x1u) != 0,
+        (bits & 0x2u) != 0,
+        (bits & 0x4u) != 0,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<bool> ggm::vector4D_from_bitmask(unsigned int const bits) noexcept
+{
+    return Vector4D<bool>{
+        (bits & 0x1u) != 0,
+        (bits & 0x2u) != 0,
+        (bits & 0x4u) != 0,
+        (bits & 0x8u) != 0,
+    };
+}
+
+// =============================================================================
+// reductions:
+// =============================================================================
+
+constexpr bool ggm::all_of(std::span<bool const> const values) noexcept
+{
+    std::uint8_t result = 1;
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        result &= VectorMaskImpl::byte_from_bool(values[i]);
+    }
+
+    return result != 0;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr bool ggm::any_of(std::span<bool const> const values) noexcept
+{
+    std::uint8_t result = 0;
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        result |= VectorMaskImpl::byte_from_bool(values[i]);
+    }
+
+    return result != 0;
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr bool ggm::none_of(std::span<bool const> const values) noexcept
+{
+    return !any_of(values);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::size_t ggm::count_of(std::span<bool const> const values) noexcept
+{
+    std::size_t result = 0;
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        result += VectorMaskImpl::byte_from_bool(values[i]);
+    }
+
+    return result;
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_MASK_H
@@ -0,0 +1,669 @@
+#pragma once
+#ifndef GGM_VECTOR_MESH_H
+#define GGM_VECTOR_MESH_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorHash.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Vertex normals & tangents of indexed triangle meshes, i.e. positions (& uvs) per vertex plus an index
+/// buffer with 3 vertex indices per triangle (counter-clockwise triangles face the viewer).
+///
+/// The normals & tangents are gathered rather than scattered: make_vertex_adjacency lists the triangle
+/// corners of each vertex (a serial counting sort, which can be reused while the topology doesn't change),
+/// then each vertex sums the contributions of its own corners. So each result only reads the mesh & writes
+/// its own element, i.e. disjoint ranges of vertices can be processed by separate threads (with the
+/// firstVertex overloads) without atomics or locks, & the results don't depend on the split.
+///
+/// The tangents follow MikkTSpace (Mikkelsen, "Simulation of Wrinkled Surfaces Revisited", 2008): the uv
+/// tangent of each corner is projected onto the plane of the vertex normal & weighted by the corner angle,
+/// & w is the handedness, i.e. bitangent = w * cross(normal, tangent.xyz). Unlike MikkTSpace, vertices aren't
+/// split where the uv mapping is discontinuous (e.g. at mirrored uvs), so the results match it for meshes
+/// whose vertices are already split at uv seams.
+///
+/// weld_vertices merges the vertices within epsilon of an earlier vertex (& optionally with attributes within
+/// their own epsilons), e.g. the duplicated vertices of imported meshes. The vertices are quantized to a hash
+/// grid with cells of size 2 * epsilon (or of exact positions with epsilon 0), so each vertex only compares
+/// against the vertices of the 8 cells nearest to it, & the grid is an open addressing table (linear probing
+/// of 32-bit vertex indices, rather than std::unordered_map's nodes), i.e. welding takes ~linear time for any
+/// epsilon smaller than the features of the mesh. The cells are at least 2^-30 of the largest position element
+/// (so that the cells are within the range of std::int32_t), which only crowds vertices ~2^7 closer together
+/// than the float spacing of that element. Welding is greedy, i.e. a vertex merges with the first unique
+/// vertex it is within epsilon of, even if that vertex is within epsilon of another unique vertex.
+///
+/// Syntax                                                   | Description
+/// ------                                                   | -----------
+/// make_vertex_adjacency(indices, count, adj);              | list the triangle corners of each vertex
+/// vertex_normals(ps, indices, adj, weighting, ns);         | area or angle weighted normals of each vertex
+/// vertex_normals(ps, indices, adj, weighting, first, ns);  | normals of the vertices [first, first + ns.size())
+/// vertex_tangents(ps, uvs, ns, indices, adj, ts);          | MikkTSpace style tangents of each vertex
+/// vertex_tangents(ps, uvs, ns, indices, adj, first, ts);   | tangents of the vertices [first, first + ts.size())
+/// n = weld_vertices(ps, epsilon, remap);                   | the unique vertex of each vertex, & the unique count
+/// n = weld_vertices(ps, epsilon, attributes, remap);       | weld the vertices with equal (within epsilon) attributes
+/// remap_vertices(values, remap, results);                  | the values of each unique vertex
+/// remap_indices(indices, remap, results);                  | the unique vertex of each index
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // VertexAdjacency
+    // =============================================================================
+
+    /// The triangle corners of each vertex of an indexed triangle mesh, see @ref make_vertex_adjacency
+    /// @details
+    /// The corners of vertex v are corners[offsets[v]] to corners[offsets[v + 1] - 1], in increasing order,
+    /// where corner c is indices[c], i.e. the (c % 3)th vertex of triangle c / 3.
+    struct VertexAdjacency
+    {
+        // members:
+        std::vector<std::uint32_t> offsets; // vertex count + 1
+        std::vector<std::uint32_t> corners; // index count
+    };
+
+    // =============================================================================
+    // NormalWeighting
+    // =============================================================================
+
+    /// The weights of the triangle normals of a vertex normal
+    enum class NormalWeighting
+    {
+        Area,  ///< weighted by the triangle area (cheaper, but depends on the triangulation)
+        Angle, ///< weighted by the triangle angle at the vertex (Thürmer & Wüthrich, 1998)
+    };
+
+    // =============================================================================
+    // VertexAttribute
+    // =============================================================================
+
+    /// A stream of float attributes of each vertex (e.g. uvs or normals) for @ref weld_vertices
+    struct VertexAttribute
+    {
+        // members:
+        std::span<float const> values;  // size floats per vertex
+        std::size_t            size;    // uninitialized
+        float                  epsilon; // uninitialized
+    };
+
+    // =============================================================================
+    // adjacency:
+    // =============================================================================
+
+    /// list the triangle corners of each vertex
+    /// @param[in]  indices     The index buffer, 3 vertex indices per triangle, each less than vertexCount
+    /// @param[in]  vertexCount The number of vertices
+    /// @param[out] result      The corners of each vertex
+    constexpr void make_vertex_adjacency(std::span<std::uint32_t const> const indices,
+                                         std::size_t const                    vertexCount,
+                                         VertexAdjacency &                    result);
+
+    // =============================================================================
+    // normals:
+    // =============================================================================
+
+    /// normalized sum of the (area or angle) weighted normals of the triangles of each vertex, or zero for
+    /// vertices without (non-degenerate) triangles
+    /// @param[in]  positions The position of each vertex
+    /// @param[in]  indices   The index buffer, 3 vertex indices per triangle
+    /// @param[in]  adjacency The corners of each vertex, see @ref make_vertex_adjacency
+    /// @param[in]  weighting The weights of the triangle normals
+    /// @param[out] results   The normal of each vertex, must be the same size as positions
+    /// @relates Vector3D
+    template <typename T>
+    constexpr void vertex_normals(std::span<Vector3D<T> const> const   positions,
+                                  std::span<std::uint32_t const> const indices,
+                                  VertexAdjacency const &              adjacency,
+                                  NormalWeighting const                weighting,
+                                  std::span<Vector3D<T>> const         results) noexcept;
+
+    /// vertex_normals of the vertices [firstVertex, firstVertex + results.size())
+    /// @param[in]  positions   The position of each vertex
+    /// @param[in]  indices     The index buffer, 3 vertex indices per triangle
+    /// @param[in]  adjacency   The corners of each vertex, see @ref make_vertex_adjacency
+    /// @param[in]  weighting   The weights of the triangle normals
+    /// @param[in]  firstVertex The vertex of results[0]
+    /// @param[out] results     The normal of each vertex of the range
+    /// @relates Vector3D
+    template <typename T>
+    constexpr void vertex_normals(std::span<Vector3D<T> const> const   positions,
+                                  std::span<std::uint32_t const> const indices,
+                                  VertexAdjacency const &              adjacency,
+                                  NormalWeighting const                weighting,
+                                  std::size_t const                    firstVertex,
+                                  std::span<Vector3D<T>> const         results) noexcept;
+
+    // =============================================================================
+    // tangents:
+    // =============================================================================
+
+    /// normalized sum of the angle weighted uv tangents of the triangles of each vertex, projected onto the
+    /// plane of the vertex normal, & the handedness in w (+1 or -1), or any tangent for vertices without
+    /// triangles with non-degenerate uvs
+    /// @param[in]  positions The position of each vertex
+    /// @param[in]  uvs       The texture coordinate of each vertex
+    /// @param[in]  normals   The (unit) normal of each vertex, e.g. from @ref vertex_normals
+    /// @param[in]  indices   The index buffer, 3 vertex indices per triangle
+    /// @param[in]  adjacency The corners of each vertex, see @ref make_vertex_adjacency
+    /// @param[out] results   The tangent of each vertex, must be the same size as positions
+    /// @relates Vector4D
+    template <typename T>
+    constexpr void vertex_tangents(std::span<Vector3D<T> const> const   positions,
+                                   std::span<Vector2D<T> const> const   uvs,
+                                   std::span<Vector3D<T> const> const   normals,
+                                   std::span<std::uint32_t const> const indices,
+                                   VertexAdjacency const &              adjacency,
+                                   std::span<Vector4D<T>> const         results) noexcept;
+
+    /// vertex_tangents of the vertices [firstVertex, firstVertex + results.size())
+    /// @param[in]  positions   The position of each vertex
+    /// @param[in]  uvs         The texture coordinate of each vertex
+    /// @param[in]  normals     The (unit) normal of each vertex, e.g. from @ref vertex_normals
+    /// @param[in]  indices     The index buffer, 3 vertex indices per triangle
+    /// @param[in]  adjacency   The corners of each vertex, see @ref make_vertex_adjacency
+    /// @param[in]  firstVertex The vertex of results[0]
+    /// @param[out] results     The tangent of each vertex of the range
+    /// @relates Vector4D
+    template <typename T>
+    constexpr void vertex_tangents(std::span<Vector3D<T> const> const   positions,
+                                   std::span<Vector2D<T> const> const   uvs,
+                                   std::span<Vector3D<T> const> const   normals,
+                                   std::span<std::uint32_t const> const indices,
+                                   VertexAdjacency const &              adjacency,
+                                   std::size_t const                    firstVertex,
+                                   std::span<Vector4D<T>> const         results) noexcept;
+
+    // =============================================================================
+    // welding:
+    // =============================================================================
+
+    /// map each vertex to a unique vertex, merging the vertices within epsilon of an earlier unique vertex
+    /// @details the hash grid cells are max(2 * epsilon, 2^-30 * the largest abs position element), so any finite
+    /// positions & epsilon are welded in ~linear time unless many are much closer than that cell size
+    /// @param[in]  positions The (finite) position of each vertex
+    /// @param[in]  epsilon   The maximum distance between merged positions, 0 merges equal positions
+    /// @param[out] remap     The unique vertex of each vertex, in [0, unique count), must be the same size as
+    ///                       positions (the unique vertices are numbered in the order of their first vertex)
+    /// @returns the number of unique vertices
+    constexpr std::size_t weld_vertices(std::span<Vector3D<float> const> const positions,
+                                        float const                            epsilon,
+                                        std::span<std::uint32_t> const         remap);
+
+    /// map each vertex to a unique vertex, merging the vertices within epsilon of an earlier unique vertex
+    /// with every attribute element within the attribute's epsilon
+    /// @param[in]  positions  The (finite) position of each vertex
+    /// @param[in]  epsilon    The maximum distance between merged positions, 0 merges equal positions
+    /// @param[in]  attributes The attributes that must also be equal (within their epsilon) to merge
+    /// @param[out] remap      The unique vertex of each vertex, in [0, unique count), must be the same size as
+    ///                        positions (the unique vertices are numbered in the order of their first vertex)
+    /// @returns the number of unique vertices
+    constexpr std::size_t weld_vertices(std::span<Vector3D<float> const> const positions,
+                                        float const                            epsilon,
+                                        std::span<VertexAttribute const> const attributes,
+                                        std::span<std::uint32_t> const         remap);
+
+    /// the values of each unique vertex, i.e. results[remap[i]] = values[i] of the first vertex i of each
+    /// unique vertex
+    /// @param[in]  values  The values of each vertex
+    /// @param[in]  remap   The unique vertex of each vertex, see @ref weld_vertices
+    /// @param[out] results The values of each unique vertex, must be the size of the unique count
+    template <typename T>
+    constexpr void remap_vertices(std::span<T const> const             values,
+                                  std::span<std::uint32_t const> const remap,
+                                  std::span<T> const                   results) noexcept;
+
+    /// the unique vertex of each index, i.e. results[i] = remap[indices[i]] (results may be indices)
+    /// @param[in]  indices The index buffer
+    /// @param[in]  remap   The unique vertex of each vertex, see @ref weld_vertices
+    /// @param[out] results The index buffer of the unique vertices, must be the same size as indices
+    constexpr void remap_indices(std::span<std::uint32_t const> const indices,
+                                 std::span<std::uint32_t const> const remap,
+                                 std::span<std::uint32_t> const       results) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::MeshImpl
+{
+    // =============================================================================
+
+    /// the vertices of a corner's triangle, starting at the corner's vertex (so the winding is kept)
+    struct CornerVertices
+    {
+        // members:
+        std::uint32_t v0; // uninitialized
+        std::uint32_t v1; // uninitialized
+        std::uint32_t v2; // uninitialized
+    };
+
+    constexpr CornerVertices corner_vertices(std::span<std::uint32_t const> const indices,
+                                             std::uint32_t const                  corner) noexcept
+    {
+        std::uint32_t const first = corner - corner % 3u;
+        std::uint32_t const next  = first + (corner % 3u + 1u) % 3u;
+        std::uint32_t const last  = first + (corner % 3u + 2u) % 3u;
+        return CornerVertices{ indices[corner], indices[next], indices[last] };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the angle between edge0 & edge1, in [0, pi]
+    /// @details
+    /// atan2 of |cross| & dot is accurate for small & large angles (unlike acos of the normalized dot)
+    template <typename T>
+    constexpr T corner_angle(Vector3D<T> const & edge0,
+                             Vector3D<T> const & edge1) noexcept
+    {
+        return std::atan2(length(cross(edge0, edge1)), dot(edge0, edge1));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// a unit vector perpendicular to the unit vector normal (Duff et al's orthonormal basis)
+    template <typename T>
+    constexpr Vector3D<T> perpendicular(Vector3D<T> const & normal) noexcept
+    {
+        T const sign = (normal.z < T(0)) ? T(-1) : T(1);
+        T const a    = T(-1) / (sign + normal.z);
+        return Vector3D<T>{ T(1) + sign * normal.x * normal.x * a, sign * normal.x * normal.y * a, -sign * normal.x };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr Vector3D<T> vertex_normal(std::span<Vector3D<T> const> const   positions,
+                                        std::span<std::uint32_t const> const indices,
+                                        std::span<std::uint32_t const> const corners,
+                                        NormalWeighting const                weighting) noexcept
+    {
+        Vector3D<T> sum{ T(0), T(0), T(0) };
+        for (std::uint32_t const corner : corners)
+        {
+            CornerVertices const vertices = corner_vertices(indices, corner);
+            Vector3D<T> const    p0       = positions[vertices.v0];
+            Vector3D<T> const    edge0    = positions[vertices.v1] - p0;
+            Vector3D<T> const    edge1    = positions[vertices.v2] - p0;
+
+            // note: |cross| is twice the triangle area, so the area weighted normal is just the cross product
+            Vector3D<T> const normal = cross(edge0, edge1);
+            sum += (weighting == NormalWeighting::Area) ? normal : normalize(normal) * corner_angle(edge0, edge1);
+        }
+
+        return normalize(sum);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <typename T>
+    constexpr Vector4D<T> vertex_tangent(std::span<Vector3D<T> const> const   positions,
+                                         std::span<Vector2D<T> const> const   uvs,
+                                         Vector3D<T> const &                  normal,
+                                         std::span<std::uint32_t const> const indices,
+                                         std::span<std::uint32_t const> const corners) noexcept
+    {
+        Vector3D<T> sum{ T(0), T(0), T(0) };
+        T           orientation = T(0);
+        for (std::uint32_t const corner : corners)
+        {
+            CornerVertices const vertices = corner_vertices(indices, corner);
+            Vector3D<T> const    p0       = positions[vertices.v0];
+            Vector3D<T> const    edge0    = positions[vertices.v1] - p0;
+            Vector3D<T> const    edge1    = positions[vertices.v2] - p0;
+            Vector2D<T> const    uv0      = uvs[vertices.v0];
+            Vector2D<T> const    uvEdge0  = uvs[vertices.v1] - uv0;
+            Vector2D<T> const    uvEdge1  = uvs[vertices.v2] - uv0;
+
+            // the direction of increasing u (MikkTSpace's vOs), flipped where the uv mapping is mirrored, so that
+            // it is the tangent of both orientations (& the orientation is the handedness)
+            T const           signedArea = uvEdge0.x * uvEdge1.y - uvEdge0.y * uvEdge1.x;
+            T const           sign       = (signedArea < T(0)) ? T(-1) : T(1);
+            Vector3D<T> const uTangent   = (edge0 * uvEdge1.y - edge1 * uvEdge0.y) * sign;
+
+            // projected onto the plane of the vertex normal, & weighted by the angle between the projected edges
+            Vector3D<T> const projectedEdge0 = edge0 - normal * dot(normal, edge0);
+            Vector3D<T> const projectedEdge1 = edge1 - normal * dot(normal, edge1);
+            T const           weight         = (signedArea != T(0)) ? corner_angle(projectedEdge0, projectedEdge1) : T(0);
+
+            sum += normalize(uTangent - normal * dot(normal, uTangent)) * weight;
+            orientation += sign * weight;
+        }
+
+        T const           sumLength  = length(sum);
+        Vector3D<T> const tangent    = (sumLength > T(0)) ? sum / sumLength : perpendicular(normal);
+        T const           handedness = (orientation < T(0)) ? T(-1) : T(1);
+        return Vector4D<T>{ tangent.x, tangent.y, tangent.z, handedness };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    inline constexpr std::uint32_t EmptySlot = ~0u;
+
+    /// the largest magnitude of the (non-exact) weld cell coordinates, s.t. quantize & the adjacent cells are
+    /// within the range of std::int32_t
+    inline constexpr float MaxWeldCell = 0x1p30f;
+
+    /// the hash grid cell size for welding within epsilon: 2 * epsilon, or larger when the positions are so far
+    /// from the origin (relative to epsilon) that the cells would be beyond +/-MaxWeldCell
+    constexpr float weld_cell_size(std::span<Vector3D<float> const> const positions,
+                                   float const                            epsilon) noexcept
+    {
+        float maxMagnitude = 0.0f;
+        for (Vector3D<float> const & position : positions)
+        {
+            maxMagnitude = max(maxMagnitude, max(abs(position.x), max(abs(position.y), abs(position.z))));
+        }
+
+        return max(2.0f * epsilon, maxMagnitude / MaxWeldCell);
+    }
+
+    /// the hash grid cell of a position, or the bits of the position when exact (so that equal positions are
+    /// in the same cell, without crowding all of them into a few cells whatever their scale)
+    constexpr Vector3D<std::int32_t> weld_cell(Vector3D<float> const & position,
+                                               float const             cellSize,
+                                               bool const              exact) noexcept
+    {
+        // note: + 0.0f maps -0 to +0, so that equal positions have equal bits
+        return exact ? Vector3D<std::int32_t>{ std::bit_cast<std::int32_t>(position.x + 0.0f),
+                                               std::bit_cast<std::int32_t>(position.y + 0.0f),
+                                               std::bit_cast<std::int32_t>(position.z + 0.0f) }
+                     : quantize(position, cellSize);
+    }
+
+    /// true if the attributes of vertices lhs & rhs are all within their epsilons
+    constexpr bool is_equal_attributes(std::span<VertexAttribute const> const attributes,
+                                       std::size_t const                      lhs,
+                                       std::size_t const                      rhs) noexcept
+    {
+        for (VertexAttribute const & attribute : attributes)
+        {
+            for (std::size_t element = 0; element < attribute.size; ++element)
+            {
+                float const difference = attribute.values[lhs * attribute.size + element] - attribute.values[rhs * attribute.size + element];
+                if (abs(difference) > attribute.epsilon)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // =============================================================================
+} // namespace ggm::MeshImpl
+
+// =============================================================================
+// adjacency:
+// =============================================================================
+
+constexpr void ggm::make_vertex_adjacency(std::span<std::uint32_t const> const indices,
+                                          std::size_t const                    vertexCount,
+                                          VertexAdjacency &                    result)
+{
+    assert(indices.size() % 3u == 0u);
+
+    // count the corners of each vertex, the offsets are the prefix sums of the counts
+    result.offsets.assign(vertexCount + 1u, 0u);
+    for (std::uint32_t const index : indices)
+    {
+        assert(index < vertexCount);
+        ++result.offsets[index + 1u];
+    }
+
+    for (std::size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        result.offsets[vertex + 1u] += result.offsets[vertex];
+    }
+
+    // note: fills each vertex's corners in increasing order (via a running copy of the offsets), so the sums
+    // of the contributions (& so the results) are deterministic
+    std::vector<std::uint32_t> next(result.offsets.begin(), result.offsets.end() - 1);
+    result.corners.resize(indices.size());
+
+    std::uint32_t const cornerCount = static_cast<std::uint32_t>(indices.size());
+    for (std::uint32_t corner = 0; corner < cornerCount; ++corner)
+    {
+        result.corners[next[indices[corner]]++] = corner;
+    }
+}
+
+// =============================================================================
+// normals:
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::vertex_normals(std::span<Vector3D<T> const> const   positions,
+                                   std::span<std::uint32_t const> const indices,
+                                   VertexAdjacency const &              adjacency,
+                                   NormalWeighting const                weighting,
+                                   std::span<Vector3D<T>> const         results) noexcept
+{
+    assert(positions.size() == results.size());
+    vertex_normals(positions, indices, adjacency, weighting, 0, results);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::vertex_normals(std::span<Vector3D<T> const> const   positions,
+                                   std::span<std::uint32_t const> const indices,
+                                   VertexAdjacency const &              adjacency,
+                                   NormalWeighting const                weighting,
+                                   std::size_t const                    firstVertex,
+                                   std::span<Vector3D<T>> const         results) noexcept
+{
+    assert(adjacency.offsets.size() == positions.size() + 1u);
+    assert(firstVertex + results.size() <= positions.size());
+
+    std::span<std::uint32_t const> const corners = adjacency.corners;
+
+    std::size_t const count = results.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::size_t const vertex = firstVertex + i;
+        std::size_t const first  = adjacency.offsets[vertex];
+        std::size_t const last   = adjacency.offsets[vertex + 1u];
+        results[i]               = MeshImpl::vertex_normal(positions, indices, corners.subspan(first, last - first), weighting);
+    }
+}
+
+// =============================================================================
+// tangents:
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::vertex_tangents(std::span<Vector3D<T> const> const   positions,
+                                    std::span<Vector2D<T> const> const   uvs,
+                                    std::span<Vector3D<T> const> const   normals,
+                                    std::span<std::uint32_t const> const indices,
+                                    VertexAdjacency const &              adjacency,
+                                    std::span<Vector4D<T>> const         results) noexcept
+{
+    assert(positions.size() == results.size());
+    vertex_tangents(positions, uvs, normals, indices, adjacency, 0, results);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::vertex_tangents(std::span<Vector3D<T> const> const   positions,
+                                    std::span<Vector2D<T> const> const   uvs,
+                                    std::span<Vector3D<T> const> const   normals,
+                                    std::span<std::uint32_t const> const indices,
+                                    VertexAdjacency const &              adjacency,
+                                    std::size_t const                    firstVertex,
+                                    std::span<Vector4D<T>> const         results) noexcept
+{
+    assert(uvs.size() == positions.size());
+    assert(normals.size() == positions.size());
+    assert(adjacency.offsets.size() == positions.size() + 1u);
+    assert(firstVertex + results.size() <= positions.size());
+
+    std::span<std::uint32_t const> const corners = adjacency.corners;
+
+    std::size_t const count = results.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::size_t const vertex = firstVertex + i;
+        std::size_t const first  = adjacency.offsets[vertex];
+        std::size_t const last   = adjacency.offsets[vertex + 1u];
+        results[i]               = MeshImpl::vertex_tangent(positions, uvs, normals[vertex], indices, corners.subspan(first, last - first));
+    }
+}
+
+// =============================================================================
+// welding:
+// =============================================================================
+
+constexpr std::size_t ggm::weld_vertices(std::span<Vector3D<float> const> const positions,
+                                         float const                            epsilon,
+                                         std::span<std::uint32_t> const         remap)
+{
+    return weld_vertices(positions, epsilon, std::span<VertexAttribute const>(), remap);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::size_t ggm::weld_vertices(std::span<Vector3D<float> const> const positions,
+                                         float const                            epsilon,
+                                         std::span<VertexAttribute const> const attributes,
+                                         std::span<std::uint32_t> const         remap)
+{
+    assert(epsilon >= 0.0f);
+    assert(positions.size() == remap.size());
+
+    // note: with cells of size >= 2 * epsilon the positions within epsilon of a position are in its cell or the
+    // adjacent cells on the sides nearest to it, i.e. 2x2x2 cells, & with epsilon 0 the cells are the exact
+    // positions
+    bool const        exact          = (epsilon == 0.0f);
+    float const       cellSize       = exact ? 1.0f : MeshImpl::weld_cell_size(positions, epsilon);
+    float const       scale          = 1.0f / cellSize;
+    float const       epsilonSquared = epsilon * epsilon;
+    int const         neighborCount  = exact ? 1 : 8;
+    std::size_t const count          = positions.size();
+
+    // the table maps each cell to its first unique vertex, the others are chained by next (at most 1/2 full)
+    std::size_t const          capacity = std::bit_ceil(std::max<std::size_t>(2u * count, 16u));
+    std::size_t const          mask     = capacity - 1u;
+    std::vector<std::uint32_t> table(capacity, MeshImpl::EmptySlot);
+    std::vector<std::uint32_t> next(count, MeshImpl::EmptySlot);
+
+    auto const find_slot = [&](Vector3D<std::int32_t> const & cell) noexcept {
+        std::size_t slot = cell_hash(cell) & mask;
+        while ((table[slot] != MeshImpl::EmptySlot) && (MeshImpl::weld_cell(positions[table[slot]], cellSize, exact) != cell))
+        {
+            slot = (slot + 1u) & mask;
+        }
+        return slot;
+    };
+
+    std::uint32_t uniqueCount = 0;
+    for (std::size_t vertex = 0; vertex < count; ++vertex)
+    {
+        Vector3D<float> const        position = positions[vertex];
+        Vector3D<float> const        scaled   = position * scale;
+        Vector3D<std::int32_t> const cell     = MeshImpl::weld_cell(position, cellSize, exact);
+        Vector3D<std::int32_t> const side{
+            (scaled.x - floor(scaled.x) < 0.5f) ? -1 : 1,
+            (scaled.y - floor(scaled.y) < 0.5f) ? -1 : 1,
+            (scaled.z - floor(scaled.z) < 0.5f) ? -1 : 1,
+        };
+
+        std::uint32_t match = MeshImpl::EmptySlot;
+        for (int neighbor = 0; (neighbor < neighborCount) && (match == MeshImpl::EmptySlot); ++neighbor)
+        {
+            Vector3D<std::int32_t> const neighborCell{
+                cell.x + (((neighbor & 1) != 0) ? side.x : 0),
+                cell.y + (((neighbor & 2) != 0) ? side.y : 0),
+                cell.z + (((neighbor & 4) != 0) ? side.z : 0),
+            };
+
+            for (std::uint32_t unique = table[find_slot(neighborCell)]; unique != MeshImpl::EmptySlot; unique = next[unique])
+            {
+                if ((distance_squared(position, positions[unique]) <= epsilonSquared) &&
+                    MeshImpl::is_equal_attributes(attributes, vertex, unique))
+                {
+                    match = unique;
+                    break;
+                }
+            }
+        }
+
+        if (match != MeshImpl::EmptySlot)
+        {
+            remap[vertex] = remap[match];
+        }
+        else
+        {
+            std::size_t const slot = find_slot(cell);
+            next[vertex]           = table[slot];
+            table[slot]            = static_cast<std::uint32_t>(vertex);
+            remap[vertex]          = uniqueCount++;
+        }
+    }
+
+    return uniqueCount;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::remap_vertices(std::span<T const> const             values,
+                                   std::span<std::uint32_t const> const remap,
+                                   std::span<T> const                   results) noexcept
+{
+    assert(values.size() == remap.size());
+
+    // note: the unique vertices are numbered in the order of their first vertex, so the first vertex of each
+    // is the one that reaches the next unique number
+    std::uint32_t     nextUnique = 0;
+    std::size_t const count      = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (remap[i] == nextUnique)
+        {
+            results[nextUnique++] = values[i];
+        }
+    }
+
+    assert(nextUnique == results.size());
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr void ggm::remap_indices(std::span<std::uint32_t const> const indices,
+                                  std::span<std::uint32_t const> const remap,
+                                  std::span<std::uint32_t> const       results) noexcept
+{
+    assert(indices.size() == results.size());
+
+    std::size_t const count = indices.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = remap[indices[i]];
+    }
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_MESH_H
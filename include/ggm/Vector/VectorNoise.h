@@ -0,0 +1,522 @@
+#pragma once
+#ifndef GGM_VECTOR_NOISE_H
+#define GGM_VECTOR_NOISE_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Numeric/Random.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Gradient noise of 2D & 3D points, see VectorBatch.h for the span versions.
+///
+/// - perlin_noise is Perlin's improved noise ("Improving Noise", 2002): gradients of the corners of the
+///   lattice cell of the point, blended with the quintic fade curve
+/// - simplex_noise is Perlin's simplex noise ("Noise Hardware", 2001, after Gustavson's "Simplex noise
+///   demystified"): gradients of the corners of the simplex of the point, with radial falloff kernels, which
+///   has fewer directional artifacts & is cheaper than perlin_noise in 3D (4 rather than 8 corners)
+/// - perlin_fbm & simplex_fbm sum octaves of the noise (fractal Brownian motion), i.e. the sum of
+///   gain^i * noise(value * lacunarity^i) for i in [0, octaves)
+///
+/// Both noises are 0 at the lattice points & in [-1, 1] (scaled so that the extremes are ~+/-1). The lattice
+/// gradients are selected by hashing the lattice coordinates (with pcg_hash, see Random.h) rather than by
+/// permutation table lookups, & the simplex corner selection & kernels are branch-free, so loops over sample
+/// points are vectorizable (with AVX2, which has 32-bit multiplies & per-lane shifts). The lattice coordinates must be within +/-2^31, i.e. the
+/// points within ~+/-2e9.
+///
+/// The packet overloads evaluate the noise of each lane of a Vector3DPacket, see VectorPacketUtil.h.
+///
+/// Syntax                               | Description
+/// ------                               | -----------
+/// n = perlin_noise(v);                 | improved Perlin noise of a Vector2D<float> or Vector3D<float> point
+/// n = simplex_noise(v);                | simplex noise of a Vector2D<float> or Vector3D<float> point
+/// n = perlin_fbm(v, octaves, l, g);    | octaves of perlin_noise, with lacunarity l & gain g
+/// n = simplex_fbm(v, octaves, l, g);   | octaves of simplex_noise, with lacunarity l & gain g
+/// ns = perlin_noise(p);                | perlin_noise of each lane of a Vector3DPacket<float, N>
+/// ns = simplex_noise(p);               | simplex_noise of each lane of a Vector3DPacket<float, N>
+/// ns = perlin_fbm(p, octaves, l, g);   | perlin_fbm of each lane of a Vector3DPacket<float, N>
+/// ns = simplex_fbm(p, octaves, l, g);  | simplex_fbm of each lane of a Vector3DPacket<float, N>
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // noise:
+    // =============================================================================
+
+    /// improved Perlin noise of a point, in [-1, 1]
+    /// @relates Vector2D
+    constexpr float perlin_noise(Vector2D<float> const & value) noexcept;
+
+    /// improved Perlin noise of a point, in [-1, 1]
+    /// @relates Vector3D
+    constexpr float perlin_noise(Vector3D<float> const & value) noexcept;
+
+    /// simplex noise of a point, in [-1, 1]
+    /// @relates Vector2D
+    constexpr float simplex_noise(Vector2D<float> const & value) noexcept;
+
+    /// simplex noise of a point, in [-1, 1]
+    /// @relates Vector3D
+    constexpr float simplex_noise(Vector3D<float> const & value) noexcept;
+
+    // =============================================================================
+    // fractal:
+    // =============================================================================
+
+    /// the sum of gain^i * perlin_noise(value * lacunarity^i) for i in [0, octaves)
+    /// @param[in] value      The point
+    /// @param[in] octaves    The number of octaves
+    /// @param[in] lacunarity The frequency multiplier of each octave (usually ~2)
+    /// @param[in] gain       The amplitude multiplier of each octave (usually ~0.5)
+    /// @relates Vector2D
+    constexpr float perlin_fbm(Vector2D<float> const & value,
+                               int const               octaves,
+                               float const             lacunarity,
+                               float const             gain) noexcept;
+
+    /// the sum of gain^i * perlin_noise(value * lacunarity^i) for i in [0, octaves)
+    /// @param[in] value      The point
+    /// @param[in] octaves    The number of octaves
+    /// @param[in] lacunarity The frequency multiplier of each octave (usually ~2)
+    /// @param[in] gain       The amplitude multiplier of each octave (usually ~0.5)
+    /// @relates Vector3D
+    constexpr float perlin_fbm(Vector3D<float> const & value,
+                               int const               octaves,
+                               float const             lacunarity,
+                               float const             gain) noexcept;
+
+    /// the sum of gain^i * simplex_noise(value * lacunarity^i) for i in [0, octaves)
+    /// @param[in] value      The point
+    /// @param[in] octaves    The number of octaves
+    /// @param[in] lacunarity The frequency multiplier of each octave (usually ~2)
+    /// @param[in] gain       The amplitude multiplier of each octave (usually ~0.5)
+    /// @relates Vector2D
+    constexpr float simplex_fbm(Vector2D<float> const & value,
+                                int const               octaves,
+                                float const             lacunarity,
+                                float const             gain) noexcept;
+
+    /// the sum of gain^i * simplex_noise(value * lacunarity^i) for i in [0, octaves)
+    /// @param[in] value      The point
+    /// @param[in] octaves    The number of octaves
+    /// @param[in] lacunarity The frequency multiplier of each octave (usually ~2)
+    /// @param[in] gain       The amplitude multiplier of each octave (usually ~0.5)
+    /// @relates Vector3D
+    constexpr float simplex_fbm(Vector3D<float> const & value,
+                                int const               octaves,
+                                float const             lacunarity,
+                                float const             gain) noexcept;
+
+    // =============================================================================
+    // packets:
+    // =============================================================================
+
+    /// perlin_noise of each lane
+    /// @relates Vector3DPacket
+    template <std::size_t N>
+    constexpr std::array<float, N> perlin_noise(Vector3DPacket<float, N> const & value) noexcept;
+
+    /// simplex_noise of each lane
+    /// @relates Vector3DPacket
+    template <std::size_t N>
+    constexpr std::array<float, N> simplex_noise(Vector3DPacket<float, N> const & value) noexcept;
+
+    /// perlin_fbm of each lane
+    /// @relates Vector3DPacket
+    template <std::size_t N>
+    constexpr std::array<float, N> perlin_fbm(Vector3DPacket<float, N> const & value,
+                                              int const                        octaves,
+                                              float const                      lacunarity,
+                                              float const                      gain) noexcept;
+
+    /// simplex_fbm of each lane
+    /// @relates Vector3DPacket
+    template <std::size_t N>
+    constexpr std::array<float, N> simplex_fbm(Vector3DPacket<float, N> const & value,
+                                               int const                        octaves,
+                                               float const                      lacunarity,
+                                               float const                      gain) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::NoiseImpl
+{
+    // =============================================================================
+
+    /// the scales that map the extremes of the noise to ~+/-1 (the 2D perlin noise extremes are exactly +/-1, the
+    /// simplex scales are Gustavson's), the results are also clamped to [-1, 1]
+    inline constexpr float PerlinScale3D  = 0.9649f;
+    inline constexpr float SimplexScale2D = 70.0f;
+    inline constexpr float SimplexScale3D = 32.0f;
+
+    // -----------------------------------------------------------------------------
+
+    /// the lattice coordinate of the cell that contains value, wrapped to 32 bits
+    constexpr std::uint32_t lattice_from_float(float const value) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<std::int32_t>(floor(value)));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// hash of lattice coordinates (Teschner et al's primes, then pcg_hash to mix the bits)
+    constexpr std::uint32_t lattice_hash(std::uint32_t const x,
+                                         std::uint32_t const y,
+                                         std::uint32_t const z) noexcept
+    {
+        return pcg_hash((x * 0x8DA6B343u) ^ (y * 0xD8163841u) ^ (z * 0xCB1AB31Fu));
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// dot product of the offset (x, y, z) with one of the 12 gradients (the edge midpoints of a cube) of
+    /// Perlin's improved noise, selected by the high 4 bits of hash
+    constexpr float gradient(std::uint32_t const hash,
+                             float const         x,
+                             float const         y,
+                             float const         z) noexcept
+    {
+        // note: (h & 13) == 12 is h == 12 || h == 14, & the signs are flipped with xor (rather than selected),
+        // which keeps the function free of control flow (so vectorizable)
+        std::uint32_t const h = hash >> 28u;
+        float const         u = (h < 8u) ? x : y;
+        float const         v = (h < 4u) ? y : ((h & 13u) == 12u) ? x : z;
+        float const signedU   = std::bit_cast<float>(std::bit_cast<std::uint32_t>(u) ^ ((h & 1u) << 31u));
+        float const signedV   = std::bit_cast<float>(std::bit_cast<std::uint32_t>(v) ^ ((h & 2u) << 30u));
+        return signedU + signedV;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the quintic fade curve 6t^5 - 15t^4 + 10t^3, which has zero 1st & 2nd derivatives at 0 & 1
+    constexpr float fade(float const t) noexcept
+    {
+        return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the simplex noise contribution of a corner at offset (x, y, z) with radius^2 radiusSquared
+    constexpr float simplex_corner(std::uint32_t const hash,
+                                   float const         radiusSquared,
+                                   float const         x,
+                                   float const         y,
+                                   float const         z) noexcept
+    {
+        // note: max (rather than a branch) for the corners outside the radius, so it is vectorizable
+        float const t  = max(0.0f, radiusSquared - x * x - y * y - z * z);
+        float const t2 = t * t;
+        return t2 * t2 * gradient(hash, x, y, z);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the sum of gain^i * Noise(value * lacunarity^i) for i in [0, octaves)
+    template <typename V, float (*Noise)(V const &) noexcept>
+    constexpr float fbm(V const &   value,
+                        int const   octaves,
+                        float const lacunarity,
+                        float const gain) noexcept
+    {
+        float sum       = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        for (int octave = 0; octave < octaves; ++octave)
+        {
+            sum += amplitude * Noise(value * frequency);
+            amplitude *= gain;
+            frequency *= lacunarity;
+        }
+
+        return sum;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// fbm of each lane of a packet
+    /// note: the octave loop is outside the lane loops, so that the lane loops are vectorizable
+    template <std::size_t N, std::array<float, N> (*Noise)(Vector3DPacket<float, N> const &) noexcept>
+    constexpr std::array<float, N> packet_fbm(Vector3DPacket<float, N> const & value,
+                                              int const                        octaves,
+                                              float const                      lacunarity,
+                                              float const                      gain) noexcept
+    {
+        std::array<float, N> sum{};
+        float                amplitude = 1.0f;
+        float                frequency = 1.0f;
+        for (int octave = 0; octave < octaves; ++octave)
+        {
+            std::array<float, N> const noise = Noise(value * frequency);
+            for (std::size_t lane = 0; lane < N; ++lane)
+            {
+                sum[lane] += amplitude * noise[lane];
+            }
+
+            amplitude *= gain;
+            frequency *= lacunarity;
+        }
+
+        return sum;
+    }
+
+    // =============================================================================
+} // namespace ggm::NoiseImpl
+
+// =============================================================================
+// noise:
+// =============================================================================
+
+constexpr float ggm::perlin_noise(Vector2D<float> const & value) noexcept
+{
+    using namespace NoiseImpl;
+
+    std::uint32_t const ix = lattice_from_float(value.x);
+    std::uint32_t const iy = lattice_from_float(value.y);
+    float const         x  = value.x - floor(value.x);
+    float const         y  = value.y - floor(value.y);
+
+    float const n00 = gradient(lattice_hash(ix, iy, 0u), x, y, 0.0f);
+    float const n10 = gradient(lattice_hash(ix + 1u, iy, 0u), x - 1.0f, y, 0.0f);
+    float const n01 = gradient(lattice_hash(ix, iy + 1u, 0u), x, y - 1.0f, 0.0f);
+    float const n11 = gradient(lattice_hash(ix + 1u, iy + 1u, 0u), x - 1.0f, y - 1.0f, 0.0f);
+
+    float const u = fade(x);
+    float const v = fade(y);
+    return clamp(lerp(lerp(n00, n10, u), lerp(n01, n11, u), v), -1.0f, 1.0f);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::perlin_noise(Vector3D<float> const & value) noexcept
+{
+    using namespace NoiseImpl;
+
+    std::uint32_t const ix = lattice_from_float(value.x);
+    std::uint32_t const iy = lattice_from_float(value.y);
+    std::uint32_t const iz = lattice_from_float(value.z);
+    float const         x  = value.x - floor(value.x);
+    float const         y  = value.y - floor(value.y);
+    float const         z  = value.z - floor(value.z);
+
+    float const n000 = gradient(lattice_hash(ix, iy, iz), x, y, z);
+    float const n100 = gradient(lattice_hash(ix + 1u, iy, iz), x - 1.0f, y, z);
+    float const n010 = gradient(lattice_hash(ix, iy + 1u, iz), x, y - 1.0f, z);
+    float const n110 = gradient(lattice_hash(ix + 1u, iy + 1u, iz), x - 1.0f, y - 1.0f, z);
+    float const n001 = gradient(lattice_hash(ix, iy, iz + 1u), x, y, z - 1.0f);
+    float const n101 = gradient(lattice_hash(ix + 1u, iy, iz + 1u), x - 1.0f, y, z - 1.0f);
+    float const n011 = gradient(lattice_hash(ix, iy + 1u, iz + 1u), x, y - 1.0f, z - 1.0f);
+    float const n111 = gradient(lattice_hash(ix + 1u, iy + 1u, iz + 1u), x - 1.0f, y - 1.0f, z - 1.0f);
+
+    float const u = fade(x);
+    float const v = fade(y);
+    float const w = fade(z);
+    float const noise = lerp(lerp(lerp(n000, n100, u), lerp(n010, n110, u), v),
+                             lerp(lerp(n001, n101, u), lerp(n011, n111, u), v),
+                             w);
+    return clamp(PerlinScale3D * noise, -1.0f, 1.0f);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::simplex_noise(Vector2D<float> const & value) noexcept
+{
+    using namespace NoiseImpl;
+
+    constexpr float F2 = 0.36602540378f; // (sqrt(3) - 1) / 2, skews to the lattice of squares
+    constexpr float G2 = 0.21132486540f; // (3 - sqrt(3)) / 6, unskews to the lattice of triangles
+
+    // the cell of the skewed lattice & the offset from its origin
+    float const         skew = (value.x + value.y) * F2;
+    float const         fx   = floor(value.x + skew);
+    float const         fy   = floor(value.y + skew);
+    std::uint32_t const ix   = static_cast<std::uint32_t>(static_cast<std::int32_t>(fx));
+    std::uint32_t const iy   = static_cast<std::uint32_t>(static_cast<std::int32_t>(fy));
+    float const         t    = (fx + fy) * G2;
+    float const         x0   = value.x - (fx - t);
+    float const         y0   = value.y - (fy - t);
+
+    // the middle corner of the triangle: (1, 0) if x0 > y0, else (0, 1)
+    bool const          isLower = (x0 > y0);
+    std::uint32_t const i1      = isLower ? 1u : 0u;
+    std::uint32_t const j1      = isLower ? 0u : 1u;
+
+    float const x1 = x0 - static_cast<float>(static_cast<std::int32_t>(i1)) + G2; // note: int32, see simplex_noise(Vector3D<float> const &)
+    float const y1 = y0 - static_cast<float>(static_cast<std::int32_t>(j1)) + G2;
+    float const x2 = x0 - 1.0f + 2.0f * G2;
+    float const y2 = y0 - 1.0f + 2.0f * G2;
+
+    float const n0 = simplex_corner(lattice_hash(ix, iy, 0u), 0.5f, x0, y0, 0.0f);
+    float const n1 = simplex_corner(lattice_hash(ix + i1, iy + j1, 0u), 0.5f, x1, y1, 0.0f);
+    float const n2 = simplex_corner(lattice_hash(ix + 1u, iy + 1u, 0u), 0.5f, x2, y2, 0.0f);
+    return clamp(SimplexScale2D * (n0 + n1 + n2), -1.0f, 1.0f);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::simplex_noise(Vector3D<float> const & value) noexcept
+{
+    using namespace NoiseImpl;
+
+    constexpr float F3 = 1.0f / 3.0f; // skews to the lattice of cubes
+    constexpr float G3 = 1.0f / 6.0f; // unskews to the lattice of tetrahedra
+
+    // the cell of the skewed lattice & the offset from its origin
+    float const         skew = (value.x + value.y + value.z) * F3;
+    float const         fx   = floor(value.x + skew);
+    float const         fy   = floor(value.y + skew);
+    float const         fz   = floor(value.z + skew);
+    std::uint32_t const ix   = static_cast<std::uint32_t>(static_cast<std::int32_t>(fx));
+    std::uint32_t const iy   = static_cast<std::uint32_t>(static_cast<std::int32_t>(fy));
+    std::uint32_t const iz   = static_cast<std::uint32_t>(static_cast<std::int32_t>(fz));
+    float const         t    = (fx + fy + fz) * G3;
+    float const         x0   = value.x - (fx - t);
+    float const         y0   = value.y - (fy - t);
+    float const         z0   = value.z - (fz - t);
+
+    // the 2nd & 3rd corners of the tetrahedron step along the largest, then the 2 largest offsets (the
+    // ranks of the offsets, as 0/1 bits combined with & | ^ rather than Gustavson's if-else chain or && ||,
+    // which are branches)
+    std::uint32_t const xy = (x0 >= y0) ? 1u : 0u;
+    std::uint32_t const yz = (y0 >= z0) ? 1u : 0u;
+    std::uint32_t const xz = (x0 >= z0) ? 1u : 0u;
+
+    std::uint32_t const i1 = xy & xz;
+    std::uint32_t const j1 = (xy ^ 1u) & yz;
+    std::uint32_t const k1 = (xz | yz) ^ 1u;
+    std::uint32_t const i2 = xy | xz;
+    std::uint32_t const j2 = (xy ^ 1u) | yz;
+    std::uint32_t const k2 = (xz & yz) ^ 1u;
+
+    // note: converts through int32, since only signed conversions are vectorizable
+    float const x1 = x0 - static_cast<float>(static_cast<std::int32_t>(i1)) + G3;
+    float const y1 = y0 - static_cast<float>(static_cast<std::int32_t>(j1)) + G3;
+    float const z1 = z0 - static_cast<float>(static_cast<std::int32_t>(k1)) + G3;
+    float const x2 = x0 - static_cast<float>(static_cast<std::int32_t>(i2)) + 2.0f * G3;
+    float const y2 = y0 - static_cast<float>(static_cast<std::int32_t>(j2)) + 2.0f * G3;
+    float const z2 = z0 - static_cast<float>(static_cast<std::int32_t>(k2)) + 2.0f * G3;
+    float const x3 = x0 - 1.0f + 3.0f * G3;
+    float const y3 = y0 - 1.0f + 3.0f * G3;
+    float const z3 = z0 - 1.0f + 3.0f * G3;
+
+    float const n0 = simplex_corner(lattice_hash(ix, iy, iz), 0.6f, x0, y0, z0);
+    float const n1 = simplex_corner(lattice_hash(ix + i1, iy + j1, iz + k1), 0.6f, x1, y1, z1);
+    float const n2 = simplex_corner(lattice_hash(ix + i2, iy + j2, iz + k2), 0.6f, x2, y2, z2);
+    float const n3 = simplex_corner(lattice_hash(ix + 1u, iy + 1u, iz + 1u), 0.6f, x3, y3, z3);
+    return clamp(SimplexScale3D * (n0 + n1 + n2 + n3), -1.0f, 1.0f);
+}
+
+// =============================================================================
+// fractal:
+// =============================================================================
+
+constexpr float ggm::perlin_fbm(Vector2D<float> const & value,
+                                int const               octaves,
+                                float const             lacunarity,
+                                float const             gain) noexcept
+{
+    return NoiseImpl::fbm<Vector2D<float>, &perlin_noise>(value, octaves, lacunarity, gain);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::perlin_fbm(Vector3D<float> const & value,
+                                int const               octaves,
+                                float const             lacunarity,
+                                float const             gain) noexcept
+{
+    return NoiseImpl::fbm<Vector3D<float>, &perlin_noise>(value, octaves, lacunarity, gain);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::simplex_fbm(Vector2D<float> const & value,
+                                 int const               octaves,
+                                 float const             lacunarity,
+                                 float const             gain) noexcept
+{
+    return NoiseImpl::fbm<Vector2D<float>, &simplex_noise>(value, octaves, lacunarity, gain);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr float ggm::simplex_fbm(Vector3D<float> const & value,
+                                 int const               octaves,
+                                 float const             lacunarity,
+                                 float const             gain) noexcept
+{
+    return NoiseImpl::fbm<Vector3D<float>, &simplex_noise>(value, octaves, lacunarity, gain);
+}
+
+// =============================================================================
+// packets:
+// =============================================================================
+
+template <std::size_t N>
+constexpr std::array<float, N> ggm::perlin_noise(Vector3DPacket<float, N> const & value) noexcept
+{
+    std::array<float, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = perlin_noise(get_lane(value, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N>
+constexpr std::array<float, N> ggm::simplex_noise(Vector3DPacket<float, N> const & value) noexcept
+{
+    std::array<float, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = simplex_noise(get_lane(value, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N>
+constexpr std::array<float, N> ggm::perlin_fbm(Vector3DPacket<float, N> const & value,
+                                               int const                        octaves,
+                                               float const                      lacunarity,
+                                               float const                      gain) noexcept
+{
+    return NoiseImpl::packet_fbm<N, &perlin_noise<N>>(value, octaves, lacunarity, gain);
+}
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N>
+constexpr std::array<float, N> ggm::simplex_fbm(Vector3DPacket<float, N> const & value,
+                                                int const                        octaves,
+                                                float const                      lacunarity,
+                                                float const                      gain) noexcept
+{
+    return NoiseImpl::packet_fbm<N, &simplex_noise<N>>(value, octaves, lacunarity, gain);
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_NOISE_H
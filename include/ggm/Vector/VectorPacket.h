@@ -0,0 +1,112 @@
+#pragma once
+#ifndef GGM_VECTOR_PACKET_H
+#define GGM_VECTOR_PACKET_H
+
+#include <cstddef>
+#include <vector>
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    /// @defgroup VectorPacket Array of structure of arrays (AoSoA) packets of 3D and 4D vectors
+    /// @details
+    /// A packet holds N vectors (N lanes), stored as N x elements, then N y elements, & so on. N is meant to
+    /// be a SIMD width (4, 8 or 16 floats), so the lane loops of the VectorPacketUtil.h functions map onto
+    /// whole SIMD registers. Unlike the structure of arrays containers (see VectorSoA.h), the elements of a
+    /// vector are at most N * sizeof(T) bytes apart, so a loop over a container of packets streams through
+    /// memory in a single sequential pass.
+    ///
+    /// Packets are values (like Vector3D/Vector4D), so the functions of a packet can't alias their results.
+    // =============================================================================
+
+    // =============================================================================
+    // Vector3DPacket
+    // =============================================================================
+
+    /// A packet of N 3-dimensional mathematical vectors
+    /// @ingroup VectorPacket
+    /// @tparam T The type of each vector element (usually float or double)
+    /// @tparam N The number of vectors (lanes) in the packet: 4, 8 or 16
+    template <typename T, std::size_t N>
+    struct Vector3DPacket
+    {
+        static_assert((N == 4) || (N == 8) || (N == 16), "N must be a SIMD width: 4, 8 or 16");
+
+        // members:
+        T x[N]; // uninitialized
+        T y[N]; // uninitialized
+        T z[N]; // uninitialized
+    };
+
+    // =============================================================================
+    // Vector4DPacket
+    // =============================================================================
+
+    /// A packet of N 4-dimensional mathematical vectors
+    /// @ingroup VectorPacket
+    /// @tparam T The type of each vector element (usually float or double)
+    /// @tparam N The number of vectors (lanes) in the packet: 4, 8 or 16
+    template <typename T, std::size_t N>
+    struct Vector4DPacket
+    {
+        static_assert((N == 4) || (N == 8) || (N == 16), "N must be a SIMD width: 4, 8 or 16");
+
+        // members:
+        T x[N]; // uninitialized
+        T y[N]; // uninitialized
+        T z[N]; // uninitialized
+        T w[N]; // uninitialized
+    };
+
+    // =============================================================================
+    // Vector3DPacketArray
+    // =============================================================================
+
+    /// A container of count 3-dimensional mathematical vectors, stored as packets of N vectors
+    /// @ingroup VectorPacket
+    /// @details
+    /// The lanes of the last packet after count are padding (zero after resize or gather), so a loop body
+    /// can be written once for whole packets & run over every packet, e.g.
+    /// @code
+    /// for (Vector3DPacket<float, 8> & packet : values.packets)
+    /// {
+    ///     packet = normalize(packet);
+    /// }
+    /// @endcode
+    /// @tparam T The type of each vector element (usually float or double)
+    /// @tparam N The number of vectors (lanes) in each packet: 4, 8 or 16
+    template <typename T, std::size_t N>
+    struct Vector3DPacketArray
+    {
+        // members:
+        std::vector<Vector3DPacket<T, N>> packets;
+        std::size_t                       count; // uninitialized
+    };
+
+    // =============================================================================
+    // Vector4DPacketArray
+    // =============================================================================
+
+    /// A container of count 4-dimensional mathematical vectors, stored as packets of N vectors
+    /// @ingroup VectorPacket
+    /// @details
+    /// The lanes of the last packet after count are padding (zero after resize or gather), see
+    /// Vector3DPacketArray.
+    /// @tparam T The type of each vector element (usually float or double)
+    /// @tparam N The number of vectors (lanes) in each packet: 4, 8 or 16
+    template <typename T, std::size_t N>
+    struct Vector4DPacketArray
+    {
+        // members:
+        std::vector<Vector4DPacket<T, N>> packets;
+        std::size_t                       count; // uninitialized
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_VECTOR_PACKET_H
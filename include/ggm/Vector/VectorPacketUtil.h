@@ -0,0 +1,1490 @@
+#pragma once
+#ifndef GGM_VECTOR_PACKET_UTIL_H
+#define GGM_VECTOR_PACKET_UTIL_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+// =============================================================================
+/// @addtogroup VectorPacket
+/// @{
+/// @details
+///
+/// Packet versions of the VectorUtil.h operators & functions, which apply the Vector3D/Vector4D function
+/// to each lane. Each is a loop over the N lanes that gets the lane's vector, calls the VectorUtil.h
+/// function & sets the result lane, so the results are the same as the Vector3D/Vector4D functions. N is a
+/// compile-time constant & packets are values, so compilers unroll the lane loops & map them onto SIMD
+/// registers without any run-time alias checks (e.g. GCC & Clang at -O3, or -O2 with -ftree-vectorize).
+///
+/// note: the functions that call sqrt (distance, length & normalize) only vectorize when sqrt doesn't set
+/// errno (e.g. -fno-math-errno), see VectorSoAUtil.h
+///
+/// Functions with a scalar result per lane (e.g. dot, length) return a std::array<T, N>.
+///
+/// operators:
+/// ----------
+///
+/// Syntax      | Description
+/// ------      | -----------
+/// p += q;     | vector addition assignment
+/// p -= q;     | vector subtraction assignment
+/// p *= s;     | scalar multiplication assignment
+/// p *= q;     | element-wise multiplication assignment
+/// p /= s;     | scalar division assignment
+/// p /= q;     | element-wise division assignment
+/// p = +q;     | element-wise unary plus
+/// p = -q;     | vector negation
+/// p = q + r;  | vector addition
+/// p = q - r;  | vector subtraction
+/// p = s * q;  | scalar multiplication
+/// p = q * s;  | scalar multiplication
+/// p = q * r;  | element-wise multiplication
+/// p = q / s;  | scalar division
+/// p = q / r;  | element-wise division
+/// b = p == q; | vector equality of every lane
+/// b = p != q; | vector inequality of any lane
+///
+/// lane access:
+/// ------------
+///
+/// Syntax                 | Description
+/// ------                 | -----------
+/// p = broadcast<N>(v);   | packet with every lane set to v
+/// v = get_lane(p, i);    | vector of the i(th) lane
+/// set_lane(p, i, v);     | set the vector of the i(th) lane
+///
+/// functions:
+/// ----------
+///
+/// Syntax                      | Description
+/// ------                      | -----------
+/// p = clamp(q, min, max);     | element-wise clamp of each lane
+/// p = cross(q, r);            | vector3D cross product of each lane
+/// ss = distance(p, q);        | distance between each lane of p and q
+/// ss = distance_squared(p, q);| square of the distance between each lane of p and q
+/// ss = dot(p, q);             | dot product of each lane
+/// ss = length(p);             | vector length of each lane
+/// ss = length_squared(p);     | square of the vector length of each lane
+/// p = lerp(p0, p1, s);        | linear interpolation of each lane with the same t
+/// p = lerp(p0, p1, ss);       | linear interpolation of each lane with the corresponding t
+/// p = normalize(q);           | normalized vector in the direction of each lane, or zero
+///
+/// containers:
+/// -----------
+///
+/// Syntax                 | Description
+/// ------                 | -----------
+/// resize(ps, n);         | resize to n vectors (rounded up to whole packets), new & padding lanes are zero
+/// gather(vs, ps);        | convert a std::vector of Vector3D/Vector4D to a container of packets
+/// scatter(ps, vs);       | convert a container of packets to a std::vector of Vector3D/Vector4D
+/// for (p : ps.packets)   | loop over the packets of a container
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // operators:
+    // =============================================================================
+
+    /// vector addition assignment
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> & operator+=(Vector3DPacket<T, N> &       lhs,
+                                                Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// vector addition assignment
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> & operator+=(Vector4DPacket<T, N> &       lhs,
+                                                Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector subtraction assignment
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> & operator-=(Vector3DPacket<T, N> &       lhs,
+                                                Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// vector subtraction assignment
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> & operator-=(Vector4DPacket<T, N> &       lhs,
+                                                Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar multiplication assignment
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> & operator*=(Vector3DPacket<T, N> & lhs,
+                                                T const &              rhs) noexcept;
+
+    /// scalar multiplication assignment
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> & operator*=(Vector4DPacket<T, N> & lhs,
+                                                T const &              rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise multiplication assignment
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> & operator*=(Vector3DPacket<T, N> &       lhs,
+                                                Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// element-wise multiplication assignment
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> & operator*=(Vector4DPacket<T, N> &       lhs,
+                                                Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar division assignment
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> & operator/=(Vector3DPacket<T, N> & lhs,
+                                                T const &              rhs) noexcept;
+
+    /// scalar division assignment
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> & operator/=(Vector4DPacket<T, N> & lhs,
+                                                T const &              rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise division assignment
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> & operator/=(Vector3DPacket<T, N> &       lhs,
+                                                Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// element-wise division assignment
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> & operator/=(Vector4DPacket<T, N> &       lhs,
+                                                Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise unary plus
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator+(Vector3DPacket<T, N> const & value) noexcept;
+
+    /// element-wise unary plus
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator+(Vector4DPacket<T, N> const & value) noexcept;
+
+    // =============================================================================
+
+    /// vector negation
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator-(Vector3DPacket<T, N> const & value) noexcept;
+
+    /// vector negation
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator-(Vector4DPacket<T, N> const & value) noexcept;
+
+    // =============================================================================
+
+    /// vector addition
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator+(Vector3DPacket<T, N> const & lhs,
+                                             Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// vector addition
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator+(Vector4DPacket<T, N> const & lhs,
+                                             Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector subtraction
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator-(Vector3DPacket<T, N> const & lhs,
+                                             Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// vector subtraction
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator-(Vector4DPacket<T, N> const & lhs,
+                                             Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar multiplication
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator*(T const &                    lhs,
+                                             Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// scalar multiplication
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(T const &                    lhs,
+                                             Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar multiplication
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator*(Vector3DPacket<T, N> const & lhs,
+                                             T const &                    rhs) noexcept;
+
+    /// scalar multiplication
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(Vector4DPacket<T, N> const & lhs,
+                                             T const &                    rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise multiplication
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator*(Vector3DPacket<T, N> const & lhs,
+                                             Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// element-wise multiplication
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator*(Vector4DPacket<T, N> const & lhs,
+                                             Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar division
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator/(Vector3DPacket<T, N> const & lhs,
+                                             T const &                    rhs) noexcept;
+
+    /// scalar division
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator/(Vector4DPacket<T, N> const & lhs,
+                                             T const &                    rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise division
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> operator/(Vector3DPacket<T, N> const & lhs,
+                                             Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// element-wise division
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> operator/(Vector4DPacket<T, N> const & lhs,
+                                             Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector equality of every lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr bool operator==(Vector3DPacket<T, N> const & lhs,
+                              Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// vector equality of every lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr bool operator==(Vector4DPacket<T, N> const & lhs,
+                              Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector inequality of any lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr bool operator!=(Vector3DPacket<T, N> const & lhs,
+                              Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// vector inequality of any lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr bool operator!=(Vector4DPacket<T, N> const & lhs,
+                              Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+    // lane access & functions:
+    // =============================================================================
+
+    /// packet with every lane set to value
+    /// @relates Vector3DPacket
+    template <std::size_t N, typename T>
+    constexpr Vector3DPacket<T, N> broadcast(Vector3D<T> const & value) noexcept;
+
+    /// packet with every lane set to value
+    /// @relates Vector4DPacket
+    template <std::size_t N, typename T>
+    constexpr Vector4DPacket<T, N> broadcast(Vector4D<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// vector of the given lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3D<T> get_lane(Vector3DPacket<T, N> const & value,
+                                   std::size_t const            lane) noexcept;
+
+    /// vector of the given lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4D<T> get_lane(Vector4DPacket<T, N> const & value,
+                                   std::size_t const            lane) noexcept;
+
+    // =============================================================================
+
+    /// set the vector of the given lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr void set_lane(Vector3DPacket<T, N> & values,
+                            std::size_t const      lane,
+                            Vector3D<T> const &    value) noexcept;
+
+    /// set the vector of the given lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr void set_lane(Vector4DPacket<T, N> & values,
+                            std::size_t const      lane,
+                            Vector4D<T> const &    value) noexcept;
+
+    // =============================================================================
+
+    /// element-wise clamp of each lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> clamp(Vector3DPacket<T, N> const & value,
+                                         T const &                    minValue,
+                                         T const &                    maxValue) noexcept;
+
+    /// element-wise clamp of each lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> clamp(Vector4DPacket<T, N> const & value,
+                                         T const &                    minValue,
+                                         T const &                    maxValue) noexcept;
+
+    // =============================================================================
+
+    /// vector3D cross product of each lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> cross(Vector3DPacket<T, N> const & lhs,
+                                         Vector3DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// distance between each lane of lhs and rhs
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> distance(Vector3DPacket<T, N> const & lhs,
+                                        Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// distance between each lane of lhs and rhs
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> distance(Vector4DPacket<T, N> const & lhs,
+                                        Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// square of the distance between each lane of lhs and rhs
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> distance_squared(Vector3DPacket<T, N> const & lhs,
+                                                Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// square of the distance between each lane of lhs and rhs
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> distance_squared(Vector4DPacket<T, N> const & lhs,
+                                                Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// dot product of each lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> dot(Vector3DPacket<T, N> const & lhs,
+                                   Vector3DPacket<T, N> const & rhs) noexcept;
+
+    /// dot product of each lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> dot(Vector4DPacket<T, N> const & lhs,
+                                   Vector4DPacket<T, N> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector length of each lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> length(Vector3DPacket<T, N> const & value) noexcept;
+
+    /// vector length of each lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> length(Vector4DPacket<T, N> const & value) noexcept;
+
+    // =============================================================================
+
+    /// square of the vector length of each lane
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> length_squared(Vector3DPacket<T, N> const & value) noexcept;
+
+    /// square of the vector length of each lane
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr std::array<T, N> length_squared(Vector4DPacket<T, N> const & value) noexcept;
+
+    // =============================================================================
+
+    /// linear interpolation of each lane with the same t
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> lerp(Vector3DPacket<T, N> const & value0,
+                                        Vector3DPacket<T, N> const & value1,
+                                        T const &                    t) noexcept;
+
+    /// linear interpolation of each lane with the same t
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> lerp(Vector4DPacket<T, N> const & value0,
+                                        Vector4DPacket<T, N> const & value1,
+                                        T const &                    t) noexcept;
+
+    // =============================================================================
+
+    /// linear interpolation of each lane with the corresponding t
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> lerp(Vector3DPacket<T, N> const & value0,
+                                        Vector3DPacket<T, N> const & value1,
+                                        std::array<T, N> const &     ts) noexcept;
+
+    /// linear interpolation of each lane with the corresponding t
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> lerp(Vector4DPacket<T, N> const & value0,
+                                        Vector4DPacket<T, N> const & value1,
+                                        std::array<T, N> const &     ts) noexcept;
+
+    // =============================================================================
+
+    /// normalized vector in the direction of each lane, or zero
+    /// @relates Vector3DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector3DPacket<T, N> normalize(Vector3DPacket<T, N> const & value) noexcept;
+
+    /// normalized vector in the direction of each lane, or zero
+    /// @relates Vector4DPacket
+    template <typename T, std::size_t N>
+    constexpr Vector4DPacket<T, N> normalize(Vector4DPacket<T, N> const & value) noexcept;
+
+    // =============================================================================
+
+    /// resize to count vectors (rounded up to whole packets), new & padding lanes are zero
+    /// @relates Vector3DPacketArray
+    template <typename T, std::size_t N>
+    constexpr void resize(Vector3DPacketArray<T, N> & values,
+                          std::size_t const           count);
+
+    /// resize to count vectors (rounded up to whole packets), new & padding lanes are zero
+    /// @relates Vector4DPacketArray
+    template <typename T, std::size_t N>
+    constexpr void resize(Vector4DPacketArray<T, N> & values,
+                          std::size_t const           count);
+
+    // =============================================================================
+
+    /// convert vectors to a container of packets
+    /// @relates Vector3DPacketArray
+    template <typename T, std::size_t N>
+    constexpr void gather(std::vector<Vector3D<T>> const & values,
+                          Vector3DPacketArray<T, N> &      results);
+
+    /// convert vectors to a container of packets
+    /// @relates Vector4DPacketArray
+    template <typename T, std::size_t N>
+    constexpr void gather(std::vector<Vector4D<T>> const & values,
+                          Vector4DPacketArray<T, N> &      results);
+
+    // =============================================================================
+
+    /// convert a container of packets to vectors
+    /// @relates Vector3DPacketArray
+    template <typename T, std::size_t N>
+    constexpr void scatter(Vector3DPacketArray<T, N> const & values,
+                           std::vector<Vector3D<T>> &        results);
+
+    /// convert a container of packets to vectors
+    /// @relates Vector4DPacketArray
+    template <typename T, std::size_t N>
+    constexpr void scatter(Vector4DPacketArray<T, N> const & values,
+                           std::vector<Vector4D<T>> &        results);
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// ggm::operator+=
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> & ggm::operator+=(Vector3DPacket<T, N> &       lhs,
+                                                      Vector3DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) + get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> & ggm::operator+=(Vector4DPacket<T, N> &       lhs,
+                                                      Vector4DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) + get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator-=
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> & ggm::operator-=(Vector3DPacket<T, N> &       lhs,
+                                                      Vector3DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) - get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> & ggm::operator-=(Vector4DPacket<T, N> &       lhs,
+                                                      Vector4DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) - get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator*=
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> & ggm::operator*=(Vector3DPacket<T, N> & lhs,
+                                                      T const &              rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) * rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> & ggm::operator*=(Vector4DPacket<T, N> & lhs,
+                                                      T const &              rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) * rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> & ggm::operator*=(Vector3DPacket<T, N> &       lhs,
+                                                      Vector3DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) * get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> & ggm::operator*=(Vector4DPacket<T, N> &       lhs,
+                                                      Vector4DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) * get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator/=
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> & ggm::operator/=(Vector3DPacket<T, N> & lhs,
+                                                      T const &              rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) / rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> & ggm::operator/=(Vector4DPacket<T, N> & lhs,
+                                                      T const &              rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) / rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> & ggm::operator/=(Vector3DPacket<T, N> &       lhs,
+                                                      Vector3DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) / get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> & ggm::operator/=(Vector4DPacket<T, N> &       lhs,
+                                                      Vector4DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(lhs, lane, get_lane(lhs, lane) / get_lane(rhs, lane));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator+
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator+(Vector3DPacket<T, N> const & value) noexcept
+{
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator+(Vector4DPacket<T, N> const & value) noexcept
+{
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator+(Vector3DPacket<T, N> const & lhs,
+                                                   Vector3DPacket<T, N> const & rhs) noexcept
+{
+    Vector3DPacket<T, N> result = lhs;
+    result += rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator+(Vector4DPacket<T, N> const & lhs,
+                                                   Vector4DPacket<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result = lhs;
+    result += rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator-
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator-(Vector3DPacket<T, N> const & value) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, -get_lane(value, lane));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator-(Vector4DPacket<T, N> const & value) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, -get_lane(value, lane));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator-(Vector3DPacket<T, N> const & lhs,
+                                                   Vector3DPacket<T, N> const & rhs) noexcept
+{
+    Vector3DPacket<T, N> result = lhs;
+    result -= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator-(Vector4DPacket<T, N> const & lhs,
+                                                   Vector4DPacket<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result = lhs;
+    result -= rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator*
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator*(T const &                    lhs,
+                                                   Vector3DPacket<T, N> const & rhs) noexcept
+{
+    Vector3DPacket<T, N> result = rhs;
+    result *= lhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(T const &                    lhs,
+                                                   Vector4DPacket<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result = rhs;
+    result *= lhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator*(Vector3DPacket<T, N> const & lhs,
+                                                   T const &                    rhs) noexcept
+{
+    Vector3DPacket<T, N> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(Vector4DPacket<T, N> const & lhs,
+                                                   T const &                    rhs) noexcept
+{
+    Vector4DPacket<T, N> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator*(Vector3DPacket<T, N> const & lhs,
+                                                   Vector3DPacket<T, N> const & rhs) noexcept
+{
+    Vector3DPacket<T, N> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator*(Vector4DPacket<T, N> const & lhs,
+                                                   Vector4DPacket<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator/
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator/(Vector3DPacket<T, N> const & lhs,
+                                                   T const &                    rhs) noexcept
+{
+    Vector3DPacket<T, N> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator/(Vector4DPacket<T, N> const & lhs,
+                                                   T const &                    rhs) noexcept
+{
+    Vector4DPacket<T, N> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::operator/(Vector3DPacket<T, N> const & lhs,
+                                                   Vector3DPacket<T, N> const & rhs) noexcept
+{
+    Vector3DPacket<T, N> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::operator/(Vector4DPacket<T, N> const & lhs,
+                                                   Vector4DPacket<T, N> const & rhs) noexcept
+{
+    Vector4DPacket<T, N> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator==
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr bool ggm::operator==(Vector3DPacket<T, N> const & lhs,
+                               Vector3DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        if (get_lane(lhs, lane) != get_lane(rhs, lane))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr bool ggm::operator==(Vector4DPacket<T, N> const & lhs,
+                               Vector4DPacket<T, N> const & rhs) noexcept
+{
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        if (get_lane(lhs, lane) != get_lane(rhs, lane))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// =============================================================================
+// ggm::operator!=
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr bool ggm::operator!=(Vector3DPacket<T, N> const & lhs,
+                               Vector3DPacket<T, N> const & rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr bool ggm::operator!=(Vector4DPacket<T, N> const & lhs,
+                               Vector4DPacket<T, N> const & rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+// =============================================================================
+// ggm::broadcast
+// =============================================================================
+
+template <std::size_t N, typename T>
+constexpr ggm::Vector3DPacket<T, N> ggm::broadcast(Vector3D<T> const & value) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, value);
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N, typename T>
+constexpr ggm::Vector4DPacket<T, N> ggm::broadcast(Vector4D<T> const & value) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, value);
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::get_lane
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3D<T> ggm::get_lane(Vector3DPacket<T, N> const & value,
+                                         std::size_t const            lane) noexcept
+{
+    assert(lane < N);
+
+    return Vector3D<T>{
+        value.x[lane],
+        value.y[lane],
+        value.z[lane],
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4D<T> ggm::get_lane(Vector4DPacket<T, N> const & value,
+                                         std::size_t const            lane) noexcept
+{
+    assert(lane < N);
+
+    return Vector4D<T>{
+        value.x[lane],
+        value.y[lane],
+        value.z[lane],
+        value.w[lane],
+    };
+}
+
+// =============================================================================
+// ggm::set_lane
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr void ggm::set_lane(Vector3DPacket<T, N> & values,
+                             std::size_t const      lane,
+                             Vector3D<T> const &    value) noexcept
+{
+    assert(lane < N);
+
+    values.x[lane] = value.x;
+    values.y[lane] = value.y;
+    values.z[lane] = value.z;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr void ggm::set_lane(Vector4DPacket<T, N> & values,
+                             std::size_t const      lane,
+                             Vector4D<T> const &    value) noexcept
+{
+    assert(lane < N);
+
+    values.x[lane] = value.x;
+    values.y[lane] = value.y;
+    values.z[lane] = value.z;
+    values.w[lane] = value.w;
+}
+
+// =============================================================================
+// ggm::clamp
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::clamp(Vector3DPacket<T, N> const & value,
+                                               T const &                    minValue,
+                                               T const &                    maxValue) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, clamp(get_lane(value, lane), minValue, maxValue));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::clamp(Vector4DPacket<T, N> const & value,
+                                               T const &                    minValue,
+                                               T const &                    maxValue) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, clamp(get_lane(value, lane), minValue, maxValue));
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::cross
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::cross(Vector3DPacket<T, N> const & lhs,
+                                               Vector3DPacket<T, N> const & rhs) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, cross(get_lane(lhs, lane), get_lane(rhs, lane)));
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::distance
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::distance(Vector3DPacket<T, N> const & lhs,
+                                         Vector3DPacket<T, N> const & rhs) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = distance(get_lane(lhs, lane), get_lane(rhs, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::distance(Vector4DPacket<T, N> const & lhs,
+                                         Vector4DPacket<T, N> const & rhs) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = distance(get_lane(lhs, lane), get_lane(rhs, lane));
+    }
+
+    return results;
+}
+
+// =============================================================================
+// ggm::distance_squared
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::distance_squared(Vector3DPacket<T, N> const & lhs,
+                                                 Vector3DPacket<T, N> const & rhs) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = distance_squared(get_lane(lhs, lane), get_lane(rhs, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::distance_squared(Vector4DPacket<T, N> const & lhs,
+                                                 Vector4DPacket<T, N> const & rhs) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = distance_squared(get_lane(lhs, lane), get_lane(rhs, lane));
+    }
+
+    return results;
+}
+
+// =============================================================================
+// ggm::dot
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::dot(Vector3DPacket<T, N> const & lhs,
+                                    Vector3DPacket<T, N> const & rhs) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = dot(get_lane(lhs, lane), get_lane(rhs, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::dot(Vector4DPacket<T, N> const & lhs,
+                                    Vector4DPacket<T, N> const & rhs) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = dot(get_lane(lhs, lane), get_lane(rhs, lane));
+    }
+
+    return results;
+}
+
+// =============================================================================
+// ggm::length
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::length(Vector3DPacket<T, N> const & value) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = length(get_lane(value, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::length(Vector4DPacket<T, N> const & value) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = length(get_lane(value, lane));
+    }
+
+    return results;
+}
+
+// =============================================================================
+// ggm::length_squared
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::length_squared(Vector3DPacket<T, N> const & value) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = length_squared(get_lane(value, lane));
+    }
+
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> ggm::length_squared(Vector4DPacket<T, N> const & value) noexcept
+{
+    std::array<T, N> results{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        results[lane] = length_squared(get_lane(value, lane));
+    }
+
+    return results;
+}
+
+// =============================================================================
+// ggm::lerp
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::lerp(Vector3DPacket<T, N> const & value0,
+                                              Vector3DPacket<T, N> const & value1,
+                                              T const &                    t) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, lerp(get_lane(value0, lane), get_lane(value1, lane), t));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::lerp(Vector4DPacket<T, N> const & value0,
+                                              Vector4DPacket<T, N> const & value1,
+                                              T const &                    t) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, lerp(get_lane(value0, lane), get_lane(value1, lane), t));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::lerp(Vector3DPacket<T, N> const & value0,
+                                              Vector3DPacket<T, N> const & value1,
+                                              std::array<T, N> const &     ts) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, lerp(get_lane(value0, lane), get_lane(value1, lane), ts[lane]));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::lerp(Vector4DPacket<T, N> const & value0,
+                                              Vector4DPacket<T, N> const & value1,
+                                              std::array<T, N> const &     ts) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, lerp(get_lane(value0, lane), get_lane(value1, lane), ts[lane]));
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::normalize
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector3DPacket<T, N> ggm::normalize(Vector3DPacket<T, N> const & value) noexcept
+{
+    Vector3DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, normalize(get_lane(value, lane)));
+    }
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr ggm::Vector4DPacket<T, N> ggm::normalize(Vector4DPacket<T, N> const & value) noexcept
+{
+    Vector4DPacket<T, N> result{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        set_lane(result, lane, normalize(get_lane(value, lane)));
+    }
+
+    return result;
+}
+
+// =============================================================================
+// ggm::resize
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr void ggm::resize(Vector3DPacketArray<T, N> & values,
+                           std::size_t const           count)
+{
+    values.packets.resize((count + N - 1) / N);
+    values.count = count;
+
+    // zero the padding lanes of the last packet (after shrinking)
+    std::size_t const laneCount = values.packets.size() * N;
+    for (std::size_t index = count; index < laneCount; ++index)
+    {
+        set_lane(values.packets[index / N], index % N, Vector3D<T>{});
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr void ggm::resize(Vector4DPacketArray<T, N> & values,
+                           std::size_t const           count)
+{
+    values.packets.resize((count + N - 1) / N);
+    values.count = count;
+
+    // zero the padding lanes of the last packet (after shrinking)
+    std::size_t const laneCount = values.packets.size() * N;
+    for (std::size_t index = count; index < laneCount; ++index)
+    {
+        set_lane(values.packets[index / N], index % N, Vector4D<T>{});
+    }
+}
+
+// =============================================================================
+// ggm::gather
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr void ggm::gather(std::vector<Vector3D<T>> const & values,
+                           Vector3DPacketArray<T, N> &      results)
+{
+    resize(results, values.size());
+
+    std::size_t const count = values.size();
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        set_lane(results.packets[index / N], index % N, values[index]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr void ggm::gather(std::vector<Vector4D<T>> const & values,
+                           Vector4DPacketArray<T, N> &      results)
+{
+    resize(results, values.size());
+
+    std::size_t const count = values.size();
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        set_lane(results.packets[index / N], index % N, values[index]);
+    }
+}
+
+// =============================================================================
+// ggm::scatter
+// =============================================================================
+
+template <typename T, std::size_t N>
+constexpr void ggm::scatter(Vector3DPacketArray<T, N> const & values,
+                            std::vector<Vector3D<T>> &        results)
+{
+    results.resize(values.count);
+
+    std::size_t const count = values.count;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        results[index] = get_lane(values.packets[index / N], index % N);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+constexpr void ggm::scatter(Vector4DPacketArray<T, N> const & values,
+                            std::vector<Vector4D<T>> &        results)
+{
+    results.resize(values.count);
+
+    std::size_t const count = values.count;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        results[index] = get_lane(values.packets[index / N], index % N);
+    }
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_PACKET_UTIL_H
@@ -0,0 +1,319 @@
+#pragma once
+#ifndef GGM_VECTOR_RANDOM_H
+#define GGM_VECTOR_RANDOM_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Numeric/Random.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include <bit>
+#include <cstdint>
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Random vectors & uniformly distributed samples of shapes, see VectorBatch.h for the span versions.
+///
+/// The random vectors are counter-based (see Random.h): random_vector3D(seed, n) is a function of only the
+/// seed & n, so samples can be generated in any order & with any SIMD width. The uniform_* functions map a
+/// vector of uniform values in [0, 1) (e.g. a random vector) to a uniformly distributed point of a shape,
+/// with branch-free arithmetic (i.e. no rejection sampling), so loops over them are vectorizable.
+///
+/// random vectors:
+/// ---------------
+///
+/// Syntax                                  | Description
+/// ------                                  | -----------
+/// u = random_vector2D(seed, n);           | the n-th random Vector2D<float> in [0, 1)^2 of the sequence of seed
+/// u = random_vector3D(seed, n);           | the n-th random Vector3D<float> in [0, 1)^3 of the sequence of seed
+/// u = random_vector4D(seed, n);           | the n-th random Vector4D<float> in [0, 1)^4 of the sequence of seed
+///
+/// samples:
+/// --------
+///
+/// Syntax                                  | Description
+/// ------                                  | -----------
+/// v = uniform_in_box(u, min, max);        | point in the box [min, max] (Vector2D, Vector3D or Vector4D)
+/// v = uniform_in_disk(u2);                | point in the unit disk
+/// v = uniform_on_sphere(u2);              | point on the unit sphere, i.e. a random direction
+/// v = uniform_in_sphere(u3);              | point in the unit sphere
+/// v = uniform_in_cone(u2, dir, cosAngle); | direction within the angle of dir (a unit vector)
+/// v = uniform_in_hemisphere(u2, n);       | direction in the hemisphere around n (a unit vector)
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // random vectors:
+    // =============================================================================
+
+    /// the counter-th random vector in [0, 1)^2 of the sequence of seed, i.e. the random floats 2 * counter &
+    /// 2 * counter + 1, see @ref random_float
+    /// @relates Vector2D
+    constexpr Vector2D<float> random_vector2D(std::uint32_t const seed,
+                                              std::uint32_t const counter) noexcept;
+
+    /// the counter-th random vector in [0, 1)^3 of the sequence of seed, i.e. the random floats 3 * counter
+    /// through 3 * counter + 2, see @ref random_float
+    /// @relates Vector3D
+    constexpr Vector3D<float> random_vector3D(std::uint32_t const seed,
+                                              std::uint32_t const counter) noexcept;
+
+    /// the counter-th random vector in [0, 1)^4 of the sequence of seed, i.e. the random floats 4 * counter
+    /// through 4 * counter + 3, see @ref random_float
+    /// @relates Vector4D
+    constexpr Vector4D<float> random_vector4D(std::uint32_t const seed,
+                                              std::uint32_t const counter) noexcept;
+
+    // =============================================================================
+    // samples:
+    // =============================================================================
+
+    /// uniformly distributed point in the box [boxMin, boxMax], i.e. lerp(boxMin, boxMax, uniform)
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @relates Vector2D
+    constexpr Vector2D<float> uniform_in_box(Vector2D<float> const & uniform,
+                                             Vector2D<float> const & boxMin,
+                                             Vector2D<float> const & boxMax) noexcept;
+
+    /// uniformly distributed point in the box [boxMin, boxMax], i.e. lerp(boxMin, boxMax, uniform)
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @relates Vector3D
+    constexpr Vector3D<float> uniform_in_box(Vector3D<float> const & uniform,
+                                             Vector3D<float> const & boxMin,
+                                             Vector3D<float> const & boxMax) noexcept;
+
+    /// uniformly distributed point in the box [boxMin, boxMax], i.e. lerp(boxMin, boxMax, uniform)
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @relates Vector4D
+    constexpr Vector4D<float> uniform_in_box(Vector4D<float> const & uniform,
+                                             Vector4D<float> const & boxMin,
+                                             Vector4D<float> const & boxMax) noexcept;
+
+    // -----------------------------------------------------------------------------
+
+    /// uniformly distributed point in the unit disk (radius sqrt(uniform.x), angle 2 pi uniform.y)
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @relates Vector2D
+    constexpr Vector2D<float> uniform_in_disk(Vector2D<float> const & uniform) noexcept;
+
+    // -----------------------------------------------------------------------------
+
+    /// uniformly distributed point on the unit sphere, i.e. a direction (z = 1 - 2 uniform.x, angle about z
+    /// 2 pi uniform.y)
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @relates Vector3D
+    constexpr Vector3D<float> uniform_on_sphere(Vector2D<float> const & uniform) noexcept;
+
+    /// uniformly distributed point in the unit sphere, i.e. uniform_on_sphere(uniform.xy) scaled by the cube
+    /// root of uniform.z
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @relates Vector3D
+    constexpr Vector3D<float> uniform_in_sphere(Vector3D<float> const & uniform) noexcept;
+
+    // -----------------------------------------------------------------------------
+
+    /// uniformly distributed direction within the cone of the unit vector direction, i.e. whose angle to
+    /// direction is at most acos(cosHalfAngle)
+    /// @param[in] uniform      Uniform values in [0, 1)
+    /// @param[in] direction    The axis of the cone, must be a unit vector
+    /// @param[in] cosHalfAngle The cosine of the half angle of the cone, in [-1, 1]
+    /// @relates Vector3D
+    constexpr Vector3D<float> uniform_in_cone(Vector2D<float> const & uniform,
+                                              Vector3D<float> const & direction,
+                                              float const             cosHalfAngle) noexcept;
+
+    /// uniformly distributed direction in the hemisphere around the unit vector normal, i.e.
+    /// uniform_in_cone(uniform, normal, 0)
+    /// @param[in] uniform Uniform values in [0, 1)
+    /// @param[in] normal  The axis of the hemisphere, must be a unit vector
+    /// @relates Vector3D
+    constexpr Vector3D<float> uniform_in_hemisphere(Vector2D<float> const & uniform,
+                                                    Vector3D<float> const & normal) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::VectorRandomImpl
+{
+    // =============================================================================
+
+    inline constexpr float TwoPi = 6.28318530717958647692f;
+
+    // -----------------------------------------------------------------------------
+
+    /// cube root of value in [0, 1], branch-free (a bit-level estimate refined by Newton-Raphson iterations)
+    constexpr float unit_cbrt(float const value) noexcept
+    {
+        // note: the estimate divides the exponent by 3 (within ~5%), & each iteration ~squares the relative
+        // error, so 3 iterations are enough for float (the estimate is positive, so 0 needs no special case)
+        float estimate = std::bit_cast<float>(std::bit_cast<std::uint32_t>(value) / 3u + 709921077u);
+        for (int i = 0; i < 3; ++i)
+        {
+            estimate = estimate - (estimate * estimate * estimate - value) / (3.0f * estimate * estimate);
+        }
+        return (value > 0.0f) ? estimate : 0.0f;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// a unit vector with angle acos(cosTheta) to the z axis & angle about the z axis 2 pi uniformPhi
+    constexpr Vector3D<float> unit_vector_from_polar(float const cosTheta,
+                                                     float const uniformPhi) noexcept
+    {
+        float const         sinTheta = sqrt(max(0.0f, 1.0f - cosTheta * cosTheta));
+        SinCos<float> const phi      = sincos(TwoPi * uniformPhi);
+        return Vector3D<float>{ sinTheta * phi.cos, sinTheta * phi.sin, cosTheta };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// rotate value from a frame where +z is the unit vector axis to world space
+    /// @details
+    /// The orthonormal basis is the branch-free construction of Duff et al. ("Building an Orthonormal Basis,
+    /// Revisited", 2017).
+    constexpr Vector3D<float> frame_to_axis(Vector3D<float> const & value,
+                                            Vector3D<float> const & axis) noexcept
+    {
+        float const sign = (axis.z < 0.0f) ? -1.0f : 1.0f;
+        float const a    = -1.0f / (sign + axis.z);
+        float const b    = axis.x * axis.y * a;
+
+        Vector3D<float> const tangent{ 1.0f + sign * axis.x * axis.x * a, sign * b, -sign * axis.x };
+        Vector3D<float> const bitangent{ b, sign + axis.y * axis.y * a, -axis.y };
+
+        return tangent * value.x + bitangent * value.y + axis * value.z;
+    }
+
+    // =============================================================================
+} // namespace ggm::VectorRandomImpl
+
+// =============================================================================
+// random vectors:
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::random_vector2D(std::uint32_t const seed,
+                                                    std::uint32_t const counter) noexcept
+{
+    std::uint32_t const first = counter * 2u;
+    return Vector2D<float>{
+        random_float(seed, first),
+        random_float(seed, first + 1u),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::random_vector3D(std::uint32_t const seed,
+                                                    std::uint32_t const counter) noexcept
+{
+    std::uint32_t const first = counter * 3u;
+    return Vector3D<float>{
+        random_float(seed, first),
+        random_float(seed, first + 1u),
+        random_float(seed, first + 2u),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::random_vector4D(std::uint32_t const seed,
+                                                    std::uint32_t const counter) noexcept
+{
+    std::uint32_t const first = counter * 4u;
+    return Vector4D<float>{
+        random_float(seed, first),
+        random_float(seed, first + 1u),
+        random_float(seed, first + 2u),
+        random_float(seed, first + 3u),
+    };
+}
+
+// =============================================================================
+// samples:
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::uniform_in_box(Vector2D<float> const & uniform,
+                                                   Vector2D<float> const & boxMin,
+                                                   Vector2D<float> const & boxMax) noexcept
+{
+    return lerp(boxMin, boxMax, uniform);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::uniform_in_box(Vector3D<float> const & uniform,
+                                                   Vector3D<float> const & boxMin,
+                                                   Vector3D<float> const & boxMax) noexcept
+{
+    return lerp(boxMin, boxMax, uniform);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector4D<float> ggm::uniform_in_box(Vector4D<float> const & uniform,
+                                                   Vector4D<float> const & boxMin,
+                                                   Vector4D<float> const & boxMax) noexcept
+{
+    return lerp(boxMin, boxMax, uniform);
+}
+
+// =============================================================================
+
+constexpr ggm::Vector2D<float> ggm::uniform_in_disk(Vector2D<float> const & uniform) noexcept
+{
+    float const         radius = sqrt(uniform.x);
+    SinCos<float> const phi    = sincos(VectorRandomImpl::TwoPi * uniform.y);
+    return Vector2D<float>{ radius * phi.cos, radius * phi.sin };
+}
+
+// =============================================================================
+
+constexpr ggm::Vector3D<float> ggm::uniform_on_sphere(Vector2D<float> const & uniform) noexcept
+{
+    return VectorRandomImpl::unit_vector_from_polar(1.0f - 2.0f * uniform.x, uniform.y);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::uniform_in_sphere(Vector3D<float> const & uniform) noexcept
+{
+    float const radius = VectorRandomImpl::unit_cbrt(uniform.z);
+    return uniform_on_sphere(Vector2D<float>{ uniform.x, uniform.y }) * radius;
+}
+
+// =============================================================================
+
+constexpr ggm::Vector3D<float> ggm::uniform_in_cone(Vector2D<float> const & uniform,
+                                                    Vector3D<float> const & direction,
+                                                    float const             cosHalfAngle) noexcept
+{
+    using namespace VectorRandomImpl;
+
+    // the cos of the angle to the axis is uniform in [cosHalfAngle, 1] (as the area of a spherical cap is
+    // proportional to its height)
+    float const           cosTheta = lerp(1.0f, cosHalfAngle, uniform.x);
+    Vector3D<float> const local    = unit_vector_from_polar(cosTheta, uniform.y);
+    return frame_to_axis(local, direction);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<float> ggm::uniform_in_hemisphere(Vector2D<float> const & uniform,
+                                                          Vector3D<float> const & normal) noexcept
+{
+    return uniform_in_cone(uniform, normal, 0.0f);
+}
+
+// =============================================================================
+
+#endif // GGM_VECTOR_RANDOM_H
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef GGM_VECTOR_SOA_H
+#define GGM_VECTOR_SOA_H
+
+#include <vector>
+
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    /// @defgroup VectorSoA Structure of arrays containers of 3D and 4D vectors
+    /// @details
+    /// The elements of the i(th) vector are x[i], y[i], z[i] (& w[i]), so a loop over the vectors reads &
+    /// writes each element array contiguously, which lets compilers vectorize the loop with the full SIMD
+    /// width (unlike a span of Vector3D, whose elements are interleaved). See VectorSoAUtil.h.
+    ///
+    /// Every element array must have the same size.
+    // =============================================================================
+
+    // =============================================================================
+    // Vector3DSoA
+    // =============================================================================
+
+    /// A structure of arrays container of 3-dimensional mathematical vectors
+    /// @ingroup VectorSoA
+    /// @tparam T The type of each vector element (usually float or double)
+    template <typename T>
+    struct Vector3DSoA
+    {
+        // members:
+        std::vector<T> x;
+        std::vector<T> y;
+        std::vector<T> z;
+    };
+
+    // =============================================================================
+    // Vector4DSoA
+    // =============================================================================
+
+    /// A structure of arrays container of 4-dimensional mathematical vectors
+    /// @ingroup VectorSoA
+    /// @tparam T The type of each vector element (usually float or double)
+    template <typename T>
+    struct Vector4DSoA
+    {
+        // members:
+        std::vector<T> x;
+        std::vector<T> y;
+        std::vector<T> z;
+        std::vector<T> w;
+    };
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+
+#endif // GGM_VECTOR_SOA_H
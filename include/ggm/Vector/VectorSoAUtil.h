@@ -0,0 +1,1761 @@
+#pragma once
+#ifndef GGM_VECTOR_SOA_UTIL_H
+#define GGM_VECTOR_SOA_UTIL_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorSoA.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// the restrict qualifier of the loops whose results don't overlap their inputs (GCC, Clang & MSVC all accept
+// __restrict in C++)
+#define GGM_RESTRICT __restrict
+
+// =============================================================================
+/// @addtogroup VectorSoA
+/// @{
+/// @details
+///
+/// Batch versions of the VectorUtil.h operators & functions, which apply the Vector3D/Vector4D function
+/// to each vector of the containers. Each loop is a plain indexed loop that loads the i(th) vector from the
+/// element arrays, calls the VectorUtil.h function & stores the result, so the results are the same as the
+/// Vector3D/Vector4D functions & compilers are able to auto-vectorize it (e.g. GCC & Clang at -O3, or -O2
+/// with -ftree-vectorize).
+///
+/// note: the loops that call sqrt (distance, length & normalize) only vectorize when sqrt doesn't set errno
+/// (e.g. -fno-math-errno). normalize computes the reciprocal of the length without a branch (see
+/// VectorSoAImpl::reciprocal_length), so it doesn't need -fno-trapping-math
+///
+/// note: because results may alias an input, cross & normalize check once whether results is an input & then
+/// loop over restrict qualified element arrays, so they vectorize without run-time overlap checks. In-place,
+/// normalize reads & writes the same arrays, & cross computes blocks of vectors into local arrays & copies them
+/// to the results. The other loops rely on the compiler's run-time overlap checks, which GCC limits to 10 per
+/// loop (--param vect-max-version-for-alias-checks), so GCC leaves e.g. lerp of Vector3DSoA scalar
+///
+/// Results must be the same size as the inputs (see resize), & may be the same container as an input
+/// (i.e. in-place). Functions with a scalar result per vector (e.g. dot, length) write to a span.
+///
+/// operators:
+/// ----------
+///
+/// Syntax        | Description
+/// ------        | -----------
+/// us += vs;     | vector addition assignment
+/// us -= vs;     | vector subtraction assignment
+/// us *= s;      | scalar multiplication assignment
+/// us *= vs;     | element-wise multiplication assignment
+/// us /= s;      | scalar division assignment
+/// us /= vs;     | element-wise division assignment
+/// us = vs + ws; | vector addition
+/// us = vs - ws; | vector subtraction
+/// us = s * vs;  | scalar multiplication
+/// us = vs * s;  | scalar multiplication
+/// us = vs * ws; | element-wise multiplication
+/// us = vs / s;  | scalar division
+/// us = vs / ws; | element-wise division
+///
+/// functions:
+/// ----------
+///
+/// Syntax                          | Description
+/// ------                          | -----------
+/// n = size(vs);                   | number of vectors
+/// resize(vs, n);                  | resize every element array to n vectors
+/// gather(aos, vs);                | convert a std::vector of Vector3D/Vector4D to a container
+/// scatter(vs, aos);               | convert a container to a std::vector of Vector3D/Vector4D
+/// clamp(vs, min, max, us);        | element-wise clamp of each vector
+/// cross(vs, ws, us);              | vector3D cross product of each pair of vectors
+/// distance(vs, ws, ss);           | distance between each pair of vectors
+/// distance_squared(vs, ws, ss);   | square of the distance between each pair of vectors
+/// dot(vs, ws, ss);                | dot product of each pair of vectors
+/// length(vs, ss);                 | vector length of each vector
+/// length_squared(vs, ss);         | square of the vector length of each vector
+/// lerp(v0s, v1s, t, us);          | linear interpolation between each pair of vectors with the same t
+/// lerp(v0s, v1s, ts, us);         | linear interpolation between each pair of vectors with the corresponding t
+/// normalize(vs, us);              | normalized vector in the direction of each vector, or zero
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // operators:
+    // =============================================================================
+
+    /// vector addition assignment
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> & operator+=(Vector3DSoA<T> &       lhs,
+                                          Vector3DSoA<T> const & rhs) noexcept;
+
+    /// vector addition assignment
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> & operator+=(Vector4DSoA<T> &       lhs,
+                                          Vector4DSoA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector subtraction assignment
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> & operator-=(Vector3DSoA<T> &       lhs,
+                                          Vector3DSoA<T> const & rhs) noexcept;
+
+    /// vector subtraction assignment
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> & operator-=(Vector4DSoA<T> &       lhs,
+                                          Vector4DSoA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar multiplication assignment
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> & operator*=(Vector3DSoA<T> & lhs,
+                                          T const &        rhs) noexcept;
+
+    /// scalar multiplication assignment
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> & operator*=(Vector4DSoA<T> & lhs,
+                                          T const &        rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise multiplication assignment
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> & operator*=(Vector3DSoA<T> &       lhs,
+                                          Vector3DSoA<T> const & rhs) noexcept;
+
+    /// element-wise multiplication assignment
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> & operator*=(Vector4DSoA<T> &       lhs,
+                                          Vector4DSoA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// scalar division assignment
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> & operator/=(Vector3DSoA<T> & lhs,
+                                          T const &        rhs) noexcept;
+
+    /// scalar division assignment
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> & operator/=(Vector4DSoA<T> & lhs,
+                                          T const &        rhs) noexcept;
+
+    // =============================================================================
+
+    /// element-wise division assignment
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> & operator/=(Vector3DSoA<T> &       lhs,
+                                          Vector3DSoA<T> const & rhs) noexcept;
+
+    /// element-wise division assignment
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> & operator/=(Vector4DSoA<T> &       lhs,
+                                          Vector4DSoA<T> const & rhs) noexcept;
+
+    // =============================================================================
+
+    /// vector addition
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator+(Vector3DSoA<T> const & lhs,
+                                       Vector3DSoA<T> const & rhs);
+
+    /// vector addition
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator+(Vector4DSoA<T> const & lhs,
+                                       Vector4DSoA<T> const & rhs);
+
+    // =============================================================================
+
+    /// vector subtraction
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator-(Vector3DSoA<T> const & lhs,
+                                       Vector3DSoA<T> const & rhs);
+
+    /// vector subtraction
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator-(Vector4DSoA<T> const & lhs,
+                                       Vector4DSoA<T> const & rhs);
+
+    // =============================================================================
+
+    /// scalar multiplication
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator*(T const &              lhs,
+                                       Vector3DSoA<T> const & rhs);
+
+    /// scalar multiplication
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator*(T const &              lhs,
+                                       Vector4DSoA<T> const & rhs);
+
+    // =============================================================================
+
+    /// scalar multiplication
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator*(Vector3DSoA<T> const & lhs,
+                                       T const &              rhs);
+
+    /// scalar multiplication
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator*(Vector4DSoA<T> const & lhs,
+                                       T const &              rhs);
+
+    // =============================================================================
+
+    /// element-wise multiplication
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator*(Vector3DSoA<T> const & lhs,
+                                       Vector3DSoA<T> const & rhs);
+
+    /// element-wise multiplication
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator*(Vector4DSoA<T> const & lhs,
+                                       Vector4DSoA<T> const & rhs);
+
+    // =============================================================================
+
+    /// scalar division
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator/(Vector3DSoA<T> const & lhs,
+                                       T const &              rhs);
+
+    /// scalar division
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator/(Vector4DSoA<T> const & lhs,
+                                       T const &              rhs);
+
+    // =============================================================================
+
+    /// element-wise division
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr Vector3DSoA<T> operator/(Vector3DSoA<T> const & lhs,
+                                       Vector3DSoA<T> const & rhs);
+
+    /// element-wise division
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr Vector4DSoA<T> operator/(Vector4DSoA<T> const & lhs,
+                                       Vector4DSoA<T> const & rhs);
+
+    // =============================================================================
+    // functions:
+    // =============================================================================
+
+    /// number of vectors
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr std::size_t size(Vector3DSoA<T> const & values) noexcept;
+
+    /// number of vectors
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr std::size_t size(Vector4DSoA<T> const & values) noexcept;
+
+    // =============================================================================
+
+    /// resize every element array to count vectors, new vectors are zero
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void resize(Vector3DSoA<T> &  values,
+                          std::size_t const count);
+
+    /// resize every element array to count vectors, new vectors are zero
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void resize(Vector4DSoA<T> &  values,
+                          std::size_t const count);
+
+    // =============================================================================
+
+    /// convert vectors to a structure of arrays container
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void gather(std::vector<Vector3D<T>> const & values,
+                          Vector3DSoA<T> &                 results);
+
+    /// convert vectors to a structure of arrays container
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void gather(std::vector<Vector4D<T>> const & values,
+                          Vector4DSoA<T> &                 results);
+
+    // =============================================================================
+
+    /// convert a structure of arrays container to vectors
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void scatter(Vector3DSoA<T> const &     values,
+                           std::vector<Vector3D<T>> & results);
+
+    /// convert a structure of arrays container to vectors
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void scatter(Vector4DSoA<T> const &     values,
+                           std::vector<Vector4D<T>> & results);
+
+    // =============================================================================
+
+    /// element-wise clamp of each vector
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void clamp(Vector3DSoA<T> const & values,
+                         T const &              minValue,
+                         T const &              maxValue,
+                         Vector3DSoA<T> &       results) noexcept;
+
+    /// element-wise clamp of each vector
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void clamp(Vector4DSoA<T> const & values,
+                         T const &              minValue,
+                         T const &              maxValue,
+                         Vector4DSoA<T> &       results) noexcept;
+
+    // =============================================================================
+
+    /// vector3D cross product of each pair of vectors
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void cross(Vector3DSoA<T> const & lhs,
+                         Vector3DSoA<T> const & rhs,
+                         Vector3DSoA<T> &       results) noexcept;
+
+    // =============================================================================
+
+    /// distance between each pair of vectors
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void distance(Vector3DSoA<T> const &                   lhs,
+                            Vector3DSoA<T> const &                   rhs,
+                            std::span<std::type_identity_t<T>> const results) noexcept;
+
+    /// distance between each pair of vectors
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void distance(Vector4DSoA<T> const &                   lhs,
+                            Vector4DSoA<T> const &                   rhs,
+                            std::span<std::type_identity_t<T>> const results) noexcept;
+
+    // =============================================================================
+
+    /// square of the distance between each pair of vectors
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void distance_squared(Vector3DSoA<T> const &                   lhs,
+                                    Vector3DSoA<T> const &                   rhs,
+                                    std::span<std::type_identity_t<T>> const results) noexcept;
+
+    /// square of the distance between each pair of vectors
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void distance_squared(Vector4DSoA<T> const &                   lhs,
+                                    Vector4DSoA<T> const &                   rhs,
+                                    std::span<std::type_identity_t<T>> const results) noexcept;
+
+    // =============================================================================
+
+    /// dot product of each pair of vectors
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void dot(Vector3DSoA<T> const &                   lhs,
+                       Vector3DSoA<T> const &                   rhs,
+                       std::span<std::type_identity_t<T>> const results) noexcept;
+
+    /// dot product of each pair of vectors
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void dot(Vector4DSoA<T> const &                   lhs,
+                       Vector4DSoA<T> const &                   rhs,
+                       std::span<std::type_identity_t<T>> const results) noexcept;
+
+    // =============================================================================
+
+    /// vector length of each vector
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void length(Vector3DSoA<T> const &                   values,
+                          std::span<std::type_identity_t<T>> const results) noexcept;
+
+    /// vector length of each vector
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void length(Vector4DSoA<T> const &                   values,
+                          std::span<std::type_identity_t<T>> const results) noexcept;
+
+    // =============================================================================
+
+    /// square of the vector length of each vector
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void length_squared(Vector3DSoA<T> const &                   values,
+                                  std::span<std::type_identity_t<T>> const results) noexcept;
+
+    /// square of the vector length of each vector
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void length_squared(Vector4DSoA<T> const &                   values,
+                                  std::span<std::type_identity_t<T>> const results) noexcept;
+
+    // =============================================================================
+
+    /// linear interpolation between each pair of vectors with the same t
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void lerp(Vector3DSoA<T> const & values0,
+                        Vector3DSoA<T> const & values1,
+                        T const &              t,
+                        Vector3DSoA<T> &       results) noexcept;
+
+    /// linear interpolation between each pair of vectors with the same t
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void lerp(Vector4DSoA<T> const & values0,
+                        Vector4DSoA<T> const & values1,
+                        T const &              t,
+                        Vector4DSoA<T> &       results) noexcept;
+
+    // =============================================================================
+
+    /// linear interpolation between each pair of vectors with the corresponding t
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void lerp(Vector3DSoA<T> const &                         values0,
+                        Vector3DSoA<T> const &                         values1,
+                        std::span<std::type_identity_t<T> const> const ts,
+                        Vector3DSoA<T> &                               results) noexcept;
+
+    /// linear interpolation between each pair of vectors with the corresponding t
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void lerp(Vector4DSoA<T> const &                         values0,
+                        Vector4DSoA<T> const &                         values1,
+                        std::span<std::type_identity_t<T> const> const ts,
+                        Vector4DSoA<T> &                               results) noexcept;
+
+    // =============================================================================
+
+    /// normalized vector in the direction of each vector, or zero
+    /// @relates Vector3DSoA
+    template <typename T>
+    constexpr void normalize(Vector3DSoA<T> const & values,
+                             Vector3DSoA<T> &       results) noexcept;
+
+    /// normalized vector in the direction of each vector, or zero
+    /// @relates Vector4DSoA
+    template <typename T>
+    constexpr void normalize(Vector4DSoA<T> const & values,
+                             Vector4DSoA<T> &       results) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::VectorSoAImpl
+{
+    // =============================================================================
+
+    /// pointers to the element arrays of a Vector3DSoA, read once before a loop so the loop indexes the arrays
+    /// directly rather than reloading them from the container
+    template <typename T>
+    struct Vector3DData
+    {
+        T * x; // uninitialized
+        T * y; // uninitialized
+        T * z; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// the element arrays of values
+    template <typename T>
+    constexpr Vector3DData<T const> data(Vector3DSoA<T> const & values) noexcept
+    {
+        return Vector3DData<T const>{
+            values.x.data(),
+            values.y.data(),
+            values.z.data(),
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the element arrays of values
+    template <typename T>
+    constexpr Vector3DData<T> data(Vector3DSoA<T> & values) noexcept
+    {
+        return Vector3DData<T>{
+            values.x.data(),
+            values.y.data(),
+            values.z.data(),
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the index(th) vector of values
+    template <typename T>
+    constexpr Vector3D<std::remove_const_t<T>> load(Vector3DData<T> const & values,
+                                                     std::size_t const       index) noexcept
+    {
+        return Vector3D<std::remove_const_t<T>>{
+            values.x[index],
+            values.y[index],
+            values.z[index],
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// set the index(th) vector of values
+    template <typename T>
+    constexpr void store(Vector3DData<T> const & values,
+                         std::size_t const       index,
+                         Vector3D<T> const &     value) noexcept
+    {
+        values.x[index] = value.x;
+        values.y[index] = value.y;
+        values.z[index] = value.z;
+    }
+
+    // =============================================================================
+
+    /// pointers to the element arrays of a Vector4DSoA, read once before a loop so the loop indexes the arrays
+    /// directly rather than reloading them from the container
+    template <typename T>
+    struct Vector4DData
+    {
+        T * x; // uninitialized
+        T * y; // uninitialized
+        T * z; // uninitialized
+        T * w; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// the element arrays of values
+    template <typename T>
+    constexpr Vector4DData<T const> data(Vector4DSoA<T> const & values) noexcept
+    {
+        return Vector4DData<T const>{
+            values.x.data(),
+            values.y.data(),
+            values.z.data(),
+            values.w.data(),
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the element arrays of values
+    template <typename T>
+    constexpr Vector4DData<T> data(Vector4DSoA<T> & values) noexcept
+    {
+        return Vector4DData<T>{
+            values.x.data(),
+            values.y.data(),
+            values.z.data(),
+            values.w.data(),
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the index(th) vector of values
+    template <typename T>
+    constexpr Vector4D<std::remove_const_t<T>> load(Vector4DData<T> const & values,
+                                                     std::size_t const       index) noexcept
+    {
+        return Vector4D<std::remove_const_t<T>>{
+            values.x[index],
+            values.y[index],
+            values.z[index],
+            values.w[index],
+        };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// set the index(th) vector of values
+    template <typename T>
+    constexpr void store(Vector4DData<T> const & values,
+                         std::size_t const       index,
+                         Vector4D<T> const &     value) noexcept
+    {
+        values.x[index] = value.x;
+        values.y[index] = value.y;
+        values.z[index] = value.z;
+        values.w[index] = value.w;
+    }
+
+    // =============================================================================
+
+    /// the number of vectors the in-place cross loop computes at a time into local arrays
+    inline constexpr std::size_t BlockSize = 64;
+
+    // -----------------------------------------------------------------------------
+
+    /// local element arrays of BlockSize vectors, which can't overlap the inputs of the loop that writes them
+    template <typename T>
+    struct Vector3DBlock
+    {
+        T x[BlockSize]; // uninitialized
+        T y[BlockSize]; // uninitialized
+        T z[BlockSize]; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    /// set the count vectors of values from index to those of block
+    template <typename T>
+    constexpr void store(Vector3DData<T> const &  values,
+                         std::size_t const        index,
+                         std::size_t const        count,
+                         Vector3DBlock<T> const & block) noexcept
+    {
+        std::copy_n(block.x, count, values.x + index);
+        std::copy_n(block.y, count, values.y + index);
+        std::copy_n(block.z, count, values.z + index);
+    }
+
+    // =============================================================================
+
+    /// true if results has the element arrays of values (i.e. they are the same container), the element arrays
+    /// of different containers never overlap
+    template <typename T>
+    constexpr bool aliases(Vector3DData<T> const &       results,
+                           Vector3DData<T const> const & values) noexcept
+    {
+        return (results.x == values.x) || (results.y == values.y) || (results.z == values.z);
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// true if results has the element arrays of values (i.e. they are the same container), the element arrays
+    /// of different containers never overlap
+    template <typename T>
+    constexpr bool aliases(Vector4DData<T> const &       results,
+                           Vector4DData<T const> const & values) noexcept
+    {
+        return (results.x == values.x) || (results.y == values.y) || (results.z == values.z) || (results.w == values.w);
+    }
+
+    // =============================================================================
+
+    /// reciprocal_sqrt(lengthSquared), i.e. the scale of normalize, without a branch: 1 / sqrt is computed for
+    /// every value & the result is masked after, so loops vectorize it
+    /// note: a select of the result (or of a safe value before the sqrt, as reciprocal_sqrt_fast does) isn't
+    /// enough, because GCC sinks the 1 / sqrt into a branch again & only if-converts it with -fno-trapping-math
+    template <typename T>
+    constexpr T reciprocal_length(T const lengthSquared) noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            return reciprocal_sqrt(lengthSquared);
+        }
+
+        T const result = T{ 1 } / sqrt(lengthSquared); // inf or nan for values <= 0
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            typedef typename NumericImpl::FloatTraits<T>::UIntType UIntType;
+
+            UIntType const mask = UIntType{ 0 } - static_cast<UIntType>(lengthSquared > T{ 0 });
+            return std::bit_cast<T>(std::bit_cast<UIntType>(result) & mask);
+        }
+        else
+        {
+            return (lengthSquared > T{ 0 }) ? result : T{ 0 };
+        }
+    }
+
+    // =============================================================================
+
+    /// results[i] = cross(lhs[i], rhs[i]) for i in [0, count), where the results don't overlap lhs or rhs
+    template <typename T>
+    constexpr void cross(std::size_t const       count,
+                         T const * GGM_RESTRICT const lhsX,
+                         T const * GGM_RESTRICT const lhsY,
+                         T const * GGM_RESTRICT const lhsZ,
+                         T const * GGM_RESTRICT const rhsX,
+                         T const * GGM_RESTRICT const rhsY,
+                         T const * GGM_RESTRICT const rhsZ,
+                         T * GGM_RESTRICT const       resultsX,
+                         T * GGM_RESTRICT const       resultsY,
+                         T * GGM_RESTRICT const       resultsZ) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector3D<T> const result = ggm::cross(Vector3D<T>{ lhsX[i], lhsY[i], lhsZ[i] }, Vector3D<T>{ rhsX[i], rhsY[i], rhsZ[i] });
+            resultsX[i]              = result.x;
+            resultsY[i]              = result.y;
+            resultsZ[i]              = result.z;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = normalize(values[i]) for i in [0, count), where the results don't overlap values
+    template <typename T>
+    constexpr void normalize(std::size_t const       count,
+                             T const * GGM_RESTRICT const valuesX,
+                             T const * GGM_RESTRICT const valuesY,
+                             T const * GGM_RESTRICT const valuesZ,
+                             T * GGM_RESTRICT const       resultsX,
+                             T * GGM_RESTRICT const       resultsY,
+                             T * GGM_RESTRICT const       resultsZ) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector3D<T> const value  = Vector3D<T>{ valuesX[i], valuesY[i], valuesZ[i] };
+            Vector3D<T> const result = value * reciprocal_length(length_squared(value));
+            resultsX[i]              = result.x;
+            resultsY[i]              = result.y;
+            resultsZ[i]              = result.z;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = normalize(values[i]) for i in [0, count), where the results don't overlap values
+    template <typename T>
+    constexpr void normalize(std::size_t const       count,
+                             T const * GGM_RESTRICT const valuesX,
+                             T const * GGM_RESTRICT const valuesY,
+                             T const * GGM_RESTRICT const valuesZ,
+                             T const * GGM_RESTRICT const valuesW,
+                             T * GGM_RESTRICT const       resultsX,
+                             T * GGM_RESTRICT const       resultsY,
+                             T * GGM_RESTRICT const       resultsZ,
+                             T * GGM_RESTRICT const       resultsW) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector4D<T> const value  = Vector4D<T>{ valuesX[i], valuesY[i], valuesZ[i], valuesW[i] };
+            Vector4D<T> const result = value * reciprocal_length(length_squared(value));
+            resultsX[i]              = result.x;
+            resultsY[i]              = result.y;
+            resultsZ[i]              = result.z;
+            resultsW[i]              = result.w;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// values[i] = normalize(values[i]) for i in [0, count)
+    template <typename T>
+    constexpr void normalize(std::size_t const      count,
+                             T * GGM_RESTRICT const valuesX,
+                             T * GGM_RESTRICT const valuesY,
+                             T * GGM_RESTRICT const valuesZ) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector3D<T> const value  = Vector3D<T>{ valuesX[i], valuesY[i], valuesZ[i] };
+            Vector3D<T> const result = value * reciprocal_length(length_squared(value));
+            valuesX[i]               = result.x;
+            valuesY[i]               = result.y;
+            valuesZ[i]               = result.z;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// values[i] = normalize(values[i]) for i in [0, count)
+    template <typename T>
+    constexpr void normalize(std::size_t const      count,
+                             T * GGM_RESTRICT const valuesX,
+                             T * GGM_RESTRICT const valuesY,
+                             T * GGM_RESTRICT const valuesZ,
+                             T * GGM_RESTRICT const valuesW) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector4D<T> const value  = Vector4D<T>{ valuesX[i], valuesY[i], valuesZ[i], valuesW[i] };
+            Vector4D<T> const result = value * reciprocal_length(length_squared(value));
+            valuesX[i]               = result.x;
+            valuesY[i]               = result.y;
+            valuesZ[i]               = result.z;
+            valuesW[i]               = result.w;
+        }
+    }
+
+    // =============================================================================
+
+} // namespace ggm::VectorSoAImpl
+
+// =============================================================================
+// ggm::operator+=
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> & ggm::operator+=(Vector3DSoA<T> &       lhs,
+                                                Vector3DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) + VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> & ggm::operator+=(Vector4DSoA<T> &       lhs,
+                                                Vector4DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) + VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator-=
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> & ggm::operator-=(Vector3DSoA<T> &       lhs,
+                                                Vector3DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) - VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> & ggm::operator-=(Vector4DSoA<T> &       lhs,
+                                                Vector4DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) - VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator*=
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> & ggm::operator*=(Vector3DSoA<T> & lhs,
+                                                T const &        rhs) noexcept
+{
+    VectorSoAImpl::Vector3DData<T> const lhsData = VectorSoAImpl::data(lhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) * rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> & ggm::operator*=(Vector4DSoA<T> & lhs,
+                                                T const &        rhs) noexcept
+{
+    VectorSoAImpl::Vector4DData<T> const lhsData = VectorSoAImpl::data(lhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) * rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> & ggm::operator*=(Vector3DSoA<T> &       lhs,
+                                                Vector3DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) * VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> & ggm::operator*=(Vector4DSoA<T> &       lhs,
+                                                Vector4DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) * VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator/=
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> & ggm::operator/=(Vector3DSoA<T> & lhs,
+                                                T const &        rhs) noexcept
+{
+    VectorSoAImpl::Vector3DData<T> const lhsData = VectorSoAImpl::data(lhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) / rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> & ggm::operator/=(Vector4DSoA<T> & lhs,
+                                                T const &        rhs) noexcept
+{
+    VectorSoAImpl::Vector4DData<T> const lhsData = VectorSoAImpl::data(lhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) / rhs);
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> & ggm::operator/=(Vector3DSoA<T> &       lhs,
+                                                Vector3DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) / VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> & ggm::operator/=(Vector4DSoA<T> &       lhs,
+                                                Vector4DSoA<T> const & rhs) noexcept
+{
+    assert(size(rhs) == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T> const       lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(lhsData, i, VectorSoAImpl::load(lhsData, i) / VectorSoAImpl::load(rhsData, i));
+    }
+
+    return lhs;
+}
+
+// =============================================================================
+// ggm::operator+
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator+(Vector3DSoA<T> const & lhs,
+                                             Vector3DSoA<T> const & rhs)
+{
+    Vector3DSoA<T> result = lhs;
+    result += rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator+(Vector4DSoA<T> const & lhs,
+                                             Vector4DSoA<T> const & rhs)
+{
+    Vector4DSoA<T> result = lhs;
+    result += rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator-
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator-(Vector3DSoA<T> const & lhs,
+                                             Vector3DSoA<T> const & rhs)
+{
+    Vector3DSoA<T> result = lhs;
+    result -= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator-(Vector4DSoA<T> const & lhs,
+                                             Vector4DSoA<T> const & rhs)
+{
+    Vector4DSoA<T> result = lhs;
+    result -= rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator*
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator*(T const &              lhs,
+                                             Vector3DSoA<T> const & rhs)
+{
+    return rhs * lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator*(T const &              lhs,
+                                             Vector4DSoA<T> const & rhs)
+{
+    return rhs * lhs;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator*(Vector3DSoA<T> const & lhs,
+                                             T const &              rhs)
+{
+    Vector3DSoA<T> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator*(Vector4DSoA<T> const & lhs,
+                                             T const &              rhs)
+{
+    Vector4DSoA<T> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator*(Vector3DSoA<T> const & lhs,
+                                             Vector3DSoA<T> const & rhs)
+{
+    Vector3DSoA<T> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator*(Vector4DSoA<T> const & lhs,
+                                             Vector4DSoA<T> const & rhs)
+{
+    Vector4DSoA<T> result = lhs;
+    result *= rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::operator/
+// =============================================================================
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator/(Vector3DSoA<T> const & lhs,
+                                             T const &              rhs)
+{
+    Vector3DSoA<T> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator/(Vector4DSoA<T> const & lhs,
+                                             T const &              rhs)
+{
+    Vector4DSoA<T> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3DSoA<T> ggm::operator/(Vector3DSoA<T> const & lhs,
+                                             Vector3DSoA<T> const & rhs)
+{
+    Vector3DSoA<T> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4DSoA<T> ggm::operator/(Vector4DSoA<T> const & lhs,
+                                             Vector4DSoA<T> const & rhs)
+{
+    Vector4DSoA<T> result = lhs;
+    result /= rhs;
+    return result;
+}
+
+// =============================================================================
+// ggm::size
+// =============================================================================
+
+template <typename T>
+constexpr std::size_t ggm::size(Vector3DSoA<T> const & values) noexcept
+{
+    assert((values.y.size() == values.x.size()) && (values.z.size() == values.x.size()));
+    return values.x.size();
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr std::size_t ggm::size(Vector4DSoA<T> const & values) noexcept
+{
+    assert((values.y.size() == values.x.size()) && (values.z.size() == values.x.size()) && (values.w.size() == values.x.size()));
+    return values.x.size();
+}
+
+// =============================================================================
+// ggm::resize
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::resize(Vector3DSoA<T> &  values,
+                           std::size_t const count)
+{
+    values.x.resize(count);
+    values.y.resize(count);
+    values.z.resize(count);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::resize(Vector4DSoA<T> &  values,
+                           std::size_t const count)
+{
+    values.x.resize(count);
+    values.y.resize(count);
+    values.z.resize(count);
+    values.w.resize(count);
+}
+
+// =============================================================================
+// ggm::gather
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::gather(std::vector<Vector3D<T>> const & values,
+                           Vector3DSoA<T> &                 results)
+{
+    resize(results, values.size());
+
+    VectorSoAImpl::Vector3DData<T> const resultsData = VectorSoAImpl::data(results);
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, values[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::gather(std::vector<Vector4D<T>> const & values,
+                           Vector4DSoA<T> &                 results)
+{
+    resize(results, values.size());
+
+    VectorSoAImpl::Vector4DData<T> const resultsData = VectorSoAImpl::data(results);
+
+    std::size_t const count = values.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, values[i]);
+    }
+}
+
+// =============================================================================
+// ggm::scatter
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::scatter(Vector3DSoA<T> const &     values,
+                            std::vector<Vector3D<T>> & results)
+{
+    results.resize(size(values));
+
+    VectorSoAImpl::Vector3DData<T const> const valuesData = VectorSoAImpl::data(values);
+
+    std::size_t const count = results.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = VectorSoAImpl::load(valuesData, i);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::scatter(Vector4DSoA<T> const &     values,
+                            std::vector<Vector4D<T>> & results)
+{
+    results.resize(size(values));
+
+    VectorSoAImpl::Vector4DData<T const> const valuesData = VectorSoAImpl::data(values);
+
+    std::size_t const count = results.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = VectorSoAImpl::load(valuesData, i);
+    }
+}
+
+// =============================================================================
+// ggm::clamp
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::clamp(Vector3DSoA<T> const & values,
+                          T const &              minValue,
+                          T const &              maxValue,
+                          Vector3DSoA<T> &       results) noexcept
+{
+    assert(size(results) == size(values));
+
+    VectorSoAImpl::Vector3DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector3DData<T const> const valuesData  = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, clamp(VectorSoAImpl::load(valuesData, i), minValue, maxValue));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::clamp(Vector4DSoA<T> const & values,
+                          T const &              minValue,
+                          T const &              maxValue,
+                          Vector4DSoA<T> &       results) noexcept
+{
+    assert(size(results) == size(values));
+
+    VectorSoAImpl::Vector4DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector4DData<T const> const valuesData  = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, clamp(VectorSoAImpl::load(valuesData, i), minValue, maxValue));
+    }
+}
+
+// =============================================================================
+// ggm::cross
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::cross(Vector3DSoA<T> const & lhs,
+                          Vector3DSoA<T> const & rhs,
+                          Vector3DSoA<T> &       results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(size(results) == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector3DData<T const> const lhsData     = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData     = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    if (VectorSoAImpl::aliases(resultsData, lhsData) || VectorSoAImpl::aliases(resultsData, rhsData))
+    {
+        // in-place
+        for (std::size_t i = 0; i < count; i += VectorSoAImpl::BlockSize)
+        {
+            std::size_t const                blockCount = std::min(count - i, VectorSoAImpl::BlockSize);
+            VectorSoAImpl::Vector3DBlock<T> block;
+            VectorSoAImpl::cross(blockCount,
+                                 lhsData.x + i, lhsData.y + i, lhsData.z + i,
+                                 rhsData.x + i, rhsData.y + i, rhsData.z + i,
+                                 block.x, block.y, block.z);
+            VectorSoAImpl::store(resultsData, i, blockCount, block);
+        }
+    }
+    else
+    {
+        VectorSoAImpl::cross(count,
+                             lhsData.x, lhsData.y, lhsData.z,
+                             rhsData.x, rhsData.y, rhsData.z,
+                             resultsData.x, resultsData.y, resultsData.z);
+    }
+}
+
+// =============================================================================
+// ggm::distance
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::distance(Vector3DSoA<T> const &                   lhs,
+                             Vector3DSoA<T> const &                   rhs,
+                             std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(results.size() == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T const> const lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = distance(VectorSoAImpl::load(lhsData, i), VectorSoAImpl::load(rhsData, i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::distance(Vector4DSoA<T> const &                   lhs,
+                             Vector4DSoA<T> const &                   rhs,
+                             std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(results.size() == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T const> const lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = distance(VectorSoAImpl::load(lhsData, i), VectorSoAImpl::load(rhsData, i));
+    }
+}
+
+// =============================================================================
+// ggm::distance_squared
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::distance_squared(Vector3DSoA<T> const &                   lhs,
+                                     Vector3DSoA<T> const &                   rhs,
+                                     std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(results.size() == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T const> const lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = distance_squared(VectorSoAImpl::load(lhsData, i), VectorSoAImpl::load(rhsData, i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::distance_squared(Vector4DSoA<T> const &                   lhs,
+                                     Vector4DSoA<T> const &                   rhs,
+                                     std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(results.size() == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T const> const lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = distance_squared(VectorSoAImpl::load(lhsData, i), VectorSoAImpl::load(rhsData, i));
+    }
+}
+
+// =============================================================================
+// ggm::dot
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::dot(Vector3DSoA<T> const &                   lhs,
+                        Vector3DSoA<T> const &                   rhs,
+                        std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(results.size() == size(lhs));
+
+    VectorSoAImpl::Vector3DData<T const> const lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector3DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = dot(VectorSoAImpl::load(lhsData, i), VectorSoAImpl::load(rhsData, i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::dot(Vector4DSoA<T> const &                   lhs,
+                        Vector4DSoA<T> const &                   rhs,
+                        std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(size(rhs) == size(lhs));
+    assert(results.size() == size(lhs));
+
+    VectorSoAImpl::Vector4DData<T const> const lhsData = VectorSoAImpl::data(lhs);
+    VectorSoAImpl::Vector4DData<T const> const rhsData = VectorSoAImpl::data(rhs);
+
+    std::size_t const count = size(lhs);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = dot(VectorSoAImpl::load(lhsData, i), VectorSoAImpl::load(rhsData, i));
+    }
+}
+
+// =============================================================================
+// ggm::length
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::length(Vector3DSoA<T> const &                   values,
+                           std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(results.size() == size(values));
+
+    VectorSoAImpl::Vector3DData<T const> const valuesData = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = length(VectorSoAImpl::load(valuesData, i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::length(Vector4DSoA<T> const &                   values,
+                           std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(results.size() == size(values));
+
+    VectorSoAImpl::Vector4DData<T const> const valuesData = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = length(VectorSoAImpl::load(valuesData, i));
+    }
+}
+
+// =============================================================================
+// ggm::length_squared
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::length_squared(Vector3DSoA<T> const &                   values,
+                                   std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(results.size() == size(values));
+
+    VectorSoAImpl::Vector3DData<T const> const valuesData = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = length_squared(VectorSoAImpl::load(valuesData, i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::length_squared(Vector4DSoA<T> const &                   values,
+                                   std::span<std::type_identity_t<T>> const results) noexcept
+{
+    assert(results.size() == size(values));
+
+    VectorSoAImpl::Vector4DData<T const> const valuesData = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        results[i] = length_squared(VectorSoAImpl::load(valuesData, i));
+    }
+}
+
+// =============================================================================
+// ggm::lerp
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::lerp(Vector3DSoA<T> const & values0,
+                         Vector3DSoA<T> const & values1,
+                         T const &              t,
+                         Vector3DSoA<T> &       results) noexcept
+{
+    assert(size(values1) == size(values0));
+    assert(size(results) == size(values0));
+
+    VectorSoAImpl::Vector3DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector3DData<T const> const values0Data = VectorSoAImpl::data(values0);
+    VectorSoAImpl::Vector3DData<T const> const values1Data = VectorSoAImpl::data(values1);
+
+    std::size_t const count = size(values0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, lerp(VectorSoAImpl::load(values0Data, i), VectorSoAImpl::load(values1Data, i), t));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::lerp(Vector4DSoA<T> const & values0,
+                         Vector4DSoA<T> const & values1,
+                         T const &              t,
+                         Vector4DSoA<T> &       results) noexcept
+{
+    assert(size(values1) == size(values0));
+    assert(size(results) == size(values0));
+
+    VectorSoAImpl::Vector4DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector4DData<T const> const values0Data = VectorSoAImpl::data(values0);
+    VectorSoAImpl::Vector4DData<T const> const values1Data = VectorSoAImpl::data(values1);
+
+    std::size_t const count = size(values0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, lerp(VectorSoAImpl::load(values0Data, i), VectorSoAImpl::load(values1Data, i), t));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::lerp(Vector3DSoA<T> const &                         values0,
+                         Vector3DSoA<T> const &                         values1,
+                         std::span<std::type_identity_t<T> const> const ts,
+                         Vector3DSoA<T> &                               results) noexcept
+{
+    assert(size(values1) == size(values0));
+    assert(ts.size() == size(values0));
+    assert(size(results) == size(values0));
+
+    VectorSoAImpl::Vector3DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector3DData<T const> const values0Data = VectorSoAImpl::data(values0);
+    VectorSoAImpl::Vector3DData<T const> const values1Data = VectorSoAImpl::data(values1);
+
+    std::size_t const count = size(values0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, lerp(VectorSoAImpl::load(values0Data, i), VectorSoAImpl::load(values1Data, i), ts[i]));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::lerp(Vector4DSoA<T> const &                         values0,
+                         Vector4DSoA<T> const &                         values1,
+                         std::span<std::type_identity_t<T> const> const ts,
+                         Vector4DSoA<T> &                               results) noexcept
+{
+    assert(size(values1) == size(values0));
+    assert(ts.size() == size(values0));
+    assert(size(results) == size(values0));
+
+    VectorSoAImpl::Vector4DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector4DData<T const> const values0Data = VectorSoAImpl::data(values0);
+    VectorSoAImpl::Vector4DData<T const> const values1Data = VectorSoAImpl::data(values1);
+
+    std::size_t const count = size(values0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        VectorSoAImpl::store(resultsData, i, lerp(VectorSoAImpl::load(values0Data, i), VectorSoAImpl::load(values1Data, i), ts[i]));
+    }
+}
+
+// =============================================================================
+// ggm::normalize
+// =============================================================================
+
+template <typename T>
+constexpr void ggm::normalize(Vector3DSoA<T> const & values,
+                              Vector3DSoA<T> &       results) noexcept
+{
+    assert(size(results) == size(values));
+
+    VectorSoAImpl::Vector3DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector3DData<T const> const valuesData  = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    if (VectorSoAImpl::aliases(resultsData, valuesData))
+    {
+        // in-place
+        VectorSoAImpl::normalize(count, resultsData.x, resultsData.y, resultsData.z);
+    }
+    else
+    {
+        VectorSoAImpl::normalize(count,
+                                 valuesData.x, valuesData.y, valuesData.z,
+                                 resultsData.x, resultsData.y, resultsData.z);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr void ggm::normalize(Vector4DSoA<T> const & values,
+                              Vector4DSoA<T> &       results) noexcept
+{
+    assert(size(results) == size(values));
+
+    VectorSoAImpl::Vector4DData<T> const       resultsData = VectorSoAImpl::data(results);
+    VectorSoAImpl::Vector4DData<T const> const valuesData  = VectorSoAImpl::data(values);
+
+    std::size_t const count = size(values);
+    if (VectorSoAImpl::aliases(resultsData, valuesData))
+    {
+        // in-place
+        VectorSoAImpl::normalize(count, resultsData.x, resultsData.y, resultsData.z, resultsData.w);
+    }
+    else
+    {
+        VectorSoAImpl::normalize(count,
+                                 valuesData.x, valuesData.y, valuesData.z, valuesData.w,
+                                 resultsData.x, resultsData.y, resultsData.z, resultsData.w);
+    }
+}
+
+// =============================================================================
+
+#undef GGM_RESTRICT
+
+#endif // GGM_VECTOR_SOA_UTIL_H
@@ -0,0 +1,466 @@
+#pragma once
+#ifndef GGM_VECTOR_SPATIAL_KEY_H
+#define GGM_VECTOR_SPATIAL_KEY_H
+
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+
+#include <cstdint>
+#include <type_traits>
+
+// morton keys use the BMI2 pdep & pext instructions when the target has them (e.g. -mbmi2, -march=haswell,
+// /arch:AVX2), otherwise the equivalent (bit-identical) magic number shifts & masks
+// note: pdep & pext are microcoded (i.e. slow) on AMD CPUs before Zen 3
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define GGM_BMI2() 1
+#include <immintrin.h>
+#else
+#define GGM_BMI2() 0
+#endif
+
+// =============================================================================
+/// @addtogroup Vector
+/// @{
+/// @details
+///
+/// Spatial keys (space-filling curves) of integer grid coordinates, see VectorBatch.h for the span versions.
+///
+/// Sorting objects by the key of their (quantized) position places objects that are close in space close in
+/// memory, e.g. for cache locality or to build a linear BVH (LBVH). The keys are unsigned integers, so they
+/// are ready for a radix sort.
+///
+/// - a morton key (Z-order curve) interleaves the bits of the coordinates, x in the lowest bit
+/// - a hilbert key orders the grid along a Hilbert curve, where consecutive keys are always adjacent cells
+///   (which gives better locality than morton keys, but is slower to compute)
+///
+/// Vector2D keys use the low 16 bits of each coordinate (a 32-bit key) & Vector3D keys use the low 21 bits of
+/// each coordinate (a 63-bit key), higher bits are ignored. grid_from_vector2D & grid_from_vector3D quantize
+/// float positions within bounds to those grids.
+///
+/// keys:
+/// -----
+///
+/// Syntax                                | Description
+/// ------                                | -----------
+/// k = morton_from_vector2D(u);          | morton key of 2D grid coordinates
+/// k = morton_from_vector3D(u);          | morton key of 3D grid coordinates
+/// u = vector2D_from_morton(k);          | 2D grid coordinates of a morton key
+/// u = vector3D_from_morton(k);          | 3D grid coordinates of a morton key
+/// k = hilbert_from_vector2D(u);         | hilbert key of 2D grid coordinates
+/// k = hilbert_from_vector3D(u);         | hilbert key of 3D grid coordinates
+/// u = vector2D_from_hilbert(k);         | 2D grid coordinates of a hilbert key
+/// u = vector3D_from_hilbert(k);         | 3D grid coordinates of a hilbert key
+///
+/// grids:
+/// ------
+///
+/// Syntax                                | Description
+/// ------                                | -----------
+/// u = grid_from_vector2D(v, min, max);  | cell of the 65536^2 grid over [min, max] that contains v
+/// u = grid_from_vector3D(v, min, max);  | cell of the 2097152^3 grid over [min, max] that contains v
+///
+/// @}
+// =============================================================================
+
+namespace ggm
+{
+    // =============================================================================
+    // keys:
+    // =============================================================================
+
+    /// number of bits of each coordinate used by the Vector2D keys
+    inline constexpr unsigned int SpatialKey2DBits = 16;
+
+    /// number of bits of each coordinate used by the Vector3D keys
+    inline constexpr unsigned int SpatialKey3DBits = 21;
+
+    // =============================================================================
+
+    /// morton key of 2D grid coordinates, i.e. bit i of x is bit 2 * i & bit i of y is bit 2 * i + 1
+    /// @relates Vector2D
+    constexpr std::uint32_t morton_from_vector2D(Vector2D<unsigned int> const & value) noexcept;
+
+    /// morton key of 3D grid coordinates, i.e. bit i of x is bit 3 * i, bit i of y is bit 3 * i + 1 & bit i of
+    /// z is bit 3 * i + 2
+    /// @relates Vector3D
+    constexpr std::uint64_t morton_from_vector3D(Vector3D<unsigned int> const & value) noexcept;
+
+    /// 2D grid coordinates of a morton key, see @ref morton_from_vector2D
+    /// @relates Vector2D
+    constexpr Vector2D<unsigned int> vector2D_from_morton(std::uint32_t const key) noexcept;
+
+    /// 3D grid coordinates of a morton key, see @ref morton_from_vector3D
+    /// @relates Vector3D
+    constexpr Vector3D<unsigned int> vector3D_from_morton(std::uint64_t const key) noexcept;
+
+    // =============================================================================
+
+    /// hilbert key of 2D grid coordinates, the distance along a Hilbert curve of order 16 that starts at 0
+    /// @relates Vector2D
+    constexpr std::uint32_t hilbert_from_vector2D(Vector2D<unsigned int> const & value) noexcept;
+
+    /// hilbert key of 3D grid coordinates, the distance along a Hilbert curve of order 21 that starts at 0
+    /// @relates Vector3D
+    constexpr std::uint64_t hilbert_from_vector3D(Vector3D<unsigned int> const & value) noexcept;
+
+    /// 2D grid coordinates of a hilbert key, see @ref hilbert_from_vector2D
+    /// @relates Vector2D
+    constexpr Vector2D<unsigned int> vector2D_from_hilbert(std::uint32_t const key) noexcept;
+
+    /// 3D grid coordinates of a hilbert key, see @ref hilbert_from_vector3D
+    /// @relates Vector3D
+    constexpr Vector3D<unsigned int> vector3D_from_hilbert(std::uint64_t const key) noexcept;
+
+    // =============================================================================
+    // grids:
+    // =============================================================================
+
+    /// cell of the 2^16 x 2^16 grid over [boundsMin, boundsMax] that contains value, for the Vector2D keys
+    /// @details
+    /// Values outside the bounds are clamped to the nearest cell & nan gives 0 (as does a zero extent).
+    /// @relates Vector2D
+    constexpr Vector2D<unsigned int> grid_from_vector2D(Vector2D<float> const & value,
+                                                        Vector2D<float> const & boundsMin,
+                                                        Vector2D<float> const & boundsMax) noexcept;
+
+    /// cell of the 2^21 x 2^21 x 2^21 grid over [boundsMin, boundsMax] that contains value, for the Vector3D keys
+    /// @details
+    /// Values outside the bounds are clamped to the nearest cell & nan gives 0 (as does a zero extent).
+    /// @relates Vector3D
+    constexpr Vector3D<unsigned int> grid_from_vector3D(Vector3D<float> const & value,
+                                                        Vector3D<float> const & boundsMin,
+                                                        Vector3D<float> const & boundsMax) noexcept;
+
+    // =============================================================================
+} // namespace ggm
+
+// =============================================================================
+// implementation:
+// =============================================================================
+
+namespace ggm::SpatialKeyImpl
+{
+    // =============================================================================
+    // morton:
+    // =============================================================================
+
+    /// spread the low 16 bits of value to the even bits
+    constexpr std::uint32_t spread_bits_2D(std::uint32_t const value) noexcept
+    {
+        std::uint32_t bits = value & 0x0000FFFFu;
+        bits               = (bits | (bits << 8)) & 0x00FF00FFu;
+        bits               = (bits | (bits << 4)) & 0x0F0F0F0Fu;
+        bits               = (bits | (bits << 2)) & 0x33333333u;
+        bits               = (bits | (bits << 1)) & 0x55555555u;
+        return bits;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// gather the even bits of value to the low 16 bits, i.e. the inverse of spread_bits_2D
+    constexpr std::uint32_t compact_bits_2D(std::uint32_t const value) noexcept
+    {
+        std::uint32_t bits = value & 0x55555555u;
+        bits               = (bits | (bits >> 1)) & 0x33333333u;
+        bits               = (bits | (bits >> 2)) & 0x0F0F0F0Fu;
+        bits               = (bits | (bits >> 4)) & 0x00FF00FFu;
+        bits               = (bits | (bits >> 8)) & 0x0000FFFFu;
+        return bits;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// spread the low 21 bits of value to every 3rd bit
+    constexpr std::uint64_t spread_bits_3D(std::uint64_t const value) noexcept
+    {
+        std::uint64_t bits = value & 0x00000000001FFFFFull;
+        bits               = (bits | (bits << 32)) & 0x001F00000000FFFFull;
+        bits               = (bits | (bits << 16)) & 0x001F0000FF0000FFull;
+        bits               = (bits | (bits << 8)) & 0x100F00F00F00F00Full;
+        bits               = (bits | (bits << 4)) & 0x10C30C30C30C30C3ull;
+        bits               = (bits | (bits << 2)) & 0x1249249249249249ull;
+        return bits;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// gather every 3rd bit of value to the low 21 bits, i.e. the inverse of spread_bits_3D
+    constexpr std::uint64_t compact_bits_3D(std::uint64_t const value) noexcept
+    {
+        std::uint64_t bits = value & 0x1249249249249249ull;
+        bits               = (bits | (bits >> 2)) & 0x10C30C30C30C30C3ull;
+        bits               = (bits | (bits >> 4)) & 0x100F00F00F00F00Full;
+        bits               = (bits | (bits >> 8)) & 0x001F0000FF0000FFull;
+        bits               = (bits | (bits >> 16)) & 0x001F00000000FFFFull;
+        bits               = (bits | (bits >> 32)) & 0x00000000001FFFFFull;
+        return bits;
+    }
+
+    // =============================================================================
+    // hilbert:
+    //
+    // Skilling's algorithm ("Programming the Hilbert curve", 2004): the coordinates are transformed in place to
+    // the "transposed" hilbert key, whose bits interleave (most significant first) to the key. Each
+    // conditional step is computed with masks (rather than branches).
+    // =============================================================================
+
+    /// transform grid coordinates of Bits bits to the transposed hilbert key
+    template <std::size_t N, unsigned int Bits>
+    constexpr void transpose_from_axes(std::uint32_t (&axes)[N]) noexcept
+    {
+        // inverse undo
+        for (std::uint32_t q = std::uint32_t{ 1 } << (Bits - 1); q > 1; q >>= 1)
+        {
+            std::uint32_t const p = q - 1;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::uint32_t const isSet    = std::uint32_t{ 0 } - ((axes[i] & q) != 0 ? 1u : 0u);
+                std::uint32_t const exchange = (axes[0] ^ axes[i]) & p & ~isSet;
+                axes[0] ^= (p & isSet) | exchange; // invert if set, else exchange the low bits of axes[0] & axes[i]
+                axes[i] ^= exchange;
+            }
+        }
+
+        // gray encode
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            axes[i] ^= axes[i - 1];
+        }
+
+        std::uint32_t t = 0;
+        for (std::uint32_t q = std::uint32_t{ 1 } << (Bits - 1); q > 1; q >>= 1)
+        {
+            t ^= (q - 1) & (std::uint32_t{ 0 } - ((axes[N - 1] & q) != 0 ? 1u : 0u));
+        }
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            axes[i] ^= t;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// transform the transposed hilbert key to grid coordinates of Bits bits, i.e. the inverse of transpose_from_axes
+    template <std::size_t N, unsigned int Bits>
+    constexpr void axes_from_transpose(std::uint32_t (&axes)[N]) noexcept
+    {
+        // gray decode
+        std::uint32_t const t = axes[N - 1] >> 1;
+        for (std::size_t i = N - 1; i > 0; --i)
+        {
+            axes[i] ^= axes[i - 1];
+        }
+        axes[0] ^= t;
+
+        // undo excess work
+        for (std::uint32_t q = 2; q != (std::uint32_t{ 1 } << Bits); q <<= 1)
+        {
+            std::uint32_t const p = q - 1;
+            for (std::size_t j = N; j > 0; --j)
+            {
+                std::size_t const   i        = j - 1;
+                std::uint32_t const isSet    = std::uint32_t{ 0 } - ((axes[i] & q) != 0 ? 1u : 0u);
+                std::uint32_t const exchange = (axes[0] ^ axes[i]) & p & ~isSet;
+                axes[0] ^= (p & isSet) | exchange; // invert if set, else exchange the low bits of axes[0] & axes[i]
+                axes[i] ^= exchange;
+            }
+        }
+    }
+
+    // =============================================================================
+    // grids:
+    // =============================================================================
+
+    /// cell of a grid of Cells cells over [boundsMin, boundsMax] that contains value
+    template <std::uint32_t Cells>
+    constexpr unsigned int grid_from_float(float const value,
+                                           float const boundsMin,
+                                           float const boundsMax) noexcept
+    {
+        constexpr float MaxCell = static_cast<float>(Cells - 1);
+
+        // note: max(0, x) gives 0 for nan, & min & max (rather than branches) keep the conversion unconditional,
+        // so compilers are able to vectorize loops over this (the scale only depends on the bounds, so is hoisted)
+        float const extent = boundsMax - boundsMin;
+        float const scale  = (extent > 0.0f) ? static_cast<float>(Cells) / extent : 0.0f;
+        float const scaled = (value - boundsMin) * scale;
+        float const cell   = min(max(0.0f, scaled), MaxCell);
+        return static_cast<unsigned int>(static_cast<std::int32_t>(cell));
+    }
+
+    // =============================================================================
+} // namespace ggm::SpatialKeyImpl
+
+// =============================================================================
+// keys:
+// =============================================================================
+
+constexpr std::uint32_t ggm::morton_from_vector2D(Vector2D<unsigned int> const & value) noexcept
+{
+#if GGM_BMI2()
+    if (!std::is_constant_evaluated())
+    {
+        return _pdep_u32(value.x, 0x55555555u) | _pdep_u32(value.y, 0xAAAAAAAAu);
+    }
+#endif
+
+    using namespace SpatialKeyImpl;
+
+    return spread_bits_2D(value.x) | (spread_bits_2D(value.y) << 1);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint64_t ggm::morton_from_vector3D(Vector3D<unsigned int> const & value) noexcept
+{
+#if GGM_BMI2()
+    if (!std::is_constant_evaluated())
+    {
+        return _pdep_u64(value.x, 0x1249249249249249ull) |
+               _pdep_u64(value.y, 0x2492492492492492ull) |
+               _pdep_u64(value.z, 0x4924924924924924ull);
+    }
+#endif
+
+    using namespace SpatialKeyImpl;
+
+    return spread_bits_3D(value.x) | (spread_bits_3D(value.y) << 1) | (spread_bits_3D(value.z) << 2);
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector2D<unsigned int> ggm::vector2D_from_morton(std::uint32_t const key) noexcept
+{
+#if GGM_BMI2()
+    if (!std::is_constant_evaluated())
+    {
+        return Vector2D<unsigned int>{
+            _pext_u32(key, 0x55555555u),
+            _pext_u32(key, 0xAAAAAAAAu),
+        };
+    }
+#endif
+
+    using namespace SpatialKeyImpl;
+
+    return Vector2D<unsigned int>{
+        compact_bits_2D(key),
+        compact_bits_2D(key >> 1),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<unsigned int> ggm::vector3D_from_morton(std::uint64_t const key) noexcept
+{
+#if GGM_BMI2()
+    if (!std::is_constant_evaluated())
+    {
+        return Vector3D<unsigned int>{
+            static_cast<unsigned int>(_pext_u64(key, 0x1249249249249249ull)),
+            static_cast<unsigned int>(_pext_u64(key, 0x2492492492492492ull)),
+            static_cast<unsigned int>(_pext_u64(key, 0x4924924924924924ull)),
+        };
+    }
+#endif
+
+    using namespace SpatialKeyImpl;
+
+    return Vector3D<unsigned int>{
+        static_cast<unsigned int>(compact_bits_3D(key)),
+        static_cast<unsigned int>(compact_bits_3D(key >> 1)),
+        static_cast<unsigned int>(compact_bits_3D(key >> 2)),
+    };
+}
+
+// =============================================================================
+
+constexpr std::uint32_t ggm::hilbert_from_vector2D(Vector2D<unsigned int> const & value) noexcept
+{
+    constexpr std::uint32_t Mask = (std::uint32_t{ 1 } << SpatialKey2DBits) - 1u;
+
+    std::uint32_t axes[2] = { value.x & Mask, value.y & Mask };
+    SpatialKeyImpl::transpose_from_axes<2, SpatialKey2DBits>(axes);
+
+    // the bits of axes[0] are the more significant of each pair
+    return morton_from_vector2D(Vector2D<unsigned int>{ axes[1], axes[0] });
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr std::uint64_t ggm::hilbert_from_vector3D(Vector3D<unsigned int> const & value) noexcept
+{
+    constexpr std::uint32_t Mask = (std::uint32_t{ 1 } << SpatialKey3DBits) - 1u;
+
+    std::uint32_t axes[3] = { value.x & Mask, value.y & Mask, value.z & Mask };
+    SpatialKeyImpl::transpose_from_axes<3, SpatialKey3DBits>(axes);
+
+    // the bits of axes[0] are the most significant of each triple
+    return morton_from_vector3D(Vector3D<unsigned int>{ axes[2], axes[1], axes[0] });
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector2D<unsigned int> ggm::vector2D_from_hilbert(std::uint32_t const key) noexcept
+{
+    Vector2D<unsigned int> const transpose = vector2D_from_morton(key);
+
+    std::uint32_t axes[2] = { transpose.y, transpose.x };
+    SpatialKeyImpl::axes_from_transpose<2, SpatialKey2DBits>(axes);
+
+    return Vector2D<unsigned int>{ axes[0], axes[1] };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<unsigned int> ggm::vector3D_from_hilbert(std::uint64_t const key) noexcept
+{
+    Vector3D<unsigned int> const transpose = vector3D_from_morton(key);
+
+    std::uint32_t axes[3] = { transpose.z, transpose.y, transpose.x };
+    SpatialKeyImpl::axes_from_transpose<3, SpatialKey3DBits>(axes);
+
+    return Vector3D<unsigned int>{ axes[0], axes[1], axes[2] };
+}
+
+// =============================================================================
+// grids:
+// =============================================================================
+
+constexpr ggm::Vector2D<unsigned int> ggm::grid_from_vector2D(Vector2D<float> const & value,
+                                                              Vector2D<float> const & boundsMin,
+                                                              Vector2D<float> const & boundsMax) noexcept
+{
+    using namespace SpatialKeyImpl;
+
+    constexpr std::uint32_t Cells = std::uint32_t{ 1 } << SpatialKey2DBits;
+
+    return Vector2D<unsigned int>{
+        grid_from_float<Cells>(value.x, boundsMin.x, boundsMax.x),
+        grid_from_float<Cells>(value.y, boundsMin.y, boundsMax.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+constexpr ggm::Vector3D<unsigned int> ggm::grid_from_vector3D(Vector3D<float> const & value,
+                                                              Vector3D<float> const & boundsMin,
+                                                              Vector3D<float> const & boundsMax) noexcept
+{
+    using namespace SpatialKeyImpl;
+
+    constexpr std::uint32_t Cells = std::uint32_t{ 1 } << SpatialKey3DBits;
+
+    return Vector3D<unsigned int>{
+        grid_from_float<Cells>(value.x, boundsMin.x, boundsMax.x),
+        grid_from_float<Cells>(value.y, boundsMin.y, boundsMax.y),
+        grid_from_float<Cells>(value.z, boundsMin.z, boundsMax.z),
+    };
+}
+
+// =============================================================================
+
+#undef GGM_BMI2
+
+#endif // GGM_VECTOR_SPATIAL_KEY_H
@@ -2,6 +2,7 @@
 #ifndef GGM_VECTOR_TYPEDEFS_H
 #define GGM_VECTOR_TYPEDEFS_H
 
+#include "ggm/Numeric/Half.h"
 #include "ggm/Vector/VectorFwd.h"
 
 #include <cstddef>
@@ -24,6 +25,7 @@ namespace ggm
     typedef Vector2D<unsigned long>      Vector2Dlu;
     typedef Vector2D<long long>          Vector2Dlli;
     typedef Vector2D<unsigned long long> Vector2Dllu;
+    typedef Vector2D<half>               Vector2Dh;
     typedef Vector2D<float>              Vector2Df;
     typedef Vector2D<double>             Vector2Dlf;
     typedef Vector2D<long double>        Vector2DLf;
@@ -50,6 +52,7 @@ namespace ggm
     typedef Vector3D<unsigned long>      Vector3Dlu;
     typedef Vector3D<long long>          Vector3Dlli;
     typedef Vector3D<unsigned long long> Vector3Dllu;
+    typedef Vector3D<half>               Vector3Dh;
     typedef Vector3D<float>              Vector3Df;
     typedef Vector3D<double>             Vector3Dlf;
     typedef Vector3D<long double>        Vector3DLf;
@@ -63,6 +66,16 @@ namespace ggm
     typedef Vector3D<std::uint64_t>      Vector3Du64;
     typedef Vector3D<std::size_t>        Vector3Dzu;
 
+    // =============================================================================
+    // aliases for fully typed Vector3DA
+    // =============================================================================
+
+    typedef Vector3DA<bool>         Vector3DAb;
+    typedef Vector3DA<int>          Vector3DAi;
+    typedef Vector3DA<unsigned int> Vector3DAu;
+    typedef Vector3DA<float>        Vector3DAf;
+    typedef Vector3DA<double>       Vector3DAlf;
+
     // =============================================================================
     // aliases for fully typed Vector4D
     // =============================================================================
@@ -76,6 +89,7 @@ namespace ggm
     typedef Vector4D<unsigned long>      Vector4Dlu;
     typedef Vector4D<long long>          Vector4Dlli;
     typedef Vector4D<unsigned long long> Vector4Dllu;
+    typedef Vector4D<half>               Vector4Dh;
     typedef Vector4D<float>              Vector4Df;
     typedef Vector4D<double>             Vector4Dlf;
     typedef Vector4D<long double>        Vector4DLf;
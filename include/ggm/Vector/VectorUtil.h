@@ -75,12 +75,15 @@
 /// s = max_element(v);         | max of all vector elements
 /// s = min_element(v);         | min of all vector elements
 /// u = normalize(v);           | normalized vector in the direction of v, or zero
+/// u = normalize_fast(v);      | approximately normalized vector in the direction of v, or zero
 /// u = reciprocal(v, def);     | element-wise reciprocal
 /// u = reciprocal_sqrt(v, def);| element-wise reciprocal_sqrt
+/// u = reciprocal_sqrt_fast(v);| element-wise reciprocal_sqrt_fast
 /// u = reflect(v, n);          | reflection direction for an incident vector
 /// u = refract(v, n, eta);     | refraction direction for an incident vector
 /// u = repeat(v, min, max);    | element-wise repeat
 /// u = saturate(v);            | element-wise saturate
+/// u = select(b, v, w);       | element-wise select, i.e. b ? v : w (branch-free)
 /// u = smooth_step(e0, e1, v); | element-wise smooth_step
 /// u = trunc(v);               | element-wise trunc
 ///
@@ -93,6 +96,7 @@
 /// b = any_of(v);              | true if any bool elements are true
 /// b = none_of(v);             | true if all bool elements are false
 /// b = is_close(u, v);         | element-wise is_close
+/// b = is_close_ulps(u, v);    | element-wise is_close_ulps
 /// b = is_equal(u, v);         | element-wise ==
 /// b = is_greater(u, v);       | element-wise >
 /// b = is_greater_equal(u, v); | element-wise >=
@@ -590,20 +594,20 @@ namespace ggm
     /// distance between lhs and rhs
     /// @relates Vector2D
     template <typename T>
-    inline T distance(Vector2D<T> const & lhs,
-                      Vector2D<T> const & rhs) noexcept;
+    constexpr T distance(Vector2D<T> const & lhs,
+                         Vector2D<T> const & rhs) noexcept;
 
     /// distance between lhs and rhs
     /// @relates Vector3D
     template <typename T>
-    inline T distance(Vector3D<T> const & lhs,
-                      Vector3D<T> const & rhs) noexcept;
+    constexpr T distance(Vector3D<T> const & lhs,
+                         Vector3D<T> const & rhs) noexcept;
 
     /// distance between lhs and rhs
     /// @relates Vector4D
     template <typename T>
-    inline T distance(Vector4D<T> const & lhs,
-                      Vector4D<T> const & rhs) noexcept;
+    constexpr T distance(Vector4D<T> const & lhs,
+                         Vector4D<T> const & rhs) noexcept;
 
     // =============================================================================
 
@@ -742,37 +746,37 @@ namespace ggm
     /// true if length(value) is approximately 1
     /// @relates Vector2D
     template <typename T>
-    inline bool is_normalized(Vector2D<T> const & value,
-                              T const &           epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_normalized(Vector2D<T> const & value,
+                                 T const &           epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if length(value) is approximately 1
     /// @relates Vector3D
     template <typename T>
-    inline bool is_normalized(Vector3D<T> const & value,
-                              T const &           epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_normalized(Vector3D<T> const & value,
+                                 T const &           epsilon = DefaultTolerance<T>) noexcept;
 
     /// true if length(value) is approximately 1
     /// @relates Vector4D
     template <typename T>
-    inline bool is_normalized(Vector4D<T> const & value,
-                              T const &           epsilon = DefaultTolerance<T>) noexcept;
+    constexpr bool is_normalized(Vector4D<T> const & value,
+                                 T const &           epsilon = DefaultTolerance<T>) noexcept;
 
     // =============================================================================
 
     /// vector length of value
     /// @relates Vector2D
     template <typename T>
-    inline T length(Vector2D<T> const & value) noexcept;
+    constexpr T length(Vector2D<T> const & value) noexcept;
 
     /// vector length of value
     /// @relates Vector3D
     template <typename T>
-    inline T length(Vector3D<T> const & value) noexcept;
+    constexpr T length(Vector3D<T> const & value) noexcept;
 
     /// vector length of value
     /// @relates Vector4D
     template <typename T>
-    inline T length(Vector4D<T> const & value) noexcept;
+    constexpr T length(Vector4D<T> const & value) noexcept;
 
     // =============================================================================
 
@@ -927,17 +931,40 @@ namespace ggm
     /// normalized vector in the direction of value, or zero
     /// @relates Vector2D
     template <typename T>
-    inline Vector2D<T> normalize(Vector2D<T> const & value) noexcept;
+    constexpr Vector2D<T> normalize(Vector2D<T> const & value) noexcept;
 
     /// normalized vector in the direction of value, or zero
     /// @relates Vector3D
     template <typename T>
-    inline Vector3D<T> normalize(Vector3D<T> const & value) noexcept;
+    constexpr Vector3D<T> normalize(Vector3D<T> const & value) noexcept;
 
     /// normalized vector in the direction of value, or zero
     /// @relates Vector4D
     template <typename T>
-    inline Vector4D<T> normalize(Vector4D<T> const & value) noexcept;
+    constexpr Vector4D<T> normalize(Vector4D<T> const & value) noexcept;
+
+    // =============================================================================
+
+    /// approximately normalized vector in the direction of value, or zero
+    /// @details
+    /// Uses reciprocal_sqrt_fast<Steps>, see it for error bounds.
+    /// @relates Vector2D
+    template <unsigned int Steps = 2>
+    constexpr Vector2D<float> normalize_fast(Vector2D<float> const & value) noexcept;
+
+    /// approximately normalized vector in the direction of value, or zero
+    /// @details
+    /// Uses reciprocal_sqrt_fast<Steps>, see it for error bounds.
+    /// @relates Vector3D
+    template <unsigned int Steps = 2>
+    constexpr Vector3D<float> normalize_fast(Vector3D<float> const & value) noexcept;
+
+    /// approximately normalized vector in the direction of value, or zero
+    /// @details
+    /// Uses reciprocal_sqrt_fast<Steps>, see it for error bounds.
+    /// @relates Vector4D
+    template <unsigned int Steps = 2>
+    constexpr Vector4D<float> normalize_fast(Vector4D<float> const & value) noexcept;
 
     // =============================================================================
 
@@ -964,20 +991,40 @@ namespace ggm
     /// element-wise reciprocal_sqrt
     /// @relates Vector2D
     template <typename T>
-    inline Vector2D<T> reciprocal_sqrt(Vector2D<T> const & value,
-                                       Vector2D<T> const & defaultValue = {}) noexcept;
+    constexpr Vector2D<T> reciprocal_sqrt(Vector2D<T> const & value,
+                                          Vector2D<T> const & defaultValue = {}) noexcept;
 
     /// element-wise reciprocal_sqrt
     /// @relates Vector3D
     template <typename T>
-    inline Vector3D<T> reciprocal_sqrt(Vector3D<T> const & value,
-                                       Vector3D<T> const & defaultValue = {}) noexcept;
+    constexpr Vector3D<T> reciprocal_sqrt(Vector3D<T> const & value,
+                                          Vector3D<T> const & defaultValue = {}) noexcept;
 
     /// element-wise reciprocal_sqrt
     /// @relates Vector4D
     template <typename T>
-    inline Vector4D<T> reciprocal_sqrt(Vector4D<T> const & value,
-                                       Vector4D<T> const & defaultValue = {}) noexcept;
+    constexpr Vector4D<T> reciprocal_sqrt(Vector4D<T> const & value,
+                                          Vector4D<T> const & defaultValue = {}) noexcept;
+
+    // =============================================================================
+
+    /// element-wise reciprocal_sqrt_fast
+    /// @relates Vector2D
+    template <unsigned int Steps = 2>
+    constexpr Vector2D<float> reciprocal_sqrt_fast(Vector2D<float> const & value,
+                                                  Vector2D<float> const & defaultValue = {}) noexcept;
+
+    /// element-wise reciprocal_sqrt_fast
+    /// @relates Vector3D
+    template <unsigned int Steps = 2>
+    constexpr Vector3D<float> reciprocal_sqrt_fast(Vector3D<float> const & value,
+                                                  Vector3D<float> const & defaultValue = {}) noexcept;
+
+    /// element-wise reciprocal_sqrt_fast
+    /// @relates Vector4D
+    template <unsigned int Steps = 2>
+    constexpr Vector4D<float> reciprocal_sqrt_fast(Vector4D<float> const & value,
+                                                  Vector4D<float> const & defaultValue = {}) noexcept;
 
     // =============================================================================
 
@@ -1005,9 +1052,9 @@ namespace ggm
     /// @param[in] surfaceNormal The surface normal vector.
     /// @param[in] eta           The ratio of indices of refraction.
     template <typename T>
-    inline Vector2D<T> refract(Vector2D<T> const & incident,
-                               Vector2D<T> const & surfaceNormal,
-                               T const &           eta) noexcept;
+    constexpr Vector2D<T> refract(Vector2D<T> const & incident,
+                                  Vector2D<T> const & surfaceNormal,
+                                  T const &           eta) noexcept;
 
     /// refraction direction for an incident vector
     /// @relates Vector3D
@@ -1015,9 +1062,9 @@ namespace ggm
     /// @param[in] surfaceNormal The surface normal vector.
     /// @param[in] eta           The ratio of indices of refraction.
     template <typename T>
-    inline Vector3D<T> refract(Vector3D<T> const & incident,
-                               Vector3D<T> const & surfaceNormal,
-                               T const &           eta) noexcept;
+    constexpr Vector3D<T> refract(Vector3D<T> const & incident,
+                                  Vector3D<T> const & surfaceNormal,
+                                  T const &           eta) noexcept;
 
     // =============================================================================
 
@@ -1061,6 +1108,29 @@ namespace ggm
 
     // =============================================================================
 
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Vector2D
+    template <typename T>
+    constexpr Vector2D<T> select(Vector2D<bool> const & mask,
+                                 Vector2D<T> const &    lhs,
+                                 Vector2D<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Vector3D
+    template <typename T>
+    constexpr Vector3D<T> select(Vector3D<bool> const & mask,
+                                 Vector3D<T> const &    lhs,
+                                 Vector3D<T> const &    rhs) noexcept;
+
+    /// element-wise select, i.e. mask ? lhs : rhs for each element (branch-free)
+    /// @relates Vector4D
+    template <typename T>
+    constexpr Vector4D<T> select(Vector4D<bool> const & mask,
+                                 Vector4D<T> const &    lhs,
+                                 Vector4D<T> const &    rhs) noexcept;
+
+    // =============================================================================
+
     /// element-wise smooth_step
     /// @relates Vector2D
     template <typename T>
@@ -1148,23 +1218,46 @@ namespace ggm
     /// element-wise is_close
     /// @relates Vector2D
     template <typename T>
-    inline Vector2D<bool> is_close(Vector2D<T> const & lhs,
-                                   Vector2D<T> const & rhs,
-                                   T const &           epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector2D<bool> is_close(Vector2D<T> const & lhs,
+                                      Vector2D<T> const & rhs,
+                                      T const &           epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Vector3D
     template <typename T>
-    inline Vector3D<bool> is_close(Vector3D<T> const & lhs,
-                                   Vector3D<T> const & rhs,
-                                   T const &           epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector3D<bool> is_close(Vector3D<T> const & lhs,
+                                      Vector3D<T> const & rhs,
+                                      T const &           epsilon = DefaultTolerance<T>) noexcept;
 
     /// element-wise is_close
     /// @relates Vector4D
     template <typename T>
-    inline Vector4D<bool> is_close(Vector4D<T> const & lhs,
-                                   Vector4D<T> const & rhs,
-                                   T const &           epsilon = DefaultTolerance<T>) noexcept;
+    constexpr Vector4D<bool> is_close(Vector4D<T> const & lhs,
+                                      Vector4D<T> const & rhs,
+                                      T const &           epsilon = DefaultTolerance<T>) noexcept;
+
+    // =============================================================================
+
+    /// element-wise is_close_ulps
+    /// @relates Vector2D
+    template <typename T>
+    constexpr Vector2D<bool> is_close_ulps(Vector2D<T> const & lhs,
+                                           Vector2D<T> const & rhs,
+                                           unsigned int const  maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Vector3D
+    template <typename T>
+    constexpr Vector3D<bool> is_close_ulps(Vector3D<T> const & lhs,
+                                           Vector3D<T> const & rhs,
+                                           unsigned int const  maxUlps = DefaultToleranceUlps) noexcept;
+
+    /// element-wise is_close_ulps
+    /// @relates Vector4D
+    template <typename T>
+    constexpr Vector4D<bool> is_close_ulps(Vector4D<T> const & lhs,
+                                           Vector4D<T> const & rhs,
+                                           unsigned int const  maxUlps = DefaultToleranceUlps) noexcept;
 
     // =============================================================================
 
@@ -2396,8 +2489,8 @@ constexpr ggm::Vector3D<T> ggm::cross(Vector3D<T> const & lhs,
 // =============================================================================
 
 template <typename T>
-inline T ggm::distance(Vector2D<T> const & lhs,
-                       Vector2D<T> const & rhs) noexcept
+constexpr T ggm::distance(Vector2D<T> const & lhs,
+                          Vector2D<T> const & rhs) noexcept
 {
     return sqrt(distance_squared(lhs, rhs));
 }
@@ -2405,8 +2498,8 @@ inline T ggm::distance(Vector2D<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline T ggm::distance(Vector3D<T> const & lhs,
-                       Vector3D<T> const & rhs) noexcept
+constexpr T ggm::distance(Vector3D<T> const & lhs,
+                          Vector3D<T> const & rhs) noexcept
 {
     return sqrt(distance_squared(lhs, rhs));
 }
@@ -2414,8 +2507,8 @@ inline T ggm::distance(Vector3D<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline T ggm::distance(Vector4D<T> const & lhs,
-                       Vector4D<T> const & rhs) noexcept
+constexpr T ggm::distance(Vector4D<T> const & lhs,
+                          Vector4D<T> const & rhs) noexcept
 {
     return sqrt(distance_squared(lhs, rhs));
 }
@@ -2453,8 +2546,8 @@ template <typename T>
 constexpr T ggm::dot(Vector2D<T> const & lhs,
                      Vector2D<T> const & rhs) noexcept
 {
-    return lhs.x * rhs.x +
-           lhs.y * rhs.y;
+    return sum_of_products(lhs.x, rhs.x,
+                           lhs.y, rhs.y);
 }
 
 // -----------------------------------------------------------------------------
@@ -2463,9 +2556,9 @@ template <typename T>
 constexpr T ggm::dot(Vector3D<T> const & lhs,
                      Vector3D<T> const & rhs) noexcept
 {
-    return lhs.x * rhs.x +
-           lhs.y * rhs.y +
-           lhs.z * rhs.z;
+    return sum_of_products(lhs.x, rhs.x,
+                           lhs.y, rhs.y,
+                           lhs.z, rhs.z);
 }
 
 // -----------------------------------------------------------------------------
@@ -2474,10 +2567,10 @@ template <typename T>
 constexpr T ggm::dot(Vector4D<T> const & lhs,
                      Vector4D<T> const & rhs) noexcept
 {
-    return lhs.x * rhs.x +
-           lhs.y * rhs.y +
-           lhs.z * rhs.z +
-           lhs.w * rhs.w;
+    return sum_of_products(lhs.x, rhs.x,
+                           lhs.y, rhs.y,
+                           lhs.z, rhs.z,
+                           lhs.w, rhs.w);
 }
 
 // =============================================================================
@@ -2627,8 +2720,8 @@ constexpr ggm::Vector4D<T> ggm::inverse_lerp(Vector4D<T> const & value0,
 // =============================================================================
 
 template <typename T>
-inline bool ggm::is_normalized(Vector2D<T> const & value,
-                               T const &           epsilon) noexcept
+constexpr bool ggm::is_normalized(Vector2D<T> const & value,
+                                  T const &           epsilon) noexcept
 {
     return is_close(length_squared(value), T{ 1 }, epsilon);
 }
@@ -2636,8 +2729,8 @@ inline bool ggm::is_normalized(Vector2D<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_normalized(Vector3D<T> const & value,
-                               T const &           epsilon) noexcept
+constexpr bool ggm::is_normalized(Vector3D<T> const & value,
+                                  T const &           epsilon) noexcept
 {
     return is_close(length_squared(value), T{ 1 }, epsilon);
 }
@@ -2645,8 +2738,8 @@ inline bool ggm::is_normalized(Vector3D<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline bool ggm::is_normalized(Vector4D<T> const & value,
-                               T const &           epsilon) noexcept
+constexpr bool ggm::is_normalized(Vector4D<T> const & value,
+                                  T const &           epsilon) noexcept
 {
     return is_close(length_squared(value), T{ 1 }, epsilon);
 }
@@ -2654,7 +2747,7 @@ inline bool ggm::is_normalized(Vector4D<T> const & value,
 // =============================================================================
 
 template <typename T>
-inline T ggm::length(Vector2D<T> const & value) noexcept
+constexpr T ggm::length(Vector2D<T> const & value) noexcept
 {
     return sqrt(length_squared(value));
 }
@@ -2662,7 +2755,7 @@ inline T ggm::length(Vector2D<T> const & value) noexcept
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline T ggm::length(Vector3D<T> const & value) noexcept
+constexpr T ggm::length(Vector3D<T> const & value) noexcept
 {
     return sqrt(length_squared(value));
 }
@@ -2670,7 +2763,7 @@ inline T ggm::length(Vector3D<T> const & value) noexcept
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline T ggm::length(Vector4D<T> const & value) noexcept
+constexpr T ggm::length(Vector4D<T> const & value) noexcept
 {
     return sqrt(length_squared(value));
 }
@@ -2948,7 +3041,7 @@ constexpr T ggm::min_element(Vector4D<T> const & value) noexcept
 // =============================================================================
 
 template <typename T>
-inline ggm::Vector2D<T> ggm::normalize(Vector2D<T> const & value) noexcept
+constexpr ggm::Vector2D<T> ggm::normalize(Vector2D<T> const & value) noexcept
 {
     return value * reciprocal_sqrt(length_squared(value));
 }
@@ -2956,7 +3049,7 @@ inline ggm::Vector2D<T> ggm::normalize(Vector2D<T> const & value) noexcept
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector3D<T> ggm::normalize(Vector3D<T> const & value) noexcept
+constexpr ggm::Vector3D<T> ggm::normalize(Vector3D<T> const & value) noexcept
 {
     return value * reciprocal_sqrt(length_squared(value));
 }
@@ -2964,13 +3057,37 @@ inline ggm::Vector3D<T> ggm::normalize(Vector3D<T> const & value) noexcept
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector4D<T> ggm::normalize(Vector4D<T> const & value) noexcept
+constexpr ggm::Vector4D<T> ggm::normalize(Vector4D<T> const & value) noexcept
 {
     return value * reciprocal_sqrt(length_squared(value));
 }
 
 // =============================================================================
 
+template <unsigned int Steps>
+constexpr ggm::Vector2D<float> ggm::normalize_fast(Vector2D<float> const & value) noexcept
+{
+    return value * reciprocal_sqrt_fast<Steps>(length_squared(value));
+}
+
+// -----------------------------------------------------------------------------
+
+template <unsigned int Steps>
+constexpr ggm::Vector3D<float> ggm::normalize_fast(Vector3D<float> const & value) noexcept
+{
+    return value * reciprocal_sqrt_fast<Steps>(length_squared(value));
+}
+
+// -----------------------------------------------------------------------------
+
+template <unsigned int Steps>
+constexpr ggm::Vector4D<float> ggm::normalize_fast(Vector4D<float> const & value) noexcept
+{
+    return value * reciprocal_sqrt_fast<Steps>(length_squared(value));
+}
+
+// =============================================================================
+
 template <typename T>
 constexpr ggm::Vector2D<T> ggm::reciprocal(Vector2D<T> const & value,
                                            Vector2D<T> const & defaultValue) noexcept
@@ -3011,8 +3128,8 @@ constexpr ggm::Vector4D<T> ggm::reciprocal(Vector4D<T> const & value,
 // =============================================================================
 
 template <typename T>
-inline ggm::Vector2D<T> ggm::reciprocal_sqrt(Vector2D<T> const & value,
-                                             Vector2D<T> const & defaultValue) noexcept
+constexpr ggm::Vector2D<T> ggm::reciprocal_sqrt(Vector2D<T> const & value,
+                                                Vector2D<T> const & defaultValue) noexcept
 {
     return Vector2D<T>{
         reciprocal_sqrt(value.x, defaultValue.x),
@@ -3023,8 +3140,8 @@ inline ggm::Vector2D<T> ggm::reciprocal_sqrt(Vector2D<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector3D<T> ggm::reciprocal_sqrt(Vector3D<T> const & value,
-                                             Vector3D<T> const & defaultValue) noexcept
+constexpr ggm::Vector3D<T> ggm::reciprocal_sqrt(Vector3D<T> const & value,
+                                                Vector3D<T> const & defaultValue) noexcept
 {
     return Vector3D<T>{
         reciprocal_sqrt(value.x, defaultValue.x),
@@ -3036,8 +3153,8 @@ inline ggm::Vector3D<T> ggm::reciprocal_sqrt(Vector3D<T> const & value,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector4D<T> ggm::reciprocal_sqrt(Vector4D<T> const & value,
-                                             Vector4D<T> const & defaultValue) noexcept
+constexpr ggm::Vector4D<T> ggm::reciprocal_sqrt(Vector4D<T> const & value,
+                                                Vector4D<T> const & defaultValue) noexcept
 {
     return Vector4D<T>{
         reciprocal_sqrt(value.x, defaultValue.x),
@@ -3049,6 +3166,45 @@ inline ggm::Vector4D<T> ggm::reciprocal_sqrt(Vector4D<T> const & value,
 
 // =============================================================================
 
+template <unsigned int Steps>
+constexpr ggm::Vector2D<float> ggm::reciprocal_sqrt_fast(Vector2D<float> const & value,
+                                                         Vector2D<float> const & defaultValue) noexcept
+{
+    return Vector2D<float>{
+        reciprocal_sqrt_fast<Steps>(value.x, defaultValue.x),
+        reciprocal_sqrt_fast<Steps>(value.y, defaultValue.y),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <unsigned int Steps>
+constexpr ggm::Vector3D<float> ggm::reciprocal_sqrt_fast(Vector3D<float> const & value,
+                                                         Vector3D<float> const & defaultValue) noexcept
+{
+    return Vector3D<float>{
+        reciprocal_sqrt_fast<Steps>(value.x, defaultValue.x),
+        reciprocal_sqrt_fast<Steps>(value.y, defaultValue.y),
+        reciprocal_sqrt_fast<Steps>(value.z, defaultValue.z),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <unsigned int Steps>
+constexpr ggm::Vector4D<float> ggm::reciprocal_sqrt_fast(Vector4D<float> const & value,
+                                                         Vector4D<float> const & defaultValue) noexcept
+{
+    return Vector4D<float>{
+        reciprocal_sqrt_fast<Steps>(value.x, defaultValue.x),
+        reciprocal_sqrt_fast<Steps>(value.y, defaultValue.y),
+        reciprocal_sqrt_fast<Steps>(value.z, defaultValue.z),
+        reciprocal_sqrt_fast<Steps>(value.w, defaultValue.w),
+    };
+}
+
+// =============================================================================
+
 template <typename T>
 constexpr ggm::Vector2D<T> ggm::reflect(Vector2D<T> const & incident,
                                         Vector2D<T> const & surfaceNormal) noexcept
@@ -3068,9 +3224,9 @@ constexpr ggm::Vector3D<T> ggm::reflect(Vector3D<T> const & incident,
 // =============================================================================
 
 template <typename T>
-inline ggm::Vector2D<T> ggm::refract(Vector2D<T> const & incident,
-                                     Vector2D<T> const & surfaceNormal,
-                                     T const &           eta) noexcept
+constexpr ggm::Vector2D<T> ggm::refract(Vector2D<T> const & incident,
+                                        Vector2D<T> const & surfaceNormal,
+                                        T const &           eta) noexcept
 {
     T const nDotI = dot(incident, surfaceNormal);
     T const k     = T{ 1 } - eta * eta * (T{ 1 } - nDotI * nDotI);
@@ -3089,9 +3245,9 @@ inline ggm::Vector2D<T> ggm::refract(Vector2D<T> const & incident,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector3D<T> ggm::refract(Vector3D<T> const & incident,
-                                     Vector3D<T> const & surfaceNormal,
-                                     T const &           eta) noexcept
+constexpr ggm::Vector3D<T> ggm::refract(Vector3D<T> const & incident,
+                                        Vector3D<T> const & surfaceNormal,
+                                        T const &           eta) noexcept
 {
     T const nDotI = dot(incident, surfaceNormal);
     T const k     = T{ 1 } - eta * eta * (T{ 1 } - nDotI * nDotI);
@@ -3188,6 +3344,48 @@ constexpr ggm::Vector4D<T> ggm::saturate(Vector4D<T> const & value) noexcept
 
 // =============================================================================
 
+template <typename T>
+constexpr ggm::Vector2D<T> ggm::select(Vector2D<bool> const & mask,
+                                       Vector2D<T> const &    lhs,
+                                       Vector2D<T> const &    rhs) noexcept
+{
+    return Vector2D<T>{
+        mask.x ? lhs.x : rhs.x,
+        mask.y ? lhs.y : rhs.y,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3D<T> ggm::select(Vector3D<bool> const & mask,
+                                       Vector3D<T> const &    lhs,
+                                       Vector3D<T> const &    rhs) noexcept
+{
+    return Vector3D<T>{
+        mask.x ? lhs.x : rhs.x,
+        mask.y ? lhs.y : rhs.y,
+        mask.z ? lhs.z : rhs.z,
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4D<T> ggm::select(Vector4D<bool> const & mask,
+                                       Vector4D<T> const &    lhs,
+                                       Vector4D<T> const &    rhs) noexcept
+{
+    return Vector4D<T>{
+        mask.x ? lhs.x : rhs.x,
+        mask.y ? lhs.y : rhs.y,
+        mask.z ? lhs.z : rhs.z,
+        mask.w ? lhs.w : rhs.w,
+    };
+}
+
+// =============================================================================
+
 template <typename T>
 constexpr ggm::Vector2D<T> ggm::smooth_step(Vector2D<T> const & edge0,
                                             Vector2D<T> const & edge1,
@@ -3269,7 +3467,7 @@ constexpr ggm::Vector4D<T> ggm::trunc(Vector4D<T> const & value) noexcept
 
 constexpr bool ggm::all_of(Vector2D<bool> const & value) noexcept
 {
-    return value.x &&
+    return value.x &
            value.y;
 }
 
@@ -3277,8 +3475,8 @@ constexpr bool ggm::all_of(Vector2D<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Vector3D<bool> const & value) noexcept
 {
-    return value.x &&
-           value.y &&
+    return value.x &
+           value.y &
            value.z;
 }
 
@@ -3286,9 +3484,9 @@ constexpr bool ggm::all_of(Vector3D<bool> const & value) noexcept
 
 constexpr bool ggm::all_of(Vector4D<bool> const & value) noexcept
 {
-    return value.x &&
-           value.y &&
-           value.z &&
+    return value.x &
+           value.y &
+           value.z &
            value.w;
 }
 
@@ -3296,7 +3494,7 @@ constexpr bool ggm::all_of(Vector4D<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Vector2D<bool> const & value) noexcept
 {
-    return value.x ||
+    return value.x |
            value.y;
 }
 
@@ -3304,8 +3502,8 @@ constexpr bool ggm::any_of(Vector2D<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Vector3D<bool> const & value) noexcept
 {
-    return value.x ||
-           value.y ||
+    return value.x |
+           value.y |
            value.z;
 }
 
@@ -3313,9 +3511,9 @@ constexpr bool ggm::any_of(Vector3D<bool> const & value) noexcept
 
 constexpr bool ggm::any_of(Vector4D<bool> const & value) noexcept
 {
-    return value.x ||
-           value.y ||
-           value.z ||
+    return value.x |
+           value.y |
+           value.z |
            value.w;
 }
 
@@ -3323,7 +3521,7 @@ constexpr bool ggm::any_of(Vector4D<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Vector2D<bool> const & value) noexcept
 {
-    return !value.x &&
+    return !value.x &
            !value.y;
 }
 
@@ -3331,8 +3529,8 @@ constexpr bool ggm::none_of(Vector2D<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Vector3D<bool> const & value) noexcept
 {
-    return !value.x &&
-           !value.y &&
+    return !value.x &
+           !value.y &
            !value.z;
 }
 
@@ -3340,18 +3538,18 @@ constexpr bool ggm::none_of(Vector3D<bool> const & value) noexcept
 
 constexpr bool ggm::none_of(Vector4D<bool> const & value) noexcept
 {
-    return !value.x &&
-           !value.y &&
-           !value.z &&
+    return !value.x &
+           !value.y &
+           !value.z &
            !value.w;
 }
 
 // =============================================================================
 
 template <typename T>
-inline ggm::Vector2D<bool> ggm::is_close(Vector2D<T> const & lhs,
-                                         Vector2D<T> const & rhs,
-                                         T const &           epsilon) noexcept
+constexpr ggm::Vector2D<bool> ggm::is_close(Vector2D<T> const & lhs,
+                                            Vector2D<T> const & rhs,
+                                            T const &           epsilon) noexcept
 {
     return Vector2D<bool>{
         is_close(lhs.x, rhs.x, epsilon),
@@ -3362,9 +3560,9 @@ inline ggm::Vector2D<bool> ggm::is_close(Vector2D<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector3D<bool> ggm::is_close(Vector3D<T> const & lhs,
-                                         Vector3D<T> const & rhs,
-                                         T const &           epsilon) noexcept
+constexpr ggm::Vector3D<bool> ggm::is_close(Vector3D<T> const & lhs,
+                                            Vector3D<T> const & rhs,
+                                            T const &           epsilon) noexcept
 {
     return Vector3D<bool>{
         is_close(lhs.x, rhs.x, epsilon),
@@ -3376,9 +3574,9 @@ inline ggm::Vector3D<bool> ggm::is_close(Vector3D<T> const & lhs,
 // -----------------------------------------------------------------------------
 
 template <typename T>
-inline ggm::Vector4D<bool> ggm::is_close(Vector4D<T> const & lhs,
-                                         Vector4D<T> const & rhs,
-                                         T const &           epsilon) noexcept
+constexpr ggm::Vector4D<bool> ggm::is_close(Vector4D<T> const & lhs,
+                                            Vector4D<T> const & rhs,
+                                            T const &           epsilon) noexcept
 {
     return Vector4D<bool>{
         is_close(lhs.x, rhs.x, epsilon),
@@ -3390,6 +3588,48 @@ inline ggm::Vector4D<bool> ggm::is_close(Vector4D<T> const & lhs,
 
 // =============================================================================
 
+template <typename T>
+constexpr ggm::Vector2D<bool> ggm::is_close_ulps(Vector2D<T> const & lhs,
+                                                 Vector2D<T> const & rhs,
+                                                 unsigned int const  maxUlps) noexcept
+{
+    return Vector2D<bool>{
+        is_close_ulps(lhs.x, rhs.x, maxUlps),
+        is_close_ulps(lhs.y, rhs.y, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector3D<bool> ggm::is_close_ulps(Vector3D<T> const & lhs,
+                                                 Vector3D<T> const & rhs,
+                                                 unsigned int const  maxUlps) noexcept
+{
+    return Vector3D<bool>{
+        is_close_ulps(lhs.x, rhs.x, maxUlps),
+        is_close_ulps(lhs.y, rhs.y, maxUlps),
+        is_close_ulps(lhs.z, rhs.z, maxUlps),
+    };
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+constexpr ggm::Vector4D<bool> ggm::is_close_ulps(Vector4D<T> const & lhs,
+                                                 Vector4D<T> const & rhs,
+                                                 unsigned int const  maxUlps) noexcept
+{
+    return Vector4D<bool>{
+        is_close_ulps(lhs.x, rhs.x, maxUlps),
+        is_close_ulps(lhs.y, rhs.y, maxUlps),
+        is_close_ulps(lhs.z, rhs.z, maxUlps),
+        is_close_ulps(lhs.w, rhs.w, maxUlps),
+    };
+}
+
+// =============================================================================
+
 template <typename T>
 constexpr ggm::Vector2D<bool> ggm::is_equal(Vector2D<T> const & lhs,
                                             Vector2D<T> const & rhs) noexcept
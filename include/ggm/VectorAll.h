@@ -3,7 +3,21 @@
 #define GGM_VECTOR_ALL_H
 
 #include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorAligned.h"
+#include "ggm/Vector/VectorAlignedUtil.h"
+#include "ggm/Vector/VectorBatch.h"
 #include "ggm/Vector/VectorConstants.h"
+#include "ggm/Vector/VectorEncoding.h"
+#include "ggm/Vector/VectorHash.h"
+#include "ggm/Vector/VectorMask.h"
+#include "ggm/Vector/VectorMesh.h"
+#include "ggm/Vector/VectorNoise.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+#include "ggm/Vector/VectorRandom.h"
+#include "ggm/Vector/VectorSoA.h"
+#include "ggm/Vector/VectorSoAUtil.h"
+#include "ggm/Vector/VectorSpatialKey.h"
 #include "ggm/Vector/VectorTypedefs.h"
 #include "ggm/Vector/VectorUtil.h"
 
@@ -1,6 +1,7 @@
 #ifndef GGM_H
 #define GGM_H
 
+#include "ggm/Dispatch/DispatchLevel.h"
 #include "ggm/MatrixAll.h"
 #include "ggm/NumericAll.h"
 #include "ggm/VectorAll.h"
@@ -0,0 +1,723 @@
+#pragma once
+#ifndef GGM_DISPATCH_BATCH_KERNELS_H
+#define GGM_DISPATCH_BATCH_KERNELS_H
+
+#include "ggm/Dispatch/DispatchLevel.h"
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixBatch.h"
+#include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Numeric/Half.h"
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorEncoding.h"
+#include "ggm/Vector/VectorNoise.h"
+#include "ggm/Vector/VectorRandom.h"
+#include "ggm/Vector/VectorSpatialKey.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <type_traits>
+
+// =============================================================================
+/// Batch kernels, compiled once per DispatchLevel (private to the ggm library).
+/// @details
+/// Each BatchKernels<Level>.cpp instantiates the kernel templates below for its own Level, & is compiled
+/// with that level's instruction set flags (see CMakeLists.txt). DispatchLevel.cpp picks the table to use.
+///
+/// note: the inline ggm functions called by a kernel are also compiled with the wider instruction set, so
+/// they must not be emitted as (weak) out-of-line definitions that the linker could pick for other
+/// callers. GGM_DISPATCH_FLATTEN() inlines every call made by a kernel to prevent that (GCC only honors it
+/// when optimizing, so CMakeLists.txt never compiles the kernels with -O0).
+// =============================================================================
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GGM_DISPATCH_FLATTEN() __attribute__((flatten))
+#elif defined(_MSC_VER)
+#define GGM_DISPATCH_FLATTEN() [[msvc::flatten]]
+#else
+#define GGM_DISPATCH_FLATTEN()
+#endif
+
+// BatchStore::Streaming uses the SSE2 streaming stores, which every x86 dispatch level has, other targets use
+// regular stores
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define GGM_DISPATCH_STREAMING() 1
+#include <emmintrin.h>
+#else
+#define GGM_DISPATCH_STREAMING() 0
+#endif
+
+namespace ggm::DispatchImpl
+{
+    // =============================================================================
+    // TransformSource
+    // =============================================================================
+
+    /// The vectors (points or directions) of a transform kernel, either the span vectors (if stride is 0) or
+    /// the interleaved vertex buffer values, where vector i is the elements values[i * stride + 0, 1(, 2)]
+    template <typename T, typename V>
+    struct TransformSource
+    {
+        // members:
+        std::span<V const> vectors;
+        std::span<T const> values;
+        std::size_t        stride; // uninitialized
+    };
+
+    // =============================================================================
+    // BatchKernels
+    // =============================================================================
+
+    /// The batch kernels compiled for one DispatchLevel.
+    struct BatchKernels
+    {
+        // members:
+        DispatchLevel level; // uninitialized
+
+        void (*floatFromHalfVector3D)(std::span<Vector3D<half> const> values,
+                                      std::span<Vector3D<float>>      results) noexcept; // uninitialized
+        void (*halfFromFloatVector3D)(std::span<Vector3D<float> const> values,
+                                      std::span<Vector3D<half>>        results) noexcept; // uninitialized
+
+        void (*normalizeVector3Df)(std::span<Vector3D<float> const> values,
+                                   std::span<Vector3D<float>>       results) noexcept; // uninitialized
+        void (*normalizeVector3Dd)(std::span<Vector3D<double> const> values,
+                                   std::span<Vector3D<double>>       results) noexcept; // uninitialized
+
+        void (*octahedral16FromVector3D)(std::span<Vector3D<float> const> values,
+                                         std::span<Vector2D<std::int16_t>> results) noexcept; // uninitialized
+        void (*octahedral8FromVector3D)(std::span<Vector3D<float> const> values,
+                                        std::span<Vector2D<std::int8_t>>  results) noexcept; // uninitialized
+        void (*vector3DFromOctahedral16)(std::span<Vector2D<std::int16_t> const> values,
+                                         std::span<Vector3D<float>>              results) noexcept; // uninitialized
+        void (*vector3DFromOctahedral8)(std::span<Vector2D<std::int8_t> const> values,
+                                        std::span<Vector3D<float>>             results) noexcept; // uninitialized
+
+        void (*snorm16FromVector2D)(std::span<Vector2D<float> const>  values,
+                                    std::span<Vector2D<std::int16_t>> results) noexcept; // uninitialized
+        void (*unorm16FromVector2D)(std::span<Vector2D<float> const>   values,
+                                    std::span<Vector2D<std::uint16_t>> results) noexcept; // uninitialized
+        void (*vector2DFromSnorm16)(std::span<Vector2D<std::int16_t> const> values,
+                                    std::span<Vector2D<float>>              results) noexcept; // uninitialized
+        void (*vector2DFromUnorm16)(std::span<Vector2D<std::uint16_t> const> values,
+                                    std::span<Vector2D<float>>               results) noexcept; // uninitialized
+
+        void (*snorm8FromVector4D)(std::span<Vector4D<float> const> values,
+                                   std::span<Vector4D<std::int8_t>> results) noexcept; // uninitialized
+        void (*unorm8FromVector4D)(std::span<Vector4D<float> const>  values,
+                                   std::span<Vector4D<std::uint8_t>> results) noexcept; // uninitialized
+        void (*snorm16FromVector4D)(std::span<Vector4D<float> const>  values,
+                                    std::span<Vector4D<std::int16_t>> results) noexcept; // uninitialized
+        void (*unorm16FromVector4D)(std::span<Vector4D<float> const>   values,
+                                    std::span<Vector4D<std::uint16_t>> results) noexcept; // uninitialized
+        void (*vector4DFromSnorm8)(std::span<Vector4D<std::int8_t> const> values,
+                                   std::span<Vector4D<float>>             results) noexcept; // uninitialized
+        void (*vector4DFromUnorm8)(std::span<Vector4D<std::uint8_t> const> values,
+                                   std::span<Vector4D<float>>              results) noexcept; // uninitialized
+        void (*vector4DFromSnorm16)(std::span<Vector4D<std::int16_t> const> values,
+                                    std::span<Vector4D<float>>              results) noexcept; // uninitialized
+        void (*vector4DFromUnorm16)(std::span<Vector4D<std::uint16_t> const> values,
+                                    std::span<Vector4D<float>>               results) noexcept; // uninitialized
+
+        void (*snorm1010102FromVector4D)(std::span<Vector4D<float> const> values,
+                                         std::span<std::uint32_t>         results) noexcept; // uninitialized
+        void (*unorm1010102FromVector4D)(std::span<Vector4D<float> const> values,
+                                         std::span<std::uint32_t>         results) noexcept; // uninitialized
+        void (*vector4DFromSnorm1010102)(std::span<std::uint32_t const> values,
+                                         std::span<Vector4D<float>>     results) noexcept; // uninitialized
+        void (*vector4DFromUnorm1010102)(std::span<std::uint32_t const> values,
+                                         std::span<Vector4D<float>>     results) noexcept; // uninitialized
+
+        void (*hilbertFromVector2D)(Vector2D<float> const &          boundsMin,
+                                    Vector2D<float> const &          boundsMax,
+                                    std::span<Vector2D<float> const> values,
+                                    std::span<std::uint32_t>         keys) noexcept; // uninitialized
+        void (*hilbertFromVector3D)(Vector3D<float> const &          boundsMin,
+                                    Vector3D<float> const &          boundsMax,
+                                    std::span<Vector3D<float> const> values,
+                                    std::span<std::uint64_t>         keys) noexcept; // uninitialized
+        void (*mortonFromVector2D)(Vector2D<float> const &          boundsMin,
+                                   Vector2D<float> const &          boundsMax,
+                                   std::span<Vector2D<float> const> values,
+                                   std::span<std::uint32_t>         keys) noexcept; // uninitialized
+        void (*mortonFromVector3D)(Vector3D<float> const &          boundsMin,
+                                   Vector3D<float> const &          boundsMax,
+                                   std::span<Vector3D<float> const> values,
+                                   std::span<std::uint64_t>         keys) noexcept; // uninitialized
+
+        void (*perlinFbm2D)(std::span<Vector2D<float> const> values,
+                            int                              octaves,
+                            float                            lacunarity,
+                            float                            gain,
+                            std::span<float>                 results) noexcept; // uninitialized
+        void (*perlinFbm3D)(std::span<Vector3D<float> const> values,
+                            int                              octaves,
+                            float                            lacunarity,
+                            float                            gain,
+                            std::span<float>                 results) noexcept; // uninitialized
+        void (*simplexFbm2D)(std::span<Vector2D<float> const> values,
+                             int                              octaves,
+                             float                            lacunarity,
+                             float                            gain,
+                             std::span<float>                 results) noexcept; // uninitialized
+        void (*simplexFbm3D)(std::span<Vector3D<float> const> values,
+                             int                              octaves,
+                             float                            lacunarity,
+                             float                            gain,
+                             std::span<float>                 results) noexcept; // uninitialized
+
+        void (*randomInBox2D)(std::uint32_t              seed,
+                              std::uint32_t              first,
+                              Vector2D<float> const &    boxMin,
+                              Vector2D<float> const &    boxMax,
+                              std::span<Vector2D<float>> results) noexcept; // uninitialized
+        void (*randomInBox3D)(std::uint32_t              seed,
+                              std::uint32_t              first,
+                              Vector3D<float> const &    boxMin,
+                              Vector3D<float> const &    boxMax,
+                              std::span<Vector3D<float>> results) noexcept; // uninitialized
+        void (*randomInBox4D)(std::uint32_t              seed,
+                              std::uint32_t              first,
+                              Vector4D<float> const &    boxMin,
+                              Vector4D<float> const &    boxMax,
+                              std::span<Vector4D<float>> results) noexcept; // uninitialized
+        void (*randomInCone)(std::uint32_t              seed,
+                             std::uint32_t              first,
+                             Vector3D<float> const &    direction,
+                             float                      cosHalfAngle,
+                             std::span<Vector3D<float>> results) noexcept; // uninitialized
+        void (*randomInDisk)(std::uint32_t              seed,
+                             std::uint32_t              first,
+                             std::span<Vector2D<float>> results) noexcept; // uninitialized
+        void (*randomInSphere)(std::uint32_t              seed,
+                               std::uint32_t              first,
+                               std::span<Vector3D<float>> results) noexcept; // uninitialized
+        void (*randomOnSphere)(std::uint32_t              seed,
+                               std::uint32_t              first,
+                               std::span<Vector3D<float>> results) noexcept; // uninitialized
+
+        void (*multiplyMatrix4x4f)(std::span<Matrix4x4<float> const> lhs,
+                                   std::span<Matrix4x4<float> const> rhs,
+                                   std::span<Matrix4x4<float>>       results) noexcept; // uninitialized
+        void (*multiplyMatrix4x4d)(std::span<Matrix4x4<double> const> lhs,
+                                   std::span<Matrix4x4<double> const> rhs,
+                                   std::span<Matrix4x4<double>>       results) noexcept; // uninitialized
+
+        void (*transformPoints4x4f)(Matrix4x4<float> const &                transform,
+                                    TransformSource<float, Vector3D<float>> source,
+                                    std::span<Vector3D<float>>              results,
+                                    BatchStore                              store) noexcept; // uninitialized
+        void (*transformPoints4x4d)(Matrix4x4<double> const &                 transform,
+                                    TransformSource<double, Vector3D<double>> source,
+                                    std::span<Vector3D<double>>               results,
+                                    BatchStore                                store) noexcept; // uninitialized
+        void (*transformDirections4x4f)(Matrix4x4<float> const &                transform,
+                                        TransformSource<float, Vector3D<float>> source,
+                                        std::span<Vector3D<float>>              results,
+                                        BatchStore                              store) noexcept; // uninitialized
+        void (*transformDirections4x4d)(Matrix4x4<double> const &                 transform,
+                                        TransformSource<double, Vector3D<double>> source,
+                                        std::span<Vector3D<double>>               results,
+                                        BatchStore                                store) noexcept; // uninitialized
+        void (*transformPointsProject4x4f)(Matrix4x4<float> const &                transform,
+                                           TransformSource<float, Vector3D<float>> source,
+                                           std::span<Vector3D<float>>              results,
+                                           BatchStore                              store) noexcept; // uninitialized
+        void (*transformPointsProject4x4d)(Matrix4x4<double> const &                 transform,
+                                           TransformSource<double, Vector3D<double>> source,
+                                           std::span<Vector3D<double>>               results,
+                                           BatchStore                                store) noexcept; // uninitialized
+
+        void (*transformPoints3Df)(MatrixTransform3D<float> const &        transform,
+                                   TransformSource<float, Vector3D<float>> source,
+                                   std::span<Vector3D<float>>              results,
+                                   BatchStore                              store) noexcept; // uninitialized
+        void (*transformPoints3Dd)(MatrixTransform3D<double> const &         transform,
+                                   TransformSource<double, Vector3D<double>> source,
+                                   std::span<Vector3D<double>>               results,
+                                   BatchStore                                store) noexcept; // uninitialized
+        void (*transformDirections3Df)(MatrixTransform3D<float> const &        transform,
+                                       TransformSource<float, Vector3D<float>> source,
+                                       std::span<Vector3D<float>>              results,
+                                       BatchStore                              store) noexcept; // uninitialized
+        void (*transformDirections3Dd)(MatrixTransform3D<double> const &         transform,
+                                       TransformSource<double, Vector3D<double>> source,
+                                       std::span<Vector3D<double>>               results,
+                                       BatchStore                                store) noexcept; // uninitialized
+
+        void (*transformPoints2Df)(MatrixTransform2D<float> const &        transform,
+                                   TransformSource<float, Vector2D<float>> source,
+                                   std::span<Vector2D<float>>              results,
+                                   BatchStore                              store) noexcept; // uninitialized
+        void (*transformPoints2Dd)(MatrixTransform2D<double> const &         transform,
+                                   TransformSource<double, Vector2D<double>> source,
+                                   std::span<Vector2D<double>>               results,
+                                   BatchStore                                store) noexcept; // uninitialized
+        void (*transformDirections2Df)(MatrixTransform2D<float> const &        transform,
+                                       TransformSource<float, Vector2D<float>> source,
+                                       std::span<Vector2D<float>>              results,
+                                       BatchStore                              store) noexcept; // uninitialized
+        void (*transformDirections2Dd)(MatrixTransform2D<double> const &         transform,
+                                       TransformSource<double, Vector2D<double>> source,
+                                       std::span<Vector2D<double>>               results,
+                                       BatchStore                                store) noexcept; // uninitialized
+    };
+
+    // =============================================================================
+
+    extern BatchKernels const BaselineBatchKernels; ///< defined in BatchKernelsBaseline.cpp
+    extern BatchKernels const Sse42BatchKernels;    ///< defined in BatchKernelsSse42.cpp
+    extern BatchKernels const Avx2BatchKernels;     ///< defined in BatchKernelsAvx2.cpp
+    extern BatchKernels const Avx512BatchKernels;   ///< defined in BatchKernelsAvx512.cpp
+
+    /// The kernels for the active dispatch level, defined in DispatchLevel.cpp.
+    BatchKernels const & active_batch_kernels() noexcept;
+
+    // =============================================================================
+    // kernels:
+    // =============================================================================
+
+    /// Level is unused, other than to give each level's instantiation a distinct symbol.
+    /// note: levels with F16C (i.e. Avx2 & Avx512) convert with those instructions, see NumericUtil.h
+    template <DispatchLevel Level>
+    GGM_DISPATCH_FLATTEN() void float_from_half_kernel(std::span<Vector3D<half> const> const values,
+                                                       std::span<Vector3D<float>> const      results) noexcept
+    {
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector3D<half> const & value = values[i];
+            results[i]                   = Vector3D<float>{ float_from_half(value.x), float_from_half(value.y), float_from_half(value.z) };
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <DispatchLevel Level>
+    GGM_DISPATCH_FLATTEN() void half_from_float_kernel(std::span<Vector3D<float> const> const values,
+                                                       std::span<Vector3D<half>> const        results) noexcept
+    {
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vector3D<float> const & value = values[i];
+            results[i]                    = Vector3D<half>{ half_from_float(value.x), half_from_float(value.y), half_from_float(value.z) };
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <DispatchLevel Level, typename T>
+    GGM_DISPATCH_FLATTEN() void normalize_kernel(std::span<Vector3D<T> const> const values,
+                                                 std::span<Vector3D<T>> const       results) noexcept
+    {
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = normalize(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = Convert(values[i]), for the element-wise conversions (e.g. octahedral16_from_vector3D)
+    /// note: Arg is the parameter type of Convert, i.e. T const & or T
+    template <DispatchLevel Level, typename Arg, typename U, U (*Convert)(Arg) noexcept>
+    GGM_DISPATCH_FLATTEN() void convert_kernel(std::span<std::remove_cvref_t<Arg> const> const values,
+                                               std::span<U> const                              results) noexcept
+    {
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = Convert(values[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// keys[i] = Key(Grid(values[i], boundsMin, boundsMax)), for the spatial keys (e.g. morton_from_vector3D)
+    /// note: levels with BMI2 (i.e. Avx2 & Avx512) compute morton keys with pdep, see VectorSpatialKey.h
+    template <DispatchLevel Level,
+              typename T,
+              typename G,
+              typename K,
+              G (*Grid)(T const &, T const &, T const &) noexcept,
+              K (*Key)(G const &) noexcept>
+    GGM_DISPATCH_FLATTEN() void spatial_key_kernel(T const &                boundsMin,
+                                                   T const &                boundsMax,
+                                                   std::span<T const> const values,
+                                                   std::span<K> const       keys) noexcept
+    {
+        // copy, so that the compiler knows that writing the keys can't modify the bounds
+        T const minimum = boundsMin;
+        T const maximum = boundsMax;
+
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            keys[i] = Key(Grid(values[i], minimum, maximum));
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = the sum of gain^o * Noise(values[i] * lacunarity^o) for o in [0, octaves), see NoiseImpl::fbm
+    /// note: the octave loop is outside the point loop, so that the point loop is vectorizable
+    template <DispatchLevel Level, typename V, float (*Noise)(V const &) noexcept>
+    GGM_DISPATCH_FLATTEN() void fbm_kernel(std::span<V const> const values,
+                                           int const                octaves,
+                                           float const              lacunarity,
+                                           float const              gain,
+                                           std::span<float> const   results) noexcept
+    {
+        std::size_t const count = values.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = 0.0f;
+        }
+
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        for (int octave = 0; octave < octaves; ++octave)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                results[i] += amplitude * Noise(values[i] * frequency);
+            }
+
+            amplitude *= gain;
+            frequency *= lacunarity;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = Sample(Random(seed, first + i)), for the random samples without parameters (e.g. uniform_in_sphere)
+    template <DispatchLevel Level,
+              typename U,
+              typename T,
+              U (*Random)(std::uint32_t, std::uint32_t) noexcept,
+              T (*Sample)(U const &) noexcept>
+    GGM_DISPATCH_FLATTEN() void random_kernel(std::uint32_t const  seed,
+                                              std::uint32_t const  first,
+                                              std::span<T> const results) noexcept
+    {
+        std::size_t const count = results.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = Sample(Random(seed, first + static_cast<std::uint32_t>(i)));
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <DispatchLevel Level, typename T, T (*Random)(std::uint32_t, std::uint32_t) noexcept>
+    GGM_DISPATCH_FLATTEN() void random_in_box_kernel(std::uint32_t const  seed,
+                                                     std::uint32_t const  first,
+                                                     T const &            boxMin,
+                                                     T const &            boxMax,
+                                                     std::span<T> const results) noexcept
+    {
+        // copy, so that the compiler knows that writing the results can't modify the box
+        T const minimum = boxMin;
+        T const maximum = boxMax;
+
+        std::size_t const count = results.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = uniform_in_box(Random(seed, first + static_cast<std::uint32_t>(i)), minimum, maximum);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <DispatchLevel Level>
+    GGM_DISPATCH_FLATTEN() void random_in_cone_kernel(std::uint32_t const                seed,
+                                                      std::uint32_t const                first,
+                                                      Vector3D<float> const &            direction,
+                                                      float const                        cosHalfAngle,
+                                                      std::span<Vector3D<float>> const results) noexcept
+    {
+        // copy, so that the compiler knows that writing the results can't modify the direction
+        Vector3D<float> const axis = direction;
+
+        std::size_t const count = results.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = uniform_in_cone(random_vector2D(seed, first + static_cast<std::uint32_t>(i)), axis, cosHalfAngle);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    template <DispatchLevel Level, typename T>
+    GGM_DISPATCH_FLATTEN() void multiply_kernel(std::span<Matrix4x4<T> const> const lhs,
+                                                std::span<Matrix4x4<T> const> const rhs,
+                                                std::span<Matrix4x4<T>> const       results) noexcept
+    {
+        std::size_t const count = lhs.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = lhs[i] * rhs[i];
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    // =============================================================================
+    // transform kernels:
+    // =============================================================================
+
+    /// (transform * Vector4D{point, 1}).xyz
+    template <typename T>
+    constexpr Vector3D<T> transform_point(Matrix4x4<T> const & transform,
+                                          Vector3D<T> const &  point) noexcept
+    {
+        Vector4D<T> const result = transform * Vector4D<T>{ point.x, point.y, point.z, T{ 1 } };
+        return Vector3D<T>{ result.x, result.y, result.z };
+    }
+
+    /// transform * Vector4D{point, 1}
+    template <typename T>
+    constexpr Vector3D<T> transform_point(MatrixTransform3D<T> const & transform,
+                                          Vector3D<T> const &          point) noexcept
+    {
+        return transform * Vector4D<T>{ point.x, point.y, point.z, T{ 1 } };
+    }
+
+    /// transform * Vector3D{point, 1}
+    template <typename T>
+    constexpr Vector2D<T> transform_point(MatrixTransform2D<T> const & transform,
+                                          Vector2D<T> const &          point) noexcept
+    {
+        return transform * Vector3D<T>{ point.x, point.y, T{ 1 } };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// (transform * Vector4D{direction, 0}).xyz
+    template <typename T>
+    constexpr Vector3D<T> transform_direction(Matrix4x4<T> const & transform,
+                                              Vector3D<T> const &  direction) noexcept
+    {
+        Vector4D<T> const result = transform * Vector4D<T>{ direction.x, direction.y, direction.z, T{ 0 } };
+        return Vector3D<T>{ result.x, result.y, result.z };
+    }
+
+    /// transform * Vector4D{direction, 0}
+    template <typename T>
+    constexpr Vector3D<T> transform_direction(MatrixTransform3D<T> const & transform,
+                                              Vector3D<T> const &          direction) noexcept
+    {
+        return transform * Vector4D<T>{ direction.x, direction.y, direction.z, T{ 0 } };
+    }
+
+    /// transform * Vector3D{direction, 0}
+    template <typename T>
+    constexpr Vector2D<T> transform_direction(MatrixTransform2D<T> const & transform,
+                                              Vector2D<T> const &          direction) noexcept
+    {
+        return transform * Vector3D<T>{ direction.x, direction.y, T{ 0 } };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// p.xyz / p.w for p = transform * Vector4D{point, 1}
+    template <typename T>
+    constexpr Vector3D<T> transform_point_project(Matrix4x4<T> const & transform,
+                                                  Vector3D<T> const &  point) noexcept
+    {
+        Vector4D<T> const result = transform * Vector4D<T>{ point.x, point.y, point.z, T{ 1 } };
+        return Vector3D<T>{ result.x / result.w, result.y / result.w, result.z / result.w };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// the vector of the elements values[offset + 0, 1]
+    template <typename T>
+    constexpr void load_vector(std::span<T const> const values,
+                               std::size_t const        offset,
+                               Vector2D<T> &            result) noexcept
+    {
+        result = Vector2D<T>{ values[offset], values[offset + 1] };
+    }
+
+    /// the vector of the elements values[offset + 0, 1, 2]
+    template <typename T>
+    constexpr void load_vector(std::span<T const> const values,
+                               std::size_t const        offset,
+                               Vector3D<T> &            result) noexcept
+    {
+        result = Vector3D<T>{ values[offset], values[offset + 1], values[offset + 2] };
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = compute(i), with streaming stores for BatchStore::Streaming (if the target has them)
+    template <typename V, typename Compute>
+    void store_results(std::span<V> const results,
+                       BatchStore const   store,
+                       Compute const &    compute) noexcept
+    {
+        std::size_t const count = results.size();
+        std::size_t       i     = 0;
+
+#if GGM_DISPATCH_STREAMING()
+        if (store == BatchStore::Streaming)
+        {
+            // the streaming stores write 16 aligned bytes, i.e. Block results, so store the first results
+            // regularly until the results are aligned (e.g. Vector2D<float> results at 8 + 16n never are)
+            constexpr std::size_t Block = 16 / std::gcd(sizeof(V), std::size_t{ 16 });
+
+            auto const is_aligned = [&results](std::size_t const index) noexcept
+            {
+                return (reinterpret_cast<std::uintptr_t>(results.data() + index) % 16) == 0;
+            };
+
+            for (; (i < count) && (i < Block) && !is_aligned(i); ++i)
+            {
+                results[i] = compute(i);
+            }
+
+            if (is_aligned(i))
+            {
+                for (; i + Block <= count; i += Block)
+                {
+                    V block[Block]; // uninitialized
+                    for (std::size_t j = 0; j < Block; ++j)
+                    {
+                        block[j] = compute(i + j);
+                    }
+
+                    char * const destination = reinterpret_cast<char *>(results.data() + i);
+                    for (std::size_t offset = 0; offset < sizeof(block); offset += 16)
+                    {
+                        __m128i bytes; // uninitialized
+                        std::memcpy(&bytes, reinterpret_cast<char const *>(block) + offset, 16);
+                        _mm_stream_si128(reinterpret_cast<__m128i *>(destination + offset), bytes);
+                    }
+                }
+
+                // order the streaming stores before any later store (e.g. a flag that the results are ready)
+                _mm_sfence();
+            }
+        }
+#else
+        static_cast<void>(store);
+#endif
+
+        for (; i < count; ++i)
+        {
+            results[i] = compute(i);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// results[i] = Transform(transform, the vector i of source), for the transform_* functions
+    template <DispatchLevel Level, typename M, typename T, typename V, V (*Transform)(M const &, V const &) noexcept>
+    GGM_DISPATCH_FLATTEN() void transform_kernel(M const &                   transform,
+                                                 TransformSource<T, V> const source,
+                                                 std::span<V> const          results,
+                                                 BatchStore const            store) noexcept
+    {
+        // copy, so that the compiler knows that writing the results can't modify the transform
+        M const m = transform;
+
+        if (source.stride == 0)
+        {
+            std::span<V const> const vectors = source.vectors;
+            store_results(results, store, [&m, vectors](std::size_t const i) noexcept { return Transform(m, vectors[i]); });
+        }
+        else
+        {
+            std::span<T const> const values = source.values;
+            std::size_t const        stride = source.stride;
+            store_results(results,
+                          store,
+                          [&m, values, stride](std::size_t const i) noexcept
+                          {
+                              V vector; // uninitialized
+                              load_vector(values, i * stride, vector);
+                              return Transform(m, vector);
+                          });
+        }
+    }
+
+    // =============================================================================
+
+    template <DispatchLevel Level>
+    constexpr BatchKernels make_batch_kernels() noexcept
+    {
+        return BatchKernels{
+            .level                      = Level,
+            .floatFromHalfVector3D      = &float_from_half_kernel<Level>,
+            .halfFromFloatVector3D      = &half_from_float_kernel<Level>,
+            .normalizeVector3Df         = &normalize_kernel<Level, float>,
+            .normalizeVector3Dd         = &normalize_kernel<Level, double>,
+            .octahedral16FromVector3D   = &convert_kernel<Level, Vector3D<float> const &, Vector2D<std::int16_t>, &octahedral16_from_vector3D>,
+            .octahedral8FromVector3D    = &convert_kernel<Level, Vector3D<float> const &, Vector2D<std::int8_t>, &octahedral8_from_vector3D>,
+            .vector3DFromOctahedral16   = &convert_kernel<Level, Vector2D<std::int16_t> const &, Vector3D<float>, &vector3D_from_octahedral16>,
+            .vector3DFromOctahedral8    = &convert_kernel<Level, Vector2D<std::int8_t> const &, Vector3D<float>, &vector3D_from_octahedral8>,
+            .snorm16FromVector2D        = &convert_kernel<Level, Vector2D<float> const &, Vector2D<std::int16_t>, &snorm16_from_float>,
+            .unorm16FromVector2D        = &convert_kernel<Level, Vector2D<float> const &, Vector2D<std::uint16_t>, &unorm16_from_float>,
+            .vector2DFromSnorm16        = &convert_kernel<Level, Vector2D<std::int16_t> const &, Vector2D<float>, &float_from_snorm>,
+            .vector2DFromUnorm16        = &convert_kernel<Level, Vector2D<std::uint16_t> const &, Vector2D<float>, &float_from_unorm>,
+            .snorm8FromVector4D         = &convert_kernel<Level, Vector4D<float> const &, Vector4D<std::int8_t>, &snorm8_from_float>,
+            .unorm8FromVector4D         = &convert_kernel<Level, Vector4D<float> const &, Vector4D<std::uint8_t>, &unorm8_from_float>,
+            .snorm16FromVector4D        = &convert_kernel<Level, Vector4D<float> const &, Vector4D<std::int16_t>, &snorm16_from_float>,
+            .unorm16FromVector4D        = &convert_kernel<Level, Vector4D<float> const &, Vector4D<std::uint16_t>, &unorm16_from_float>,
+            .vector4DFromSnorm8         = &convert_kernel<Level, Vector4D<std::int8_t> const &, Vector4D<float>, &float_from_snorm>,
+            .vector4DFromUnorm8         = &convert_kernel<Level, Vector4D<std::uint8_t> const &, Vector4D<float>, &float_from_unorm>,
+            .vector4DFromSnorm16        = &convert_kernel<Level, Vector4D<std::int16_t> const &, Vector4D<float>, &float_from_snorm>,
+            .vector4DFromUnorm16        = &convert_kernel<Level, Vector4D<std::uint16_t> const &, Vector4D<float>, &float_from_unorm>,
+            .snorm1010102FromVector4D   = &convert_kernel<Level, Vector4D<float> const &, std::uint32_t, &snorm1010102_from_vector4D>,
+            .unorm1010102FromVector4D   = &convert_kernel<Level, Vector4D<float> const &, std::uint32_t, &unorm1010102_from_vector4D>,
+            .vector4DFromSnorm1010102   = &convert_kernel<Level, std::uint32_t, Vector4D<float>, &vector4D_from_snorm1010102>,
+            .vector4DFromUnorm1010102   = &convert_kernel<Level, std::uint32_t, Vector4D<float>, &vector4D_from_unorm1010102>,
+            .hilbertFromVector2D        = &spatial_key_kernel<Level, Vector2D<float>, Vector2D<unsigned int>, std::uint32_t, &grid_from_vector2D, &hilbert_from_vector2D>,
+            .hilbertFromVector3D        = &spatial_key_kernel<Level, Vector3D<float>, Vector3D<unsigned int>, std::uint64_t, &grid_from_vector3D, &hilbert_from_vector3D>,
+            .mortonFromVector2D         = &spatial_key_kernel<Level, Vector2D<float>, Vector2D<unsigned int>, std::uint32_t, &grid_from_vector2D, &morton_from_vector2D>,
+            .mortonFromVector3D         = &spatial_key_kernel<Level, Vector3D<float>, Vector3D<unsigned int>, std::uint64_t, &grid_from_vector3D, &morton_from_vector3D>,
+            .perlinFbm2D                = &fbm_kernel<Level, Vector2D<float>, &perlin_noise>,
+            .perlinFbm3D                = &fbm_kernel<Level, Vector3D<float>, &perlin_noise>,
+            .simplexFbm2D               = &fbm_kernel<Level, Vector2D<float>, &simplex_noise>,
+            .simplexFbm3D               = &fbm_kernel<Level, Vector3D<float>, &simplex_noise>,
+            .randomInBox2D              = &random_in_box_kernel<Level, Vector2D<float>, &random_vector2D>,
+            .randomInBox3D              = &random_in_box_kernel<Level, Vector3D<float>, &random_vector3D>,
+            .randomInBox4D              = &random_in_box_kernel<Level, Vector4D<float>, &random_vector4D>,
+            .randomInCone               = &random_in_cone_kernel<Level>,
+            .randomInDisk               = &random_kernel<Level, Vector2D<float>, Vector2D<float>, &random_vector2D, &uniform_in_disk>,
+            .randomInSphere             = &random_kernel<Level, Vector3D<float>, Vector3D<float>, &random_vector3D, &uniform_in_sphere>,
+            .randomOnSphere             = &random_kernel<Level, Vector2D<float>, Vector3D<float>, &random_vector2D, &uniform_on_sphere>,
+            .multiplyMatrix4x4f         = &multiply_kernel<Level, float>,
+            .multiplyMatrix4x4d         = &multiply_kernel<Level, double>,
+            .transformPoints4x4f        = &transform_kernel<Level, Matrix4x4<float>, float, Vector3D<float>, &transform_point>,
+            .transformPoints4x4d        = &transform_kernel<Level, Matrix4x4<double>, double, Vector3D<double>, &transform_point>,
+            .transformDirections4x4f    = &transform_kernel<Level, Matrix4x4<float>, float, Vector3D<float>, &transform_direction>,
+            .transformDirections4x4d    = &transform_kernel<Level, Matrix4x4<double>, double, Vector3D<double>, &transform_direction>,
+            .transformPointsProject4x4f = &transform_kernel<Level, Matrix4x4<float>, float, Vector3D<float>, &transform_point_project>,
+            .transformPointsProject4x4d = &transform_kernel<Level, Matrix4x4<double>, double, Vector3D<double>, &transform_point_project>,
+            .transformPoints3Df         = &transform_kernel<Level, MatrixTransform3D<float>, float, Vector3D<float>, &transform_point>,
+            .transformPoints3Dd         = &transform_kernel<Level, MatrixTransform3D<double>, double, Vector3D<double>, &transform_point>,
+            .transformDirections3Df     = &transform_kernel<Level, MatrixTransform3D<float>, float, Vector3D<float>, &transform_direction>,
+            .transformDirections3Dd     = &transform_kernel<Level, MatrixTransform3D<double>, double, Vector3D<double>, &transform_direction>,
+            .transformPoints2Df         = &transform_kernel<Level, MatrixTransform2D<float>, float, Vector2D<float>, &transform_point>,
+            .transformPoints2Dd         = &transform_kernel<Level, MatrixTransform2D<double>, double, Vector2D<double>, &transform_point>,
+            .transformDirections2Df     = &transform_kernel<Level, MatrixTransform2D<float>, float, Vector2D<float>, &transform_direction>,
+            .transformDirections2Dd     = &transform_kernel<Level, MatrixTransform2D<double>, double, Vector2D<double>, &transform_direction>,
+        };
+    }
+
+    // =============================================================================
+} // namespace ggm::DispatchImpl
+
+// =============================================================================
+
+#endif // GGM_DISPATCH_BATCH_KERNELS_H
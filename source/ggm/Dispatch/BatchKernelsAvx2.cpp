@@ -0,0 +1,9 @@
+#include "ggm/Dispatch/BatchKernels.h"
+
+// =============================================================================
+// compiled with AVX2, FMA, F16C, BMI1 & BMI2 enabled (see CMakeLists.txt)
+// =============================================================================
+
+ggm::DispatchImpl::BatchKernels const ggm::DispatchImpl::Avx2BatchKernels = make_batch_kernels<DispatchLevel::Avx2>();
+
+// =============================================================================
@@ -0,0 +1,9 @@
+#include "ggm/Dispatch/BatchKernels.h"
+
+// =============================================================================
+// compiled with AVX-512 F, VL, BW, DQ & CD enabled (see CMakeLists.txt)
+// =============================================================================
+
+ggm::DispatchImpl::BatchKernels const ggm::DispatchImpl::Avx512BatchKernels = make_batch_kernels<DispatchLevel::Avx512>();
+
+// =============================================================================
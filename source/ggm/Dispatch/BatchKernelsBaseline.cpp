@@ -0,0 +1,9 @@
+#include "ggm/Dispatch/BatchKernels.h"
+
+// =============================================================================
+// compiled with the library's own flags (the target's baseline ISA)
+// =============================================================================
+
+ggm::DispatchImpl::BatchKernels const ggm::DispatchImpl::BaselineBatchKernels = make_batch_kernels<DispatchLevel::Baseline>();
+
+// =============================================================================
@@ -0,0 +1,9 @@
+#include "ggm/Dispatch/BatchKernels.h"
+
+// =============================================================================
+// compiled with SSE4.2 & POPCNT enabled (see CMakeLists.txt)
+// =============================================================================
+
+ggm::DispatchImpl::BatchKernels const ggm::DispatchImpl::Sse42BatchKernels = make_batch_kernels<DispatchLevel::Sse42>();
+
+// =============================================================================
@@ -0,0 +1,301 @@
+#include "ggm/Dispatch/DispatchLevel.h"
+
+#include "ggm/Dispatch/BatchKernels.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// GGM_DISPATCH_X86_LEVELS is defined by CMakeLists.txt when the Sse42, Avx2 & Avx512 kernels are compiled
+// with their instruction set flags (i.e. for x86 targets)
+#if defined(GGM_DISPATCH_X86_LEVELS)
+#define GGM_DISPATCH_X86() 1
+#else
+#define GGM_DISPATCH_X86() 0
+#endif
+
+#if GGM_DISPATCH_X86()
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// =============================================================================
+
+namespace
+{
+#if GGM_DISPATCH_X86()
+    // =============================================================================
+
+    struct CpuidRegisters
+    {
+        // members:
+        std::uint32_t eax; // uninitialized
+        std::uint32_t ebx; // uninitialized
+        std::uint32_t ecx; // uninitialized
+        std::uint32_t edx; // uninitialized
+    };
+
+    // -----------------------------------------------------------------------------
+
+    CpuidRegisters cpuid(std::uint32_t const leaf,
+                         std::uint32_t const subleaf) noexcept
+    {
+#if defined(_MSC_VER)
+        int registers[4] = {};
+        __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+        return CpuidRegisters{
+            static_cast<std::uint32_t>(registers[0]),
+            static_cast<std::uint32_t>(registers[1]),
+            static_cast<std::uint32_t>(registers[2]),
+            static_cast<std::uint32_t>(registers[3]),
+        };
+#else
+        CpuidRegisters registers{};
+        __cpuid_count(leaf, subleaf, registers.eax, registers.ebx, registers.ecx, registers.edx);
+        return registers;
+#endif
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// The register state enabled by the OS (XCR0), only valid if cpuid reports OSXSAVE.
+    std::uint64_t xgetbv0() noexcept
+    {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        std::uint32_t eax = 0;
+        std::uint32_t edx = 0;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+    }
+
+    // -----------------------------------------------------------------------------
+
+    constexpr bool has_bits(std::uint64_t const value,
+                            std::uint64_t const bits) noexcept
+    {
+        return (value & bits) == bits;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    ggm::DispatchLevel detect_dispatch_level() noexcept
+    {
+        // cpuid leaf 1 ecx
+        constexpr std::uint32_t Sse42Bit   = 1u << 20;
+        constexpr std::uint32_t PopcntBit  = 1u << 23;
+        constexpr std::uint32_t FmaBit     = 1u << 12;
+        constexpr std::uint32_t OsxsaveBit = 1u << 27;
+        constexpr std::uint32_t AvxBit     = 1u << 28;
+        constexpr std::uint32_t F16cBit    = 1u << 29;
+
+        // cpuid leaf 7 ebx
+        constexpr std::uint32_t Bmi1Bit     = 1u << 3;
+        constexpr std::uint32_t Avx2Bit     = 1u << 5;
+        constexpr std::uint32_t Bmi2Bit     = 1u << 8;
+        constexpr std::uint32_t Avx512fBit  = 1u << 16;
+        constexpr std::uint32_t Avx512dqBit = 1u << 17;
+        constexpr std::uint32_t Avx512cdBit = 1u << 28;
+        constexpr std::uint32_t Avx512bwBit = 1u << 30;
+        constexpr std::uint32_t Avx512vlBit = 1u << 31;
+
+        // XCR0
+        constexpr std::uint64_t AvxStateBits    = 0x06u; // xmm & ymm
+        constexpr std::uint64_t Avx512StateBits = 0xE6u; // xmm, ymm, opmask, zmm0-15 upper & zmm16-31
+
+        std::uint32_t const maxLeaf = cpuid(0, 0).eax;
+        if (maxLeaf < 1)
+        {
+            return ggm::DispatchLevel::Baseline;
+        }
+
+        std::uint32_t const leaf1 = cpuid(1, 0).ecx;
+        if (!has_bits(leaf1, Sse42Bit | PopcntBit))
+        {
+            return ggm::DispatchLevel::Baseline;
+        }
+
+        // the OS must save the ymm (& zmm) registers on context switches, in addition to the cpu support
+        std::uint64_t const osState = has_bits(leaf1, OsxsaveBit) ? xgetbv0() : 0;
+        std::uint32_t const leaf7   = (maxLeaf >= 7) ? cpuid(7, 0).ebx : 0;
+
+        bool const hasAvx2 = has_bits(leaf1, FmaBit | AvxBit | F16cBit) &&
+                             has_bits(leaf7, Bmi1Bit | Avx2Bit | Bmi2Bit) &&
+                             has_bits(osState, AvxStateBits);
+        if (!hasAvx2)
+        {
+            return ggm::DispatchLevel::Sse42;
+        }
+
+        bool const hasAvx512 = has_bits(leaf7, Avx512fBit | Avx512dqBit | Avx512cdBit | Avx512bwBit | Avx512vlBit) &&
+                               has_bits(osState, Avx512StateBits);
+        if (!hasAvx512)
+        {
+            return ggm::DispatchLevel::Avx2;
+        }
+
+        return ggm::DispatchLevel::Avx512;
+    }
+
+    // =============================================================================
+#else
+    // =============================================================================
+
+    ggm::DispatchLevel detect_dispatch_level() noexcept
+    {
+        return ggm::DispatchLevel::Baseline;
+    }
+
+    // =============================================================================
+#endif
+
+    // -----------------------------------------------------------------------------
+
+    ggm::DispatchImpl::BatchKernels const & batch_kernels(ggm::DispatchLevel const level) noexcept
+    {
+        switch (level)
+        {
+            case ggm::DispatchLevel::Baseline:
+                return ggm::DispatchImpl::BaselineBatchKernels;
+            case ggm::DispatchLevel::Sse42:
+                return ggm::DispatchImpl::Sse42BatchKernels;
+            case ggm::DispatchLevel::Avx2:
+                return ggm::DispatchImpl::Avx2BatchKernels;
+            case ggm::DispatchLevel::Avx512:
+                return ggm::DispatchImpl::Avx512BatchKernels;
+        }
+
+        return ggm::DispatchImpl::BaselineBatchKernels;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    /// The level named by the GGM_DISPATCH_LEVEL environment variable if it is supported, else the supported level.
+    ggm::DispatchLevel initial_dispatch_level() noexcept
+    {
+        constexpr ggm::DispatchLevel Levels[] = {
+            ggm::DispatchLevel::Baseline,
+            ggm::DispatchLevel::Sse42,
+            ggm::DispatchLevel::Avx2,
+            ggm::DispatchLevel::Avx512,
+        };
+
+        ggm::DispatchLevel const supportedLevel = ggm::supported_dispatch_level();
+
+        char const * const levelName = std::getenv("GGM_DISPATCH_LEVEL");
+        if (levelName != nullptr)
+        {
+            for (ggm::DispatchLevel const level : Levels)
+            {
+                if ((std::strcmp(levelName, ggm::dispatch_level_name(level)) == 0) && (level <= supportedLevel))
+                {
+                    return level;
+                }
+            }
+        }
+
+        return supportedLevel;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    ggm::DispatchImpl::BatchKernels const & initial_batch_kernels() noexcept
+    {
+        static ggm::DispatchImpl::BatchKernels const & sInitialBatchKernels = batch_kernels(initial_dispatch_level());
+        return sInitialBatchKernels;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    std::atomic<ggm::DispatchImpl::BatchKernels const *> & active_batch_kernels_ptr() noexcept
+    {
+        static std::atomic<ggm::DispatchImpl::BatchKernels const *> sActiveBatchKernels{ &initial_batch_kernels() };
+        return sActiveBatchKernels;
+    }
+
+    // =============================================================================
+} // namespace
+
+// =============================================================================
+// ggm::supported_dispatch_level
+// =============================================================================
+
+ggm::DispatchLevel ggm::supported_dispatch_level() noexcept
+{
+    static DispatchLevel const sSupportedLevel = detect_dispatch_level();
+    return sSupportedLevel;
+}
+
+// =============================================================================
+// ggm::active_dispatch_level
+// =============================================================================
+
+ggm::DispatchLevel ggm::active_dispatch_level() noexcept
+{
+    return DispatchImpl::active_batch_kernels().level;
+}
+
+// =============================================================================
+// ggm::set_dispatch_level
+// =============================================================================
+
+bool ggm::set_dispatch_level(DispatchLevel const level) noexcept
+{
+    if (level > supported_dispatch_level())
+    {
+        return false;
+    }
+
+    active_batch_kernels_ptr().store(&batch_kernels(level), std::memory_order_release);
+    return true;
+}
+
+// =============================================================================
+// ggm::reset_dispatch_level
+// =============================================================================
+
+void ggm::reset_dispatch_level() noexcept
+{
+    active_batch_kernels_ptr().store(&initial_batch_kernels(), std::memory_order_release);
+}
+
+// =============================================================================
+// ggm::dispatch_level_name
+// =============================================================================
+
+char const * ggm::dispatch_level_name(DispatchLevel const level) noexcept
+{
+    switch (level)
+    {
+        case DispatchLevel::Baseline:
+            return "baseline";
+        case DispatchLevel::Sse42:
+            return "sse4.2";
+        case DispatchLevel::Avx2:
+            return "avx2";
+        case DispatchLevel::Avx512:
+            return "avx512";
+    }
+
+    return "unknown";
+}
+
+// =============================================================================
+// ggm::DispatchImpl::active_batch_kernels
+// =============================================================================
+
+ggm::DispatchImpl::BatchKernels const & ggm::DispatchImpl::active_batch_kernels() noexcept
+{
+    return *active_batch_kernels_ptr().load(std::memory_order_acquire);
+}
+
+// =============================================================================
+
+#undef GGM_DISPATCH_X86
@@ -0,0 +1,183 @@
+#include "ggm/Matrix/MatrixBatch.h"
+
+#include "ggm/Dispatch/BatchKernels.h"
+
+#include <cassert>
+
+// =============================================================================
+// ggm::multiply
+// =============================================================================
+
+void ggm::multiply(std::span<Matrix4x4<float> const> const lhs,
+                   std::span<Matrix4x4<float> const> const rhs,
+                   std::span<Matrix4x4<float>> const       results) noexcept
+{
+    assert(rhs.size() == lhs.size());
+    assert(results.size() == lhs.size());
+    DispatchImpl::active_batch_kernels().multiplyMatrix4x4f(lhs, rhs, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::multiply(std::span<Matrix4x4<double> const> const lhs,
+                   std::span<Matrix4x4<double> const> const rhs,
+                   std::span<Matrix4x4<double>> const       results) noexcept
+{
+    assert(rhs.size() == lhs.size());
+    assert(results.size() == lhs.size());
+    DispatchImpl::active_batch_kernels().multiplyMatrix4x4d(lhs, rhs, results);
+}
+
+// =============================================================================
+
+// =============================================================================
+// ggm::transform_points
+// =============================================================================
+
+void ggm::transform_points(Matrix4x4<float> const &               transform,
+                           std::span<Vector3D<float> const> const points,
+                           std::span<Vector3D<float>> const       results,
+                           BatchStore const                       store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPoints4x4f(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(Matrix4x4<float> const &         transform,
+                           std::span<float const> const     values,
+                           std::size_t const                stride,
+                           std::span<Vector3D<float>> const results,
+                           BatchStore const                 store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformPoints4x4f(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(Matrix4x4<double> const &               transform,
+                           std::span<Vector3D<double> const> const points,
+                           std::span<Vector3D<double>> const       results,
+                           BatchStore const                        store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPoints4x4d(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(Matrix4x4<double> const &         transform,
+                           std::span<double const> const     values,
+                           std::size_t const                 stride,
+                           std::span<Vector3D<double>> const results,
+                           BatchStore const                  store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformPoints4x4d(transform, { {}, values, stride }, results, store);
+}
+
+// =============================================================================
+// ggm::transform_directions
+// =============================================================================
+
+void ggm::transform_directions(Matrix4x4<float> const &               transform,
+                               std::span<Vector3D<float> const> const directions,
+                               std::span<Vector3D<float>> const       results,
+                               BatchStore const                       store) noexcept
+{
+    assert(results.size() == directions.size());
+    DispatchImpl::active_batch_kernels().transformDirections4x4f(transform, { directions, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(Matrix4x4<float> const &         transform,
+                               std::span<float const> const     values,
+                               std::size_t const                stride,
+                               std::span<Vector3D<float>> const results,
+                               BatchStore const                 store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformDirections4x4f(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(Matrix4x4<double> const &               transform,
+                               std::span<Vector3D<double> const> const directions,
+                               std::span<Vector3D<double>> const       results,
+                               BatchStore const                        store) noexcept
+{
+    assert(results.size() == directions.size());
+    DispatchImpl::active_batch_kernels().transformDirections4x4d(transform, { directions, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(Matrix4x4<double> const &         transform,
+                               std::span<double const> const     values,
+                               std::size_t const                 stride,
+                               std::span<Vector3D<double>> const results,
+                               BatchStore const                  store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformDirections4x4d(transform, { {}, values, stride }, results, store);
+}
+
+// =============================================================================
+// ggm::transform_points_project
+// =============================================================================
+
+void ggm::transform_points_project(Matrix4x4<float> const &               transform,
+                                   std::span<Vector3D<float> const> const points,
+                                   std::span<Vector3D<float>> const       results,
+                                   BatchStore const                       store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPointsProject4x4f(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points_project(Matrix4x4<float> const &         transform,
+                                   std::span<float const> const     values,
+                                   std::size_t const                stride,
+                                   std::span<Vector3D<float>> const results,
+                                   BatchStore const                 store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformPointsProject4x4f(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points_project(Matrix4x4<double> const &               transform,
+                                   std::span<Vector3D<double> const> const points,
+                                   std::span<Vector3D<double>> const       results,
+                                   BatchStore const                        store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPointsProject4x4d(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points_project(Matrix4x4<double> const &         transform,
+                                   std::span<double const> const     values,
+                                   std::size_t const                 stride,
+                                   std::span<Vector3D<double>> const results,
+                                   BatchStore const                  store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformPointsProject4x4d(transform, { {}, values, stride }, results, store);
+}
+
+// =============================================================================
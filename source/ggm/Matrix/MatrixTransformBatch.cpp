@@ -0,0 +1,203 @@
+#include "ggm/Matrix/MatrixTransformBatch.h"
+
+#include "ggm/Dispatch/BatchKernels.h"
+
+#include <cassert>
+
+// =============================================================================
+// ggm::transform_points
+// =============================================================================
+
+void ggm::transform_points(MatrixTransform3D<float> const &       transform,
+                           std::span<Vector3D<float> const> const points,
+                           std::span<Vector3D<float>> const       results,
+                           BatchStore const                       store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPoints3Df(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform3D<float> const & transform,
+                           std::span<float const> const     values,
+                           std::size_t const                stride,
+                           std::span<Vector3D<float>> const results,
+                           BatchStore const                 store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformPoints3Df(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform3D<double> const &       transform,
+                           std::span<Vector3D<double> const> const points,
+                           std::span<Vector3D<double>> const       results,
+                           BatchStore const                        store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPoints3Dd(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform3D<double> const & transform,
+                           std::span<double const> const     values,
+                           std::size_t const                 stride,
+                           std::span<Vector3D<double>> const results,
+                           BatchStore const                  store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformPoints3Dd(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform2D<float> const &       transform,
+                           std::span<Vector2D<float> const> const points,
+                           std::span<Vector2D<float>> const       results,
+                           BatchStore const                       store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPoints2Df(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform2D<float> const & transform,
+                           std::span<float const> const     values,
+                           std::size_t const                stride,
+                           std::span<Vector2D<float>> const results,
+                           BatchStore const                 store) noexcept
+{
+    assert(stride >= 2);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 2));
+    DispatchImpl::active_batch_kernels().transformPoints2Df(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform2D<double> const &       transform,
+                           std::span<Vector2D<double> const> const points,
+                           std::span<Vector2D<double>> const       results,
+                           BatchStore const                        store) noexcept
+{
+    assert(results.size() == points.size());
+    DispatchImpl::active_batch_kernels().transformPoints2Dd(transform, { points, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_points(MatrixTransform2D<double> const & transform,
+                           std::span<double const> const     values,
+                           std::size_t const                 stride,
+                           std::span<Vector2D<double>> const results,
+                           BatchStore const                  store) noexcept
+{
+    assert(stride >= 2);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 2));
+    DispatchImpl::active_batch_kernels().transformPoints2Dd(transform, { {}, values, stride }, results, store);
+}
+
+// =============================================================================
+// ggm::transform_directions
+// =============================================================================
+
+void ggm::transform_directions(MatrixTransform3D<float> const &       transform,
+                               std::span<Vector3D<float> const> const directions,
+                               std::span<Vector3D<float>> const       results,
+                               BatchStore const                       store) noexcept
+{
+    assert(results.size() == directions.size());
+    DispatchImpl::active_batch_kernels().transformDirections3Df(transform, { directions, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform3D<float> const & transform,
+                               std::span<float const> const     values,
+                               std::size_t const                stride,
+                               std::span<Vector3D<float>> const results,
+                               BatchStore const                 store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformDirections3Df(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform3D<double> const &       transform,
+                               std::span<Vector3D<double> const> const directions,
+                               std::span<Vector3D<double>> const       results,
+                               BatchStore const                        store) noexcept
+{
+    assert(results.size() == directions.size());
+    DispatchImpl::active_batch_kernels().transformDirections3Dd(transform, { directions, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform3D<double> const & transform,
+                               std::span<double const> const     values,
+                               std::size_t const                 stride,
+                               std::span<Vector3D<double>> const results,
+                               BatchStore const                  store) noexcept
+{
+    assert(stride >= 3);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 3));
+    DispatchImpl::active_batch_kernels().transformDirections3Dd(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform2D<float> const &       transform,
+                               std::span<Vector2D<float> const> const directions,
+                               std::span<Vector2D<float>> const       results,
+                               BatchStore const                       store) noexcept
+{
+    assert(results.size() == directions.size());
+    DispatchImpl::active_batch_kernels().transformDirections2Df(transform, { directions, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform2D<float> const & transform,
+                               std::span<float const> const     values,
+                               std::size_t const                stride,
+                               std::span<Vector2D<float>> const results,
+                               BatchStore const                 store) noexcept
+{
+    assert(stride >= 2);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 2));
+    DispatchImpl::active_batch_kernels().transformDirections2Df(transform, { {}, values, stride }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform2D<double> const &       transform,
+                               std::span<Vector2D<double> const> const directions,
+                               std::span<Vector2D<double>> const       results,
+                               BatchStore const                        store) noexcept
+{
+    assert(results.size() == directions.size());
+    DispatchImpl::active_batch_kernels().transformDirections2Dd(transform, { directions, {}, 0 }, results, store);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::transform_directions(MatrixTransform2D<double> const & transform,
+                               std::span<double const> const     values,
+                               std::size_t const                 stride,
+                               std::span<Vector2D<double>> const results,
+                               BatchStore const                  store) noexcept
+{
+    assert(stride >= 2);
+    assert(results.empty() || (values.size() >= (results.size() - 1) * stride + 2));
+    DispatchImpl::active_batch_kernels().transformDirections2Dd(transform, { {}, values, stride }, results, store);
+}
+
+// =============================================================================
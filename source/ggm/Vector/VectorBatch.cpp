@@ -0,0 +1,487 @@
+#include "ggm/Vector/VectorBatch.h"
+
+#include "ggm/Dispatch/BatchKernels.h"
+
+#include <cassert>
+
+// =============================================================================
+// ggm::float_from_half
+// =============================================================================
+
+void ggm::float_from_half(std::span<Vector3D<half> const> const values,
+                          std::span<Vector3D<float>> const      results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().floatFromHalfVector3D(values, results);
+}
+
+// =============================================================================
+// ggm::float_from_snorm
+// =============================================================================
+
+void ggm::float_from_snorm(std::span<Vector2D<std::int16_t> const> const values,
+                           std::span<Vector2D<float>> const              results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector2DFromSnorm16(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::float_from_snorm(std::span<Vector4D<std::int8_t> const> const values,
+                           std::span<Vector4D<float>> const             results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector4DFromSnorm8(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::float_from_snorm(std::span<Vector4D<std::int16_t> const> const values,
+                           std::span<Vector4D<float>> const              results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector4DFromSnorm16(values, results);
+}
+
+// =============================================================================
+// ggm::float_from_unorm
+// =============================================================================
+
+void ggm::float_from_unorm(std::span<Vector2D<std::uint16_t> const> const values,
+                           std::span<Vector2D<float>> const               results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector2DFromUnorm16(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::float_from_unorm(std::span<Vector4D<std::uint8_t> const> const values,
+                           std::span<Vector4D<float>> const              results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector4DFromUnorm8(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::float_from_unorm(std::span<Vector4D<std::uint16_t> const> const values,
+                           std::span<Vector4D<float>> const               results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector4DFromUnorm16(values, results);
+}
+
+// =============================================================================
+// ggm::half_from_float
+// =============================================================================
+
+void ggm::half_from_float(std::span<Vector3D<float> const> const values,
+                          std::span<Vector3D<half>> const        results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().halfFromFloatVector3D(values, results);
+}
+
+// =============================================================================
+// ggm::hilbert_from_vector2D / ggm::hilbert_from_vector3D
+// =============================================================================
+
+void ggm::hilbert_from_vector2D(Vector2D<float> const &                boundsMin,
+                                Vector2D<float> const &                boundsMax,
+                                std::span<Vector2D<float> const> const values,
+                                std::span<std::uint32_t> const         keys) noexcept
+{
+    assert(keys.size() == values.size());
+    DispatchImpl::active_batch_kernels().hilbertFromVector2D(boundsMin, boundsMax, values, keys);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::hilbert_from_vector3D(Vector3D<float> const &                boundsMin,
+                                Vector3D<float> const &                boundsMax,
+                                std::span<Vector3D<float> const> const values,
+                                std::span<std::uint64_t> const         keys) noexcept
+{
+    assert(keys.size() == values.size());
+    DispatchImpl::active_batch_kernels().hilbertFromVector3D(boundsMin, boundsMax, values, keys);
+}
+
+// =============================================================================
+// ggm::morton_from_vector2D / ggm::morton_from_vector3D
+// =============================================================================
+
+void ggm::morton_from_vector2D(Vector2D<float> const &                boundsMin,
+                               Vector2D<float> const &                boundsMax,
+                               std::span<Vector2D<float> const> const values,
+                               std::span<std::uint32_t> const         keys) noexcept
+{
+    assert(keys.size() == values.size());
+    DispatchImpl::active_batch_kernels().mortonFromVector2D(boundsMin, boundsMax, values, keys);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::morton_from_vector3D(Vector3D<float> const &                boundsMin,
+                               Vector3D<float> const &                boundsMax,
+                               std::span<Vector3D<float> const> const values,
+                               std::span<std::uint64_t> const         keys) noexcept
+{
+    assert(keys.size() == values.size());
+    DispatchImpl::active_batch_kernels().mortonFromVector3D(boundsMin, boundsMax, values, keys);
+}
+
+// =============================================================================
+// ggm::normalize
+// =============================================================================
+
+void ggm::normalize(std::span<Vector3D<float> const> const values,
+                    std::span<Vector3D<float>> const       results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().normalizeVector3Df(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::normalize(std::span<Vector3D<double> const> const values,
+                    std::span<Vector3D<double>> const       results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().normalizeVector3Dd(values, results);
+}
+
+// =============================================================================
+// ggm::octahedral16_from_vector3D / ggm::octahedral8_from_vector3D
+// =============================================================================
+
+void ggm::octahedral16_from_vector3D(std::span<Vector3D<float> const> const values,
+                                     std::span<Vector2D<std::int16_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().octahedral16FromVector3D(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::octahedral8_from_vector3D(std::span<Vector3D<float> const> const values,
+                                    std::span<Vector2D<std::int8_t>> const  results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().octahedral8FromVector3D(values, results);
+}
+
+// =============================================================================
+// ggm::perlin_fbm
+// =============================================================================
+
+void ggm::perlin_fbm(std::span<Vector2D<float> const> const values,
+                     int const                              octaves,
+                     float const                            lacunarity,
+                     float const                            gain,
+                     std::span<float> const                 results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().perlinFbm2D(values, octaves, lacunarity, gain, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::perlin_fbm(std::span<Vector3D<float> const> const values,
+                     int const                              octaves,
+                     float const                            lacunarity,
+                     float const                            gain,
+                     std::span<float> const                 results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().perlinFbm3D(values, octaves, lacunarity, gain, results);
+}
+
+// =============================================================================
+// ggm::perlin_noise
+// =============================================================================
+
+void ggm::perlin_noise(std::span<Vector2D<float> const> const values,
+                       std::span<float> const                 results) noexcept
+{
+    // note: a single octave is the noise
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().perlinFbm2D(values, 1, 1.0f, 1.0f, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::perlin_noise(std::span<Vector3D<float> const> const values,
+                       std::span<float> const                 results) noexcept
+{
+    // note: a single octave is the noise
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().perlinFbm3D(values, 1, 1.0f, 1.0f, results);
+}
+
+// =============================================================================
+// ggm::random_in_box
+// =============================================================================
+
+void ggm::random_in_box(std::uint32_t const        seed,
+                        std::uint32_t const        first,
+                        Vector2D<float> const &    boxMin,
+                        Vector2D<float> const &    boxMax,
+                        std::span<Vector2D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomInBox2D(seed, first, boxMin, boxMax, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::random_in_box(std::uint32_t const        seed,
+                        std::uint32_t const        first,
+                        Vector3D<float> const &    boxMin,
+                        Vector3D<float> const &    boxMax,
+                        std::span<Vector3D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomInBox3D(seed, first, boxMin, boxMax, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::random_in_box(std::uint32_t const        seed,
+                        std::uint32_t const        first,
+                        Vector4D<float> const &    boxMin,
+                        Vector4D<float> const &    boxMax,
+                        std::span<Vector4D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomInBox4D(seed, first, boxMin, boxMax, results);
+}
+
+// =============================================================================
+// ggm::random_in_cone / ggm::random_in_hemisphere
+// =============================================================================
+
+void ggm::random_in_cone(std::uint32_t const        seed,
+                         std::uint32_t const        first,
+                         Vector3D<float> const &    direction,
+                         float const                cosHalfAngle,
+                         std::span<Vector3D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomInCone(seed, first, direction, cosHalfAngle, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::random_in_hemisphere(std::uint32_t const        seed,
+                               std::uint32_t const        first,
+                               Vector3D<float> const &    normal,
+                               std::span<Vector3D<float>> results) noexcept
+{
+    // note: uniform_in_hemisphere is uniform_in_cone with a cos half angle of 0
+    DispatchImpl::active_batch_kernels().randomInCone(seed, first, normal, 0.0f, results);
+}
+
+// =============================================================================
+// ggm::random_in_disk
+// =============================================================================
+
+void ggm::random_in_disk(std::uint32_t const        seed,
+                         std::uint32_t const        first,
+                         std::span<Vector2D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomInDisk(seed, first, results);
+}
+
+// =============================================================================
+// ggm::random_in_sphere / ggm::random_on_sphere
+// =============================================================================
+
+void ggm::random_in_sphere(std::uint32_t const        seed,
+                           std::uint32_t const        first,
+                           std::span<Vector3D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomInSphere(seed, first, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::random_on_sphere(std::uint32_t const        seed,
+                           std::uint32_t const        first,
+                           std::span<Vector3D<float>> results) noexcept
+{
+    DispatchImpl::active_batch_kernels().randomOnSphere(seed, first, results);
+}
+
+// =============================================================================
+// ggm::simplex_fbm
+// =============================================================================
+
+void ggm::simplex_fbm(std::span<Vector2D<float> const> const values,
+                      int const                              octaves,
+                      float const                            lacunarity,
+                      float const                            gain,
+                      std::span<float> const                 results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().simplexFbm2D(values, octaves, lacunarity, gain, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::simplex_fbm(std::span<Vector3D<float> const> const values,
+                      int const                              octaves,
+                      float const                            lacunarity,
+                      float const                            gain,
+                      std::span<float> const                 results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().simplexFbm3D(values, octaves, lacunarity, gain, results);
+}
+
+// =============================================================================
+// ggm::simplex_noise
+// =============================================================================
+
+void ggm::simplex_noise(std::span<Vector2D<float> const> const values,
+                        std::span<float> const                 results) noexcept
+{
+    // note: a single octave is the noise
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().simplexFbm2D(values, 1, 1.0f, 1.0f, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::simplex_noise(std::span<Vector3D<float> const> const values,
+                        std::span<float> const                 results) noexcept
+{
+    // note: a single octave is the noise
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().simplexFbm3D(values, 1, 1.0f, 1.0f, results);
+}
+
+// =============================================================================
+// ggm::snorm1010102_from_vector4D
+// =============================================================================
+
+void ggm::snorm1010102_from_vector4D(std::span<Vector4D<float> const> const values,
+                                     std::span<std::uint32_t> const         results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().snorm1010102FromVector4D(values, results);
+}
+
+// =============================================================================
+// ggm::snorm8_from_float
+// =============================================================================
+
+void ggm::snorm8_from_float(std::span<Vector4D<float> const> const values,
+                            std::span<Vector4D<std::int8_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().snorm8FromVector4D(values, results);
+}
+
+// =============================================================================
+// ggm::snorm16_from_float
+// =============================================================================
+
+void ggm::snorm16_from_float(std::span<Vector2D<float> const> const  values,
+                             std::span<Vector2D<std::int16_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().snorm16FromVector2D(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::snorm16_from_float(std::span<Vector4D<float> const> const  values,
+                             std::span<Vector4D<std::int16_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().snorm16FromVector4D(values, results);
+}
+
+// =============================================================================
+// ggm::unorm1010102_from_vector4D
+// =============================================================================
+
+void ggm::unorm1010102_from_vector4D(std::span<Vector4D<float> const> const values,
+                                     std::span<std::uint32_t> const         results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().unorm1010102FromVector4D(values, results);
+}
+
+// =============================================================================
+// ggm::unorm8_from_float
+// =============================================================================
+
+void ggm::unorm8_from_float(std::span<Vector4D<float> const> const  values,
+                            std::span<Vector4D<std::uint8_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().unorm8FromVector4D(values, results);
+}
+
+// =============================================================================
+// ggm::unorm16_from_float
+// =============================================================================
+
+void ggm::unorm16_from_float(std::span<Vector2D<float> const> const   values,
+                             std::span<Vector2D<std::uint16_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().unorm16FromVector2D(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::unorm16_from_float(std::span<Vector4D<float> const> const   values,
+                             std::span<Vector4D<std::uint16_t>> const results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().unorm16FromVector4D(values, results);
+}
+
+// =============================================================================
+// ggm::vector3D_from_octahedral16 / ggm::vector3D_from_octahedral8
+// =============================================================================
+
+void ggm::vector3D_from_octahedral16(std::span<Vector2D<std::int16_t> const> const values,
+                                     std::span<Vector3D<float>> const              results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector3DFromOctahedral16(values, results);
+}
+
+// -----------------------------------------------------------------------------
+
+void ggm::vector3D_from_octahedral8(std::span<Vector2D<std::int8_t> const> const values,
+                                    std::span<Vector3D<float>> const             results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector3DFromOctahedral8(values, results);
+}
+
+// =============================================================================
+// ggm::vector4D_from_snorm1010102
+// =============================================================================
+
+void ggm::vector4D_from_snorm1010102(std::span<std::uint32_t const> const values,
+                                     std::span<Vector4D<float>> const     results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector4DFromSnorm1010102(values, results);
+}
+
+// =============================================================================
+// ggm::vector4D_from_unorm1010102
+// =============================================================================
+
+void ggm::vector4D_from_unorm1010102(std::span<std::uint32_t const> const values,
+                                     std::span<Vector4D<float>> const     results) noexcept
+{
+    assert(results.size() == values.size());
+    DispatchImpl::active_batch_kernels().vector4DFromUnorm1010102(values, results);
+}
+
+// =============================================================================
@@ -0,0 +1,44 @@
+#include "ggm/Dispatch/DispatchLevel.h"
+
+#include "TestUtils/DispatchLevels.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstring>
+
+// =============================================================================
+
+TEST_CASE("ggm::Dispatch::DispatchLevel", /*tags*/ "")
+{
+    using namespace ggm;
+
+    // names match GGM_DISPATCH_LEVEL values
+    CHECK(std::strcmp(dispatch_level_name(DispatchLevel::Baseline), "baseline") == 0);
+    CHECK(std::strcmp(dispatch_level_name(DispatchLevel::Sse42), "sse4.2") == 0);
+    CHECK(std::strcmp(dispatch_level_name(DispatchLevel::Avx2), "avx2") == 0);
+    CHECK(std::strcmp(dispatch_level_name(DispatchLevel::Avx512), "avx512") == 0);
+
+    DispatchLevel const initialLevel = active_dispatch_level();
+    CHECK(initialLevel <= supported_dispatch_level());
+
+    // every supported level can be selected
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+        CHECK(active_dispatch_level() == level);
+    }
+
+    // unsupported levels are rejected & leave the active level unchanged
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    if (supported_dispatch_level() < DispatchLevel::Avx512)
+    {
+        CHECK_FALSE(set_dispatch_level(DispatchLevel::Avx512));
+        CHECK(active_dispatch_level() == DispatchLevel::Baseline);
+    }
+
+    reset_dispatch_level();
+    CHECK(active_dispatch_level() == initialLevel);
+}
+
+// =============================================================================
@@ -0,0 +1,143 @@
+#include "ggm/Numeric/Fixed.h"
+#include "ggm/Numeric/FixedUtil.h"
+
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath>
+
+// =============================================================================
+// explicitly instantiate templates to confirm they compile without error:
+// =============================================================================
+
+template struct ggm::Fixed<16, 16>;
+template struct ggm::Fixed<2, 30>;
+
+// =============================================================================
+
+template ggm::Vector3D<ggm::Fixed<16, 16>> ggm::normalize(Vector3D<Fixed<16, 16>> const & value) noexcept;
+template ggm::Matrix3x3<ggm::Fixed<16, 16>> ggm::inverse(Matrix3x3<Fixed<16, 16>> const & value, Fixed<16, 16> const & epsilon) noexcept;
+template ggm::MatrixTransform3D<ggm::Fixed<16, 16>> ggm::inverse(MatrixTransform3D<Fixed<16, 16>> const & value, Fixed<16, 16> const & epsilon) noexcept;
+template ggm::MatrixRotation3D<ggm::Fixed<16, 16>> ggm::rotation3D_from_angle_axis(Fixed<16, 16> const & angleRadians, Vector3D<Fixed<16, 16>> const & axis) noexcept;
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Numeric::FixedUtil", /*tags*/ "", (ggm::Fixed<16, 16>), (ggm::Fixed<8, 24>), (ggm::Fixed<4, 28>))
+{
+    using namespace ggm;
+
+    // conversion
+    STATIC_CHECK(TestType{ 1 }.bits == TestType::One);
+    STATIC_CHECK(TestType{ -1 }.bits == -TestType::One);
+    STATIC_CHECK(TestType{ 0.5 }.bits == TestType::One / 2);
+    STATIC_CHECK(TestType{ -0.25f }.bits == -TestType::One / 4);
+    STATIC_CHECK(static_cast<double>(TestType{ 1.5 }) == 1.5);
+    STATIC_CHECK(static_cast<float>(TestType{ -0.75 }) == -0.75f);
+
+    // arithmetic
+    STATIC_CHECK(TestType{ 0.5 } + TestType{ 0.25 } == TestType{ 0.75 });
+    STATIC_CHECK(TestType{ 0.5 } - TestType{ 0.75 } == TestType{ -0.25 });
+    STATIC_CHECK(TestType{ 1.5 } * TestType{ -0.5 } == TestType{ -0.75 });
+    STATIC_CHECK(TestType{ 0.75 } / TestType{ 1.5 } == TestType{ 0.5 });
+    STATIC_CHECK(-TestType{ 0.5 } == TestType{ -0.5 });
+    STATIC_CHECK(TestType{ -0.5 } < TestType{ 0.25 });
+    STATIC_CHECK(TestType::from_bits(3) * TestType{ 0.5 } == TestType::from_bits(2)); // round to nearest
+
+    // rounding
+    STATIC_CHECK(floor(TestType{ -1.5 }) == TestType{ -2 });
+    STATIC_CHECK(floor(TestType{ 1.5 }) == TestType{ 1 });
+    STATIC_CHECK(ceil(TestType{ -1.5 }) == TestType{ -1 });
+    STATIC_CHECK(ceil(TestType{ 1.5 }) == TestType{ 2 });
+    STATIC_CHECK(trunc(TestType{ -1.5 }) == TestType{ -1 });
+    STATIC_CHECK(trunc(TestType{ 1.5 }) == TestType{ 1 });
+    STATIC_CHECK(fract(TestType{ -1.25 }) == TestType{ 0.75 });
+    STATIC_CHECK(abs(TestType{ -1.25 }) == TestType{ 1.25 });
+
+    // utilities
+    STATIC_CHECK(clamp(TestType{ 1.5 }, TestType{ -1 }, TestType{ 1 }) == TestType{ 1 });
+    STATIC_CHECK(saturate(TestType{ -0.5 }) == TestType{ 0 });
+    STATIC_CHECK(lerp(TestType{ -1 }, TestType{ 1 }, TestType{ 0.25 }) == TestType{ -0.5 });
+    STATIC_CHECK(inverse_lerp(TestType{ -1 }, TestType{ 1 }, TestType{ -0.5 }) == TestType{ 0.25 });
+    STATIC_CHECK(smooth_step(TestType{ 0 }, TestType{ 1 }, TestType{ 0.5 }) == TestType{ 0.5 });
+    STATIC_CHECK(reciprocal(TestType{ 0.5 }) == TestType{ 2 });
+    STATIC_CHECK(reciprocal(TestType{ 0 }, TestType{ 1 }) == TestType{ 1 });
+    STATIC_CHECK(is_close(TestType{ 0.5 }, TestType{ 0.5 } + TestType::from_bits(4)));
+    STATIC_CHECK(!is_close(TestType{ 0.5 }, TestType{ 0.5 } + TestType::from_bits(5)));
+
+    // sqrt
+    STATIC_CHECK(sqrt(TestType{ 0 }) == TestType{ 0 });
+    STATIC_CHECK(sqrt(TestType{ 1 }) == TestType{ 1 });
+    STATIC_CHECK(sqrt(TestType{ 0.25 }) == TestType{ 0.5 });
+    STATIC_CHECK(sqrt(TestType{ -1 }) == TestType{ 0 });
+    STATIC_CHECK(reciprocal_sqrt(TestType{ 0.25 }) == TestType{ 2 });
+    STATIC_CHECK(reciprocal_sqrt(TestType{ -1 }, TestType{ 1 }) == TestType{ 1 });
+
+    // sincos
+    STATIC_CHECK(sin(TestType{ 0 }) == TestType{ 0 });
+    STATIC_CHECK(cos(TestType{ 0 }) == TestType{ 1 });
+
+    // runtime evaluation is within 1 unit of the last place (+ the table error) of <cmath>
+    double const tolerance = static_cast<double>(TestType::from_bits(1)) + 3e-7;
+
+    for (int i = -1000; i <= 1000; ++i)
+    {
+        TestType const angle = TestType{ static_cast<double>(i) * 0.00157 };
+        double const   value = static_cast<double>(angle);
+
+        SinCos<TestType> const result = sincos(angle);
+        CHECK(std::abs(static_cast<double>(result.sin) - std::sin(value)) <= tolerance);
+        CHECK(std::abs(static_cast<double>(result.cos) - std::cos(value)) <= tolerance);
+
+        TestType const positive = abs(angle);
+        CHECK(std::abs(static_cast<double>(sqrt(positive)) - std::sqrt(static_cast<double>(positive))) <= static_cast<double>(TestType::from_bits(1)));
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Numeric::FixedUtil::Vector & Matrix")
+{
+    using namespace ggm;
+
+    typedef Fixed<16, 16> FixedType;
+
+    FixedType const Tolerance = FixedType{ 1e-3 };
+    FixedType const Zero      = FixedType{ 0 };
+    FixedType const One       = FixedType{ 1 };
+    FixedType const Angle     = FixedType{ 0.75 };
+
+    Vector3D<FixedType> const axis = normalize(Vector3D<FixedType>{ One, FixedType{ 2 }, FixedType{ 2 } });
+    CHECK(is_close(length(axis), One, Tolerance));
+
+    // matches float within tolerance
+    MatrixRotation3D<FixedType> const rotation      = rotation3D_from_angle_axis(Angle, axis);
+    MatrixRotation3D<float> const     rotationFloat = rotation3D_from_angle_axis(0.75f, Vector3D<float>{ 1.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f });
+
+    Vector3D<FixedType> const point      = Vector3D<FixedType>{ FixedType{ 1.5 }, FixedType{ -2 }, FixedType{ 0.25 } };
+    Vector3D<FixedType> const rotated    = rotation * point;
+    Vector3D<float> const     rotatedRef = rotationFloat * Vector3D<float>{ 1.5f, -2.0f, 0.25f };
+
+    CHECK(std::abs(static_cast<float>(rotated.x) - rotatedRef.x) <= 1e-3f);
+    CHECK(std::abs(static_cast<float>(rotated.y) - rotatedRef.y) <= 1e-3f);
+    CHECK(std::abs(static_cast<float>(rotated.z) - rotatedRef.z) <= 1e-3f);
+
+    // rotations are orthogonal
+    CHECK(is_orthogonal(rotation, Tolerance));
+    CHECK(all_of(is_close(inverse(rotation) * rotated, point, Tolerance)));
+
+    // transforms
+    MatrixTransform3D<FixedType> const model    = transform3D_from_translation_rotation_scale(Vector3D<FixedType>{ One, Zero, -One },
+                                                                                           rotation,
+                                                                                           Vector3D<FixedType>{ FixedType{ 2 }, FixedType{ 2 }, FixedType{ 2 } });
+    MatrixTransform3D<FixedType> const identity = transform(model, inverse(model));
+
+    CHECK(all_of(is_close(identity, transform3D_from_scale(One), Tolerance)));
+}
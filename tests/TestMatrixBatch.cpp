@@ -0,0 +1,151 @@
+#include "ggm/Matrix/MatrixBatch.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/DispatchLevels.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixBatch", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    std::vector<Matrix4x4<TestType>> lhs;
+    std::vector<Matrix4x4<TestType>> rhs;
+    for (int i = 0; i < 13; ++i)
+    {
+        TestType const a = TestType(i) * TestType{ 0.25 };
+        TestType const b = TestType(i - 6);
+        lhs.push_back(Matrix4x4<TestType>{
+            a, TestType{ 1 }, TestType{ 2 }, TestType{ 3 },
+            TestType{ -1 }, b, TestType{ 0.5 }, TestType{ 4 },
+            TestType{ 2 }, TestType{ -3 }, a + b, TestType{ 5 },
+            TestType{ 0 }, TestType{ 0 }, TestType{ 0 }, TestType{ 1 },
+        });
+        rhs.push_back(Matrix4x4<TestType>{
+            b, TestType{ 0.125 }, TestType{ -2 }, a,
+            TestType{ 3 }, a * a, TestType{ 1 }, TestType{ -4 },
+            TestType{ -0.75 }, TestType{ 6 }, b * b, TestType{ 7 },
+            a, b, TestType{ 1 }, TestType{ 2 },
+        });
+    }
+
+    std::vector<Matrix4x4<TestType>> baselineResults(lhs.size());
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    multiply(lhs, rhs, baselineResults);
+
+    // baseline results match the scalar operator
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        CHECK(all_of(is_close(baselineResults[i], lhs[i] * rhs[i])));
+    }
+
+    // every level gives bit-identical results
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Matrix4x4<TestType>> results(lhs.size());
+        multiply(lhs, rhs, results);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            CHECK(results[i] == baselineResults[i]);
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixBatch::transform", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    Matrix4x4<TestType> const transform{
+        TestType{ 2 }, TestType{ 0.5 }, TestType{ -1 }, TestType{ 3 },
+        TestType{ 0.25 }, TestType{ 1.5 }, TestType{ 0 }, TestType{ -2 },
+        TestType{ -0.5 }, TestType{ 1 }, TestType{ 3 }, TestType{ 1 },
+        TestType{ 0.125 }, TestType{ -0.25 }, TestType{ 0.5 }, TestType{ 4 },
+    };
+
+    // odd count, so that the streaming stores also handle a partial block at each end
+    std::vector<Vector3D<TestType>> points;
+    for (int i = 0; i < 37; ++i)
+    {
+        points.push_back(Vector3D<TestType>{ TestType(i - 18), TestType(i % 7) * TestType{ 0.25 }, TestType(i % 5) });
+    }
+
+    // the same points, interleaved with a 2 element attribute
+    constexpr std::size_t stride = 5;
+    std::vector<TestType> values;
+    for (Vector3D<TestType> const & point : points)
+    {
+        values.insert(values.end(), { point.x, point.y, point.z, TestType{ -7 }, TestType{ 9 } });
+    }
+
+    std::vector<Vector3D<TestType>> baselinePoints(points.size());
+    std::vector<Vector3D<TestType>> baselineDirections(points.size());
+    std::vector<Vector3D<TestType>> baselineProjected(points.size());
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    transform_points(transform, points, baselinePoints);
+    transform_directions(transform, points, baselineDirections);
+    transform_points_project(transform, points, baselineProjected);
+
+    // baseline results match the scalar operator
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        Vector4D<TestType> const p = transform * Vector4D<TestType>{ points[i].x, points[i].y, points[i].z, TestType{ 1 } };
+        Vector4D<TestType> const d = transform * Vector4D<TestType>{ points[i].x, points[i].y, points[i].z, TestType{ 0 } };
+        CHECK(all_of(is_close(baselinePoints[i], Vector3D<TestType>{ p.x, p.y, p.z })));
+        CHECK(all_of(is_close(baselineDirections[i], Vector3D<TestType>{ d.x, d.y, d.z })));
+        CHECK(all_of(is_close(baselineProjected[i], Vector3D<TestType>{ p.x / p.w, p.y / p.w, p.z / p.w })));
+    }
+
+    // every level gives bit-identical results, for every source & store
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        for (BatchStore const store : { BatchStore::Cached, BatchStore::Streaming })
+        {
+            std::vector<Vector3D<TestType>> results(points.size());
+            transform_points(transform, points, results, store);
+            CHECK(results == baselinePoints);
+            transform_directions(transform, points, results, store);
+            CHECK(results == baselineDirections);
+            transform_points_project(transform, points, results, store);
+            CHECK(results == baselineProjected);
+
+            // strided
+            transform_points(transform, values, stride, results, store);
+            CHECK(results == baselinePoints);
+            transform_directions(transform, values, stride, results, store);
+            CHECK(results == baselineDirections);
+            transform_points_project(transform, values, stride, results, store);
+            CHECK(results == baselineProjected);
+
+            // in-place, from an unaligned start
+            std::vector<Vector3D<TestType>> inPlaceResults = points;
+            std::span<Vector3D<TestType>> const tail       = std::span{ inPlaceResults }.subspan(1);
+            transform_points(transform, tail, tail, store);
+            CHECK(inPlaceResults[0] == points[0]);
+            CHECK(std::equal(tail.begin(), tail.end(), baselinePoints.begin() + 1));
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
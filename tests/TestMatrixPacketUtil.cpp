@@ -0,0 +1,83 @@
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixPacket.h"
+#include "ggm/Matrix/MatrixPacketUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+
+// =============================================================================
+// explicitly instantiate templates to confirm they compile without error:
+// =============================================================================
+
+template struct ggm::Matrix4x4Packet<float, 4>;
+template struct ggm::Matrix4x4Packet<float, 8>;
+template struct ggm::Matrix4x4Packet<double, 16>;
+
+// =============================================================================
+
+template ggm::Vector4DPacket<float, 8> ggm::operator* <float, 8>(Matrix4x4Packet<float, 8> const & lhs, Vector4DPacket<float, 8> const & rhs) noexcept;
+template ggm::Vector4DPacket<float, 8> ggm::operator* <float, 8>(Matrix4x4<float> const & lhs, Vector4DPacket<float, 8> const & rhs) noexcept;
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixPacketUtil::Matrix4x4Packet", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr std::size_t N = 8;
+
+    Matrix4x4Packet<TestType, N> m{};
+    Vector4DPacket<TestType, N>  v{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        TestType const s = static_cast<TestType>(lane);
+        set_lane(m,
+                 lane,
+                 Matrix4x4<TestType>{
+                     // clang-format off
+                     TestType{ 1 } + s,   TestType{ 0.5 },                  -s,  TestType{ 2 },
+                                     s, TestType{ 2 } - s,    TestType{ 0.25 }, TestType{ -1 },
+                      TestType{ 0.75 },                -s, TestType{ 1.5 } + s, TestType{ 0.5 },
+                                     s,     TestType{ 3 },       TestType{ 1 },  TestType{ 1 },
+                     // clang-format on
+                 });
+        set_lane(v, lane, Vector4D<TestType>{ s + TestType{ 1 }, TestType{ 0.5 } * s, TestType{ 3 } - s, TestType{ 1 } });
+    }
+
+    Matrix4x4<TestType> const shared{
+        // clang-format off
+        TestType{ 2 }, TestType{ 0 }, TestType{ 1 }, TestType{ 3 },
+        TestType{ 1 }, TestType{ 3 }, TestType{ 2 }, TestType{ 0 },
+        TestType{ 1 }, TestType{ 1 }, TestType{ 2 }, TestType{ 1 },
+        TestType{ 0 }, TestType{ 2 }, TestType{ 1 }, TestType{ 4 },
+        // clang-format on
+    };
+
+    // lane access
+    CHECK(get_lane(broadcast<N>(shared), 3) == shared);
+    CHECK(m == m);
+    CHECK(m != broadcast<N>(shared));
+
+    // results match the Matrix4x4 operators
+    Vector4DPacket<TestType, N> const mv       = m * v;
+    Vector4DPacket<TestType, N> const vm       = v * m;
+    Vector4DPacket<TestType, N> const sharedMv = shared * v;
+    Vector4DPacket<TestType, N> const sharedVm = v * shared;
+
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        CHECK(get_lane(mv, lane) == get_lane(m, lane) * get_lane(v, lane));
+        CHECK(get_lane(vm, lane) == get_lane(v, lane) * get_lane(m, lane));
+        CHECK(get_lane(sharedMv, lane) == shared * get_lane(v, lane));
+        CHECK(get_lane(sharedVm, lane) == get_lane(v, lane) * shared);
+    }
+}
@@ -0,0 +1,62 @@
+#include "ggm/Matrix/MatrixRotation.h"
+#include "ggm/Matrix/MatrixRotationBatch.h"
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// =============================================================================
+// explicitly instantiate templates to confirm they compile without error:
+// =============================================================================
+
+template void ggm::rotation2D_from_angle(std::span<float const> const angleRadians, std::span<MatrixRotation2D<float>> const rotations) noexcept;
+
+// =============================================================================
+
+template void ggm::rotation3D_from_angle_axis(std::span<float const> const angleRadians, std::span<Vector3D<float> const> const axes, std::span<MatrixRotation3D<float>> const rotations) noexcept;
+template void ggm::rotation3D_from_angle_axis_x(std::span<float const> const angleRadians, std::span<MatrixRotation3D<float>> const rotations) noexcept;
+template void ggm::rotation3D_from_angle_axis_y(std::span<float const> const angleRadians, std::span<MatrixRotation3D<float>> const rotations) noexcept;
+template void ggm::rotation3D_from_angle_axis_z(std::span<float const> const angleRadians, std::span<MatrixRotation3D<float>> const rotations) noexcept;
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixRotationBatch", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    std::vector<TestType>           angles;
+    std::vector<Vector3D<TestType>> axes;
+    for (TestType angle = TestType{ -10 }; angle <= TestType{ 10 }; angle += TestType{ 0.25 })
+    {
+        angles.push_back(angle);
+        axes.push_back(Vector3D<TestType>{ TestType{ 0.6 }, TestType{ 0 }, TestType{ 0.8 } });
+    }
+
+    std::vector<MatrixRotation2D<TestType>> rotations2D(angles.size());
+    std::vector<MatrixRotation3D<TestType>> rotations3D(angles.size());
+    std::vector<MatrixRotation3D<TestType>> rotations3DX(angles.size());
+    std::vector<MatrixRotation3D<TestType>> rotations3DY(angles.size());
+    std::vector<MatrixRotation3D<TestType>> rotations3DZ(angles.size());
+
+    rotation2D_from_angle<TestType>(angles, rotations2D);
+    rotation3D_from_angle_axis<TestType>(angles, axes, rotations3D);
+    rotation3D_from_angle_axis_x<TestType>(angles, rotations3DX);
+    rotation3D_from_angle_axis_y<TestType>(angles, rotations3DY);
+    rotation3D_from_angle_axis_z<TestType>(angles, rotations3DZ);
+
+    // batch results match the scalar functions
+    for (std::size_t i = 0; i < angles.size(); ++i)
+    {
+        CHECK(rotations2D[i] == rotation2D_from_angle(angles[i]));
+        CHECK(rotations3D[i] == rotation3D_from_angle_axis(angles[i], axes[i]));
+        CHECK(rotations3DX[i] == rotation3D_from_angle_axis_x(angles[i]));
+        CHECK(rotations3DY[i] == rotation3D_from_angle_axis_y(angles[i]));
+        CHECK(rotations3DZ[i] == rotation3D_from_angle_axis_z(angles[i]));
+    }
+}
@@ -1,5 +1,7 @@
 #include "ggm/Matrix/MatrixRotation.h"
 #include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
 
 #include "TestUtils/Types.h"
 
@@ -26,3 +28,39 @@ template ggm::MatrixRotation3D<float> ggm::rotation3D_from_angle_axis_y(float co
 template ggm::MatrixRotation3D<float> ggm::rotation3D_from_angle_axis_z(float const & angleRadians) noexcept;
 
 // =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixRotationUtil", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr TestType Pi     = TestType{ 3.14159265358979323846L };
+    constexpr TestType Zero   = TestType{ 0 };
+    constexpr TestType One    = TestType{ 1 };
+    constexpr TestType Angle  = TestType{ 0.75 };
+    constexpr TestType Sqrt13 = TestType{ 0.57735026918962576451L }; // 1 / sqrt(3)
+
+    // constant evaluation, consistent with the fixed angle rotations
+    STATIC_CHECK(all_of(is_close(rotation2D_from_angle(Pi / TestType{ 2 }), rotation2D_from_angle_90<TestType>())));
+    STATIC_CHECK(all_of(is_close(rotation2D_from_angle(Pi), rotation2D_from_angle_180<TestType>())));
+    STATIC_CHECK(all_of(is_close(rotation2D_from_angle(-Pi / TestType{ 2 }), rotation2D_from_angle_270<TestType>())));
+
+    // counter-clockwise rotation of column vectors
+    STATIC_CHECK(all_of(is_close(rotation2D_from_angle(Pi / TestType{ 2 }) * Vector2D<TestType>{ One, Zero }, Vector2D<TestType>{ Zero, One })));
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis_x(Pi / TestType{ 2 }) * Vector3D<TestType>{ Zero, One, Zero }, Vector3D<TestType>{ Zero, Zero, One })));
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis_y(Pi / TestType{ 2 }) * Vector3D<TestType>{ Zero, Zero, One }, Vector3D<TestType>{ One, Zero, Zero })));
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis_z(Pi / TestType{ 2 }) * Vector3D<TestType>{ One, Zero, Zero }, Vector3D<TestType>{ Zero, One, Zero })));
+
+    // the axis-aligned rotations match the general angle-axis rotation
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis_x(Angle), rotation3D_from_angle_axis(Angle, Vector3D<TestType>{ One, Zero, Zero }))));
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis_y(Angle), rotation3D_from_angle_axis(Angle, Vector3D<TestType>{ Zero, One, Zero }))));
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis_z(Angle), rotation3D_from_angle_axis(Angle, Vector3D<TestType>{ Zero, Zero, One }))));
+
+    // rotations are orthogonal
+    STATIC_CHECK(is_orthogonal(rotation2D_from_angle(Angle)));
+    STATIC_CHECK(is_orthogonal(rotation3D_from_angle_axis_y(Angle)));
+    STATIC_CHECK(is_orthogonal(rotation3D_from_angle_axis(Angle, Vector3D<TestType>{ Sqrt13, Sqrt13, Sqrt13 })));
+
+    // a third of a turn around the diagonal cycles the axes
+    STATIC_CHECK(all_of(is_close(rotation3D_from_angle_axis(TestType{ 2 } * Pi / TestType{ 3 }, Vector3D<TestType>{ Sqrt13, Sqrt13, Sqrt13 }) * Vector3D<TestType>{ One, Zero, Zero },
+                                 Vector3D<TestType>{ Zero, One, Zero })));
+}
@@ -0,0 +1,197 @@
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixTransformBatch.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixVectorUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/DispatchLevels.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformBatch", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    MatrixTransform3D<TestType> const transform = transform3D_from_translation_rotation_scale(
+        Vector3D<TestType>{ TestType{ 1 }, TestType{ -2 }, TestType{ 3 } },
+        rotation3D_from_angle_axis(TestType{ 0.5 }, Vector3D<TestType>{ TestType{ 0.6 }, TestType{ 0 }, TestType{ 0.8 } }),
+        Vector3D<TestType>{ TestType{ 2 }, TestType{ 0.5 }, TestType{ 1.5 } });
+
+    // odd count, so that each level also handles a partial vector at the end
+    std::vector<Vector3D<TestType>> points;
+    for (int i = 0; i < 37; ++i)
+    {
+        points.push_back(Vector3D<TestType>{ TestType(i - 18), TestType(i % 7) * TestType{ 0.25 }, TestType(i * i) });
+    }
+
+    std::vector<Vector3D<TestType>> baselineResults(points.size());
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    transform_points(transform, points, baselineResults);
+
+    // baseline results match the scalar operator
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        Vector4D<TestType> const point{ points[i].x, points[i].y, points[i].z, TestType{ 1 } };
+        CHECK(all_of(is_close(baselineResults[i], transform * point)));
+    }
+
+    // every level gives bit-identical results (see is_dispatch_equal)
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Vector3D<TestType>> results(points.size());
+        transform_points(transform, points, results);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            CHECK(is_dispatch_equal(results[i], baselineResults[i]));
+        }
+
+        // in-place
+        std::vector<Vector3D<TestType>> inPlaceResults = points;
+        transform_points(transform, inPlaceResults, inPlaceResults);
+        CHECK(is_dispatch_equal(inPlaceResults, baselineResults));
+
+        // streaming, from an unaligned start
+        std::vector<Vector3D<TestType>> streamingResults(points.size() + 1);
+        transform_points(transform, points, std::span{ streamingResults }.subspan(1), BatchStore::Streaming);
+        CHECK(is_dispatch_equal(std::vector<Vector3D<TestType>>(streamingResults.begin() + 1, streamingResults.end()), baselineResults));
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformBatch::transform_directions", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    MatrixTransform3D<TestType> const transform = transform3D_from_translation_rotation_scale(
+        Vector3D<TestType>{ TestType{ 1 }, TestType{ -2 }, TestType{ 3 } },
+        rotation3D_from_angle_axis(TestType{ 0.5 }, Vector3D<TestType>{ TestType{ 0.6 }, TestType{ 0 }, TestType{ 0.8 } }),
+        Vector3D<TestType>{ TestType{ 2 }, TestType{ 0.5 }, TestType{ 1.5 } });
+
+    // directions interleaved with a 1 element attribute
+    constexpr std::size_t           stride = 4;
+    std::vector<Vector3D<TestType>> directions;
+    std::vector<TestType>           values;
+    for (int i = 0; i < 37; ++i)
+    {
+        directions.push_back(Vector3D<TestType>{ TestType(i % 3) - TestType{ 1 }, TestType(i) * TestType{ 0.125 }, TestType(i - 9) });
+        values.insert(values.end(), { directions.back().x, directions.back().y, directions.back().z, TestType{ 5 } });
+    }
+
+    std::vector<Vector3D<TestType>> baselineResults(directions.size());
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    transform_directions(transform, directions, baselineResults);
+
+    // baseline results match the scalar operator
+    for (std::size_t i = 0; i < directions.size(); ++i)
+    {
+        Vector4D<TestType> const direction{ directions[i].x, directions[i].y, directions[i].z, TestType{ 0 } };
+        CHECK(all_of(is_close(baselineResults[i], transform * direction)));
+    }
+
+    // every level gives bit-identical results (see is_dispatch_equal), for every source & store
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        for (BatchStore const store : { BatchStore::Cached, BatchStore::Streaming })
+        {
+            std::vector<Vector3D<TestType>> results(directions.size());
+            transform_directions(transform, directions, results, store);
+            CHECK(is_dispatch_equal(results, baselineResults));
+
+            transform_directions(transform, values, stride, results, store);
+            CHECK(is_dispatch_equal(results, baselineResults));
+
+            // strided points read the same elements
+            std::vector<Vector3D<TestType>> points(directions.size());
+            std::vector<Vector3D<TestType>> stridedPoints(directions.size());
+            transform_points(transform, directions, points, store);
+            transform_points(transform, values, stride, stridedPoints, store);
+            CHECK(stridedPoints == points);
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// -----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformBatch::MatrixTransform2D", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    MatrixTransform2D<TestType> const transform{
+        TestType{ 0.5 }, TestType{ -2 }, TestType{ 3 },
+        TestType{ 1.5 }, TestType{ 0.25 }, TestType{ -1 },
+    };
+
+    // points interleaved with a 1 element attribute
+    constexpr std::size_t           stride = 3;
+    std::vector<Vector2D<TestType>> points;
+    std::vector<TestType>           values;
+    for (int i = 0; i < 37; ++i)
+    {
+        points.push_back(Vector2D<TestType>{ TestType(i - 18), TestType(i % 7) * TestType{ 0.25 } });
+        values.insert(values.end(), { points.back().x, points.back().y, TestType{ 5 } });
+    }
+
+    std::vector<Vector2D<TestType>> baselinePoints(points.size());
+    std::vector<Vector2D<TestType>> baselineDirections(points.size());
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    transform_points(transform, points, baselinePoints);
+    transform_directions(transform, points, baselineDirections);
+
+    // baseline results match the scalar operator
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        CHECK(all_of(is_close(baselinePoints[i], transform * Vector3D<TestType>{ points[i].x, points[i].y, TestType{ 1 } })));
+        CHECK(all_of(is_close(baselineDirections[i], transform * Vector3D<TestType>{ points[i].x, points[i].y, TestType{ 0 } })));
+    }
+
+    // every level gives bit-identical results, for every source & store
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        for (BatchStore const store : { BatchStore::Cached, BatchStore::Streaming })
+        {
+            std::vector<Vector2D<TestType>> results(points.size());
+            transform_points(transform, points, results, store);
+            CHECK(results == baselinePoints);
+            transform_directions(transform, points, results, store);
+            CHECK(results == baselineDirections);
+
+            transform_points(transform, values, stride, results, store);
+            CHECK(results == baselinePoints);
+            transform_directions(transform, values, stride, results, store);
+            CHECK(results == baselineDirections);
+
+            // in-place, from an unaligned start (Vector2D<float> is 8 bytes, so it never aligns for odd offsets)
+            std::vector<Vector2D<TestType>> inPlaceResults = points;
+            std::span<Vector2D<TestType>> const tail       = std::span{ inPlaceResults }.subspan(1);
+            transform_points(transform, tail, tail, store);
+            CHECK(inPlaceResults[0] == points[0]);
+            CHECK(std::equal(tail.begin(), tail.end(), baselinePoints.begin() + 1));
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
@@ -0,0 +1,156 @@
+#include "ggm/Matrix/MatrixRotationUtil.h"
+#include "ggm/Matrix/MatrixTransformHierarchy.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixUtilSimd.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// =============================================================================
+
+namespace
+{
+    /// 2 roots, each with a chain & some branches, in topological order
+    std::vector<std::uint32_t> make_parents()
+    {
+        std::vector<std::uint32_t> parents{ ggm::TransformHierarchy_NoParent };
+        for (std::uint32_t node = 1; node < 41; ++node)
+        {
+            parents.push_back((node == 20) ? ggm::TransformHierarchy_NoParent : (node * 7u) / 10u);
+        }
+
+        return parents;
+    }
+
+    template <typename T>
+    std::vector<ggm::MatrixTransform3D<T>> make_locals(std::size_t const count)
+    {
+        std::vector<ggm::MatrixTransform3D<T>> locals;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            T const s = static_cast<T>(i % 5);
+            locals.push_back(ggm::transform3D_from_translation_rotation_scale(
+                ggm::Vector3D<T>{ T{ 1 } + s, T{ -0.5 } * s, T{ 0.25 } },
+                ggm::rotation3D_from_angle_axis(T{ 0.125 } * s + T{ 0.25 }, ggm::Vector3D<T>{ T{ 0 }, T{ 0.6 }, T{ 0.8 } }),
+                ggm::Vector3D<T>{ T{ 1.25 }, T{ 1 }, T{ 0.75 } }));
+        }
+
+        return locals;
+    }
+} // namespace
+
+// =============================================================================
+
+TEST_CASE("ggm::Matrix::MatrixTransformHierarchy::make_transform_hierarchy_levels")
+{
+    using namespace ggm;
+
+    std::vector<std::uint32_t> const parents = make_parents();
+
+    TransformHierarchyLevels levels;
+    make_transform_hierarchy_levels(parents, levels);
+
+    REQUIRE(levels.offsets.size() >= 2);
+    CHECK(levels.offsets.front() == 0);
+    CHECK(levels.offsets.back() == parents.size());
+    REQUIRE(levels.nodes.size() == parents.size());
+
+    // level 0 is the roots
+    CHECK(levels.offsets[1] == 2);
+    CHECK(levels.nodes[0] == 0);
+    CHECK(levels.nodes[1] == 20);
+
+    // each node is listed once, in increasing order per level, after its parent's level
+    std::vector<std::size_t> nodeLevels(parents.size(), parents.size());
+    for (std::size_t level = 0; level + 1 < levels.offsets.size(); ++level)
+    {
+        std::span<std::uint32_t const> const nodes = std::span{ levels.nodes }.subspan(levels.offsets[level], levels.offsets[level + 1] - levels.offsets[level]);
+        CHECK(!nodes.empty());
+        CHECK(std::is_sorted(nodes.begin(), nodes.end()));
+        for (std::uint32_t const node : nodes)
+        {
+            CHECK(nodeLevels[node] == parents.size());
+            nodeLevels[node] = level;
+            if (parents[node] != TransformHierarchy_NoParent)
+            {
+                CHECK(nodeLevels[parents[node]] + 1 == level);
+            }
+        }
+    }
+
+    // no nodes
+    make_transform_hierarchy_levels({}, levels);
+    CHECK(levels.offsets == std::vector<std::uint32_t>{ 0 });
+    CHECK(levels.nodes.empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformHierarchy::world_transforms", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    std::vector<std::uint32_t> const               parents = make_parents();
+    std::vector<MatrixTransform3D<TestType>> const locals  = make_locals<TestType>(parents.size());
+
+    std::vector<MatrixTransform3D<TestType>> worlds(locals.size());
+    world_transforms<TestType>(locals, parents, worlds);
+
+    // matches the scalar loop (with transform_simd, as for every float & double), & the product of the locals
+    // along the path from the root
+    for (std::size_t node = 0; node < locals.size(); ++node)
+    {
+        std::uint32_t const parent = parents[node];
+        CHECK(worlds[node] == ((parent == TransformHierarchy_NoParent) ? locals[node] : transform_simd(worlds[parent], locals[node])));
+
+        MatrixTransform3D<TestType> expected = locals[node];
+        for (std::uint32_t ancestor = parent; ancestor != TransformHierarchy_NoParent; ancestor = parents[ancestor])
+        {
+            expected = transform(locals[ancestor], expected);
+        }
+
+        CHECK(all_of(is_close(worlds[node], expected, TestType{ 1e-3 })));
+    }
+
+    // inverses
+    std::vector<MatrixTransform3D<TestType>> inverseWorlds(locals.size());
+    std::vector<MatrixTransform3D<TestType>> worldsWithInverses(locals.size());
+    world_transforms<TestType>(locals, parents, worldsWithInverses, inverseWorlds);
+    CHECK(worldsWithInverses == worlds);
+    for (std::size_t node = 0; node < locals.size(); ++node)
+    {
+        CHECK(inverseWorlds[node] == inverse(worlds[node]));
+    }
+
+    // level by level, in ranges of a few nodes (as separate threads would), gives the same results
+    TransformHierarchyLevels levels;
+    make_transform_hierarchy_levels(parents, levels);
+
+    std::vector<MatrixTransform3D<TestType>> levelWorlds(locals.size());
+    std::vector<MatrixTransform3D<TestType>> levelInverseWorlds(locals.size());
+    std::vector<MatrixTransform3D<TestType>> levelWorldsOnly(locals.size());
+    for (std::size_t level = 0; level + 1 < levels.offsets.size(); ++level)
+    {
+        constexpr std::size_t rangeSize = 3;
+        for (std::size_t first = levels.offsets[level]; first < levels.offsets[level + 1]; first += rangeSize)
+        {
+            std::size_t const                    count = std::min<std::size_t>(rangeSize, levels.offsets[level + 1] - first);
+            std::span<std::uint32_t const> const nodes = std::span{ levels.nodes }.subspan(first, count);
+            world_transforms<TestType>(locals, parents, nodes, levelWorlds, levelInverseWorlds);
+            world_transforms<TestType>(locals, parents, nodes, levelWorldsOnly);
+        }
+    }
+
+    CHECK(levelWorlds == worlds);
+    CHECK(levelInverseWorlds == inverseWorlds);
+    CHECK(levelWorldsOnly == worlds);
+}
+
+// =============================================================================
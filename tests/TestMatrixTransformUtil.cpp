@@ -1,5 +1,7 @@
+#include "ggm/Matrix/MatrixRotationUtil.h"
 #include "ggm/Matrix/MatrixTransform.h"
 #include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
 
 #include "TestUtils/Types.h"
 
@@ -40,6 +42,13 @@ template ggm::MatrixTransform3D<float> ggm::inverse<float>(MatrixTransform3D<flo
 
 // =============================================================================
 
+template ggm::MatrixTransform2D<float> ggm::inverse_rigid<float>(MatrixTransform2D<float> const & value, float const & epsilon) noexcept;
+template ggm::MatrixTransform3D<float> ggm::inverse_rigid<float>(MatrixTransform3D<float> const & value, float const & epsilon) noexcept;
+template ggm::MatrixTransform2D<float> ggm::inverse_uniform_scale<float>(MatrixTransform2D<float> const & value, float const & epsilon) noexcept;
+template ggm::MatrixTransform3D<float> ggm::inverse_uniform_scale<float>(MatrixTransform3D<float> const & value, float const & epsilon) noexcept;
+
+// =============================================================================
+
 template ggm::MatrixTransform2D<float> ggm::transform2D_from_scale<float>(float const & scale) noexcept;
 template ggm::MatrixTransform2D<float> ggm::transform2D_from_scale<float>(float const & scaleX, float const & scaleY) noexcept;
 template ggm::MatrixTransform2D<float> ggm::transform2D_from_scale<float>(Vector2D<float> const & scaleXY) noexcept;
@@ -61,3 +70,120 @@ template ggm::MatrixTransform3D<float> ggm::transform3D_from_translation<float>(
 template ggm::MatrixTransform3D<float> ggm::transform3D_from_translation<float>(Vector3D<float> const & translationXYZ) noexcept;
 
 // =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformUtil::inverse", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    // MatrixTransform2D
+    {
+        MatrixTransform2D<TestType> const m = {
+            TestType{ 1 }, TestType{ 2 }, TestType{ 5 },
+            TestType{ 3 }, TestType{ 4 }, TestType{ -1 },
+        };
+
+        CHECK(determinant(m) == TestType{ -2 });
+        CHECK(all_of(is_close(transform(m, inverse(m)), transform2D_from_scale(TestType{ 1 }), Tolerance)));
+        CHECK(all_of(is_close(transform(inverse(m), m), transform2D_from_scale(TestType{ 1 }), Tolerance)));
+    }
+
+    // MatrixTransform3D
+    {
+        MatrixTransform3D<TestType> const m = {
+            TestType{ 2 }, TestType{ 0 }, TestType{ 1 }, TestType{ 5 },
+            TestType{ 1 }, TestType{ 3 }, TestType{ 2 }, TestType{ -1 },
+            TestType{ 1 }, TestType{ 1 }, TestType{ 2 }, TestType{ 3 },
+        };
+
+        CHECK(determinant(m) == TestType{ 6 });
+        CHECK(all_of(is_close(transform(m, inverse(m)), transform3D_from_scale(TestType{ 1 }), Tolerance)));
+        CHECK(all_of(is_close(transform(inverse(m), m), transform3D_from_scale(TestType{ 1 }), Tolerance)));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformUtil::inverse_rigid", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    // MatrixTransform2D
+    {
+        MatrixTransform2D<TestType> const m = transform2D_from_translation_rotation_scale(
+            Vector2D<TestType>{ TestType{ 5 }, TestType{ -1 } },
+            rotation2D_from_angle(TestType{ 0.75 }),
+            Vector2D<TestType>{ TestType{ 1 }, TestType{ 1 } });
+
+        CHECK(all_of(is_close(inverse_rigid(m), inverse(m), Tolerance)));
+        CHECK(all_of(is_close(transform(m, inverse_rigid(m)), transform2D_from_scale(TestType{ 1 }), Tolerance)));
+        CHECK(all_of(is_close(transform(inverse_rigid(m), m), transform2D_from_scale(TestType{ 1 }), Tolerance)));
+    }
+
+    // MatrixTransform3D
+    {
+        MatrixTransform3D<TestType> const m = transform3D_from_translation_rotation_scale(
+            Vector3D<TestType>{ TestType{ 5 }, TestType{ -1 }, TestType{ 3 } },
+            rotation3D_from_angle_axis(TestType{ 0.75 }, Vector3D<TestType>{ TestType{ 0.6 }, TestType{ 0 }, TestType{ -0.8 } }),
+            Vector3D<TestType>{ TestType{ 1 }, TestType{ 1 }, TestType{ 1 } });
+
+        CHECK(all_of(is_close(inverse_rigid(m), inverse(m), Tolerance)));
+        CHECK(all_of(is_close(transform(m, inverse_rigid(m)), transform3D_from_scale(TestType{ 1 }), Tolerance)));
+        CHECK(all_of(is_close(transform(inverse_rigid(m), m), transform3D_from_scale(TestType{ 1 }), Tolerance)));
+    }
+
+    // the translation only
+    {
+        MatrixTransform3D<TestType> const m = transform3D_from_translation(TestType{ 1 }, TestType{ -2 }, TestType{ 4 });
+        STATIC_CHECK(inverse_rigid(transform3D_from_translation(TestType{ 1 }, TestType{ -2 }, TestType{ 4 })) == transform3D_from_translation(TestType{ -1 }, TestType{ 2 }, TestType{ -4 }));
+        CHECK(inverse_rigid(m) == transform3D_from_translation(TestType{ -1 }, TestType{ 2 }, TestType{ -4 }));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixTransformUtil::inverse_uniform_scale", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    // MatrixTransform2D
+    {
+        MatrixTransform2D<TestType> const m = transform2D_from_translation_rotation_scale(
+            Vector2D<TestType>{ TestType{ 5 }, TestType{ -1 } },
+            rotation2D_from_angle(TestType{ 0.75 }),
+            Vector2D<TestType>{ TestType{ 2.5 }, TestType{ 2.5 } });
+
+        CHECK(all_of(is_close(inverse_uniform_scale(m), inverse(m), Tolerance)));
+        CHECK(all_of(is_close(transform(m, inverse_uniform_scale(m)), transform2D_from_scale(TestType{ 1 }), Tolerance)));
+        CHECK(all_of(is_close(transform(inverse_uniform_scale(m), m), transform2D_from_scale(TestType{ 1 }), Tolerance)));
+    }
+
+    // MatrixTransform3D
+    {
+        MatrixTransform3D<TestType> const m = transform3D_from_translation_rotation_scale(
+            Vector3D<TestType>{ TestType{ 5 }, TestType{ -1 }, TestType{ 3 } },
+            rotation3D_from_angle_axis(TestType{ 0.75 }, Vector3D<TestType>{ TestType{ 0.6 }, TestType{ 0 }, TestType{ -0.8 } }),
+            Vector3D<TestType>{ TestType{ 0.5 }, TestType{ 0.5 }, TestType{ 0.5 } });
+
+        CHECK(all_of(is_close(inverse_uniform_scale(m), inverse(m), Tolerance)));
+        CHECK(all_of(is_close(transform(m, inverse_uniform_scale(m)), transform3D_from_scale(TestType{ 1 }), Tolerance)));
+        CHECK(all_of(is_close(transform(inverse_uniform_scale(m), m), transform3D_from_scale(TestType{ 1 }), Tolerance)));
+    }
+
+    // rigid transforms are scale 1
+    {
+        MatrixTransform3D<TestType> const m = transform3D_from_translation_rotation_scale(
+            Vector3D<TestType>{ TestType{ 5 }, TestType{ -1 }, TestType{ 3 } },
+            rotation3D_from_angle_axis(TestType{ -1.25 }, Vector3D<TestType>{ TestType{ 0 }, TestType{ 0.8 }, TestType{ 0.6 } }),
+            Vector3D<TestType>{ TestType{ 1 }, TestType{ 1 }, TestType{ 1 } });
+
+        CHECK(all_of(is_close(inverse_uniform_scale(m), inverse_rigid(m), Tolerance)));
+    }
+}
+
+// =============================================================================
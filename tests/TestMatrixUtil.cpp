@@ -564,6 +564,28 @@ template ggm::Matrix3x4<float> ggm::matrix_drop_row<3, float>(Matrix4x4<float> c
 
 // =============================================================================
 
+template ggm::Matrix1x1<bool> ggm::is_close_ulps<float>(Matrix1x1<float> const & lhs, Matrix1x1<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix1x2<bool> ggm::is_close_ulps<float>(Matrix1x2<float> const & lhs, Matrix1x2<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix1x3<bool> ggm::is_close_ulps<float>(Matrix1x3<float> const & lhs, Matrix1x3<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix1x4<bool> ggm::is_close_ulps<float>(Matrix1x4<float> const & lhs, Matrix1x4<float> const & rhs, unsigned int const maxUlps) noexcept;
+
+template ggm::Matrix2x1<bool> ggm::is_close_ulps<float>(Matrix2x1<float> const & lhs, Matrix2x1<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix2x2<bool> ggm::is_close_ulps<float>(Matrix2x2<float> const & lhs, Matrix2x2<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix2x3<bool> ggm::is_close_ulps<float>(Matrix2x3<float> const & lhs, Matrix2x3<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix2x4<bool> ggm::is_close_ulps<float>(Matrix2x4<float> const & lhs, Matrix2x4<float> const & rhs, unsigned int const maxUlps) noexcept;
+
+template ggm::Matrix3x1<bool> ggm::is_close_ulps<float>(Matrix3x1<float> const & lhs, Matrix3x1<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix3x2<bool> ggm::is_close_ulps<float>(Matrix3x2<float> const & lhs, Matrix3x2<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix3x3<bool> ggm::is_close_ulps<float>(Matrix3x3<float> const & lhs, Matrix3x3<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix3x4<bool> ggm::is_close_ulps<float>(Matrix3x4<float> const & lhs, Matrix3x4<float> const & rhs, unsigned int const maxUlps) noexcept;
+
+template ggm::Matrix4x1<bool> ggm::is_close_ulps<float>(Matrix4x1<float> const & lhs, Matrix4x1<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix4x2<bool> ggm::is_close_ulps<float>(Matrix4x2<float> const & lhs, Matrix4x2<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix4x3<bool> ggm::is_close_ulps<float>(Matrix4x3<float> const & lhs, Matrix4x3<float> const & rhs, unsigned int const maxUlps) noexcept;
+template ggm::Matrix4x4<bool> ggm::is_close_ulps<float>(Matrix4x4<float> const & lhs, Matrix4x4<float> const & rhs, unsigned int const maxUlps) noexcept;
+
+// =============================================================================
+
 template ggm::Matrix1x1<bool> ggm::is_equal<float>(Matrix1x1<float> const & lhs, Matrix1x1<float> const & rhs) noexcept;
 template ggm::Matrix1x2<bool> ggm::is_equal<float>(Matrix1x2<float> const & lhs, Matrix1x2<float> const & rhs) noexcept;
 template ggm::Matrix1x3<bool> ggm::is_equal<float>(Matrix1x3<float> const & lhs, Matrix1x3<float> const & rhs) noexcept;
@@ -827,5 +849,95 @@ TEMPLATE_TEST_CASE("ggm::Matrix::MatrixUtil", /*tags*/ "", GGM_NUMERIC_TEST_TYPE
         Matrix4x4 const m1 = {};
         Matrix4x4 const m2 = {};
         CHECK(m1 == m2);
+
+        // select
+        Matrix4x4 const m3 = {
+            // clang-format off
+            TestType{ 1 }, TestType{ 2 }, TestType{ 3 }, TestType{ 4 },
+            TestType{ 5 }, TestType{ 6 }, TestType{ 7 }, TestType{ 8 },
+            TestType{ 9 }, TestType{ 1 }, TestType{ 2 }, TestType{ 3 },
+            TestType{ 4 }, TestType{ 5 }, TestType{ 6 }, TestType{ 7 },
+            // clang-format on
+        };
+        Matrix4x4 const m4 = transpose(m3);
+        Matrix4x4 const m5 = select(is_less(m3, m4), m3, m4);
+        CHECK(select(is_equal(m1, m2), m3, m4) == m3);
+        CHECK(select(is_not_equal(m1, m2), m3, m4) == m4);
+        CHECK(m5.m01 == TestType{ 2 });
+        CHECK(m5.m10 == TestType{ 2 });
+        CHECK(m5.m23 == TestType{ 3 });
+        CHECK(m5.m32 == TestType{ 3 });
+        CHECK(all_of(is_less_equal(m5, m3)));
+        CHECK(all_of(is_less_equal(m5, m4)));
+    }
+}
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixUtil::inverse", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    // Matrix1x1
+    {
+        Matrix1x1<TestType> const m = { TestType{ 4 } };
+        STATIC_CHECK(determinant(Matrix1x1<TestType>{ TestType{ 4 } }) == TestType{ 4 });
+        STATIC_CHECK(inverse(Matrix1x1<TestType>{ TestType{ 4 } }).m00 == TestType{ 0.25 });
+        CHECK(all_of(is_close(m * inverse(m), Matrix1x1<TestType>{ TestType{ 1 } }, Tolerance)));
+    }
+
+    // Matrix2x2
+    {
+        Matrix2x2<TestType> const m = {
+            TestType{ 1 }, TestType{ 2 },
+            TestType{ 3 }, TestType{ 4 },
+        };
+        Matrix2x2<TestType> const identity = {
+            TestType{ 1 }, TestType{ 0 },
+            TestType{ 0 }, TestType{ 1 },
+        };
+
+        CHECK(determinant(m) == TestType{ -2 });
+        CHECK(all_of(is_close(m * inverse(m), identity, Tolerance)));
+        CHECK(all_of(is_close(inverse(m) * m, identity, Tolerance)));
+    }
+
+    // Matrix3x3
+    {
+        Matrix3x3<TestType> const m = {
+            TestType{ 2 }, TestType{ 0 }, TestType{ 1 },
+            TestType{ 1 }, TestType{ 3 }, TestType{ 2 },
+            TestType{ 1 }, TestType{ 1 }, TestType{ 2 },
+        };
+        Matrix3x3<TestType> const identity = {
+            TestType{ 1 }, TestType{ 0 }, TestType{ 0 },
+            TestType{ 0 }, TestType{ 1 }, TestType{ 0 },
+            TestType{ 0 }, TestType{ 0 }, TestType{ 1 },
+        };
+
+        CHECK(determinant(m) == TestType{ 6 });
+        CHECK(all_of(is_close(m * inverse(m), identity, Tolerance)));
+        CHECK(all_of(is_close(inverse(m) * m, identity, Tolerance)));
+    }
+
+    // Matrix4x4
+    {
+        Matrix4x4<TestType> const m = {
+            TestType{ 2 }, TestType{ 0 }, TestType{ 1 }, TestType{ 3 },
+            TestType{ 1 }, TestType{ 3 }, TestType{ 2 }, TestType{ 0 },
+            TestType{ 1 }, TestType{ 1 }, TestType{ 2 }, TestType{ 1 },
+            TestType{ 0 }, TestType{ 2 }, TestType{ 1 }, TestType{ 4 },
+        };
+        Matrix4x4<TestType> const identity = {
+            TestType{ 1 }, TestType{ 0 }, TestType{ 0 }, TestType{ 0 },
+            TestType{ 0 }, TestType{ 1 }, TestType{ 0 }, TestType{ 0 },
+            TestType{ 0 }, TestType{ 0 }, TestType{ 1 }, TestType{ 0 },
+            TestType{ 0 }, TestType{ 0 }, TestType{ 0 }, TestType{ 1 },
+        };
+
+        CHECK(determinant(m) == TestType{ 30 });
+        CHECK(all_of(is_close(m * inverse(m), identity, Tolerance)));
+        CHECK(all_of(is_close(inverse(m) * m, identity, Tolerance)));
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,129 @@
+#include "ggm/Matrix/Matrix.h"
+#include "ggm/Matrix/MatrixConstants.h"
+#include "ggm/Matrix/MatrixTransform.h"
+#include "ggm/Matrix/MatrixTransformConstants.h"
+#include "ggm/Matrix/MatrixTransformUtil.h"
+#include "ggm/Matrix/MatrixUtil.h"
+#include "ggm/Matrix/MatrixUtilSimd.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+
+// =============================================================================
+
+namespace
+{
+    /// a well-conditioned matrix that varies with i
+    template <typename T>
+    constexpr ggm::Matrix4x4<T> make_matrix4x4(std::size_t const i) noexcept
+    {
+        T const s = T{ 0.125 } * static_cast<T>(i % 17) - T{ 1 };
+        T const t = T{ 0.0625 } * static_cast<T>(i % 11);
+        return ggm::Matrix4x4<T>{
+            // clang-format off
+            T{ 4 } + s,         t,    T{ -1 },  T{ 2 } * s,
+                     t, T{ 3 } - s, T{ 0.5 },     T{ -1 },
+               T{ 0.75 },     -s, T{ 5 } + t,   T{ 0.5 },
+                  s * t,   T{ 1 },        s,  T{ 6 } - t,
+            // clang-format on
+        };
+    }
+
+    /// an affine transform that varies with i
+    template <typename T>
+    constexpr ggm::MatrixTransform3D<T> make_transform3D(std::size_t const i) noexcept
+    {
+        ggm::Matrix4x4<T> const m = make_matrix4x4<T>(i);
+        return ggm::MatrixTransform3D<T>{
+            // clang-format off
+            m.m00, m.m01, m.m02, m.m03,
+            m.m10, m.m11, m.m12, m.m13,
+            m.m20, m.m21, m.m22, m.m23,
+            // clang-format on
+        };
+    }
+} // namespace
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixUtilSimd::multiply_simd", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    // constant evaluation uses the generic template
+    STATIC_CHECK(multiply_simd(make_matrix4x4<TestType>(3), Matrix4x4_Identity<TestType>) == make_matrix4x4<TestType>(3));
+
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        Matrix4x4<TestType> const lhs = make_matrix4x4<TestType>(i);
+        Matrix4x4<TestType> const rhs = make_matrix4x4<TestType>(i * 7 + 5);
+
+        // the same products, accumulated in the same order (but the compiler may contract the generic template)
+        CHECK(all_of(is_close(multiply_simd(lhs, rhs), lhs * rhs, Tolerance)));
+    }
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixUtilSimd::inverse_simd", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    Matrix4x4<TestType> const identity = Matrix4x4_Identity<TestType>;
+
+    STATIC_CHECK(inverse_simd(Matrix4x4_Identity<TestType>) == Matrix4x4_Identity<TestType>);
+
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        Matrix4x4<TestType> const m   = make_matrix4x4<TestType>(i);
+        Matrix4x4<TestType> const inv = inverse_simd(m);
+
+        CHECK(all_of(is_close(inv, inverse(m), Tolerance)));
+        CHECK(all_of(is_close(m * inv, identity, Tolerance)));
+        CHECK(all_of(is_close(inv * m, identity, Tolerance)));
+    }
+
+    // not invertible: the zero matrix, like the generic template
+    Matrix4x4<TestType> const singular = {
+        // clang-format off
+        TestType{ 1 }, TestType{ 2 }, TestType{ 3 }, TestType{ 4 },
+        TestType{ 2 }, TestType{ 4 }, TestType{ 6 }, TestType{ 8 },
+        TestType{ 0 }, TestType{ 1 }, TestType{ 0 }, TestType{ 1 },
+        TestType{ 1 }, TestType{ 0 }, TestType{ 1 }, TestType{ 0 },
+        // clang-format on
+    };
+
+    CHECK(inverse_simd(singular) == Matrix4x4_Zero<TestType>);
+    CHECK(inverse(singular) == Matrix4x4_Zero<TestType>);
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Matrix::MatrixUtilSimd::transform_simd", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    TestType const Tolerance = TestType{ 1e-5 };
+
+    STATIC_CHECK(transform_simd(make_transform3D<TestType>(3), MatrixTransform3D_Identity<TestType>) == make_transform3D<TestType>(3));
+
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        MatrixTransform3D<TestType> const lhs = make_transform3D<TestType>(i);
+        MatrixTransform3D<TestType> const rhs = make_transform3D<TestType>(i * 7 + 5);
+
+        // the same products, accumulated in the same order (but the compiler may contract the generic template)
+        CHECK(all_of(is_close(transform_simd(lhs, rhs), transform(lhs, rhs), Tolerance)));
+        CHECK(all_of(is_close(matrix4x4_from_transform3D(transform_simd(lhs, rhs)),
+                              matrix4x4_from_transform3D(lhs) * matrix4x4_from_transform3D(rhs),
+                              Tolerance)));
+    }
+}
+
+// =============================================================================
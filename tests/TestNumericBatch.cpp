@@ -0,0 +1,246 @@
+#include "ggm/Numeric/NumericBatch.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    constexpr bool check_constexpr_sincos() noexcept
+    {
+        std::array<T, 3> const angles = { T{ 0 }, T{ 1 }, T{ -2 } };
+        std::array<T, 3>       sinValues{};
+        std::array<T, 3>       cosValues{};
+        ggm::sincos(angles, sinValues, cosValues);
+
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            if ((sinValues[i] != ggm::sin(angles[i])) || (cosValues[i] != ggm::cos(angles[i])))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    constexpr bool check_constexpr_floor() noexcept
+    {
+        std::array<T, 4> const values = { T{ -1.5 }, T{ -0.25 }, T{ 0.75 }, T{ 2 } };
+        std::array<T, 4>       results{};
+        ggm::floor(values, results);
+
+        return (results[0] == T{ -2 }) && (results[1] == T{ -1 }) && (results[2] == T{ 0 }) && (results[3] == T{ 2 });
+    }
+
+    constexpr bool check_constexpr_half() noexcept
+    {
+        std::array<float, 3> const values = { -2.0f, 0.5f, 65504.0f };
+        std::array<ggm::half, 3>   halfValues{};
+        std::array<float, 3>       results{};
+        ggm::half_from_float(values, halfValues);
+        ggm::float_from_half(halfValues, results);
+
+        return (halfValues[0].bits == 0xC000) && (halfValues[1].bits == 0x3800) && (halfValues[2].bits == 0x7BFF) && (results == values);
+    }
+} // namespace
+
+TEST_CASE("ggm::Numeric::NumericBatch")
+{
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericBatch::sincos", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    // constant evaluation
+    STATIC_CHECK(check_constexpr_sincos<TestType>());
+
+    // batch results match the scalar functions
+    std::vector<TestType> angles;
+    for (TestType angle = TestType{ -100 }; angle <= TestType{ 100 }; angle += TestType{ 0.375 })
+    {
+        angles.push_back(angle);
+    }
+
+    std::vector<TestType> sinValues(angles.size());
+    std::vector<TestType> cosValues(angles.size());
+    std::vector<TestType> sinOnlyValues(angles.size());
+    std::vector<TestType> cosOnlyValues(angles.size());
+
+    ggm::sincos(angles, sinValues, cosValues);
+    ggm::sin(angles, sinOnlyValues);
+    ggm::cos(angles, cosOnlyValues);
+
+    for (std::size_t i = 0; i < angles.size(); ++i)
+    {
+        ggm::SinCos<TestType> const expected = ggm::sincos(angles[i]);
+
+        CHECK(sinValues[i] == expected.sin);
+        CHECK(cosValues[i] == expected.cos);
+        CHECK(sinOnlyValues[i] == expected.sin);
+        CHECK(cosOnlyValues[i] == expected.cos);
+    }
+
+    // empty spans are a no-op
+    ggm::sincos(std::span<TestType const>{}, std::span<TestType>{}, std::span<TestType>{});
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericBatch::floor", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    // constant evaluation
+    STATIC_CHECK(check_constexpr_floor<TestType>());
+
+    // batch results match the scalar functions
+    std::vector<TestType> values;
+    for (TestType value = TestType{ -100 }; value <= TestType{ 100 }; value += TestType{ 0.375 })
+    {
+        values.push_back(value);
+    }
+
+    std::vector<TestType> floorValues(values.size());
+    std::vector<TestType> ceilValues(values.size());
+    std::vector<TestType> fractValues(values.size());
+    std::vector<TestType> repeatValues(values.size());
+
+    ggm::floor(values, floorValues);
+    ggm::ceil(values, ceilValues);
+    ggm::fract(values, fractValues);
+    ggm::repeat(values, TestType{ -3 }, TestType{ 5 }, repeatValues);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        CHECK(floorValues[i] == ggm::floor(values[i]));
+        CHECK(ceilValues[i] == ggm::ceil(values[i]));
+        CHECK(fractValues[i] == ggm::fract(values[i]));
+        CHECK(repeatValues[i] == ggm::repeat(values[i], TestType{ -3 }, TestType{ 5 }));
+    }
+
+    // in-place
+    ggm::floor(values, values);
+    CHECK(values == floorValues);
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericBatch::lerp", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    // batch results match the scalar functions
+    std::vector<TestType> values;
+    std::vector<TestType> otherValues;
+    for (TestType value = TestType{ -4 }; value <= TestType{ 4 }; value += TestType{ 0.125 })
+    {
+        values.push_back(value);
+        otherValues.push_back(TestType{ 1 } - value * TestType{ 0.5 });
+    }
+
+    std::size_t const     count = values.size();
+    std::vector<TestType> results(count);
+
+    ggm::abs(values, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::abs(values[i]));
+    }
+
+    ggm::clamp(values, TestType{ -1 }, TestType{ 2 }, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::clamp(values[i], TestType{ -1 }, TestType{ 2 }));
+    }
+
+    ggm::saturate(values, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::saturate(values[i]));
+    }
+
+    ggm::inverse_lerp(TestType{ -2 }, TestType{ 6 }, values, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::inverse_lerp(TestType{ -2 }, TestType{ 6 }, values[i]));
+    }
+
+    ggm::lerp(TestType{ -2 }, TestType{ 6 }, values, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::lerp(TestType{ -2 }, TestType{ 6 }, values[i]));
+    }
+
+    ggm::lerp(values, otherValues, TestType{ 0.25 }, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::lerp(values[i], otherValues[i], TestType{ 0.25 }));
+    }
+
+    ggm::lerp(values, otherValues, otherValues, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::lerp(values[i], otherValues[i], otherValues[i]));
+    }
+
+    ggm::linear_step(TestType{ -2 }, TestType{ 3 }, values, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::linear_step(TestType{ -2 }, TestType{ 3 }, values[i]));
+    }
+
+    ggm::smooth_step(TestType{ -2 }, TestType{ 3 }, values, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::smooth_step(TestType{ -2 }, TestType{ 3 }, values[i]));
+    }
+
+    ggm::min(values, otherValues, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::min(TestType{ values[i] }, TestType{ otherValues[i] }));
+    }
+
+    ggm::max(values, otherValues, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::max(TestType{ values[i] }, TestType{ otherValues[i] }));
+    }
+
+    ggm::min(values, TestType{ 0.5 }, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::min(TestType{ values[i] }, TestType{ 0.5 }));
+    }
+
+    ggm::max(values, TestType{ 0.5 }, results);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        CHECK(results[i] == ggm::max(TestType{ values[i] }, TestType{ 0.5 }));
+    }
+}
+
+TEST_CASE("ggm::Numeric::NumericBatch::half")
+{
+    // constant evaluation
+    STATIC_CHECK(check_constexpr_half());
+
+    // batch results match the scalar functions
+    std::vector<float> values;
+    for (float value = -70000.0f; value <= 70000.0f; value += 17.125f)
+    {
+        values.push_back(value);
+        values.push_back(value * 1e-9f); // denormal halves
+    }
+
+    std::vector<ggm::half> halfValues(values.size());
+    std::vector<float>     floatValues(values.size());
+
+    ggm::half_from_float(values, halfValues);
+    ggm::float_from_half(halfValues, floatValues);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        CHECK(halfValues[i].bits == ggm::half_from_float(values[i]).bits);
+        CHECK(floatValues[i] == ggm::float_from_half(halfValues[i]));
+    }
+}
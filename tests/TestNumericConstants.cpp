@@ -16,3 +16,12 @@ TEMPLATE_TEST_CASE("ggm::Numeric::NumericConstants", /*tags*/ "", GGM_FLOAT_TEST
     STATIC_CHECK(DefaultTolerance<TestType> < TestType(1e-6));
     STATIC_CHECK(DefaultTolerance<TestType> > TestType(1e-7));
 }
+
+// =============================================================================
+
+TEST_CASE("ggm::Numeric::NumericConstants::DefaultToleranceUlps")
+{
+    using namespace ggm;
+
+    STATIC_CHECK(DefaultToleranceUlps > 0);
+}
@@ -1,7 +1,575 @@
 #include "ggm/Numeric/NumericUtil.h"
 
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
 #include "catch2/catch_test_macros.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
 TEST_CASE("ggm::Numeric::NumericUtil")
 {
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::sqrt", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    // constant evaluation
+    STATIC_CHECK(ggm::sqrt(TestType{ 0 }) == TestType{ 0 });
+    STATIC_CHECK(ggm::sqrt(TestType{ 1 }) == TestType{ 1 });
+    STATIC_CHECK(ggm::sqrt(TestType{ 4 }) == TestType{ 2 });
+    STATIC_CHECK(ggm::sqrt(TestType{ 0.25 }) == TestType{ 0.5 });
+    STATIC_CHECK(ggm::sqrt(TestType{ 1024 } * TestType{ 1024 }) == TestType{ 1024 });
+    STATIC_CHECK(ggm::sqrt(limits::infinity()) == limits::infinity());
+    STATIC_CHECK(ggm::sqrt(TestType{ -1 }) != ggm::sqrt(TestType{ -1 })); // nan
+    STATIC_CHECK(is_close(ggm::sqrt(TestType{ 2 }), TestType{ 1.41421356237309504880L }, limits::epsilon()));
+
+    STATIC_CHECK(reciprocal_sqrt(TestType{ 4 }) == TestType{ 0.5 });
+    STATIC_CHECK(reciprocal_sqrt(TestType{ 0 }) == TestType{ 0 });
+    STATIC_CHECK(reciprocal_sqrt(TestType{ -1 }, TestType{ 7 }) == TestType{ 7 });
+
+    // runtime evaluation matches <cmath>
+    TestType const Values[] = {
+        TestType{ 0 },
+        TestType{ 0.5 },
+        TestType{ 2 },
+        TestType{ 3 },
+        TestType{ 1e-3 },
+        TestType{ 12345.678 },
+        limits::min(),
+        limits::max(),
+    };
+
+    for (TestType const value : Values)
+    {
+        CHECK(ggm::sqrt(value) == std::sqrt(value));
+        CHECK(is_close(NumericImpl::constexpr_sqrt(value), std::sqrt(value), limits::epsilon()));
+    }
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::is_close", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    // constant evaluation
+    STATIC_CHECK(is_close(TestType{ 1 }, TestType{ 1 } + DefaultTolerance<TestType>));
+    STATIC_CHECK_FALSE(is_close(TestType{ 1 }, TestType{ 1 } + TestType{ 2 } * DefaultTolerance<TestType>));
+    STATIC_CHECK(is_close(TestType{ 1024 }, TestType{ 1024 } + TestType{ 512 } * DefaultTolerance<TestType>));
+    STATIC_CHECK_FALSE(is_close(TestType{ 1024 }, TestType{ 1024 } + TestType{ 2048 } * DefaultTolerance<TestType>));
+    STATIC_CHECK_FALSE(is_close(limits::quiet_NaN(), limits::quiet_NaN()));
+    CHECK_FALSE(is_close(limits::infinity(), limits::infinity()));
+
+    // tolerance scale agrees with ilogb & scalbn
+    TestType const Values[] = {
+        TestType{ 0 },
+        TestType{ 0.75 },
+        TestType{ -3 },
+        TestType{ 1000 },
+        TestType{ 1e6 },
+        limits::min() / TestType{ 4 }, // subnormal
+        limits::max(),
+    };
+
+    for (TestType const lhs : Values)
+    {
+        for (TestType const rhs : Values)
+        {
+            CHECK(NumericImpl::is_close_tolerance(lhs, rhs, DefaultTolerance<TestType>) ==
+                  std::scalbn(DefaultTolerance<TestType>, max(max(std::ilogb(lhs), std::ilogb(rhs)), 0)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::is_close_ulps", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    constexpr TestType One     = TestType{ 1 };
+    constexpr TestType Epsilon = limits::epsilon(); // 1 ulp above One
+
+    // constant evaluation
+    STATIC_CHECK(is_close_ulps(One, One, 0));
+    STATIC_CHECK(is_close_ulps(One, One + Epsilon, 1));
+    STATIC_CHECK_FALSE(is_close_ulps(One, One + Epsilon, 0));
+    STATIC_CHECK(is_close_ulps(One, One + TestType{ 4 } * Epsilon));
+    STATIC_CHECK_FALSE(is_close_ulps(One, One + TestType{ 5 } * Epsilon));
+    STATIC_CHECK(is_close_ulps(One, One - Epsilon / TestType{ 2 }, 1)); // ulps halve below a power-of-two
+    STATIC_CHECK(is_close_ulps(TestType{ 0 }, -TestType{ 0 }, 0));
+    STATIC_CHECK(is_close_ulps(limits::denorm_min(), -limits::denorm_min(), 2));
+    STATIC_CHECK_FALSE(is_close_ulps(limits::denorm_min(), -limits::denorm_min(), 1));
+    STATIC_CHECK_FALSE(is_close_ulps(-One, One, 1000));
+    STATIC_CHECK(is_close_ulps(limits::infinity(), limits::infinity(), 0));
+    STATIC_CHECK(is_close_ulps(limits::infinity(), limits::max(), 1));
+    STATIC_CHECK_FALSE(is_close_ulps(limits::infinity(), -limits::infinity(), 1000));
+    STATIC_CHECK_FALSE(is_close_ulps(limits::quiet_NaN(), limits::quiet_NaN(), ~0u));
+    STATIC_CHECK_FALSE(is_close_ulps(limits::quiet_NaN(), One, ~0u));
+
+    // runtime evaluation against std::nextafter
+    TestType const Values[] = {
+        TestType{ 0 },
+        TestType{ -0.75 },
+        TestType{ 3 },
+        TestType{ 1e6 },
+        limits::min(),
+        -limits::max(),
+    };
+
+    for (TestType const value : Values)
+    {
+        TestType const above = std::nextafter(value, limits::infinity());
+        TestType const below = std::nextafter(value, -limits::infinity());
+
+        CHECK(is_close_ulps(value, above, 1));
+        CHECK(is_close_ulps(below, value, 1));
+        CHECK(is_close_ulps(below, above, 2));
+        CHECK_FALSE(is_close_ulps(below, above, 1));
+    }
+}
+
+TEST_CASE("ggm::Numeric::NumericUtil::reciprocal_sqrt_fast")
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<float> limits;
+
+    // constant evaluation
+    STATIC_CHECK(reciprocal_sqrt_fast(0.0f) == 0.0f);
+    STATIC_CHECK(reciprocal_sqrt_fast(-1.0f, 7.0f) == 7.0f);
+    STATIC_CHECK(is_close(reciprocal_sqrt_fast<3>(4.0f), 0.5f, 1e-6f));
+
+    // documented maximum relative error for each number of steps
+    constexpr float MaxRelativeError[] = {
+        3.5e-2f, // 0 steps
+        1.7e-5f, // 1 step
+        1.9e-7f, // 2 steps
+        1.6e-7f, // 3 steps
+    };
+
+    // sweep across the full exponent range of normal values
+    for (float value = limits::min(); value < limits::max() / 1.0625f; value *= 1.0625f)
+    {
+        double const exact = 1.0 / std::sqrt(static_cast<double>(value));
+
+        CHECK(std::abs(reciprocal_sqrt_fast<0>(value) / exact - 1.0) <= MaxRelativeError[0]);
+        CHECK(std::abs(reciprocal_sqrt_fast<1>(value) / exact - 1.0) <= MaxRelativeError[1]);
+        CHECK(std::abs(reciprocal_sqrt_fast<2>(value) / exact - 1.0) <= MaxRelativeError[2]);
+        CHECK(std::abs(reciprocal_sqrt_fast<3>(value) / exact - 1.0) <= MaxRelativeError[3]);
+        CHECK(is_close_ulps(reciprocal_sqrt_fast<2>(value), reciprocal_sqrt(value), 4));
+        CHECK(is_close_ulps(reciprocal_sqrt_fast<3>(value), reciprocal_sqrt(value), 4));
+    }
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::sincos", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    constexpr TestType Pi = TestType{ 3.14159265358979323846L };
+
+    // constant evaluation
+    STATIC_CHECK(ggm::sin(TestType{ 0 }) == TestType{ 0 });
+    STATIC_CHECK(ggm::cos(TestType{ 0 }) == TestType{ 1 });
+    STATIC_CHECK(is_close(ggm::sin(Pi / TestType{ 6 }), TestType{ 0.5 }));
+    STATIC_CHECK(is_close(ggm::cos(Pi / TestType{ 3 }), TestType{ 0.5 }));
+    STATIC_CHECK(is_close(ggm::sin(-Pi / TestType{ 2 }), TestType{ -1 }));
+    STATIC_CHECK(is_close(ggm::cos(Pi), TestType{ -1 }));
+    STATIC_CHECK(is_close(sincos(TestType{ 1 }).sin, TestType{ 0.841470984807896506652L }));
+    STATIC_CHECK(is_close(sincos(TestType{ 1 }).cos, TestType{ 0.540302305868139717401L }));
+
+    // nan & inf propagate as nan
+    CHECK(ggm::sin(limits::quiet_NaN()) != ggm::sin(limits::quiet_NaN()));
+    CHECK(ggm::cos(limits::infinity()) != ggm::cos(limits::infinity()));
+
+    // documented maximum absolute error (of the double kernel for long double)
+    constexpr TestType MaxError = static_cast<TestType>(std::is_same_v<TestType, float> ? 9.4e-8 : 2.1e-16);
+    constexpr TestType MaxAngle = TestType{ 1e4 };
+
+    // sweep across all quadrants, repeated far from zero
+    // (the step is exactly representable, so each angle is also exact when converted to double)
+    for (TestType angle = -MaxAngle; angle <= MaxAngle; angle += TestType{ 0.984375 })
+    {
+        SinCos<TestType> const result = sincos(angle);
+
+        long double const exactAngle = static_cast<long double>(angle);
+        CHECK(std::abs(static_cast<long double>(result.sin) - std::sin(exactAngle)) <= MaxError);
+        CHECK(std::abs(static_cast<long double>(result.cos) - std::cos(exactAngle)) <= MaxError);
+        CHECK(ggm::sin(angle) == result.sin);
+        CHECK(ggm::cos(angle) == result.cos);
+    }
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::sincos large angles", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    // documented maximum absolute error beyond the fully accurate range (of the double kernel for long double)
+    struct AngleRange
+    {
+        double maxAngle;
+        double maxError;
+    };
+
+    typedef std::conditional_t<std::is_same_v<TestType, float>, float, double> KernelType;
+
+    constexpr bool IsFloat     = std::is_same_v<TestType, float>;
+    constexpr int  SampleCount = 10000;
+
+    constexpr AngleRange AngleRanges[] = {
+        IsFloat ? AngleRange{ 1e5, 9.6e-7 } : AngleRange{ 1e9, 6.0e-8 },
+        IsFloat ? AngleRange{ 1e6, 3.2e-2 } : AngleRange{ 1e12, 6.2e-5 },
+    };
+
+    for (AngleRange const range : AngleRanges)
+    {
+        for (int i = -SampleCount; i <= SampleCount; ++i)
+        {
+            // note: rounded to float or double first, so that each angle is also exact for the long double kernel
+            TestType const angle = static_cast<TestType>(static_cast<KernelType>(range.maxAngle * i / SampleCount));
+
+            SinCos<TestType> const result = sincos(angle);
+
+            long double const exactAngle = static_cast<long double>(angle);
+            CHECK(std::abs(static_cast<long double>(result.sin) - std::sin(exactAngle)) <= range.maxError);
+            CHECK(std::abs(static_cast<long double>(result.cos) - std::cos(exactAngle)) <= range.maxError);
+        }
+    }
+
+    // quadrants beyond int32 are not truncated
+    if constexpr (!IsFloat)
+    {
+        CHECK(std::abs(ggm::sin(TestType{ 4e9 }) - std::sin(4e9L)) <= TestType{ 6.0e-8 });
+        CHECK(std::abs(ggm::cos(TestType{ 4e9 }) - std::cos(4e9L)) <= TestType{ 6.0e-8 });
+        CHECK(std::abs(ggm::sin(TestType{ 1e12 }) - std::sin(1e12L)) <= TestType{ 6.2e-5 });
+        CHECK(std::abs(ggm::cos(TestType{ 1e12 }) - std::cos(1e12L)) <= TestType{ 6.2e-5 });
+    }
+
+    // every finite angle returns sin & cos in [-1, 1], even once the results are meaningless
+    for (TestType absAngle = TestType{ 1 }; absAngle < limits::max(); absAngle *= TestType{ 3 })
+    {
+        for (TestType const angle : { absAngle, -absAngle, std::nextafter(absAngle, limits::max()) })
+        {
+            SinCos<TestType> const result = sincos(angle);
+
+            CHECK(std::abs(result.sin) <= TestType{ 1 });
+            CHECK(std::abs(result.cos) <= TestType{ 1 });
+        }
+    }
+
+    CHECK(std::abs(sincos(limits::max()).sin) <= TestType{ 1 });
+    CHECK(std::abs(sincos(limits::max()).cos) <= TestType{ 1 });
+    CHECK(std::abs(sincos(-limits::max()).sin) <= TestType{ 1 });
+    CHECK(std::abs(sincos(-limits::max()).cos) <= TestType{ 1 });
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::trunc", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    // constant evaluation
+    STATIC_CHECK(ggm::trunc(TestType{ 2.75 }) == TestType{ 2 });
+    STATIC_CHECK(ggm::trunc(TestType{ -2.75 }) == TestType{ -2 });
+    STATIC_CHECK(ggm::floor(TestType{ 2.75 }) == TestType{ 2 });
+    STATIC_CHECK(ggm::floor(TestType{ -2.75 }) == TestType{ -3 });
+    STATIC_CHECK(ggm::ceil(TestType{ 2.25 }) == TestType{ 3 });
+    STATIC_CHECK(ggm::ceil(TestType{ -2.25 }) == TestType{ -2 });
+    STATIC_CHECK(ggm::floor(TestType{ -0.5 }) == TestType{ -1 });
+    STATIC_CHECK(ggm::ceil(TestType{ 0.5 }) == TestType{ 1 });
+    STATIC_CHECK(fract(TestType{ -1.25 }) == TestType{ 0.75 });
+    STATIC_CHECK(ggm::trunc(limits::max()) == limits::max());
+    STATIC_CHECK(ggm::floor(-limits::max()) == -limits::max());
+    STATIC_CHECK(ggm::ceil(limits::denorm_min()) == TestType{ 1 });
+    STATIC_CHECK(ggm::trunc(limits::infinity()) == limits::infinity());
+
+    // runtime evaluation matches <cmath> across the full range
+    TestType const Values[] = {
+        TestType{ 0 },
+        TestType{ 0.5 },
+        TestType{ 1 },
+        TestType{ 1.5 },
+        TestType{ 2.5 },
+        TestType{ 12345.678 },
+        TestType{ 1e10 },
+        TestType{ 1e30 },
+        limits::denorm_min(),
+        limits::min(),
+        TestType{ 1 } - limits::epsilon(),
+        TestType{ 1 } / limits::epsilon() - TestType{ 0.5 }, // largest value with a fractional component
+        TestType{ 1 } / limits::epsilon(),
+        limits::max(),
+        limits::infinity(),
+    };
+
+    for (TestType const absValue : Values)
+    {
+        for (TestType const value : { absValue, -absValue })
+        {
+            CHECK(ggm::trunc(value) == std::trunc(value));
+            CHECK(ggm::floor(value) == std::floor(value));
+            CHECK(ggm::ceil(value) == std::ceil(value));
+            CHECK(std::signbit(ggm::trunc(value)) == std::signbit(std::trunc(value)));
+            CHECK(std::signbit(ggm::floor(value)) == std::signbit(std::floor(value)));
+            CHECK(std::signbit(ggm::ceil(value)) == std::signbit(std::ceil(value)));
+        }
+    }
+
+    // nan propagates
+    CHECK(std::isnan(ggm::trunc(limits::quiet_NaN())));
+    CHECK(std::isnan(ggm::floor(limits::quiet_NaN())));
+    CHECK(std::isnan(ggm::ceil(limits::quiet_NaN())));
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::smooth_step", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    // constant evaluation
+    STATIC_CHECK(saturate(TestType{ -2 }) == TestType{ 0 });
+    STATIC_CHECK(saturate(TestType{ 0.25 }) == TestType{ 0.25 });
+    STATIC_CHECK(saturate(TestType{ 2 }) == TestType{ 1 });
+    STATIC_CHECK(linear_step(TestType{ 2 }, TestType{ 4 }, TestType{ 3 }) == TestType{ 0.5 });
+    STATIC_CHECK(linear_step(TestType{ 2 }, TestType{ 4 }, TestType{ 1 }) == TestType{ 0 });
+    STATIC_CHECK(smooth_step(TestType{ 2 }, TestType{ 4 }, TestType{ 2.5 }) == TestType{ 0.15625 });
+    STATIC_CHECK(smooth_step(TestType{ 2 }, TestType{ 4 }, TestType{ 3 }) == TestType{ 0.5 });
+    STATIC_CHECK(smooth_step(TestType{ 2 }, TestType{ 4 }, TestType{ 5 }) == TestType{ 1 });
+
+    // -0 saturates to +0 & nan propagates
+    CHECK_FALSE(std::signbit(saturate(-TestType{ 0 })));
+    CHECK(std::isnan(saturate(limits::quiet_NaN())));
+    CHECK(saturate(limits::infinity()) == TestType{ 1 });
+}
+
+TEMPLATE_TEST_CASE("ggm::Numeric::NumericUtil::fma", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<TestType> limits;
+
+    // constant evaluation is rounded once, i.e. 0.1 * 10 - 1 is the rounding error of 0.1
+    STATIC_CHECK(ggm::fma(TestType{ 2 }, TestType{ 3 }, TestType{ 4 }) == TestType{ 10 });
+    STATIC_CHECK(ggm::fma(TestType{ 0.1 }, TestType{ 10 }, TestType{ -1 }) == std::ldexp(TestType{ 1 }, (limits::digits == 24) ? -26 : -54));
+
+    // multiply_add is only fused with GGM_USE_FMA, on a target with FMA instructions
+#if defined(GGM_USE_FMA) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+    STATIC_CHECK(multiply_add(TestType{ 0.1 }, TestType{ 10 }, TestType{ -1 }) == ggm::fma(TestType{ 0.1 }, TestType{ 10 }, TestType{ -1 }));
+#endif
+    STATIC_CHECK(multiply_add(TestType{ 2 }, TestType{ 3 }, TestType{ 4 }) == TestType{ 10 });
+    STATIC_CHECK(multiply_add(2, 3, 4) == 10);
+    STATIC_CHECK(sum_of_products(1, 2, 3, -4) == -10);
+    STATIC_CHECK(sum_of_products(1, 2, 3, 4, 5, 6) == 44);
+    STATIC_CHECK(sum_of_products(TestType{ 1 }, TestType{ 2 }, TestType{ 3 }, TestType{ 4 }, TestType{ 5 }, TestType{ 6 }, TestType{ 7 }, TestType{ 8 }) == TestType{ 100 });
+
+    // constant evaluation matches the runtime std::fma
+    std::uint64_t state = 0x9E3779B97F4A7C15u;
+
+    auto const random_value = [&state]() -> TestType {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return std::ldexp(static_cast<TestType>(state >> 11) / TestType{ 0x1p53 }, static_cast<int>(state % 16) - 8) *
+               (((state >> 4) & 1) ? TestType{ -1 } : TestType{ 1 });
+    };
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        TestType const lhs    = random_value();
+        TestType const rhs    = random_value();
+        TestType const addend = random_value();
+
+        CHECK(NumericImpl::constexpr_fma(lhs, rhs, addend) == std::fma(lhs, rhs, addend));
+        CHECK(ggm::fma(lhs, rhs, addend) == std::fma(lhs, rhs, addend));
+    }
+
+    // inf & nan propagate
+    CHECK(NumericImpl::constexpr_fma(limits::infinity(), TestType{ 2 }, TestType{ 1 }) == limits::infinity());
+    CHECK(std::isnan(NumericImpl::constexpr_fma(limits::infinity(), TestType{ 0 }, TestType{ 1 })));
+}
+
+TEST_CASE("ggm::Numeric::NumericUtil::half")
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<float> limits;
+
+    STATIC_CHECK(std::is_trivially_default_constructible_v<half>);
+    STATIC_CHECK(std::is_standard_layout_v<half>);
+    STATIC_CHECK(sizeof(half) == 2);
+
+    // constant evaluation
+    STATIC_CHECK(half_from_float(0.0f).bits == 0x0000);
+    STATIC_CHECK(half_from_float(-0.0f).bits == 0x8000);
+    STATIC_CHECK(half_from_float(1.0f).bits == 0x3C00);
+    STATIC_CHECK(half_from_float(-2.0f).bits == 0xC000);
+    STATIC_CHECK(half_from_float(65504.0f).bits == 0x7BFF);                          // max half
+    STATIC_CHECK(half_from_float(65520.0f).bits == 0x7C00);                          // rounds up to infinity
+    STATIC_CHECK(half_from_float(0x1p-14f).bits == 0x0400);                          // min normal half
+    STATIC_CHECK(half_from_float(0x1p-24f).bits == 0x0001);                          // min denormal half
+    STATIC_CHECK(half_from_float(0x1p-25f).bits == 0x0000);                          // tie rounds to even
+    STATIC_CHECK(half_from_float(1.0f + 0x1p-11f).bits == 0x3C00);                   // tie rounds to even
+    STATIC_CHECK(half_from_float(1.0f + 0x3p-11f).bits == 0x3C02);                   // tie rounds to even
+    STATIC_CHECK(half_from_float(limits::infinity()).bits == 0x7C00);
+    STATIC_CHECK(half_from_float(-limits::infinity()).bits == 0xFC00);
+    STATIC_CHECK(half_from_float(limits::quiet_NaN()).bits == 0x7E00);
+    STATIC_CHECK(half_from_float(std::bit_cast<float>(0x7F802000u)).bits == 0x7E01); // quieted, payload kept
+
+    STATIC_CHECK(float_from_half(half{ 0x3C00 }) == 1.0f);
+    STATIC_CHECK(float_from_half(half{ 0xC000 }) == -2.0f);
+    STATIC_CHECK(float_from_half(half{ 0x7BFF }) == 65504.0f);
+    STATIC_CHECK(float_from_half(half{ 0x0001 }) == 0x1p-24f);
+    STATIC_CHECK(float_from_half(half{ 0x03FF }) == 0x3FFp-24f);
+    STATIC_CHECK(float_from_half(half{ 0x7C00 }) == limits::infinity());
+    STATIC_CHECK(std::bit_cast<std::uint32_t>(float_from_half(half{ 0x8000 })) == 0x80000000u);
+    STATIC_CHECK(std::bit_cast<std::uint32_t>(float_from_half(half{ 0x7D01 })) == 0x7FE02000u); // quieted, payload kept
+
+    // runtime evaluation (which may use F16C) matches the constexpr implementation, every half round trips exactly
+    for (std::uint32_t bits = 0; bits <= 0xFFFFu; ++bits)
+    {
+        half const  value      = half{ static_cast<std::uint16_t>(bits) };
+        float const floatValue = float_from_half(value);
+        CHECK(std::bit_cast<std::uint32_t>(floatValue) == std::bit_cast<std::uint32_t>(NumericImpl::float_from_half(value)));
+
+        bool const isNaN = ((bits & 0x7C00u) == 0x7C00u) && ((bits & 0x03FFu) != 0);
+        CHECK(half_from_float(floatValue).bits == (isNaN ? (bits | 0x0200u) : bits));
+    }
+
+    // rounding of floats between consecutive halves, across the denormal & normal ranges
+    for (std::uint32_t bits = 0x33000000u; bits < 0x477FE000u; bits += 0x00000FFFu)
+    {
+        float const value = std::bit_cast<float>(bits);
+        CHECK(half_from_float(value).bits == NumericImpl::half_from_float(value).bits);
+        CHECK(half_from_float(-value).bits == NumericImpl::half_from_float(-value).bits);
+
+        // nearest, i.e. the error is at most half of the spacing of the adjacent halves
+        half const  rounded = half_from_float(value);
+        float const error   = std::abs(float_from_half(rounded) - value);
+        CHECK(error <= 0.5f * (float_from_half(half{ static_cast<std::uint16_t>(rounded.bits + 1u) }) - float_from_half(rounded)));
+    }
+}
+
+TEST_CASE("ggm::Numeric::NumericUtil::normalized integers")
+{
+    using namespace ggm;
+
+    typedef std::numeric_limits<float> limits;
+
+    // constant evaluation
+    STATIC_CHECK(snorm8_from_float(1.0f) == 127);
+    STATIC_CHECK(snorm8_from_float(-1.0f) == -127);
+    STATIC_CHECK(snorm8_from_float(0.5f) == 64);   // 63.5 rounds away from zero
+    STATIC_CHECK(snorm8_from_float(-0.5f) == -64); // -63.5 rounds away from zero
+    STATIC_CHECK(snorm8_from_float(2.0f) == 127);  // saturates
+    STATIC_CHECK(snorm8_from_float(-2.0f) == -127);
+    STATIC_CHECK(snorm8_from_float(limits::infinity()) == 127);
+    STATIC_CHECK(snorm8_from_float(-limits::infinity()) == -127);
+    STATIC_CHECK(snorm8_from_float(limits::quiet_NaN()) == 0);
+    STATIC_CHECK(snorm16_from_float(1.0f) == 32767);
+    STATIC_CHECK(snorm16_from_float(-1.0f) == -32767);
+
+    STATIC_CHECK(unorm8_from_float(1.0f) == 255);
+    STATIC_CHECK(unorm8_from_float(0.5f) == 128); // 127.5 rounds up
+    STATIC_CHECK(unorm8_from_float(-0.5f) == 0);  // saturates
+    STATIC_CHECK(unorm8_from_float(2.0f) == 255);
+    STATIC_CHECK(unorm8_from_float(limits::infinity()) == 255);
+    STATIC_CHECK(unorm8_from_float(-limits::infinity()) == 0);
+    STATIC_CHECK(unorm8_from_float(limits::quiet_NaN()) == 0);
+    STATIC_CHECK(unorm16_from_float(1.0f) == 65535);
+
+    STATIC_CHECK(float_from_snorm(std::int8_t{ 127 }) == 1.0f);
+    STATIC_CHECK(float_from_snorm(std::int8_t{ -127 }) == -1.0f);
+    STATIC_CHECK(float_from_snorm(std::int8_t{ -128 }) == -1.0f);
+    STATIC_CHECK(float_from_snorm(std::int16_t{ -32768 }) == -1.0f);
+    STATIC_CHECK(float_from_unorm(std::uint8_t{ 255 }) == 1.0f);
+    STATIC_CHECK(float_from_unorm(std::uint16_t{ 65535 }) == 1.0f);
+
+    // every integer decodes to a float that encodes to the same integer (min decodes to -1, so encodes to min + 1)
+    for (int i = -128; i <= 127; ++i)
+    {
+        std::int8_t const value = static_cast<std::int8_t>(i);
+        CHECK(snorm8_from_float(float_from_snorm(value)) == ((i == -128) ? -127 : i));
+        CHECK(float_from_snorm(value) == std::max(static_cast<float>(i) / 127.0f, -1.0f));
+    }
+
+    for (int i = -32768; i <= 32767; ++i)
+    {
+        std::int16_t const value = static_cast<std::int16_t>(i);
+        CHECK(snorm16_from_float(float_from_snorm(value)) == ((i == -32768) ? -32767 : i));
+    }
+
+    for (int i = 0; i <= 255; ++i)
+    {
+        std::uint8_t const value = static_cast<std::uint8_t>(i);
+        CHECK(unorm8_from_float(float_from_unorm(value)) == i);
+        CHECK(float_from_unorm(value) == static_cast<float>(i) / 255.0f);
+    }
+
+    for (int i = 0; i <= 65535; ++i)
+    {
+        std::uint16_t const value = static_cast<std::uint16_t>(i);
+        CHECK(unorm16_from_float(float_from_unorm(value)) == i);
+    }
+
+    // the exact product is rounded to the nearest integer (ties away from zero), as std::lround does
+    for (int i = -2100; i <= 2100; ++i)
+    {
+        float const  value  = static_cast<float>(i) / 2000.0f;
+        double const scaled = static_cast<double>(value);
+
+        INFO(value);
+        CHECK(snorm8_from_float(value) == std::lround(std::clamp(scaled * 127.0, -127.0, 127.0)));
+        CHECK(snorm16_from_float(value) == std::lround(std::clamp(scaled * 32767.0, -32767.0, 32767.0)));
+        CHECK(unorm8_from_float(value) == std::lround(std::clamp(scaled * 255.0, 0.0, 255.0)));
+        CHECK(unorm16_from_float(value) == std::lround(std::clamp(scaled * 65535.0, 0.0, 65535.0)));
+    }
+
+    // the floats just below & at (or just above) k + 0.5, whose float product rounds to k + 0.5 for some k
+    STATIC_CHECK(unorm16_from_float(7.62951095e-06f) == 0);
+    STATIC_CHECK(unorm16_from_float(7.62951186e-06f) == 1);
+
+    auto const check_half_boundaries = [](auto const convert, int const first, int const last, double const scale)
+    {
+        for (int k = first; k < last; ++k)
+        {
+            // the largest float whose product is below k + 0.5, & the next float
+            double const half  = static_cast<double>(k) + ((k < 0) ? -0.5 : 0.5);
+            float        below = static_cast<float>(half / scale);
+            while (std::abs(static_cast<double>(below) * scale) >= std::abs(half))
+            {
+                below = std::nextafter(below, 0.0f);
+            }
+
+            while (std::abs(static_cast<double>(std::nextafter(below, 2.0f * below)) * scale) < std::abs(half))
+            {
+                below = std::nextafter(below, 2.0f * below);
+            }
+
+            float const above = std::nextafter(below, 2.0f * below);
+
+            INFO(k << " " << below << " " << above);
+            CHECK(static_cast<int>(convert(below)) == k);
+            CHECK(static_cast<int>(convert(above)) == ((k < 0) ? k - 1 : k + 1));
+        }
+    };
+
+    check_half_boundaries([](float const value) { return snorm8_from_float(value); }, -126, 127, 127.0);
+    check_half_boundaries([](float const value) { return snorm16_from_float(value); }, -32766, 32767, 32767.0);
+    check_half_boundaries([](float const value) { return unorm8_from_float(value); }, 0, 255, 255.0);
+    check_half_boundaries([](float const value) { return unorm16_from_float(value); }, 0, 65535, 65535.0);
+}
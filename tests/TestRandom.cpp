@@ -0,0 +1,67 @@
+#include "ggm/Numeric/Random.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstdint>
+#include <set>
+
+// =============================================================================
+
+TEST_CASE("ggm::Numeric::Random")
+{
+    using namespace ggm;
+
+    // reference values of the PCG RXS-M-XS permutation
+    STATIC_CHECK(pcg_hash(0u) == 0x07BB2FE2u);
+    STATIC_CHECK(pcg_hash(1u) == 0xA8BEEA3Cu);
+    STATIC_CHECK(pcg_hash(2u) == 0x7A7ECC88u);
+    STATIC_CHECK(random_uint32(42u, 5u) == 0xA791D9E4u);
+    STATIC_CHECK(random_uint32(42u, 5u) == pcg_hash(5u + pcg_hash(42u)));
+
+    STATIC_CHECK(float_from_random_bits(0u) == 0.0f);
+    STATIC_CHECK(float_from_random_bits(0xFFFFFFFFu) == 1.0f - 0x1p-24f);
+    STATIC_CHECK(float_from_random_bits(0x80000000u) == 0.5f);
+
+    // a permutation, i.e. distinct values give distinct hashes
+    std::set<std::uint32_t> hashes;
+    for (std::uint32_t i = 0; i < 10000u; ++i)
+    {
+        hashes.insert(pcg_hash(i));
+    }
+    CHECK(hashes.size() == 10000u);
+
+    // deterministic, in [0, 1) & roughly uniform
+    constexpr int Count   = 100000;
+    constexpr int Buckets = 10;
+
+    int    counts[Buckets] = {};
+    double sum             = 0.0;
+    for (int i = 0; i < Count; ++i)
+    {
+        float const value = random_float(7u, static_cast<std::uint32_t>(i));
+        REQUIRE(value >= 0.0f);
+        REQUIRE(value < 1.0f);
+        CHECK(value == random_float(7u, static_cast<std::uint32_t>(i)));
+
+        sum += value;
+        ++counts[static_cast<int>(value * Buckets)];
+    }
+
+    CHECK(sum / Count > 0.49);
+    CHECK(sum / Count < 0.51);
+    for (int const count : counts)
+    {
+        CHECK(count > Count / Buckets * 95 / 100);
+        CHECK(count < Count / Buckets * 105 / 100);
+    }
+
+    // different seeds give different sequences
+    int same = 0;
+    for (std::uint32_t i = 0; i < 1000u; ++i)
+    {
+        same += (random_uint32(1u, i) == random_uint32(2u, i)) ? 1 : 0;
+    }
+    CHECK(same == 0);
+}
+
+// =============================================================================
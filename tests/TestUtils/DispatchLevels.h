@@ -0,0 +1,74 @@
+#pragma once
+#ifndef GGM_TESTS_DISPATCH_LEVELS_H
+#define GGM_TESTS_DISPATCH_LEVELS_H
+
+#include "ggm/Dispatch/DispatchLevel.h"
+#include "ggm/Numeric/NumericUtil.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+// =============================================================================
+
+/// Every DispatchLevel supported by this machine, in increasing order (so the first is always Baseline).
+inline std::vector<ggm::DispatchLevel> supported_dispatch_levels()
+{
+    constexpr ggm::DispatchLevel Levels[] = {
+        ggm::DispatchLevel::Baseline,
+        ggm::DispatchLevel::Sse42,
+        ggm::DispatchLevel::Avx2,
+        ggm::DispatchLevel::Avx512,
+    };
+
+    std::vector<ggm::DispatchLevel> levels;
+    for (ggm::DispatchLevel const level : Levels)
+    {
+        if (level <= ggm::supported_dispatch_level())
+        {
+            levels.push_back(level);
+        }
+    }
+
+    return levels;
+}
+
+// =============================================================================
+
+/// Compare the results of a batch kernel with the baseline level (or with the scalar functions): bit-identical,
+/// except in a GGM_USE_FMA build, where multiply_add is only fused at the levels with FMA instructions (see
+/// DispatchLevel.h), so the results are compared within tolerance.
+template <typename T>
+bool is_dispatch_equal(T const & lhs,
+                       T const & rhs)
+{
+#if defined(GGM_USE_FMA)
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return ggm::is_close(lhs, rhs);
+    }
+    else
+    {
+        // note: unqualified, the Vector & Matrix is_close & all_of are found by argument dependent lookup
+        return all_of(is_close(lhs, rhs));
+    }
+#else
+    return lhs == rhs;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+/// @ref is_dispatch_equal of each element
+template <typename T>
+bool is_dispatch_equal(std::vector<T> const & lhs,
+                       std::vector<T> const & rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](T const & l, T const & r) {
+        return is_dispatch_equal(l, r);
+    });
+}
+
+// =============================================================================
+
+#endif // GGM_TESTS_DISPATCH_LEVELS_H
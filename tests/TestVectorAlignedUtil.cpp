@@ -0,0 +1,174 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorAligned.h"
+#include "ggm/Vector/VectorAlignedUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// =============================================================================
+// explicitly instantiate templates to confirm they compile without error:
+// =============================================================================
+
+template struct ggm::Vector3DA<float>;
+template struct ggm::Vector3DA<double>;
+
+static_assert(sizeof(ggm::Vector3DA<float>) == 16);
+static_assert(alignof(ggm::Vector3DA<float>) == 16);
+static_assert(sizeof(ggm::Vector3DA<double>) == 32);
+static_assert(alignof(ggm::Vector3DA<double>) == 32);
+
+// =============================================================================
+
+template ggm::Vector3DA<float> & ggm::operator+= <float>(Vector3DA<float> & lhs, Vector3DA<float> const & rhs) noexcept;
+template ggm::Vector3DA<float> ggm::operator* <float>(float const & lhs, Vector3DA<float> const & rhs) noexcept;
+
+// =============================================================================
+
+template ggm::Vector3DA<float> ggm::cross<float>(Vector3DA<float> const & lhs, Vector3DA<float> const & rhs) noexcept;
+template float ggm::dot<float>(Vector3DA<float> const & lhs, Vector3DA<float> const & rhs) noexcept;
+template ggm::Vector3DA<double> ggm::normalize<double>(Vector3DA<double> const & value) noexcept;
+template ggm::Vector3DA<float> ggm::vector3DA_from_vector3D<float>(Vector3D<float> const & value) noexcept;
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorAligned::Vector3DA", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    Vector3DA<TestType> a{ 1, 2, 3, 0 };
+
+    CHECK(a[0] == TestType{ 1 });
+    CHECK(a[1] == TestType{ 2 });
+    CHECK(a[2] == TestType{ 3 });
+
+    a[1] = TestType{ 5 };
+    CHECK(a.y == TestType{ 5 });
+
+    // the pad is excluded from the elements
+    std::size_t count = 0;
+    for (TestType const & element : a)
+    {
+        CHECK(element == a[count]);
+        ++count;
+    }
+    CHECK(count == 3);
+
+    Vector3DA<int> const b = static_cast<Vector3DA<int>>(a);
+    CHECK(b == Vector3DA<int>{ 1, 5, 3, 0 });
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorAlignedUtil::Vector3DA", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    Vector3D<TestType> const u{ TestType{ 1.5 }, TestType{ -2.25 }, TestType{ 3.125 } };
+    Vector3D<TestType> const v{ TestType{ -0.5 }, TestType{ 4 }, TestType{ 0.75 } };
+    Vector3D<TestType> const n = normalize(Vector3D<TestType>{ 1, 2, 2 });
+
+    // a non-zero pad never changes the x, y & z results
+    Vector3DA<TestType> const a{ u.x, u.y, u.z, TestType{ 7 } };
+    Vector3DA<TestType> const b{ v.x, v.y, v.z, TestType{ -9 } };
+    Vector3DA<TestType> const m = vector3DA_from_vector3D(n);
+
+    CHECK(vector3D_from_vector3DA(a) == u);
+    CHECK(vector3DA_from_vector3D(u) == a);
+    CHECK(vector3DA_from_vector3D(u).pad == TestType{ 0 });
+
+    // operators
+    Vector3DA<TestType> compound = a;
+    compound += b;
+    compound -= b;
+    compound *= TestType{ 2 };
+    compound /= TestType{ 2 };
+    compound *= b;
+    compound /= b;
+
+    CHECK(vector3D_from_vector3DA(compound) == ((((u + v - v) * TestType{ 2 }) / TestType{ 2 }) * v) / v);
+    CHECK(vector3D_from_vector3DA(+a) == +u);
+    CHECK(vector3D_from_vector3DA(-a) == -u);
+    CHECK(vector3D_from_vector3DA(a + b) == u + v);
+    CHECK(vector3D_from_vector3DA(a - b) == u - v);
+    CHECK(vector3D_from_vector3DA(TestType{ 2 } * a) == TestType{ 2 } * u);
+    CHECK(vector3D_from_vector3DA(a * TestType{ 2 }) == u * TestType{ 2 });
+    CHECK(vector3D_from_vector3DA(a * b) == u * v);
+    CHECK(vector3D_from_vector3DA(a / TestType{ 2 }) == u / TestType{ 2 });
+    CHECK(vector3D_from_vector3DA(a / b) == u / v);
+    CHECK(a == a);
+    CHECK(a != b);
+
+    // functions
+    CHECK(vector3D_from_vector3DA(abs(a)) == abs(u));
+    CHECK(vector3D_from_vector3DA(ceil(a)) == ceil(u));
+    CHECK(vector3D_from_vector3DA(clamp(a, TestType{ -2 }, TestType{ 2 })) == clamp(u, TestType{ -2 }, TestType{ 2 }));
+    CHECK(vector3D_from_vector3DA(clamp(a, b, b + a * a)) == clamp(u, v, v + u * u));
+    CHECK(vector3D_from_vector3DA(cross(a, b)) == cross(u, v));
+    CHECK(distance(a, b) == distance(u, v));
+    CHECK(distance_squared(a, b) == distance_squared(u, v));
+    CHECK(dot(a, b) == dot(u, v));
+    CHECK(vector3D_from_vector3DA(face_forward(m, a, b)) == face_forward(n, u, v));
+    CHECK(vector3D_from_vector3DA(floor(a)) == floor(u));
+    CHECK(vector3D_from_vector3DA(fract(a)) == fract(u));
+    CHECK(is_normalized(m) == is_normalized(n));
+    CHECK(is_normalized(a) == is_normalized(u));
+    CHECK(length(a) == length(u));
+    CHECK(length_squared(a) == length_squared(u));
+    CHECK(vector3D_from_vector3DA(lerp(a, b, TestType{ 0.25 })) == lerp(u, v, TestType{ 0.25 }));
+    CHECK(vector3D_from_vector3DA(normalize(a)) == normalize(u));
+    CHECK(vector3D_from_vector3DA(reciprocal(a)) == reciprocal(u));
+    CHECK(vector3D_from_vector3DA(reflect(a, m)) == reflect(u, n));
+    CHECK(vector3D_from_vector3DA(refract(a, m, TestType{ 0.75 })) == refract(u, n, TestType{ 0.75 }));
+    CHECK(vector3D_from_vector3DA(saturate(a)) == saturate(u));
+    CHECK(vector3D_from_vector3DA(select(is_less(a, b), a, b)) == select(is_less(u, v), u, v));
+    CHECK(vector3D_from_vector3DA(trunc(a)) == trunc(u));
+
+    // comparisons
+    CHECK(vector3D_from_vector3DA(is_less(a, b)) == is_less(u, v));
+    CHECK(vector3D_from_vector3DA(is_greater_equal(a, b)) == is_greater_equal(u, v));
+    CHECK(vector3D_from_vector3DA(is_equal(a, a)) == is_equal(u, u));
+    CHECK(vector3D_from_vector3DA(is_close(a, b)) == is_close(u, v));
+    CHECK(all_of(is_equal(a, a)));
+    CHECK(any_of(is_less(a, b)));
+    CHECK(none_of(is_not_equal(a, a)));
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorAlignedUtil::conversions")
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 9;
+
+    std::vector<Vector3D<float>> values(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        float const s = static_cast<float>(i);
+        values[i]     = Vector3D<float>{ s + 1.0f, 0.5f * s - 7.25f, 3.125f - 0.25f * s };
+    }
+
+    std::vector<Vector3DA<float>> aligned(Count);
+    vector3DA_from_vector3D(std::span<Vector3D<float> const>(values), std::span<Vector3DA<float>>(aligned));
+
+    for (Vector3DA<float> & value : aligned)
+    {
+        value = normalize(value);
+    }
+
+    std::vector<Vector3D<float>> results(Count);
+    vector3D_from_vector3DA(std::span<Vector3DA<float> const>(aligned), std::span<Vector3D<float>>(results));
+
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(aligned[i].pad == 0.0f);
+        CHECK(results[i] == normalize(values[i]));
+    }
+}
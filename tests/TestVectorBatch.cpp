@@ -0,0 +1,407 @@
+#include "ggm/Numeric/NumericUtil.h"
+#include "ggm/Vector/VectorBatch.h"
+#include "ggm/Vector/VectorEncoding.h"
+#include "ggm/Vector/VectorNoise.h"
+#include "ggm/Vector/VectorRandom.h"
+#include "ggm/Vector/VectorSpatialKey.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/DispatchLevels.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorBatch", /*tags*/ "", float, double)
+{
+    using namespace ggm;
+
+    // odd count, so that each level also handles a partial vector at the end
+    std::vector<Vector3D<TestType>> values;
+    for (int i = 0; i < 37; ++i)
+    {
+        values.push_back(Vector3D<TestType>{ TestType(i - 18), TestType(i % 5) + TestType{ 0.5 }, TestType(1 + i * i) });
+    }
+
+    std::vector<Vector3D<TestType>> baselineResults(values.size());
+    REQUIRE(set_dispatch_level(DispatchLevel::Baseline));
+    normalize(values, baselineResults);
+
+    // baseline results match the scalar function
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        CHECK(all_of(is_close(baselineResults[i], normalize(values[i]))));
+    }
+
+    // every level gives bit-identical results
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Vector3D<TestType>> results(values.size());
+        normalize(values, results);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(results[i] == baselineResults[i]);
+        }
+
+        // in-place
+        std::vector<Vector3D<TestType>> inPlaceResults = values;
+        normalize(inPlaceResults, inPlaceResults);
+        CHECK(inPlaceResults == baselineResults);
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorBatch::half")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> values;
+    for (int i = 0; i < 37; ++i)
+    {
+        values.push_back(Vector3D<float>{ float(i - 18) * 0.3f, float(i * i) * 97.0f, float(i) * 1e-6f });
+    }
+
+    // every level gives the same results as the scalar functions (whether or not it uses F16C)
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Vector3D<half>>  halfValues(values.size());
+        std::vector<Vector3D<float>> floatValues(values.size());
+        half_from_float(values, halfValues);
+        float_from_half(halfValues, floatValues);
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(halfValues[i].x.bits == half_from_float(values[i].x).bits);
+            CHECK(halfValues[i].y.bits == half_from_float(values[i].y).bits);
+            CHECK(halfValues[i].z.bits == half_from_float(values[i].z).bits);
+            CHECK(floatValues[i] == Vector3D<float>{ float_from_half(halfValues[i].x), float_from_half(halfValues[i].y), float_from_half(halfValues[i].z) });
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorBatch::octahedral")
+{
+    using namespace ggm;
+
+    std::vector<Vector3D<float>> values;
+    for (int i = 0; i < 37; ++i)
+    {
+        values.push_back(normalize(Vector3D<float>{ float(i - 18) * 0.3f, float(i % 7) - 3.0f, float(i * i) * 0.01f - 4.0f }));
+    }
+
+    // every level gives the same results as the scalar functions (see is_dispatch_equal)
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Vector2D<std::int16_t>> encoded16(values.size());
+        std::vector<Vector2D<std::int8_t>>  encoded8(values.size());
+        std::vector<Vector3D<float>>        decoded16(values.size());
+        std::vector<Vector3D<float>>        decoded8(values.size());
+        octahedral16_from_vector3D(values, encoded16);
+        octahedral8_from_vector3D(values, encoded8);
+        vector3D_from_octahedral16(encoded16, decoded16);
+        vector3D_from_octahedral8(encoded8, decoded8);
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(encoded16[i] == octahedral16_from_vector3D(values[i]));
+            CHECK(encoded8[i] == octahedral8_from_vector3D(values[i]));
+            CHECK(is_dispatch_equal(decoded16[i], vector3D_from_octahedral16(encoded16[i])));
+            CHECK(is_dispatch_equal(decoded8[i], vector3D_from_octahedral8(encoded8[i])));
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorBatch::normalized integers")
+{
+    using namespace ggm;
+
+    // includes values outside [-1, 1] (which saturate) & ties
+    std::vector<Vector4D<float>> values;
+    std::vector<Vector2D<float>> uvs;
+    for (int i = 0; i < 37; ++i)
+    {
+        values.push_back(Vector4D<float>{ float(i - 18) * 0.06f, float(i) / 36.0f, float(i % 5) * 0.25f - 0.5f, (i % 2 == 0) ? 1.0f : -1.0f });
+        uvs.push_back(Vector2D<float>{ float(i) * 0.03f, 1.0f - float(i) * 0.04f });
+    }
+
+    // every level gives the same results as the scalar functions
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Vector4D<std::int8_t>>   snorm8s(values.size());
+        std::vector<Vector4D<std::int16_t>>  snorm16s(values.size());
+        std::vector<Vector4D<std::uint8_t>>  unorm8s(values.size());
+        std::vector<Vector4D<std::uint16_t>> unorm16s(values.size());
+        std::vector<Vector2D<std::int16_t>>  snorm16uvs(uvs.size());
+        std::vector<Vector2D<std::uint16_t>> unorm16uvs(uvs.size());
+        std::vector<std::uint32_t>           snorm1010102s(values.size());
+        std::vector<std::uint32_t>           unorm1010102s(values.size());
+        snorm8_from_float(values, snorm8s);
+        snorm16_from_float(values, snorm16s);
+        unorm8_from_float(values, unorm8s);
+        unorm16_from_float(values, unorm16s);
+        snorm16_from_float(uvs, snorm16uvs);
+        unorm16_from_float(uvs, unorm16uvs);
+        snorm1010102_from_vector4D(values, snorm1010102s);
+        unorm1010102_from_vector4D(values, unorm1010102s);
+
+        std::vector<Vector4D<float>> decoded(values.size());
+        std::vector<Vector2D<float>> decodedUVs(uvs.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(snorm8s[i] == snorm8_from_float(values[i]));
+            CHECK(snorm16s[i] == snorm16_from_float(values[i]));
+            CHECK(unorm8s[i] == unorm8_from_float(values[i]));
+            CHECK(unorm16s[i] == unorm16_from_float(values[i]));
+            CHECK(snorm16uvs[i] == snorm16_from_float(uvs[i]));
+            CHECK(unorm16uvs[i] == unorm16_from_float(uvs[i]));
+            CHECK(snorm1010102s[i] == snorm1010102_from_vector4D(values[i]));
+            CHECK(unorm1010102s[i] == unorm1010102_from_vector4D(values[i]));
+        }
+
+        float_from_snorm(snorm8s, decoded);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(decoded[i] == float_from_snorm(snorm8s[i]));
+        }
+
+        float_from_snorm(snorm16s, decoded);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(decoded[i] == float_from_snorm(snorm16s[i]));
+        }
+
+        float_from_unorm(unorm8s, decoded);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(decoded[i] == float_from_unorm(unorm8s[i]));
+        }
+
+        float_from_unorm(unorm16s, decoded);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(decoded[i] == float_from_unorm(unorm16s[i]));
+        }
+
+        vector4D_from_snorm1010102(snorm1010102s, decoded);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(decoded[i] == vector4D_from_snorm1010102(snorm1010102s[i]));
+        }
+
+        vector4D_from_unorm1010102(unorm1010102s, decoded);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(decoded[i] == vector4D_from_unorm1010102(unorm1010102s[i]));
+        }
+
+        float_from_snorm(snorm16uvs, decodedUVs);
+        for (std::size_t i = 0; i < uvs.size(); ++i)
+        {
+            CHECK(decodedUVs[i] == float_from_snorm(snorm16uvs[i]));
+        }
+
+        float_from_unorm(unorm16uvs, decodedUVs);
+        for (std::size_t i = 0; i < uvs.size(); ++i)
+        {
+            CHECK(decodedUVs[i] == float_from_unorm(unorm16uvs[i]));
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorBatch::spatial keys")
+{
+    using namespace ggm;
+
+    // includes positions outside the bounds (which clamp) & a zero extent in z
+    Vector3D<float> const boundsMin{ -10.0f, 0.0f, 2.0f };
+    Vector3D<float> const boundsMax{ 10.0f, 5.0f, 2.0f };
+
+    std::vector<Vector3D<float>> values;
+    for (int i = 0; i < 37; ++i)
+    {
+        values.push_back(Vector3D<float>{ float(i - 18) * 0.6f, float(i % 7) * 0.9f, float(i) * 0.1f });
+    }
+
+    std::vector<Vector2D<float>> values2D;
+    for (Vector3D<float> const & value : values)
+    {
+        values2D.push_back(Vector2D<float>{ value.x, value.y });
+    }
+
+    Vector2D<float> const boundsMin2D{ boundsMin.x, boundsMin.y };
+    Vector2D<float> const boundsMax2D{ boundsMax.x, boundsMax.y };
+
+    // every level gives the same results as the scalar functions (whether or not it uses BMI2)
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<std::uint64_t> mortonKeys(values.size());
+        std::vector<std::uint64_t> hilbertKeys(values.size());
+        std::vector<std::uint32_t> mortonKeys2D(values2D.size());
+        std::vector<std::uint32_t> hilbertKeys2D(values2D.size());
+        morton_from_vector3D(boundsMin, boundsMax, values, mortonKeys);
+        hilbert_from_vector3D(boundsMin, boundsMax, values, hilbertKeys);
+        morton_from_vector2D(boundsMin2D, boundsMax2D, values2D, mortonKeys2D);
+        hilbert_from_vector2D(boundsMin2D, boundsMax2D, values2D, hilbertKeys2D);
+
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(mortonKeys[i] == morton_from_vector3D(grid_from_vector3D(values[i], boundsMin, boundsMax)));
+            CHECK(hilbertKeys[i] == hilbert_from_vector3D(grid_from_vector3D(values[i], boundsMin, boundsMax)));
+            CHECK(mortonKeys2D[i] == morton_from_vector2D(grid_from_vector2D(values2D[i], boundsMin2D, boundsMax2D)));
+            CHECK(hilbertKeys2D[i] == hilbert_from_vector2D(grid_from_vector2D(values2D[i], boundsMin2D, boundsMax2D)));
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorBatch::random")
+{
+    using namespace ggm;
+
+    constexpr std::uint32_t Seed  = 1234u;
+    constexpr std::uint32_t First = 100u;
+    constexpr std::size_t   Count = 37;
+
+    Vector3D<float> const direction = normalize(Vector3D<float>{ 1.0f, -2.0f, 3.0f });
+
+    // every level gives the same results as the scalar functions
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<Vector2D<float>> boxes2D(Count);
+        std::vector<Vector3D<float>> boxes3D(Count);
+        std::vector<Vector4D<float>> boxes4D(Count);
+        std::vector<Vector3D<float>> cones(Count);
+        std::vector<Vector2D<float>> disks(Count);
+        std::vector<Vector3D<float>> hemispheres(Count);
+        std::vector<Vector3D<float>> inSpheres(Count);
+        std::vector<Vector3D<float>> onSpheres(Count);
+        random_in_box(Seed, First, Vector2D<float>{ -1.0f, 0.0f }, Vector2D<float>{ 1.0f, 2.0f }, boxes2D);
+        random_in_box(Seed, First, Vector3D<float>{ -1.0f, 0.0f, 5.0f }, Vector3D<float>{ 1.0f, 2.0f, 6.0f }, boxes3D);
+        random_in_box(Seed, First, Vector4D<float>{ 0.0f, 0.0f, 0.0f, 1.0f }, Vector4D<float>{ 1.0f, 1.0f, 1.0f, 1.0f }, boxes4D);
+        random_in_cone(Seed, First, direction, 0.5f, cones);
+        random_in_disk(Seed, First, disks);
+        random_in_hemisphere(Seed, First, direction, hemispheres);
+        random_in_sphere(Seed, First, inSpheres);
+        random_on_sphere(Seed, First, onSpheres);
+
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            std::uint32_t const counter = First + static_cast<std::uint32_t>(i);
+            CHECK(boxes2D[i] == uniform_in_box(random_vector2D(Seed, counter), Vector2D<float>{ -1.0f, 0.0f }, Vector2D<float>{ 1.0f, 2.0f }));
+            CHECK(boxes3D[i] == uniform_in_box(random_vector3D(Seed, counter), Vector3D<float>{ -1.0f, 0.0f, 5.0f }, Vector3D<float>{ 1.0f, 2.0f, 6.0f }));
+            CHECK(boxes4D[i] == uniform_in_box(random_vector4D(Seed, counter), Vector4D<float>{ 0.0f, 0.0f, 0.0f, 1.0f }, Vector4D<float>{ 1.0f, 1.0f, 1.0f, 1.0f }));
+            CHECK(cones[i] == uniform_in_cone(random_vector2D(Seed, counter), direction, 0.5f));
+            CHECK(disks[i] == uniform_in_disk(random_vector2D(Seed, counter)));
+            CHECK(hemispheres[i] == uniform_in_hemisphere(random_vector2D(Seed, counter), direction));
+            CHECK(inSpheres[i] == uniform_in_sphere(random_vector3D(Seed, counter)));
+            CHECK(onSpheres[i] == uniform_on_sphere(random_vector2D(Seed, counter)));
+        }
+
+        // a sequence generated in several calls is the same as in one call
+        std::vector<Vector3D<float>> parts(Count);
+        random_in_sphere(Seed, First, std::span<Vector3D<float>>(parts).first(10));
+        random_in_sphere(Seed, First + 10u, std::span<Vector3D<float>>(parts).subspan(10));
+        CHECK(parts == inSpheres);
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorBatch::noise")
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 37;
+
+    std::vector<Vector2D<float>> values2D(Count);
+    std::vector<Vector3D<float>> values3D(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        std::uint32_t const counter = static_cast<std::uint32_t>(i);
+        values3D[i]                 = (random_vector3D(99u, counter) - Vector3D<float>{ 0.5f, 0.5f, 0.5f }) * 40.0f;
+        values2D[i]                 = Vector2D<float>{ values3D[i].x, values3D[i].y };
+    }
+
+    // every level gives the same results as the scalar functions (see is_dispatch_equal)
+    for (DispatchLevel const level : supported_dispatch_levels())
+    {
+        INFO(dispatch_level_name(level));
+        REQUIRE(set_dispatch_level(level));
+
+        std::vector<float> perlin2D(Count);
+        std::vector<float> perlin3D(Count);
+        std::vector<float> simplex2D(Count);
+        std::vector<float> simplex3D(Count);
+        std::vector<float> perlinFbm2D(Count);
+        std::vector<float> perlinFbm3D(Count);
+        std::vector<float> simplexFbm2D(Count);
+        std::vector<float> simplexFbm3D(Count);
+        perlin_noise(values2D, perlin2D);
+        perlin_noise(values3D, perlin3D);
+        simplex_noise(values2D, simplex2D);
+        simplex_noise(values3D, simplex3D);
+        perlin_fbm(values2D, 5, 2.0f, 0.5f, perlinFbm2D);
+        perlin_fbm(values3D, 5, 2.0f, 0.5f, perlinFbm3D);
+        simplex_fbm(values2D, 5, 2.0f, 0.5f, simplexFbm2D);
+        simplex_fbm(values3D, 5, 2.0f, 0.5f, simplexFbm3D);
+
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            CHECK(is_dispatch_equal(perlin2D[i], perlin_noise(values2D[i])));
+            CHECK(is_dispatch_equal(perlin3D[i], perlin_noise(values3D[i])));
+            CHECK(is_dispatch_equal(simplex2D[i], simplex_noise(values2D[i])));
+            CHECK(is_dispatch_equal(simplex3D[i], simplex_noise(values3D[i])));
+            CHECK(is_dispatch_equal(perlinFbm2D[i], perlin_fbm(values2D[i], 5, 2.0f, 0.5f)));
+            CHECK(is_dispatch_equal(perlinFbm3D[i], perlin_fbm(values3D[i], 5, 2.0f, 0.5f)));
+            CHECK(is_dispatch_equal(simplexFbm2D[i], simplex_fbm(values2D[i], 5, 2.0f, 0.5f)));
+            CHECK(is_dispatch_equal(simplexFbm3D[i], simplex_fbm(values3D[i], 5, 2.0f, 0.5f)));
+        }
+    }
+
+    reset_dispatch_level();
+}
+
+// =============================================================================
@@ -0,0 +1,182 @@
+#include "ggm/Numeric/NumericConstants.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorConstants.h"
+#include "ggm/Vector/VectorEncoding.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+// =============================================================================
+
+namespace
+{
+    /// count points spread evenly over the unit sphere (a spherical Fibonacci lattice)
+    ggm::Vector3D<float> fibonacci_sphere_point(int const index, int const count)
+    {
+        double const goldenAngle = 2.399963229728653; // pi * (3 - sqrt(5))
+        double const z           = 1.0 - (2.0 * index + 1.0) / count;
+        double const radius      = std::sqrt(1.0 - z * z);
+        double const angle       = goldenAngle * index;
+
+        return ggm::Vector3D<float>{
+            static_cast<float>(radius * std::cos(angle)),
+            static_cast<float>(radius * std::sin(angle)),
+            static_cast<float>(z),
+        };
+    }
+
+    /// sine of the angle between 2 unit vectors (accurate for small angles, unlike 1 - dot)
+    float sin_angle(ggm::Vector3D<float> const & lhs,
+                    ggm::Vector3D<float> const & rhs)
+    {
+        return ggm::length(ggm::cross(lhs, rhs));
+    }
+} // namespace
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorEncoding::octahedral16")
+{
+    using namespace ggm;
+
+    constexpr float MaxSinError = 8e-5f; // ~0.0046 degrees
+
+    // the axes are exact
+    for (Vector3D<float> const & axis : { Vector3D_AxisX<float>, Vector3D_AxisY<float>, Vector3D_AxisZ<float> })
+    {
+        CHECK(vector3D_from_octahedral16(octahedral16_from_vector3D(axis)) == axis);
+        CHECK(vector3D_from_octahedral16(octahedral16_from_vector3D(-axis)) == -axis);
+    }
+
+    STATIC_CHECK(octahedral16_from_vector3D(Vector3D_AxisZ<float>) == Vector2D<std::int16_t>{ 0, 0 });
+    STATIC_CHECK(octahedral16_from_vector3D(Vector3D_Zero<float>) == Vector2D<std::int16_t>{ 0, 0 });
+    CHECK(vector3D_from_octahedral16(Vector2D<std::int16_t>{ -32768, -32768 }) == -Vector3D_AxisZ<float>);
+
+    constexpr int Count = 20000;
+    for (int i = 0; i < Count; ++i)
+    {
+        Vector3D<float> const value   = fibonacci_sphere_point(i, Count);
+        Vector3D<float> const decoded = vector3D_from_octahedral16(octahedral16_from_vector3D(value));
+
+        INFO(i);
+        CHECK(is_normalized(decoded, 1e-6f));
+        CHECK(dot(value, decoded) > 0.0f);
+        CHECK(sin_angle(value, decoded) <= MaxSinError);
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorEncoding::octahedral8")
+{
+    using namespace ggm;
+
+    constexpr float MaxSinError = 0.0175f; // ~1 degree
+
+    // the axes are exact
+    for (Vector3D<float> const & axis : { Vector3D_AxisX<float>, Vector3D_AxisY<float>, Vector3D_AxisZ<float> })
+    {
+        CHECK(vector3D_from_octahedral8(octahedral8_from_vector3D(axis)) == axis);
+        CHECK(vector3D_from_octahedral8(octahedral8_from_vector3D(-axis)) == -axis);
+    }
+
+    constexpr int Count = 20000;
+    for (int i = 0; i < Count; ++i)
+    {
+        Vector3D<float> const value   = fibonacci_sphere_point(i, Count);
+        Vector3D<float> const decoded = vector3D_from_octahedral8(octahedral8_from_vector3D(value));
+
+        INFO(i);
+        CHECK(is_normalized(decoded, 1e-6f));
+        CHECK(dot(value, decoded) > 0.0f);
+        CHECK(sin_angle(value, decoded) <= MaxSinError);
+    }
+
+    // every encoding inside the square (the points of its edges are shared by 2 encodings) decodes to a unit
+    // vector that encodes to itself
+    for (int x = -126; x <= 126; ++x)
+    {
+        for (int y = -126; y <= 126; ++y)
+        {
+            Vector2D<std::int8_t> const encoded{ static_cast<std::int8_t>(x), static_cast<std::int8_t>(y) };
+            Vector3D<float> const       decoded = vector3D_from_octahedral8(encoded);
+
+            INFO(x << ", " << y);
+            CHECK(is_normalized(decoded, 1e-6f));
+            CHECK(octahedral8_from_vector3D(decoded) == encoded);
+        }
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorEncoding::normalized integers")
+{
+    using namespace ggm;
+
+    Vector4D<float> const color{ 0.0f, 0.25f, 1.0f, 1.5f };
+    Vector4D<float> const tangent{ -1.0f, 0.5f, 0.75f, -1.0f };
+
+    STATIC_CHECK(unorm8_from_float(Vector4D<float>{ 0.0f, 0.25f, 1.0f, 1.5f }) == Vector4D<std::uint8_t>{ 0, 64, 255, 255 });
+    STATIC_CHECK(snorm8_from_float(Vector3D<float>{ -1.0f, 0.5f, 2.0f }) == Vector3D<std::int8_t>{ -127, 64, 127 });
+    STATIC_CHECK(float_from_unorm(Vector2D<std::uint16_t>{ 0, 65535 }) == Vector2D<float>{ 0.0f, 1.0f });
+    STATIC_CHECK(float_from_snorm(Vector2D<std::int8_t>{ -128, 127 }) == Vector2D<float>{ -1.0f, 1.0f });
+
+    // element-wise
+    CHECK(unorm8_from_float(color) == Vector4D<std::uint8_t>{ unorm8_from_float(color.x), unorm8_from_float(color.y), unorm8_from_float(color.z), unorm8_from_float(color.w) });
+    CHECK(unorm16_from_float(color) == Vector4D<std::uint16_t>{ unorm16_from_float(color.x), unorm16_from_float(color.y), unorm16_from_float(color.z), unorm16_from_float(color.w) });
+    CHECK(snorm8_from_float(tangent) == Vector4D<std::int8_t>{ snorm8_from_float(tangent.x), snorm8_from_float(tangent.y), snorm8_from_float(tangent.z), snorm8_from_float(tangent.w) });
+    CHECK(snorm16_from_float(tangent) == Vector4D<std::int16_t>{ snorm16_from_float(tangent.x), snorm16_from_float(tangent.y), snorm16_from_float(tangent.z), snorm16_from_float(tangent.w) });
+
+    // within half a step of the saturated or clamped value
+    CHECK(all_of(is_close(float_from_unorm(unorm8_from_float(color)), saturate(color), 0.5f / 255.0f)));
+    CHECK(all_of(is_close(float_from_unorm(unorm16_from_float(color)), saturate(color), 0.5f / 65535.0f)));
+    CHECK(all_of(is_close(float_from_snorm(snorm8_from_float(tangent)), tangent, 0.5f / 127.0f)));
+    CHECK(all_of(is_close(float_from_snorm(snorm16_from_float(tangent)), tangent, 0.5f / 32767.0f)));
+
+    Vector2D<float> const uv{ 0.125f, 0.8f };
+    CHECK(all_of(is_close(float_from_unorm(unorm16_from_float(uv)), uv, 0.5f / 65535.0f)));
+    CHECK(all_of(is_close(float_from_snorm(snorm16_from_float(uv)), uv, 0.5f / 32767.0f)));
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorEncoding::1010102")
+{
+    using namespace ggm;
+
+    // x in bits 0-9, y in bits 10-19, z in bits 20-29 & w in bits 30-31
+    STATIC_CHECK(unorm1010102_from_vector4D(Vector4D<float>{ 1.0f, 0.0f, 0.0f, 0.0f }) == 0x000003FFu);
+    STATIC_CHECK(unorm1010102_from_vector4D(Vector4D<float>{ 0.0f, 1.0f, 0.0f, 0.0f }) == 0x000FFC00u);
+    STATIC_CHECK(unorm1010102_from_vector4D(Vector4D<float>{ 0.0f, 0.0f, 1.0f, 0.0f }) == 0x3FF00000u);
+    STATIC_CHECK(unorm1010102_from_vector4D(Vector4D<float>{ 0.0f, 0.0f, 0.0f, 1.0f }) == 0xC0000000u);
+    STATIC_CHECK(unorm1010102_from_vector4D(Vector4D<float>{ 2.0f, -1.0f, 0.5f, 0.5f }) == (0x3FFu | (512u << 20) | (2u << 30)));
+    STATIC_CHECK(snorm1010102_from_vector4D(Vector4D<float>{ 1.0f, -1.0f, 0.0f, -1.0f }) == (0x1FFu | (0x201u << 10) | (0x3u << 30)));
+    STATIC_CHECK(vector4D_from_unorm1010102(0xFFFFFFFFu) == Vector4D<float>{ 1.0f, 1.0f, 1.0f, 1.0f });
+    STATIC_CHECK(vector4D_from_snorm1010102(0x200u | (0x2u << 30)) == Vector4D<float>{ -1.0f, 0.0f, 0.0f, -1.0f }); // min is -1
+
+    // every 10-bit element & every 2-bit w round trips
+    for (std::uint32_t i = 0; i < 1024; ++i)
+    {
+        std::uint32_t const packed = i | (((i * 7u) & 0x3FFu) << 10) | (((i * 13u) & 0x3FFu) << 20) | ((i & 0x3u) << 30);
+
+        INFO(i);
+        CHECK(unorm1010102_from_vector4D(vector4D_from_unorm1010102(packed)) == packed);
+
+        // the min of each element (0x200 & 0x2) decodes to -1, so encodes to min + 1
+        std::uint32_t const signedPacked = ((i & 0x3FFu) == 0x200u ? 0x201u : i) |
+                                           ((((i * 7u) & 0x3FFu) == 0x200u ? 0x201u : ((i * 7u) & 0x3FFu)) << 10) |
+                                           ((((i * 13u) & 0x3FFu) == 0x200u ? 0x201u : ((i * 13u) & 0x3FFu)) << 20) |
+                                           (((i & 0x3u) == 0x2u ? 0x3u : (i & 0x3u)) << 30);
+        CHECK(snorm1010102_from_vector4D(vector4D_from_snorm1010102(packed)) == signedPacked);
+    }
+
+    // a tangent & the sign of its bitangent
+    Vector4D<float> const tangent{ 0.6f, -0.8f, 0.0f, -1.0f };
+    Vector4D<float> const decoded = vector4D_from_snorm1010102(snorm1010102_from_vector4D(tangent));
+    CHECK(all_of(is_close(decoded, tangent, 0.5f / 511.0f)));
+    CHECK(decoded.w == -1.0f);
+}
@@ -0,0 +1,93 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorHash.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorHash::std::hash")
+{
+    using namespace ggm;
+
+    std::hash<Vector2D<float>> const  hash2D;
+    std::hash<Vector3D<float>> const  hash3D;
+    std::hash<Vector4D<double>> const hash4D;
+
+    // equal vectors have equal hashes, including +0 & -0
+    CHECK(hash3D(Vector3D<float>{ 1.0f, 2.0f, 3.0f }) == hash3D(Vector3D<float>{ 1.0f, 2.0f, 3.0f }));
+    CHECK(hash3D(Vector3D<float>{ 0.0f, -0.0f, 0.0f }) == hash3D(Vector3D<float>{ -0.0f, 0.0f, -0.0f }));
+    CHECK(hash2D(Vector2D<float>{ 0.0f, 1.0f }) == hash2D(Vector2D<float>{ -0.0f, 1.0f }));
+
+    // the order of the elements matters
+    CHECK(hash2D(Vector2D<float>{ 1.0f, 2.0f }) != hash2D(Vector2D<float>{ 2.0f, 1.0f }));
+    CHECK(hash3D(Vector3D<float>{ 1.0f, 2.0f, 3.0f }) != hash3D(Vector3D<float>{ 3.0f, 2.0f, 1.0f }));
+    CHECK(hash4D(Vector4D<double>{ 1.0, 2.0, 3.0, 4.0 }) != hash4D(Vector4D<double>{ 1.0, 2.0, 4.0, 3.0 }));
+
+    // usable as keys of the std containers, with few collisions
+    std::unordered_map<Vector3D<int>, int> map;
+    std::set<std::size_t>                  hashes;
+    for (int x = 0; x < 20; ++x)
+    {
+        for (int y = 0; y < 20; ++y)
+        {
+            for (int z = 0; z < 20; ++z)
+            {
+                map[Vector3D<int>{ x, y, z }] = x + y + z;
+                hashes.insert(std::hash<Vector3D<int>>{}(Vector3D<int>{ x, y, z }));
+            }
+        }
+    }
+
+    CHECK(map.size() == 8000u);
+    CHECK(map.at(Vector3D<int>{ 3, 4, 5 }) == 12);
+    CHECK(hashes.size() > 7990u);
+
+    std::unordered_set<Vector2D<double>> set{ Vector2D<double>{ 0.5, 1.5 }, Vector2D<double>{ 0.5, 1.5 }, Vector2D<double>{ 1.5, 0.5 } };
+    CHECK(set.size() == 2u);
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorHash::quantize")
+{
+    using namespace ggm;
+
+    STATIC_CHECK(quantize(Vector3D<float>{ 0.0f, 0.99f, 1.0f }, 1.0f) == Vector3D<std::int32_t>{ 0, 0, 1 });
+    STATIC_CHECK(quantize(Vector3D<float>{ -0.01f, -1.0f, -1.01f }, 1.0f) == Vector3D<std::int32_t>{ -1, -1, -2 });
+    STATIC_CHECK(quantize(Vector3D<float>{ 0.3f, -0.3f, 2.5f }, 0.25f) == Vector3D<std::int32_t>{ 1, -2, 10 });
+    STATIC_CHECK(quantize(Vector2D<float>{ 0.3f, -0.3f }, 0.25f) == Vector2D<std::int32_t>{ 1, -2 });
+    STATIC_CHECK(quantize(Vector2D<float>{ -0x1p31f, 0x1p31f - 128.0f }, 1.0f) == Vector2D<std::int32_t>{ -2147483647 - 1, 2147483520 }); // limits
+
+    // points of the same cell have the same hash
+    STATIC_CHECK(quantized_hash(Vector3D<float>{ 0.1f, 0.2f, 0.3f }, 0.5f) == quantized_hash(Vector3D<float>{ 0.4f, 0.3f, 0.2f }, 0.5f));
+    STATIC_CHECK(quantized_hash(Vector2D<float>{ 0.1f, 0.2f }, 0.5f) == cell_hash(Vector2D<std::int32_t>{ 0, 0 }));
+    STATIC_CHECK(quantized_hash(Vector3D<float>{ -0.1f, 0.2f, 0.3f }, 0.5f) == cell_hash(Vector3D<std::int32_t>{ -1, 0, 0 }));
+
+    // the cell hashes of a block of cells have few collisions in 32 bits & use the low bits (for power of 2 tables)
+    std::set<std::uint32_t> hashes;
+    std::set<std::uint32_t> lowBits;
+    for (std::int32_t x = -8; x < 8; ++x)
+    {
+        for (std::int32_t y = -8; y < 8; ++y)
+        {
+            for (std::int32_t z = -8; z < 8; ++z)
+            {
+                std::uint32_t const hash = cell_hash(Vector3D<std::int32_t>{ x, y, z });
+                hashes.insert(hash);
+                lowBits.insert(hash & 0xFFFu);
+            }
+        }
+    }
+
+    CHECK(hashes.size() > 4090u);
+    CHECK(lowBits.size() > 2500u); // ~4096 * (1 - 1/e) ~= 2589 for random hashes
+}
+
+// =============================================================================
@@ -0,0 +1,101 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorMask.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMask::bitmask")
+{
+    using namespace ggm;
+
+    STATIC_CHECK(bitmask(Vector2D<bool>{ false, true }) == 0x2u);
+    STATIC_CHECK(bitmask(Vector3D<bool>{ true, false, true }) == 0x5u);
+    STATIC_CHECK(bitmask(Vector4D<bool>{ true, true, false, true }) == 0xBu);
+    STATIC_CHECK(bitmask(is_less(Vector4D<int>{ 0, 5, 2, 7 }, Vector4D<int>{ 1, 1, 3, 3 })) == 0x5u);
+
+    // every 4-bit integer round trips
+    for (unsigned int bits = 0; bits < 16; ++bits)
+    {
+        CHECK(bitmask(vector4D_from_bitmask(bits)) == bits);
+        CHECK(bitmask(vector3D_from_bitmask(bits)) == (bits & 0x7u));
+        CHECK(bitmask(vector2D_from_bitmask(bits)) == (bits & 0x3u));
+    }
+
+    std::vector<Vector3D<bool>> const masks = {
+        Vector3D<bool>{ false, false, false },
+        Vector3D<bool>{ true, false, false },
+        Vector3D<bool>{ false, true, true },
+        Vector3D<bool>{ true, true, true },
+    };
+
+    std::vector<unsigned int> bits(masks.size());
+    bitmask(std::span<Vector3D<bool> const>(masks), std::span<unsigned int>(bits));
+    CHECK(bits == std::vector<unsigned int>{ 0x0u, 0x1u, 0x6u, 0x7u });
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMask::bitmask words")
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 150; // not a multiple of 64
+
+    bool bools[Count] = {};
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        bools[i] = (i % 3 == 0) || (i == Count - 1);
+    }
+
+    std::uint64_t words[3] = { ~0ull, ~0ull, ~0ull };
+    bitmask(std::span<bool const>(bools), std::span<std::uint64_t>(words));
+
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(((words[i / 64] >> (i % 64)) & 1u) == (bools[i] ? 1u : 0u));
+    }
+
+    // the unused bits of the last word are zero
+    CHECK((words[2] >> (Count % 64)) == 0u);
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMask::reductions")
+{
+    using namespace ggm;
+
+    bool const none[] = { false, false, false, false, false };
+    bool const some[] = { false, true, false, true, false };
+    bool const all[]  = { true, true, true, true, true };
+
+    STATIC_CHECK(all_of(std::span<bool const>()));
+    STATIC_CHECK_FALSE(any_of(std::span<bool const>()));
+    STATIC_CHECK(none_of(std::span<bool const>()));
+    STATIC_CHECK(count_of(std::span<bool const>()) == 0);
+
+    CHECK_FALSE(all_of(none));
+    CHECK_FALSE(any_of(none));
+    CHECK(none_of(none));
+    CHECK(count_of(none) == 0);
+
+    CHECK_FALSE(all_of(some));
+    CHECK(any_of(some));
+    CHECK_FALSE(none_of(some));
+    CHECK(count_of(some) == 2);
+
+    CHECK(all_of(all));
+    CHECK(any_of(all));
+    CHECK_FALSE(none_of(all));
+    CHECK(count_of(all) == 5);
+}
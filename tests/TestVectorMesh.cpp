@@ -0,0 +1,327 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorMesh.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// =============================================================================
+
+namespace
+{
+    /// an n x n grid of quads in the xy plane (facing +z), with uv = (uScale * x, y)
+    struct Grid
+    {
+        std::vector<ggm::Vector3D<float>> positions;
+        std::vector<ggm::Vector2D<float>> uvs;
+        std::vector<std::uint32_t>        indices;
+    };
+
+    Grid make_grid(std::uint32_t const n,
+                   float const         uScale)
+    {
+        Grid grid;
+        for (std::uint32_t y = 0; y <= n; ++y)
+        {
+            for (std::uint32_t x = 0; x <= n; ++x)
+            {
+                // note: a slight bump, so the normals aren't all equal
+                float const fx = static_cast<float>(x);
+                float const fy = static_cast<float>(y);
+                grid.positions.push_back(ggm::Vector3D<float>{ fx, fy, 0.1f * std::sin(fx) * std::cos(fy) });
+                grid.uvs.push_back(ggm::Vector2D<float>{ uScale * fx, fy });
+            }
+        }
+
+        for (std::uint32_t y = 0; y < n; ++y)
+        {
+            for (std::uint32_t x = 0; x < n; ++x)
+            {
+                std::uint32_t const v00 = y * (n + 1) + x;
+                std::uint32_t const v10 = v00 + 1;
+                std::uint32_t const v01 = v00 + n + 1;
+                std::uint32_t const v11 = v01 + 1;
+                grid.indices.insert(grid.indices.end(), { v00, v10, v11, v00, v11, v01 });
+            }
+        }
+
+        return grid;
+    }
+
+    bool is_near(ggm::Vector3D<float> const & lhs,
+                 ggm::Vector3D<float> const & rhs,
+                 float const                  tolerance)
+    {
+        return ggm::length(lhs - rhs) <= tolerance;
+    }
+} // namespace
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMesh::adjacency")
+{
+    using namespace ggm;
+
+    // 2 triangles sharing the edge 1-2, & vertex 4 without triangles
+    std::vector<std::uint32_t> const indices{ 0, 1, 2, 2, 1, 3 };
+
+    VertexAdjacency adjacency;
+    make_vertex_adjacency(indices, 5, adjacency);
+
+    CHECK(adjacency.offsets == std::vector<std::uint32_t>{ 0, 1, 3, 5, 6, 6 });
+    CHECK(adjacency.corners == std::vector<std::uint32_t>{ 0, 1, 4, 2, 3, 5 });
+
+    // the corners of each vertex index the vertex
+    for (std::uint32_t vertex = 0; vertex < 5; ++vertex)
+    {
+        for (std::uint32_t i = adjacency.offsets[vertex]; i < adjacency.offsets[vertex + 1]; ++i)
+        {
+            CHECK(indices[adjacency.corners[i]] == vertex);
+        }
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMesh::normals")
+{
+    using namespace ggm;
+
+    // a unit cube with shared corner vertices, each face split into 2 triangles along a different diagonal
+    std::vector<Vector3D<float>> const positions{
+        { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f }, { 1.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 1.0f },
+    };
+    std::vector<std::uint32_t> const indices{
+        0, 2, 1, 1, 2, 3, // -z
+        4, 5, 7, 4, 7, 6, // +z
+        0, 1, 5, 0, 5, 4, // -y
+        2, 6, 3, 3, 6, 7, // +y
+        0, 4, 2, 2, 4, 6, // -x
+        1, 3, 7, 1, 7, 5, // +x
+    };
+
+    VertexAdjacency adjacency;
+    make_vertex_adjacency(indices, positions.size(), adjacency);
+
+    // angle weighted normals are the corner diagonals (each face contributes 90 degrees whatever its triangles)
+    std::vector<Vector3D<float>> normals(positions.size());
+    vertex_normals<float>(positions, indices, adjacency, NormalWeighting::Angle, normals);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        INFO(i);
+        Vector3D<float> const diagonal = normalize(positions[i] - Vector3D<float>{ 0.5f, 0.5f, 0.5f });
+        CHECK(is_near(normals[i], diagonal, 1e-6f));
+    }
+
+    // area weighted normals depend on the triangulation, e.g. vertex 0 has 2 triangles of -y but 1 of -x & -z
+    vertex_normals<float>(positions, indices, adjacency, NormalWeighting::Area, normals);
+    CHECK(is_near(normals[0], normalize(Vector3D<float>{ -1.0f, -2.0f, -1.0f }), 1e-6f));
+
+    // the normals of a bumpy grid are unit vectors facing +z, & a range of vertices gives the same results
+    Grid const grid = make_grid(16, 1.0f);
+    make_vertex_adjacency(grid.indices, grid.positions.size(), adjacency);
+
+    for (NormalWeighting const weighting : { NormalWeighting::Area, NormalWeighting::Angle })
+    {
+        std::vector<Vector3D<float>> gridNormals(grid.positions.size());
+        vertex_normals<float>(grid.positions, grid.indices, adjacency, weighting, gridNormals);
+
+        std::vector<Vector3D<float>> ranges(grid.positions.size());
+        for (std::size_t first = 0; first < ranges.size(); first += 50)
+        {
+            std::size_t const count = std::min<std::size_t>(50, ranges.size() - first);
+            vertex_normals<float>(grid.positions, grid.indices, adjacency, weighting, first, std::span<Vector3D<float>>(ranges).subspan(first, count));
+        }
+
+        for (std::size_t i = 0; i < gridNormals.size(); ++i)
+        {
+            INFO(i);
+            CHECK(std::abs(length(gridNormals[i]) - 1.0f) <= 1e-6f);
+            CHECK(gridNormals[i].z > 0.9f);
+            CHECK(ranges[i] == gridNormals[i]);
+        }
+    }
+
+    // vertices without triangles have zero normals
+    std::vector<Vector3D<float>> const unused{ { 0.0f, 0.0f, 0.0f } };
+    make_vertex_adjacency({}, 1, adjacency);
+    vertex_normals<float>(unused, {}, adjacency, NormalWeighting::Angle, std::span<Vector3D<float>>(normals).first(1));
+    CHECK(normals[0] == Vector3D<float>{ 0.0f, 0.0f, 0.0f });
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMesh::tangents")
+{
+    using namespace ggm;
+
+    for (float const uScale : { 1.0f, -1.0f, 0.25f })
+    {
+        INFO(uScale);
+        Grid const grid = make_grid(16, uScale);
+
+        VertexAdjacency adjacency;
+        make_vertex_adjacency(grid.indices, grid.positions.size(), adjacency);
+
+        std::vector<Vector3D<float>> normals(grid.positions.size());
+        vertex_normals<float>(grid.positions, grid.indices, adjacency, NormalWeighting::Angle, normals);
+
+        std::vector<Vector4D<float>> tangents(grid.positions.size());
+        vertex_tangents<float>(grid.positions, grid.uvs, normals, grid.indices, adjacency, tangents);
+
+        std::vector<Vector4D<float>> ranges(grid.positions.size());
+        for (std::size_t first = 0; first < ranges.size(); first += 50)
+        {
+            std::size_t const count = std::min<std::size_t>(50, ranges.size() - first);
+            vertex_tangents<float>(grid.positions, grid.uvs, normals, grid.indices, adjacency, first, std::span<Vector4D<float>>(ranges).subspan(first, count));
+        }
+
+        // u increases along +x (or -x when mirrored), & v along +y, i.e. the bitangent
+        float const handedness = (uScale < 0.0f) ? -1.0f : 1.0f;
+        for (std::size_t i = 0; i < tangents.size(); ++i)
+        {
+            INFO(i);
+            Vector3D<float> const tangent{ tangents[i].x, tangents[i].y, tangents[i].z };
+            CHECK(std::abs(length(tangent) - 1.0f) <= 1e-6f);
+            CHECK(std::abs(dot(tangent, normals[i])) <= 1e-6f);
+            CHECK(tangent.x * handedness > 0.9f);
+            CHECK(tangents[i].w == handedness);
+            CHECK(cross(normals[i], tangent).y * tangents[i].w > 0.9f);
+            CHECK(ranges[i] == tangents[i]);
+        }
+    }
+
+    // degenerate uvs give a tangent perpendicular to the normal
+    std::vector<Vector3D<float>> const positions{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+    std::vector<Vector2D<float>> const uvs(3, Vector2D<float>{ 0.5f, 0.5f });
+    std::vector<Vector3D<float>> const normals(3, Vector3D<float>{ 0.0f, 0.0f, 1.0f });
+    std::vector<std::uint32_t> const   indices{ 0, 1, 2 };
+
+    VertexAdjacency adjacency;
+    make_vertex_adjacency(indices, 3, adjacency);
+
+    std::vector<Vector4D<float>> tangents(3);
+    vertex_tangents<float>(positions, uvs, normals, indices, adjacency, tangents);
+    for (Vector4D<float> const & tangent : tangents)
+    {
+        CHECK(std::abs(length(tangent) - std::sqrt(2.0f)) <= 1e-6f);
+        CHECK(tangent.z == 0.0f);
+        CHECK(tangent.w == 1.0f);
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorMesh::weld")
+{
+    using namespace ggm;
+
+    // exact duplicates (including +0 & -0) are merged with epsilon 0
+    {
+        std::vector<Vector3D<float>> const positions{
+            { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { -0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 1e-7f, 0.0f },
+        };
+
+        std::vector<std::uint32_t> remap(positions.size());
+        CHECK(weld_vertices(positions, 0.0f, remap) == 3u);
+        CHECK(remap == std::vector<std::uint32_t>{ 0, 1, 0, 1, 2 });
+    }
+
+    // positions within epsilon are merged, whichever side of a cell boundary they are
+    {
+        std::vector<Vector3D<float>> const positions{
+            { 0.99f, 0.0f, 0.0f }, { 1.005f, 0.0f, 0.0f }, { 1.02f, 0.0f, 0.0f }, { 0.99f, -0.005f, 0.009f }, { 1.0f, 1.0f, 1.0f },
+        };
+
+        std::vector<std::uint32_t> remap(positions.size());
+        CHECK(weld_vertices(positions, 0.016f, remap) == 3u);
+        CHECK(remap == std::vector<std::uint32_t>{ 0, 0, 1, 0, 2 }); // 1.02 is within epsilon of 1.005, but not of 0.99
+    }
+
+    // positions are only merged with equal (within epsilon) attributes, e.g. at uv seams
+    {
+        std::vector<Vector3D<float>> const positions{ { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+        std::vector<float> const           uvs{ 0.0f, 0.5f, 1.0f, 0.5f, 0.0f, 0.5f, 0.001f, 0.5f };
+        VertexAttribute const              attributes[]{ VertexAttribute{ uvs, 2, 0.01f } };
+
+        std::vector<std::uint32_t> remap(positions.size());
+        CHECK(weld_vertices(positions, 0.0f, attributes, remap) == 2u);
+        CHECK(remap == std::vector<std::uint32_t>{ 0, 1, 0, 0 });
+    }
+
+    // positions far from the origin relative to epsilon (i.e. with cells of 2 * epsilon beyond std::int32_t) are
+    // welded in larger cells, & positions within epsilon are still merged
+    {
+        std::vector<Vector3D<float>> positions;
+        for (int i = 0; i < 64; ++i)
+        {
+            Vector3D<float> const position{ 1e6f + 0.0625f * static_cast<float>(i), -1e6f, 1e6f - 0.0625f * static_cast<float>(i) };
+            positions.insert(positions.end(), { position, position });
+        }
+
+        float const cellSize = MeshImpl::weld_cell_size(positions, 1e-4f);
+        CHECK(cellSize >= 2e-4f);
+        CHECK(cellSize < 1e-3f); // ~2^-30 of the largest element, far below the float spacing there (0.0625)
+        CHECK(1.01e6f / cellSize < 0x1p31f);
+
+        std::vector<std::uint32_t> remap(positions.size());
+        CHECK(weld_vertices(positions, 1e-4f, remap) == 64u);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            CHECK(remap[i] == i / 2u);
+        }
+    }
+
+    {
+        std::vector<Vector3D<float>> const positions{
+            { 0.0f, 0.0f, 0.0f }, { 1000.0f, 0.0f, 0.0f }, { 5e-8f, 0.0f, -5e-8f }, { 2e-7f, 0.0f, 0.0f }, { 1000.0f, 0.0f, 0.0f },
+        };
+
+        std::vector<std::uint32_t> remap(positions.size());
+        CHECK(weld_vertices(positions, 1e-7f, remap) == 3u);
+        CHECK(remap == std::vector<std::uint32_t>{ 0, 1, 0, 2, 1 });
+    }
+
+    // a triangle soup of a grid is welded back to the grid's vertices, even with tiny jitter
+    Grid const                   grid = make_grid(32, 1.0f);
+    std::vector<Vector3D<float>> soup;
+    for (std::size_t i = 0; i < grid.indices.size(); ++i)
+    {
+        float const jitter = 5e-5f * (static_cast<float>(i % 7) - 3.0f);
+        soup.push_back(grid.positions[grid.indices[i]] + Vector3D<float>{ jitter, -jitter, jitter });
+    }
+
+    std::vector<std::uint32_t> remap(soup.size());
+    std::size_t const          uniqueCount = weld_vertices(soup, 1e-3f, remap);
+    CHECK(uniqueCount == grid.positions.size());
+
+    std::vector<Vector3D<float>> uniquePositions(uniqueCount);
+    remap_vertices<Vector3D<float>>(soup, remap, uniquePositions);
+
+    std::vector<std::uint32_t> indices(soup.size());
+    for (std::uint32_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = i;
+    }
+    remap_indices(indices, remap, indices);
+
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        INFO(i);
+        CHECK(indices[i] == remap[i]);
+        CHECK(distance(uniquePositions[indices[i]], grid.positions[grid.indices[i]]) <= 1e-3f);
+    }
+
+    // the first vertex of each unique vertex is the unique vertex
+    CHECK(uniquePositions[0] == soup[0]);
+    CHECK(uniquePositions[remap.back()] == soup[std::find(remap.begin(), remap.end(), remap.back()) - remap.begin()]);
+}
+
+// =============================================================================
@@ -0,0 +1,173 @@
+#include "ggm/Numeric/Random.h"
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorNoise.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// =============================================================================
+
+namespace
+{
+    /// a random point in [-range, range)^3
+    ggm::Vector3D<float> random_point(std::uint32_t const counter,
+                                      float const         range)
+    {
+        return ggm::Vector3D<float>{
+            (ggm::random_float(7u, 3u * counter + 0u) * 2.0f - 1.0f) * range,
+            (ggm::random_float(7u, 3u * counter + 1u) * 2.0f - 1.0f) * range,
+            (ggm::random_float(7u, 3u * counter + 2u) * 2.0f - 1.0f) * range,
+        };
+    }
+} // namespace
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorNoise::noise")
+{
+    using namespace ggm;
+
+    // 0 at the lattice points
+    STATIC_CHECK(perlin_noise(Vector2D<float>{ 0.0f, 0.0f }) == 0.0f);
+    STATIC_CHECK(perlin_noise(Vector3D<float>{ 3.0f, -5.0f, 7.0f }) == 0.0f);
+    STATIC_CHECK(simplex_noise(Vector2D<float>{ 0.0f, 0.0f }) == 0.0f);
+    STATIC_CHECK(simplex_noise(Vector3D<float>{ 0.0f, 0.0f, 0.0f }) == 0.0f);
+    for (int x = -4; x <= 4; ++x)
+    {
+        for (int y = -4; y <= 4; ++y)
+        {
+            Vector3D<float> const lattice{ static_cast<float>(x), static_cast<float>(y), static_cast<float>(x - y) };
+            CHECK(perlin_noise(Vector2D<float>{ lattice.x, lattice.y }) == 0.0f);
+            CHECK(perlin_noise(lattice) == 0.0f);
+        }
+    }
+
+    constexpr float Delta     = 1e-3f;
+    constexpr float MaxChange = 0.02f; // the noise gradients are at most a few units
+
+    float minPerlin  = 0.0f;
+    float maxPerlin  = 0.0f;
+    float minSimplex = 0.0f;
+    float maxSimplex = 0.0f;
+    for (std::uint32_t i = 0; i < 20000u; ++i)
+    {
+        Vector3D<float> const value3D = random_point(i, 50.0f);
+        Vector2D<float> const value2D{ value3D.x, value3D.y };
+
+        INFO(i);
+        float const perlin2D  = perlin_noise(value2D);
+        float const perlin3D  = perlin_noise(value3D);
+        float const simplex2D = simplex_noise(value2D);
+        float const simplex3D = simplex_noise(value3D);
+
+        // in [-1, 1]
+        CHECK(std::abs(perlin2D) <= 1.0f);
+        CHECK(std::abs(perlin3D) <= 1.0f);
+        CHECK(std::abs(simplex2D) <= 1.0f);
+        CHECK(std::abs(simplex3D) <= 1.0f);
+
+        // continuous, i.e. a small step in any direction is a small change
+        Vector3D<float> const step = value3D + Vector3D<float>{ Delta, -Delta, Delta };
+        CHECK(std::abs(perlin_noise(Vector2D<float>{ step.x, step.y }) - perlin2D) <= MaxChange);
+        CHECK(std::abs(perlin_noise(step) - perlin3D) <= MaxChange);
+        CHECK(std::abs(simplex_noise(Vector2D<float>{ step.x, step.y }) - simplex2D) <= MaxChange);
+        CHECK(std::abs(simplex_noise(step) - simplex3D) <= MaxChange);
+
+        // deterministic
+        CHECK(perlin_noise(value3D) == perlin3D);
+        CHECK(simplex_noise(value3D) == simplex3D);
+
+        minPerlin  = std::fmin(minPerlin, perlin3D);
+        maxPerlin  = std::fmax(maxPerlin, perlin3D);
+        minSimplex = std::fmin(minSimplex, simplex3D);
+        maxSimplex = std::fmax(maxSimplex, simplex3D);
+    }
+
+    // the noise covers most of the range
+    CHECK(minPerlin < -0.5f);
+    CHECK(maxPerlin > 0.5f);
+    CHECK(minSimplex < -0.5f);
+    CHECK(maxSimplex > 0.5f);
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorNoise::fbm")
+{
+    using namespace ggm;
+
+    constexpr float Lacunarity = 2.0f;
+    constexpr float Gain       = 0.5f;
+
+    for (std::uint32_t i = 0; i < 1000u; ++i)
+    {
+        Vector3D<float> const value3D = random_point(i, 10.0f);
+        Vector2D<float> const value2D{ value3D.x, value3D.y };
+
+        INFO(i);
+
+        // a single octave is the noise
+        CHECK(perlin_fbm(value2D, 1, Lacunarity, Gain) == perlin_noise(value2D));
+        CHECK(perlin_fbm(value3D, 1, Lacunarity, Gain) == perlin_noise(value3D));
+        CHECK(simplex_fbm(value2D, 1, Lacunarity, Gain) == simplex_noise(value2D));
+        CHECK(simplex_fbm(value3D, 1, Lacunarity, Gain) == simplex_noise(value3D));
+        CHECK(perlin_fbm(value3D, 0, Lacunarity, Gain) == 0.0f);
+
+        // the sum of the octaves
+        float perlin    = 0.0f;
+        float simplex   = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        for (int octave = 0; octave < 5; ++octave)
+        {
+            perlin += amplitude * perlin_noise(value3D * frequency);
+            simplex += amplitude * simplex_noise(value2D * frequency);
+            amplitude *= Gain;
+            frequency *= Lacunarity;
+        }
+        CHECK(perlin_fbm(value3D, 5, Lacunarity, Gain) == perlin);
+        CHECK(simplex_fbm(value2D, 5, Lacunarity, Gain) == simplex);
+        CHECK(std::abs(perlin) <= 2.0f); // the sum of the amplitudes
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorNoise::packets")
+{
+    using namespace ggm;
+
+    constexpr std::size_t N = 8;
+
+    // each lane is the noise of the lane's point
+    for (std::uint32_t i = 0; i < 100u; ++i)
+    {
+        Vector3DPacket<float, N> packet{};
+        for (std::size_t lane = 0; lane < N; ++lane)
+        {
+            set_lane(packet, lane, random_point(static_cast<std::uint32_t>(N) * i + static_cast<std::uint32_t>(lane), 20.0f));
+        }
+
+        std::array<float, N> const perlin     = perlin_noise(packet);
+        std::array<float, N> const simplex    = simplex_noise(packet);
+        std::array<float, N> const perlinFbm  = perlin_fbm(packet, 4, 2.0f, 0.5f);
+        std::array<float, N> const simplexFbm = simplex_fbm(packet, 4, 2.0f, 0.5f);
+        for (std::size_t lane = 0; lane < N; ++lane)
+        {
+            Vector3D<float> const value = get_lane(packet, lane);
+            CHECK(perlin[lane] == perlin_noise(value));
+            CHECK(simplex[lane] == simplex_noise(value));
+            CHECK(perlinFbm[lane] == perlin_fbm(value, 4, 2.0f, 0.5f));
+            CHECK(simplexFbm[lane] == simplex_fbm(value, 4, 2.0f, 0.5f));
+        }
+    }
+}
+
+// =============================================================================
@@ -0,0 +1,254 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorPacket.h"
+#include "ggm/Vector/VectorPacketUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// =============================================================================
+// explicitly instantiate templates to confirm they compile without error:
+// =============================================================================
+
+template struct ggm::Vector3DPacket<float, 4>;
+template struct ggm::Vector3DPacket<float, 8>;
+template struct ggm::Vector3DPacket<float, 16>;
+template struct ggm::Vector4DPacket<double, 4>;
+template struct ggm::Vector3DPacketArray<float, 8>;
+template struct ggm::Vector4DPacketArray<float, 8>;
+
+// =============================================================================
+
+template ggm::Vector3DPacket<float, 8> & ggm::operator+= <float, 8>(Vector3DPacket<float, 8> & lhs, Vector3DPacket<float, 8> const & rhs) noexcept;
+template ggm::Vector4DPacket<float, 8> ggm::operator* <float, 8>(float const & lhs, Vector4DPacket<float, 8> const & rhs) noexcept;
+
+// =============================================================================
+
+template ggm::Vector3DPacket<float, 8> ggm::cross<float, 8>(Vector3DPacket<float, 8> const & lhs, Vector3DPacket<float, 8> const & rhs) noexcept;
+template std::array<float, 8> ggm::dot<float, 8>(Vector4DPacket<float, 8> const & lhs, Vector4DPacket<float, 8> const & rhs) noexcept;
+template ggm::Vector4DPacket<float, 16> ggm::normalize<float, 16>(Vector4DPacket<float, 16> const & value) noexcept;
+template void ggm::gather<float, 4>(std::vector<Vector3D<float>> const & values, Vector3DPacketArray<float, 4> & results);
+
+// =============================================================================
+
+namespace
+{
+    template <typename T, std::size_t N>
+    ggm::Vector3DPacket<T, N> make_packet3D(T const offset)
+    {
+        ggm::Vector3DPacket<T, N> packet{};
+        for (std::size_t lane = 0; lane < N; ++lane)
+        {
+            T const s = static_cast<T>(lane) + offset;
+            set_lane(packet, lane, ggm::Vector3D<T>{ s + T{ 1 }, T{ 0.5 } * s - T{ 7.25 }, T{ 3.125 } - T{ 0.25 } * s });
+        }
+
+        return packet;
+    }
+
+    template <typename T, std::size_t N>
+    ggm::Vector4DPacket<T, N> make_packet4D(T const offset)
+    {
+        ggm::Vector4DPacket<T, N> packet{};
+        for (std::size_t lane = 0; lane < N; ++lane)
+        {
+            T const s = static_cast<T>(lane) + offset;
+            set_lane(packet, lane, ggm::Vector4D<T>{ s + T{ 1 }, T{ 0.5 } * s - T{ 7.25 }, T{ 3.125 } - T{ 0.25 } * s, T{ 2 } * s });
+        }
+
+        return packet;
+    }
+} // namespace
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorPacketUtil::Vector3DPacket", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr std::size_t N = 8;
+
+    Vector3DPacket<TestType, N> const p = make_packet3D<TestType, N>(TestType{ 0 });
+    Vector3DPacket<TestType, N> const q = make_packet3D<TestType, N>(TestType{ 0.5 });
+
+    std::array<TestType, N> ts{};
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        ts[lane] = static_cast<TestType>(lane) / TestType{ N };
+    }
+
+    // lane access
+    CHECK(get_lane(broadcast<N>(Vector3D<TestType>{ 1, 2, 3 }), 5) == Vector3D<TestType>{ 1, 2, 3 });
+    CHECK(p == p);
+    CHECK(p != q);
+
+    // results match the Vector3D functions
+    Vector3DPacket<TestType, N> compound = p;
+    compound += q;
+    compound -= q;
+    compound *= TestType{ 2 };
+    compound /= TestType{ 2 };
+    compound *= q;
+    compound /= q;
+
+    Vector3DPacket<TestType, N> const sum        = p + q;
+    Vector3DPacket<TestType, N> const difference = p - q;
+    Vector3DPacket<TestType, N> const negated    = -p;
+    Vector3DPacket<TestType, N> const scaled     = TestType{ 2 } * p;
+    Vector3DPacket<TestType, N> const product    = p * q;
+    Vector3DPacket<TestType, N> const quotient   = q / p;
+    Vector3DPacket<TestType, N> const clamped    = clamp(p, TestType{ -2 }, TestType{ 2 });
+    Vector3DPacket<TestType, N> const crossed    = cross(p, q);
+    Vector3DPacket<TestType, N> const lerped     = lerp(p, q, TestType{ 0.25 });
+    Vector3DPacket<TestType, N> const lerpedTs   = lerp(p, q, ts);
+    Vector3DPacket<TestType, N> const normalized = normalize(p);
+    std::array<TestType, N> const     dots       = dot(p, q);
+    std::array<TestType, N> const     lengths    = length(p);
+    std::array<TestType, N> const     lengths2   = length_squared(p);
+    std::array<TestType, N> const     distances  = distance(p, q);
+    std::array<TestType, N> const     distances2 = distance_squared(p, q);
+
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        Vector3D<TestType> const u = get_lane(p, lane);
+        Vector3D<TestType> const v = get_lane(q, lane);
+
+        CHECK(get_lane(compound, lane) == ((((u + v - v) * TestType{ 2 }) / TestType{ 2 }) * v) / v);
+        CHECK(get_lane(sum, lane) == u + v);
+        CHECK(get_lane(difference, lane) == u - v);
+        CHECK(get_lane(negated, lane) == -u);
+        CHECK(get_lane(scaled, lane) == TestType{ 2 } * u);
+        CHECK(get_lane(product, lane) == u * v);
+        CHECK(get_lane(quotient, lane) == v / u);
+        CHECK(get_lane(clamped, lane) == clamp(u, TestType{ -2 }, TestType{ 2 }));
+        CHECK(get_lane(crossed, lane) == cross(u, v));
+        CHECK(get_lane(lerped, lane) == lerp(u, v, TestType{ 0.25 }));
+        CHECK(get_lane(lerpedTs, lane) == lerp(u, v, ts[lane]));
+        CHECK(get_lane(normalized, lane) == normalize(u));
+        CHECK(dots[lane] == dot(u, v));
+        CHECK(lengths[lane] == length(u));
+        CHECK(lengths2[lane] == length_squared(u));
+        CHECK(distances[lane] == distance(u, v));
+        CHECK(distances2[lane] == distance_squared(u, v));
+    }
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorPacketUtil::Vector4DPacket", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr std::size_t N = 4;
+
+    Vector4DPacket<TestType, N> const p = make_packet4D<TestType, N>(TestType{ 0 });
+    Vector4DPacket<TestType, N> const q = make_packet4D<TestType, N>(TestType{ 0.5 });
+
+    Vector4DPacket<TestType, N> const sum        = p + q;
+    Vector4DPacket<TestType, N> const scaled     = p * TestType{ 3 };
+    Vector4DPacket<TestType, N> const lerped     = lerp(p, q, TestType{ 0.75 });
+    Vector4DPacket<TestType, N> const normalized = normalize(p);
+    std::array<TestType, N> const     dots       = dot(p, q);
+    std::array<TestType, N> const     lengths    = length(p);
+
+    for (std::size_t lane = 0; lane < N; ++lane)
+    {
+        Vector4D<TestType> const u = get_lane(p, lane);
+        Vector4D<TestType> const v = get_lane(q, lane);
+
+        CHECK(get_lane(sum, lane) == u + v);
+        CHECK(get_lane(scaled, lane) == u * TestType{ 3 });
+        CHECK(get_lane(lerped, lane) == lerp(u, v, TestType{ 0.75 }));
+        CHECK(get_lane(normalized, lane) == normalize(u));
+        CHECK(dots[lane] == dot(u, v));
+        CHECK(lengths[lane] == length(u));
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorPacketUtil::Vector3DPacketArray")
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 37; // not a multiple of any packet width
+
+    std::vector<Vector3D<float>> values(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        float const s = static_cast<float>(i);
+        values[i]     = Vector3D<float>{ s + 1.0f, 0.5f * s - 7.25f, 3.125f - 0.25f * s };
+    }
+
+    Vector3DPacketArray<float, 16> packets;
+    gather(values, packets);
+    REQUIRE(packets.count == Count);
+    REQUIRE(packets.packets.size() == 3);
+
+    // padding lanes are zero
+    for (std::size_t lane = Count % 16; lane < 16; ++lane)
+    {
+        CHECK(get_lane(packets.packets.back(), lane) == Vector3D<float>{ 0.0f, 0.0f, 0.0f });
+    }
+
+    // one loop body over every packet
+    for (Vector3DPacket<float, 16> & packet : packets.packets)
+    {
+        packet = normalize(packet);
+    }
+
+    std::vector<Vector3D<float>> results;
+    scatter(packets, results);
+    REQUIRE(results.size() == Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == normalize(values[i]));
+    }
+
+    // shrinking zeros the new padding lanes
+    resize(packets, 20);
+    CHECK(packets.count == 20);
+    CHECK(packets.packets.size() == 2);
+    CHECK(get_lane(packets.packets.back(), 3) == normalize(values[19]));
+    CHECK(get_lane(packets.packets.back(), 4) == Vector3D<float>{ 0.0f, 0.0f, 0.0f });
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorPacketUtil::Vector4DPacketArray")
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 11;
+
+    std::vector<Vector4D<float>> values(Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        float const s = static_cast<float>(i);
+        values[i]     = Vector4D<float>{ s + 1.0f, 0.5f * s - 7.25f, 3.125f - 0.25f * s, 2.0f * s };
+    }
+
+    Vector4DPacketArray<float, 4> packets;
+    gather(values, packets);
+    REQUIRE(packets.count == Count);
+    REQUIRE(packets.packets.size() == 3);
+
+    for (Vector4DPacket<float, 4> & packet : packets.packets)
+    {
+        packet *= 2.0f;
+    }
+
+    std::vector<Vector4D<float>> results;
+    scatter(packets, results);
+    REQUIRE(results.size() == Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values[i] * 2.0f);
+    }
+}
@@ -0,0 +1,97 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorConstants.h"
+#include "ggm/Vector/VectorRandom.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorRandom::random vectors")
+{
+    using namespace ggm;
+
+    // the elements are consecutive random floats
+    STATIC_CHECK(random_vector2D(3u, 5u) == Vector2D<float>{ random_float(3u, 10u), random_float(3u, 11u) });
+    STATIC_CHECK(random_vector3D(3u, 5u) == Vector3D<float>{ random_float(3u, 15u), random_float(3u, 16u), random_float(3u, 17u) });
+    STATIC_CHECK(random_vector4D(3u, 5u) == Vector4D<float>{ random_float(3u, 20u), random_float(3u, 21u), random_float(3u, 22u), random_float(3u, 23u) });
+
+    for (std::uint32_t i = 0; i < 1000u; ++i)
+    {
+        Vector4D<float> const value = random_vector4D(11u, i);
+        CHECK(all_of(is_greater_equal(value, Vector4D_Zero<float>)));
+        CHECK(all_of(is_less(value, Vector4D<float>{ 1.0f, 1.0f, 1.0f, 1.0f })));
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorRandom::samples")
+{
+    using namespace ggm;
+
+    constexpr int   Count     = 20000;
+    constexpr float Tolerance = 1e-5f;
+
+    // the extremes of the uniform values
+    STATIC_CHECK(uniform_in_box(Vector3D<float>{ 0.0f, 0.5f, 0.0f }, Vector3D<float>{ -1.0f, 2.0f, 4.0f }, Vector3D<float>{ 1.0f, 4.0f, 4.0f }) == Vector3D<float>{ -1.0f, 3.0f, 4.0f });
+    STATIC_CHECK(uniform_in_disk(Vector2D<float>{ 0.0f, 0.3f }) == Vector2D<float>{ 0.0f, 0.0f });
+    STATIC_CHECK(uniform_on_sphere(Vector2D<float>{ 0.0f, 0.0f }) == Vector3D<float>{ 0.0f, 0.0f, 1.0f });
+    STATIC_CHECK(uniform_in_sphere(Vector3D<float>{ 0.3f, 0.7f, 0.0f }) == Vector3D<float>{ 0.0f, 0.0f, 0.0f });
+    CHECK(std::abs(VectorRandomImpl::unit_cbrt(0.125f) - 0.5f) <= 1e-7f);
+    CHECK(std::abs(VectorRandomImpl::unit_cbrt(0x1p-24f) - std::cbrt(0x1p-24f)) <= 1e-12f);
+    CHECK(std::abs(VectorRandomImpl::unit_cbrt(0.999f) - std::cbrt(0.999f)) <= 1e-7f);
+
+    // cone axes in every octant & along the axes (where the orthonormal basis changes sign)
+    Vector3D<float> const directions[] = {
+        Vector3D_AxisZ<float>,
+        -Vector3D_AxisZ<float>,
+        Vector3D_AxisX<float>,
+        normalize(Vector3D<float>{ 1.0f, -2.0f, 3.0f }),
+        normalize(Vector3D<float>{ -3.0f, 1.0f, -0.5f }),
+    };
+
+    int    inHalfDisk   = 0;
+    int    inHalfSphere = 0;
+    double sphereZ      = 0.0;
+    for (int i = 0; i < Count; ++i)
+    {
+        INFO(i);
+        std::uint32_t const   counter = static_cast<std::uint32_t>(i);
+        Vector2D<float> const u2      = random_vector2D(1u, counter);
+        Vector3D<float> const u3      = random_vector3D(2u, counter);
+
+        Vector2D<float> const disk = uniform_in_disk(u2);
+        CHECK(length(disk) <= 1.0f + Tolerance);
+        inHalfDisk += (length(disk) < 0.5f) ? 1 : 0;
+
+        Vector3D<float> const onSphere = uniform_on_sphere(u2);
+        CHECK(std::abs(length(onSphere) - 1.0f) <= Tolerance);
+        sphereZ += onSphere.z;
+
+        Vector3D<float> const inSphere = uniform_in_sphere(u3);
+        CHECK(length(inSphere) <= 1.0f + Tolerance);
+        inHalfSphere += (length(inSphere) < 0.5f) ? 1 : 0;
+
+        for (Vector3D<float> const & direction : directions)
+        {
+            Vector3D<float> const cone = uniform_in_cone(u2, direction, 0.9f);
+            CHECK(std::abs(length(cone) - 1.0f) <= Tolerance);
+            CHECK(dot(cone, direction) >= 0.9f - Tolerance);
+
+            Vector3D<float> const hemisphere = uniform_in_hemisphere(u2, direction);
+            CHECK(hemisphere == uniform_in_cone(u2, direction, 0.0f));
+            CHECK(dot(hemisphere, direction) >= -Tolerance);
+        }
+    }
+
+    // the area (volume) within half the radius is 1/4 (1/8) of the disk (sphere), & the sphere is centered
+    CHECK(std::abs(inHalfDisk / double(Count) - 0.25) < 0.01);
+    CHECK(std::abs(inHalfSphere / double(Count) - 0.125) < 0.01);
+    CHECK(std::abs(sphereZ / Count) < 0.02);
+}
+
+// =============================================================================
@@ -0,0 +1,395 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorSoA.h"
+#include "ggm/Vector/VectorSoAUtil.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "TestUtils/Types.h"
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// =============================================================================
+// explicitly instantiate templates to confirm they compile without error:
+// =============================================================================
+
+template struct ggm::Vector3DSoA<float>;
+template struct ggm::Vector4DSoA<float>;
+
+// =============================================================================
+
+template ggm::Vector3DSoA<float> & ggm::operator+= <float>(Vector3DSoA<float> & lhs, Vector3DSoA<float> const & rhs) noexcept;
+template ggm::Vector4DSoA<float> & ggm::operator+= <float>(Vector4DSoA<float> & lhs, Vector4DSoA<float> const & rhs) noexcept;
+template ggm::Vector3DSoA<float> ggm::operator* <float>(float const & lhs, Vector3DSoA<float> const & rhs);
+template ggm::Vector4DSoA<float> ggm::operator* <float>(float const & lhs, Vector4DSoA<float> const & rhs);
+
+// =============================================================================
+
+template void ggm::cross<float>(Vector3DSoA<float> const & lhs, Vector3DSoA<float> const & rhs, Vector3DSoA<float> & results) noexcept;
+template void ggm::dot<float>(Vector4DSoA<float> const & lhs, Vector4DSoA<float> const & rhs, std::span<float> const results) noexcept;
+template void ggm::normalize<float>(Vector4DSoA<float> const & values, Vector4DSoA<float> & results) noexcept;
+template void ggm::lerp<float>(Vector3DSoA<float> const & values0, Vector3DSoA<float> const & values1, std::span<float const> const ts, Vector3DSoA<float> & results) noexcept;
+
+// =============================================================================
+
+namespace
+{
+    template <typename T>
+    std::vector<ggm::Vector3D<T>> make_vectors3D(std::size_t const count)
+    {
+        std::vector<ggm::Vector3D<T>> vectors(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            T const s  = static_cast<T>(i);
+            vectors[i] = ggm::Vector3D<T>{ s + T{ 1 }, T{ 0.5 } * s - T{ 7.25 }, T{ 3.125 } - T{ 0.25 } * s };
+        }
+
+        return vectors;
+    }
+
+    template <typename T>
+    std::vector<ggm::Vector4D<T>> make_vectors4D(std::size_t const count)
+    {
+        std::vector<ggm::Vector4D<T>> vectors(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            T const s  = static_cast<T>(i);
+            vectors[i] = ggm::Vector4D<T>{ s + T{ 1 }, T{ 0.5 } * s - T{ 7.25 }, T{ 3.125 } - T{ 0.25 } * s, T{ 2 } * s };
+        }
+
+        return vectors;
+    }
+} // namespace
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorSoAUtil::Vector3DSoA", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 37; // not a multiple of any SIMD width
+
+    std::vector<Vector3D<TestType>> const values0 = make_vectors3D<TestType>(Count);
+    std::vector<Vector3D<TestType>>       values1 = make_vectors3D<TestType>(Count);
+    for (Vector3D<TestType> & value : values1)
+    {
+        value = Vector3D<TestType>{ value.z, -value.x, value.y + TestType{ 1 } };
+    }
+
+    Vector3DSoA<TestType> soa0;
+    Vector3DSoA<TestType> soa1;
+    gather(values0, soa0);
+    gather(values1, soa1);
+    REQUIRE(size(soa0) == Count);
+
+    // gather & scatter round trip
+    {
+        std::vector<Vector3D<TestType>> results;
+        scatter(soa0, results);
+        CHECK(results == values0);
+    }
+
+    // results match the Vector3D functions
+    Vector3DSoA<TestType> soaResults;
+    std::vector<TestType> scalarResults(Count);
+    std::vector<TestType> ts(Count);
+    resize(soaResults, Count);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        ts[i] = static_cast<TestType>(i) / TestType{ Count };
+    }
+
+    std::vector<Vector3D<TestType>> results;
+
+    scatter(soa0 + soa1, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values0[i] + values1[i]);
+    }
+
+    scatter(soa0 - soa1, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values0[i] - values1[i]);
+    }
+
+    scatter(soa0 * soa1, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values0[i] * values1[i]);
+    }
+
+    scatter(TestType{ 2 } * soa0, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == TestType{ 2 } * values0[i]);
+    }
+
+    scatter(soa0 / TestType{ 4 }, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values0[i] / TestType{ 4 });
+    }
+
+    scatter(soa1 / soa0, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values1[i] / values0[i]);
+    }
+
+    cross(soa0, soa1, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == cross(values0[i], values1[i]));
+    }
+
+    normalize(soa0, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == normalize(values0[i]));
+    }
+
+    clamp(soa0, TestType{ -2 }, TestType{ 2 }, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == clamp(values0[i], TestType{ -2 }, TestType{ 2 }));
+    }
+
+    lerp(soa0, soa1, TestType{ 0.25 }, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == lerp(values0[i], values1[i], TestType{ 0.25 }));
+    }
+
+    lerp(soa0, soa1, ts, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == lerp(values0[i], values1[i], ts[i]));
+    }
+
+    dot(soa0, soa1, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == dot(values0[i], values1[i]));
+    }
+
+    length(soa0, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == length(values0[i]));
+    }
+
+    length_squared(soa0, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == length_squared(values0[i]));
+    }
+
+    distance(soa0, soa1, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == distance(values0[i], values1[i]));
+    }
+
+    distance_squared(soa0, soa1, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == distance_squared(values0[i], values1[i]));
+    }
+
+    // in-place
+    Vector3DSoA<TestType> inPlace = soa0;
+    inPlace += soa1;
+    inPlace -= soa1;
+    inPlace *= TestType{ 2 };
+    inPlace /= TestType{ 2 };
+    normalize(inPlace, inPlace);
+    scatter(inPlace, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == normalize(((values0[i] + values1[i] - values1[i]) * TestType{ 2 }) / TestType{ 2 }));
+    }
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorSoAUtil::Vector4DSoA", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 37; // not a multiple of any SIMD width
+
+    std::vector<Vector4D<TestType>> const values0 = make_vectors4D<TestType>(Count);
+    std::vector<Vector4D<TestType>>       values1 = make_vectors4D<TestType>(Count);
+    for (Vector4D<TestType> & value : values1)
+    {
+        value = Vector4D<TestType>{ value.w, -value.x, value.y + TestType{ 1 }, value.z };
+    }
+
+    Vector4DSoA<TestType> soa0;
+    Vector4DSoA<TestType> soa1;
+    gather(values0, soa0);
+    gather(values1, soa1);
+    REQUIRE(size(soa0) == Count);
+
+    // gather & scatter round trip
+    {
+        std::vector<Vector4D<TestType>> results;
+        scatter(soa0, results);
+        CHECK(results == values0);
+    }
+
+    // results match the Vector4D functions
+    Vector4DSoA<TestType> soaResults;
+    std::vector<TestType> scalarResults(Count);
+    resize(soaResults, Count);
+
+    std::vector<Vector4D<TestType>> results;
+
+    scatter(soa0 + soa1, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values0[i] + values1[i]);
+    }
+
+    scatter(soa0 * TestType{ 3 }, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == values0[i] * TestType{ 3 });
+    }
+
+    normalize(soa0, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == normalize(values0[i]));
+    }
+
+    lerp(soa0, soa1, TestType{ 0.75 }, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == lerp(values0[i], values1[i], TestType{ 0.75 }));
+    }
+
+    dot(soa0, soa1, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == dot(values0[i], values1[i]));
+    }
+
+    length(soa0, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == length(values0[i]));
+    }
+
+    distance_squared(soa0, soa1, scalarResults);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(scalarResults[i] == distance_squared(values0[i], values1[i]));
+    }
+}
+
+// =============================================================================
+
+TEMPLATE_TEST_CASE("ggm::Vector::VectorSoAUtil::in-place", /*tags*/ "", GGM_FLOAT_TEST_TYPES())
+{
+    using namespace ggm;
+
+    constexpr std::size_t Count = 150; // several in-place blocks & a partial one
+
+    std::vector<Vector3D<TestType>> values0 = make_vectors3D<TestType>(Count);
+    std::vector<Vector4D<TestType>> values4 = make_vectors4D<TestType>(Count);
+    std::vector<Vector3D<TestType>> values1 = make_vectors3D<TestType>(Count);
+    for (Vector3D<TestType> & value : values1)
+    {
+        value = Vector3D<TestType>{ value.z, -value.x, value.y + TestType{ 1 } };
+    }
+
+    // zero vectors normalize to zero
+    values0[3]   = Vector3D<TestType>{ TestType{ 0 }, TestType{ 0 }, TestType{ 0 } };
+    values0[100] = Vector3D<TestType>{ TestType{ -0.0 }, TestType{ 0 }, TestType{ -0.0 } };
+    values4[64]  = Vector4D<TestType>{ TestType{ 0 }, TestType{ 0 }, TestType{ 0 }, TestType{ 0 } };
+
+    Vector3DSoA<TestType> soa0;
+    Vector3DSoA<TestType> soa1;
+    Vector4DSoA<TestType> soa4;
+    gather(values0, soa0);
+    gather(values1, soa1);
+    gather(values4, soa4);
+
+    std::vector<Vector3D<TestType>> results;
+    std::vector<Vector4D<TestType>> results4;
+
+    // results is lhs
+    Vector3DSoA<TestType> inPlace = soa0;
+    cross(inPlace, soa1, inPlace);
+    scatter(inPlace, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == cross(values0[i], values1[i]));
+    }
+
+    // results is rhs
+    inPlace = soa1;
+    cross(soa0, inPlace, inPlace);
+    scatter(inPlace, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == cross(values0[i], values1[i]));
+    }
+
+    // results is lhs & rhs
+    inPlace = soa1;
+    cross(inPlace, inPlace, inPlace);
+    scatter(inPlace, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == cross(values1[i], values1[i]));
+    }
+
+    // results is a different container, for comparison with the in-place results
+    Vector3DSoA<TestType> soaResults;
+    resize(soaResults, Count);
+    normalize(soa0, soaResults);
+    scatter(soaResults, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == normalize(values0[i]));
+    }
+
+    inPlace = soa0;
+    normalize(inPlace, inPlace);
+    scatter(inPlace, results);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results[i] == normalize(values0[i]));
+    }
+
+    CHECK(results[3] == Vector3D<TestType>{ TestType{ 0 }, TestType{ 0 }, TestType{ 0 } });
+    CHECK(results[100] == Vector3D<TestType>{ TestType{ 0 }, TestType{ 0 }, TestType{ 0 } });
+
+    Vector4DSoA<TestType> soaResults4;
+    resize(soaResults4, Count);
+    normalize(soa4, soaResults4);
+    scatter(soaResults4, results4);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results4[i] == normalize(values4[i]));
+    }
+
+    normalize(soa4, soa4);
+    scatter(soa4, results4);
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        CHECK(results4[i] == normalize(values4[i]));
+    }
+}
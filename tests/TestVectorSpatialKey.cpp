@@ -0,0 +1,167 @@
+#include "ggm/Vector/Vector.h"
+#include "ggm/Vector/VectorSpatialKey.h"
+#include "ggm/Vector/VectorUtil.h"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <set>
+
+// =============================================================================
+
+namespace
+{
+    /// manhattan distance between 2 grid cells
+    unsigned int manhattan_distance(ggm::Vector3D<unsigned int> const & lhs,
+                                    ggm::Vector3D<unsigned int> const & rhs)
+    {
+        auto const distance = [](unsigned int const a, unsigned int const b) { return (a < b) ? (b - a) : (a - b); };
+        return distance(lhs.x, rhs.x) + distance(lhs.y, rhs.y) + distance(lhs.z, rhs.z);
+    }
+
+    /// a deterministic sequence of values with every bit pattern (a 32-bit xorshift)
+    std::uint32_t next_random(std::uint32_t & state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+} // namespace
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorSpatialKey::morton")
+{
+    using namespace ggm;
+
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 0, 0 }) == 0u);
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 1, 0 }) == 1u);
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 0, 1 }) == 2u);
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 3, 5 }) == 0b100111u);
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 0xFFFF, 0 }) == 0x55555555u);
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 0xFFFF, 0xFFFF }) == 0xFFFFFFFFu);
+    STATIC_CHECK(morton_from_vector2D(Vector2D<unsigned int>{ 0x10000, 0x10000 }) == 0u); // higher bits are ignored
+
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 0, 0, 0 }) == 0u);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 1, 0, 0 }) == 1u);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 0, 1, 0 }) == 2u);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 0, 0, 1 }) == 4u);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 3, 5, 6 }) == 0b110101011u);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 0x1FFFFF, 0, 0 }) == 0x1249249249249249u);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 0x1FFFFF, 0x1FFFFF, 0x1FFFFF }) == 0x7FFFFFFFFFFFFFFFu);
+    STATIC_CHECK(morton_from_vector3D(Vector3D<unsigned int>{ 0x200000, 0x200000, 0x200000 }) == 0u); // higher bits are ignored
+
+    STATIC_CHECK(vector2D_from_morton(0b100111u) == Vector2D<unsigned int>{ 3, 5 });
+    STATIC_CHECK(vector3D_from_morton(0b110101011u) == Vector3D<unsigned int>{ 3, 5, 6 });
+    STATIC_CHECK(vector3D_from_morton(0xFFFFFFFFFFFFFFFFu) == Vector3D<unsigned int>{ 0x1FFFFF, 0x1FFFFF, 0x1FFFFF }); // the top bit is ignored
+
+    // the runtime versions (which use pdep & pext when available) match the constexpr (magic bits) versions
+    std::uint32_t state = 0x12345678u;
+    for (int i = 0; i < 1000; ++i)
+    {
+        Vector2D<unsigned int> const value2D{ next_random(state) & 0xFFFFu, next_random(state) & 0xFFFFu };
+        Vector3D<unsigned int> const value3D{ next_random(state) & 0x1FFFFFu, next_random(state) & 0x1FFFFFu, next_random(state) & 0x1FFFFFu };
+
+        std::uint32_t const key2D = morton_from_vector2D(value2D);
+        std::uint64_t const key3D = morton_from_vector3D(value3D);
+        CHECK(key2D == SpatialKeyImpl::spread_bits_2D(value2D.x) + (SpatialKeyImpl::spread_bits_2D(value2D.y) << 1));
+        CHECK(key3D == SpatialKeyImpl::spread_bits_3D(value3D.x) + (SpatialKeyImpl::spread_bits_3D(value3D.y) << 1) + (SpatialKeyImpl::spread_bits_3D(value3D.z) << 2));
+        CHECK(vector2D_from_morton(key2D) == value2D);
+        CHECK(vector3D_from_morton(key3D) == value3D);
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorSpatialKey::hilbert")
+{
+    using namespace ggm;
+
+    STATIC_CHECK(hilbert_from_vector2D(Vector2D<unsigned int>{ 0, 0 }) == 0u);
+    STATIC_CHECK(hilbert_from_vector3D(Vector3D<unsigned int>{ 0, 0, 0 }) == 0u);
+    STATIC_CHECK(vector2D_from_hilbert(hilbert_from_vector2D(Vector2D<unsigned int>{ 3, 5 })) == Vector2D<unsigned int>{ 3, 5 });
+    STATIC_CHECK(vector3D_from_hilbert(hilbert_from_vector3D(Vector3D<unsigned int>{ 3, 5, 6 })) == Vector3D<unsigned int>{ 3, 5, 6 });
+
+    // the curve ends at a corner next to the start
+    Vector2D<unsigned int> const last2D = vector2D_from_hilbert(0xFFFFFFFFu);
+    CHECK(last2D.x + last2D.y == 0xFFFFu);
+    CHECK(last2D.x * last2D.y == 0u);
+
+    // the first 4^6 keys fill the 64x64 square at the origin & consecutive keys are adjacent cells
+    {
+        std::set<std::uint32_t> cells;
+        Vector2D<unsigned int>  previous = vector2D_from_hilbert(0u);
+        for (std::uint32_t key = 0; key < 4096u; ++key)
+        {
+            Vector2D<unsigned int> const cell = vector2D_from_hilbert(key);
+
+            INFO(key);
+            CHECK(cell.x < 64u);
+            CHECK(cell.y < 64u);
+            CHECK(hilbert_from_vector2D(cell) == key);
+            CHECK(manhattan_distance(Vector3D<unsigned int>{ cell.x, cell.y, 0 }, Vector3D<unsigned int>{ previous.x, previous.y, 0 }) == ((key == 0) ? 0u : 1u));
+
+            cells.insert(morton_from_vector2D(cell));
+            previous = cell;
+        }
+        CHECK(cells.size() == 4096u);
+    }
+
+    // the first 8^4 keys fill the 16x16x16 cube at the origin & consecutive keys are adjacent cells
+    {
+        std::set<std::uint64_t> cells;
+        Vector3D<unsigned int>  previous = vector3D_from_hilbert(0u);
+        for (std::uint64_t key = 0; key < 4096u; ++key)
+        {
+            Vector3D<unsigned int> const cell = vector3D_from_hilbert(key);
+
+            INFO(key);
+            CHECK(cell.x < 16u);
+            CHECK(cell.y < 16u);
+            CHECK(cell.z < 16u);
+            CHECK(hilbert_from_vector3D(cell) == key);
+            CHECK(manhattan_distance(cell, previous) == ((key == 0) ? 0u : 1u));
+
+            cells.insert(morton_from_vector3D(cell));
+            previous = cell;
+        }
+        CHECK(cells.size() == 4096u);
+    }
+
+    // round trip of the full range
+    std::uint32_t state = 0x9E3779B9u;
+    for (int i = 0; i < 1000; ++i)
+    {
+        Vector2D<unsigned int> const value2D{ next_random(state) & 0xFFFFu, next_random(state) & 0xFFFFu };
+        Vector3D<unsigned int> const value3D{ next_random(state) & 0x1FFFFFu, next_random(state) & 0x1FFFFFu, next_random(state) & 0x1FFFFFu };
+
+        CHECK(vector2D_from_hilbert(hilbert_from_vector2D(value2D)) == value2D);
+        CHECK(vector3D_from_hilbert(hilbert_from_vector3D(value3D)) == value3D);
+        CHECK(hilbert_from_vector3D(value3D) < (std::uint64_t{ 1 } << 63));
+    }
+}
+
+// =============================================================================
+
+TEST_CASE("ggm::Vector::VectorSpatialKey::grid")
+{
+    using namespace ggm;
+
+    constexpr Vector3D<float> BoundsMin{ -1.0f, 0.0f, 10.0f };
+    constexpr Vector3D<float> BoundsMax{ 1.0f, 8.0f, 10.0f }; // zero extent in z
+
+    STATIC_CHECK(grid_from_vector3D(BoundsMin, BoundsMin, BoundsMax) == Vector3D<unsigned int>{ 0, 0, 0 });
+    STATIC_CHECK(grid_from_vector3D(BoundsMax, BoundsMin, BoundsMax) == Vector3D<unsigned int>{ 0x1FFFFF, 0x1FFFFF, 0 });
+    STATIC_CHECK(grid_from_vector3D(Vector3D<float>{ 0.0f, 4.0f, 10.0f }, BoundsMin, BoundsMax) == Vector3D<unsigned int>{ 0x100000, 0x100000, 0 });
+    STATIC_CHECK(grid_from_vector3D(Vector3D<float>{ -2.0f, 9.0f, 11.0f }, BoundsMin, BoundsMax) == Vector3D<unsigned int>{ 0, 0x1FFFFF, 0 }); // clamped
+
+    STATIC_CHECK(grid_from_vector2D(Vector2D<float>{ 0.5f, 0.25f }, Vector2D<float>{ 0.0f, 0.0f }, Vector2D<float>{ 1.0f, 1.0f }) == Vector2D<unsigned int>{ 0x8000, 0x4000 });
+    STATIC_CHECK(grid_from_vector2D(Vector2D<float>{ 1.0f, -1.0f }, Vector2D<float>{ 0.0f, 0.0f }, Vector2D<float>{ 1.0f, 1.0f }) == Vector2D<unsigned int>{ 0xFFFF, 0 });
+
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+    CHECK(grid_from_vector3D(Vector3D<float>{ nan, nan, nan }, BoundsMin, BoundsMax) == Vector3D<unsigned int>{ 0, 0, 0 });
+}
+
+// =============================================================================
@@ -11,6 +11,7 @@
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 #include "catch2/matchers/catch_matchers_templated.hpp"
 
+#include <limits>
 #include <ostream>
 
 template <typename T>
@@ -198,6 +199,56 @@ TEMPLATE_TEST_CASE("ggm::Vector::VectorUtil", /*tags*/ "", GGM_SIGNED_NUMERIC_TE
                 }
             }
         }
+
+        // constexpr float only functions:
+        if constexpr (std::is_floating_point_v<TestType>)
+        {
+            STATIC_CHECK(length(TestVectors[5]) == TestType{ 5 });
+            STATIC_CHECK(length(TestVectors[6]) == TestType{ 11 });
+            STATIC_CHECK(distance(TestVectors[5], Zero) == TestType{ 5 });
+            STATIC_CHECK(is_normalized(normalize(TestVectors[7])));
+            STATIC_CHECK(all_of(is_close(normalize(TestVectors[5]), Vector3D{ TestType{ 0 }, TestType{ 0.6 }, TestType{ 0.8 } })));
+            STATIC_CHECK(normalize(Zero) == Zero);
+        }
+
+        // fast approximations: float only
+        if constexpr (std::is_same_v<TestType, float>)
+        {
+            STATIC_CHECK(normalize_fast(Zero) == Zero);
+            STATIC_CHECK(is_normalized(normalize_fast<3>(TestVectors[7])));
+
+            for (Vector3D const & testVector : TestVectors)
+            {
+                if (testVector != Zero)
+                {
+                    Vector3D const exact = normalize(testVector);
+
+                    // 2 steps: relative error <= 1.9e-7, i.e. ~22 bits of precision
+                    CHECK(is_normalized(normalize_fast(testVector), 2.0f * 1.9e-7f + 4.0f * std::numeric_limits<float>::epsilon()));
+                    CHECK(all_of(is_close(normalize_fast(testVector), exact, 1e-6f)));
+
+                    // 1 step: relative error <= 1.7e-5, i.e. ~15 bits of precision
+                    CHECK(is_normalized(normalize_fast<1>(testVector), 2.0f * 1.7e-5f + 4.0f * std::numeric_limits<float>::epsilon()));
+                    CHECK(all_of(is_close(normalize_fast<1>(testVector), exact, 1.7e-5f + 4.0f * std::numeric_limits<float>::epsilon())));
+
+                    CHECK(all_of(is_close(reciprocal_sqrt_fast(testVector * testVector, Ones), reciprocal_sqrt(testVector * testVector, Ones), 1e-6f)));
+                }
+            }
+        }
+
+        // is_close_ulps: float & double only
+        if constexpr (std::is_same_v<TestType, float> || std::is_same_v<TestType, double>)
+        {
+            constexpr TestType Epsilon = std::numeric_limits<TestType>::epsilon();
+
+            STATIC_CHECK(all_of(is_close_ulps(Ones, Ones + Vector3D{ Epsilon, TestType{ 0 }, TestType{ 2 } * Epsilon }, 2)));
+            STATIC_CHECK(is_close_ulps(Ones, Ones + Vector3D{ Epsilon, TestType{ 0 }, TestType{ 2 } * Epsilon }, 1) == ggm::Vector3D<bool>{ true, true, false });
+        }
+
+        // select
+        STATIC_CHECK(select(ggm::Vector3D<bool>{ true, false, true }, AxisX, Ones) == Vector3D{ TestType{ 1 }, TestType{ 1 }, TestType{ 0 } });
+        STATIC_CHECK(select(is_less(AxisY, AxisX), Zero, Ones) == Vector3D{ TestType{ 0 }, TestType{ 1 }, TestType{ 1 } });
+        STATIC_CHECK(select(is_less(Zero, Ones), AxisZ, AxisX) == AxisZ);
     }
 
     // Vector4D